@@ -2,6 +2,7 @@
 #include <stdint.h>
 #include "categories.h"
 
+#if defined (PREFER_SIZE_OVER_SPEED) || defined (__OPTIMIZE_SIZE__)
 struct _category {
   enum category cat: 8;
   uint_least32_t first: 24;
@@ -38,3 +39,27 @@ enum category category(wint_t ucs)
   return bisearch_cat(ucs, categories,
 		      sizeof(categories) / sizeof(*categories) - 1);
 }
+#else
+/* staged tables generated from categories.t by mkstages;
+   0xFF stands for characters without category */
+#include "catpages.t"
+
+enum category category(wint_t ucs)
+{
+  /* unsigned, in case wint_t is not */
+  uint_least32_t c = ucs;
+  unsigned int cat;
+
+  /* Latin-1 characters come first in cat_blocks */
+  if (c < 0x100)
+    cat = cat_blocks[c];
+  else if (c < 0x110000)
+    cat = cat_blocks[cat_pages[cat_index[c >> CAT_PAGE_SHIFT]
+			       + ((c >> CAT_BLOCK_SHIFT)
+				  & ((1 << (CAT_PAGE_SHIFT - CAT_BLOCK_SHIFT)) - 1))]
+		     + (c & ((1 << CAT_BLOCK_SHIFT) - 1))];
+  else
+    return -1;
+  return cat == 0xFF ? -1 : cat;
+}
+#endif
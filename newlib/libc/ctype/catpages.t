@@ -0,0 +1,1238 @@
+/* generated by mkstages from categories.t, do not edit */
+
+#define CAT_PAGE_SHIFT 10
+#define CAT_BLOCK_SHIFT 4
+
+static const uint_least16_t cat_index[1088] = {
+  0x0000, 0x0040, 0x0080, 0x00C0, 0x0100, 0x0140, 0x0180, 0x01C0,
+  0x0200, 0x0240, 0x0280, 0x02C0, 0x0300, 0x0340, 0x0340, 0x0340,
+  0x0340, 0x0340, 0x0340, 0x0380, 0x0340, 0x0340, 0x0340, 0x0340,
+  0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340,
+  0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x03C0,
+  0x0400, 0x0440, 0x0480, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340,
+  0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x04C0, 0x0500, 0x0500,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0580, 0x05C0,
+  0x0600, 0x0640, 0x0680, 0x06C0, 0x0700, 0x0740, 0x0780, 0x07C0,
+  0x0800, 0x0840, 0x0540, 0x0540, 0x0340, 0x0880, 0x0540, 0x0540,
+  0x0540, 0x08C0, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0900, 0x0940, 0x0340, 0x0340, 0x0340, 0x0340,
+  0x0340, 0x0980, 0x09C0, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0A00, 0x0540, 0x0540, 0x0A40,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0A80, 0x0AC0, 0x0B00, 0x0540,
+  0x0B40, 0x0540, 0x0B80, 0x0BC0, 0x0C00, 0x0C40, 0x0C80, 0x0540,
+  0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340,
+  0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340,
+  0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340,
+  0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340,
+  0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340,
+  0x0340, 0x0CC0, 0x0340, 0x0340, 0x0340, 0x0D00, 0x0D40, 0x0340,
+  0x0340, 0x0340, 0x0340, 0x0D80, 0x0340, 0x0340, 0x0340, 0x0340,
+  0x0340, 0x0340, 0x0DC0, 0x0540, 0x0540, 0x0540, 0x0E00, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0E40, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540,
+  0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540, 0x0540
+};
+static const uint_least16_t cat_pages[3712] = {
+  0x0000, 0x0010, 0x0020, 0x0030, 0x0040, 0x0050, 0x0060, 0x0070,
+  0x0080, 0x0090, 0x00A0, 0x00B0, 0x00C0, 0x00D0, 0x00E0, 0x00F0,
+  0x00C0, 0x00C0, 0x00C0, 0x0100, 0x0110, 0x00C0, 0x00C0, 0x00C0,
+  0x0120, 0x0130, 0x0140, 0x0150, 0x0160, 0x00C0, 0x00C0, 0x0170,
+  0x00C0, 0x00C0, 0x0180, 0x0190, 0x00C0, 0x01A0, 0x01B0, 0x01C0,
+  0x01D0, 0x01E0, 0x01F0, 0x0200, 0x0210, 0x0220, 0x0230, 0x0240,
+  0x0250, 0x0250, 0x0250, 0x0250, 0x0250, 0x0250, 0x0250, 0x0260,
+  0x0270, 0x0280, 0x0290, 0x0280, 0x00C0, 0x02A0, 0x00C0, 0x02B0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x02C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x02D0, 0x00C0, 0x02E0, 0x0280, 0x00C0,
+  0x02F0, 0x0300, 0x0250, 0x0310, 0x0320, 0x0330, 0x0340, 0x0350,
+  0x0360, 0x0370, 0x0330, 0x0330, 0x0380, 0x0250, 0x0390, 0x03A0,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x03B0, 0x03C0, 0x03D0,
+  0x03E0, 0x03F0, 0x0330, 0x0250, 0x0400, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0410, 0x0420, 0x0430, 0x0330, 0x0440, 0x0450,
+  0x0330, 0x0460, 0x0470, 0x0480, 0x0330, 0x0490, 0x04A0, 0x04B0,
+  0x04B0, 0x04B0, 0x0330, 0x04C0, 0x04B0, 0x04D0, 0x04E0, 0x0250,
+  0x04F0, 0x0330, 0x0330, 0x0500, 0x0510, 0x0520, 0x0530, 0x0540,
+  0x0550, 0x0560, 0x0570, 0x0580, 0x0590, 0x05A0, 0x05B0, 0x05C0,
+  0x05D0, 0x0560, 0x0570, 0x05E0, 0x05F0, 0x0600, 0x0610, 0x0620,
+  0x0630, 0x0640, 0x0570, 0x0650, 0x0660, 0x0670, 0x05B0, 0x0680,
+  0x0690, 0x0560, 0x0570, 0x06A0, 0x06B0, 0x06C0, 0x05B0, 0x06D0,
+  0x06E0, 0x06F0, 0x0700, 0x0710, 0x0720, 0x0730, 0x0610, 0x0740,
+  0x0750, 0x0760, 0x0570, 0x0770, 0x0780, 0x0790, 0x05B0, 0x07A0,
+  0x07B0, 0x0760, 0x0570, 0x07C0, 0x07D0, 0x07E0, 0x05B0, 0x07F0,
+  0x0800, 0x0760, 0x0330, 0x0810, 0x0820, 0x0830, 0x05B0, 0x0840,
+  0x0850, 0x0860, 0x0330, 0x0870, 0x0880, 0x0890, 0x0610, 0x08A0,
+  0x08B0, 0x0330, 0x0330, 0x08C0, 0x08D0, 0x08E0, 0x04B0, 0x04B0,
+  0x08F0, 0x0900, 0x0910, 0x0920, 0x0930, 0x0940, 0x04B0, 0x04B0,
+  0x0950, 0x0960, 0x0970, 0x0980, 0x0990, 0x0330, 0x09A0, 0x09B0,
+  0x09C0, 0x09D0, 0x0250, 0x09E0, 0x09F0, 0x0A00, 0x04B0, 0x04B0,
+  0x0330, 0x0330, 0x0A10, 0x0A20, 0x0A30, 0x0A40, 0x0A50, 0x0A60,
+  0x0A70, 0x0A80, 0x00C0, 0x00C0, 0x0A90, 0x00C0, 0x00C0, 0x0AA0,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0AB0, 0x0AC0, 0x0330, 0x0330,
+  0x0AB0, 0x0330, 0x0330, 0x0AD0, 0x0AE0, 0x0AF0, 0x0330, 0x0330,
+  0x0330, 0x0AE0, 0x0330, 0x0330, 0x0330, 0x0B00, 0x0B10, 0x0B20,
+  0x0330, 0x0B30, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x0B40,
+  0x0B50, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0B60, 0x0330,
+  0x0B70, 0x0B80, 0x0330, 0x0330, 0x0330, 0x0330, 0x0B90, 0x0BA0,
+  0x0BB0, 0x0BC0, 0x0330, 0x0BD0, 0x0330, 0x0BE0, 0x0BB0, 0x0BF0,
+  0x0330, 0x0330, 0x0330, 0x0C00, 0x0C10, 0x0C20, 0x0C30, 0x0C40,
+  0x0C50, 0x0C30, 0x0330, 0x0330, 0x0C60, 0x0330, 0x0330, 0x0C70,
+  0x0C80, 0x0330, 0x0C90, 0x0330, 0x0330, 0x0330, 0x0330, 0x0CA0,
+  0x0330, 0x0CB0, 0x0CC0, 0x0CD0, 0x0CE0, 0x0330, 0x0CF0, 0x0D00,
+  0x0330, 0x0330, 0x0D10, 0x0330, 0x0D20, 0x0D30, 0x0D40, 0x0D40,
+  0x0330, 0x0D50, 0x0330, 0x0330, 0x0330, 0x0D60, 0x0D70, 0x0D80,
+  0x0C30, 0x0C30, 0x0D90, 0x0DA0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x0DB0, 0x0330, 0x0330, 0x0DC0, 0x0DD0, 0x0A30, 0x0DE0, 0x0DF0,
+  0x0E00, 0x0330, 0x0E10, 0x0430, 0x0330, 0x0330, 0x0E20, 0x0E30,
+  0x0330, 0x0330, 0x0E40, 0x0E50, 0x0E60, 0x0430, 0x0330, 0x0E70,
+  0x0E80, 0x00C0, 0x00C0, 0x0E90, 0x0EA0, 0x0EB0, 0x0EC0, 0x0ED0,
+  0x01F0, 0x01F0, 0x0EE0, 0x0200, 0x0200, 0x0200, 0x0EF0, 0x0F00,
+  0x01F0, 0x0F10, 0x0200, 0x0200, 0x0250, 0x0250, 0x0250, 0x0F20,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x0F30, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x0B40, 0x00C0, 0x00C0, 0x0B40, 0x0F40, 0x00C0, 0x0F50,
+  0x0F60, 0x0F60, 0x0F60, 0x0F70, 0x0F80, 0x0F90, 0x0FA0, 0x0FB0,
+  0x0FC0, 0x0FD0, 0x0FE0, 0x0FF0, 0x1000, 0x1010, 0x1020, 0x1030,
+  0x1040, 0x1050, 0x1060, 0x1060, 0x04B0, 0x1070, 0x1080, 0x1090,
+  0x10A0, 0x10B0, 0x10C0, 0x10D0, 0x10E0, 0x10F0, 0x1100, 0x1100,
+  0x1110, 0x1120, 0x1130, 0x0D40, 0x1140, 0x1150, 0x0D40, 0x1160,
+  0x1170, 0x1170, 0x1170, 0x1170, 0x1170, 0x1170, 0x1170, 0x1170,
+  0x1170, 0x1170, 0x1170, 0x1170, 0x1170, 0x1170, 0x1170, 0x1170,
+  0x1180, 0x0D40, 0x1190, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x11A0,
+  0x0D40, 0x11B0, 0x1170, 0x11C0, 0x0D40, 0x11D0, 0x11E0, 0x0D40,
+  0x0D40, 0x0D40, 0x11F0, 0x04B0, 0x1200, 0x04B0, 0x10F0, 0x10F0,
+  0x10F0, 0x1210, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x1220, 0x10F0,
+  0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40,
+  0x0D40, 0x0D40, 0x0D40, 0x1230, 0x1240, 0x0D40, 0x0D40, 0x1250,
+  0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x1260, 0x0D40,
+  0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40,
+  0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x1270, 0x1280,
+  0x10F0, 0x1290, 0x0D40, 0x0D40, 0x12A0, 0x1170, 0x12B0, 0x1170,
+  0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40,
+  0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40,
+  0x1170, 0x1170, 0x1170, 0x1170, 0x1170, 0x1170, 0x1170, 0x1170,
+  0x12C0, 0x12D0, 0x1170, 0x1170, 0x1170, 0x12E0, 0x1170, 0x12F0,
+  0x1170, 0x1170, 0x1170, 0x1170, 0x1170, 0x1170, 0x1170, 0x1170,
+  0x1170, 0x1170, 0x1170, 0x1170, 0x1170, 0x1170, 0x1170, 0x1170,
+  0x0D40, 0x0D40, 0x0D40, 0x1170, 0x1300, 0x0D40, 0x0D40, 0x1310,
+  0x0D40, 0x1320, 0x0D40, 0x0D40, 0x1330, 0x0D40, 0x0D40, 0x1340,
+  0x00C0, 0x00C0, 0x1350, 0x00C0, 0x00C0, 0x1350, 0x00C0, 0x1360,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x1370, 0x1380,
+  0x00C0, 0x00C0, 0x0A90, 0x0330, 0x0330, 0x0330, 0x1390, 0x13A0,
+  0x0330, 0x13B0, 0x13C0, 0x13C0, 0x13C0, 0x13C0, 0x0250, 0x0250,
+  0x13D0, 0x13E0, 0x13F0, 0x1400, 0x1410, 0x04B0, 0x04B0, 0x04B0,
+  0x0D40, 0x1420, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x1430,
+  0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40,
+  0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x1440, 0x04B0, 0x1450,
+  0x1460, 0x1470, 0x1480, 0x1490, 0x08B0, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x14A0, 0x0B50, 0x0330, 0x0330, 0x0330, 0x0330, 0x14B0,
+  0x14C0, 0x0330, 0x0330, 0x08B0, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0CB0, 0x14D0, 0x0330, 0x04A0, 0x0D40, 0x0D40, 0x1430, 0x0330,
+  0x0D40, 0x1340, 0x14E0, 0x0D40, 0x14F0, 0x1500, 0x0D40, 0x0D40,
+  0x14E0, 0x0D40, 0x0D40, 0x1500, 0x0D40, 0x0D40, 0x0D40, 0x1340,
+  0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40,
+  0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0CA0, 0x0D40, 0x0D40, 0x0D40, 0x0D40,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x04B0,
+  0x0330, 0x1510, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x09A0, 0x0D40, 0x0D40, 0x0D40, 0x11F0, 0x0330, 0x0330, 0x0E70,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x1520, 0x0330, 0x1530, 0x04B0, 0x00C0, 0x00C0, 0x1540, 0x1550,
+  0x00C0, 0x1560, 0x0330, 0x0330, 0x0330, 0x0330, 0x1570, 0x1580,
+  0x0240, 0x1590, 0x15A0, 0x15B0, 0x00C0, 0x00C0, 0x00C0, 0x15C0,
+  0x15D0, 0x15E0, 0x15F0, 0x1600, 0x04B0, 0x04B0, 0x04B0, 0x1610,
+  0x1620, 0x0330, 0x1630, 0x1640, 0x0330, 0x0330, 0x0330, 0x1650,
+  0x1660, 0x0330, 0x0330, 0x1670, 0x1680, 0x0C30, 0x0250, 0x1690,
+  0x0430, 0x0330, 0x16A0, 0x0330, 0x16B0, 0x16C0, 0x0330, 0x09A0,
+  0x04F0, 0x0330, 0x0330, 0x16D0, 0x16E0, 0x16F0, 0x1700, 0x1710,
+  0x0330, 0x0330, 0x1720, 0x1730, 0x1740, 0x1750, 0x0330, 0x1760,
+  0x0330, 0x0330, 0x0330, 0x1770, 0x1780, 0x1790, 0x17A0, 0x17B0,
+  0x17C0, 0x17D0, 0x13C0, 0x01F0, 0x01F0, 0x17E0, 0x17F0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x0330, 0x0330, 0x1800, 0x0C30,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x1810, 0x0330, 0x1820, 0x0330, 0x0330, 0x0D10,
+  0x1830, 0x1830, 0x1830, 0x1830, 0x1830, 0x1830, 0x1830, 0x1830,
+  0x1830, 0x1830, 0x1830, 0x1830, 0x1830, 0x1830, 0x1830, 0x1830,
+  0x1830, 0x1830, 0x1830, 0x1830, 0x1830, 0x1830, 0x1830, 0x1830,
+  0x1830, 0x1830, 0x1830, 0x1830, 0x1830, 0x1830, 0x1830, 0x1830,
+  0x1830, 0x1830, 0x1830, 0x1830, 0x1830, 0x1830, 0x1830, 0x1830,
+  0x1830, 0x1830, 0x1830, 0x1830, 0x1830, 0x1830, 0x1830, 0x1830,
+  0x1830, 0x1830, 0x1830, 0x1830, 0x1830, 0x1830, 0x1830, 0x1830,
+  0x1830, 0x1830, 0x1830, 0x1830, 0x1830, 0x1830, 0x1830, 0x1830,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0CF0, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0D20, 0x04B0, 0x04B0,
+  0x1840, 0x1850, 0x1860, 0x1870, 0x1880, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x1890, 0x18A0, 0x18B0, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x18C0, 0x04B0, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x18D0, 0x0330, 0x0330, 0x18E0, 0x04B0, 0x04B0, 0x18F0,
+  0x0250, 0x1900, 0x0250, 0x1910, 0x1920, 0x1930, 0x1940, 0x1950,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x1960,
+  0x1970, 0x0030, 0x0040, 0x0050, 0x0060, 0x1980, 0x1990, 0x19A0,
+  0x0330, 0x19B0, 0x0330, 0x0CB0, 0x19C0, 0x19D0, 0x19E0, 0x19F0,
+  0x1A00, 0x0330, 0x0AF0, 0x1A10, 0x0CF0, 0x0CF0, 0x04B0, 0x04B0,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x04A0,
+  0x1A20, 0x10F0, 0x10F0, 0x1A30, 0x1100, 0x1100, 0x1100, 0x1A40,
+  0x1A50, 0x1450, 0x1A60, 0x04B0, 0x04B0, 0x0D40, 0x0D40, 0x1A70,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x0330, 0x09A0, 0x0330, 0x0330, 0x0330, 0x0670, 0x1A80, 0x1A90,
+  0x0330, 0x0330, 0x1AA0, 0x0330, 0x1AB0, 0x0330, 0x0330, 0x1AC0,
+  0x0330, 0x1AD0, 0x0330, 0x0330, 0x1AE0, 0x1AF0, 0x04B0, 0x04B0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0CF0, 0x0C30, 0x00C0, 0x00C0, 0x1B00, 0x00C0, 0x1B10,
+  0x0330, 0x0330, 0x18E0, 0x0330, 0x0330, 0x0330, 0x1B20, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x13B0, 0x0330, 0x0CA0, 0x18E0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x1B30, 0x0330, 0x0330, 0x1B40, 0x0330, 0x1B50, 0x0330, 0x1B60,
+  0x0330, 0x0CB0, 0x1B70, 0x04B0, 0x04B0, 0x04B0, 0x0330, 0x1B80,
+  0x0330, 0x1B90, 0x0330, 0x1BA0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x0330, 0x0330, 0x0330, 0x1BB0, 0x10F0, 0x1BC0, 0x10F0, 0x10F0,
+  0x1BD0, 0x1BE0, 0x0330, 0x1BF0, 0x1C00, 0x1C10, 0x0330, 0x1C20,
+  0x0330, 0x1C30, 0x04B0, 0x04B0, 0x1C40, 0x0330, 0x1C50, 0x1C60,
+  0x0330, 0x0330, 0x0330, 0x1C70, 0x0330, 0x1C80, 0x0330, 0x1C90,
+  0x0330, 0x1CA0, 0x1CB0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0C70, 0x04B0, 0x04B0, 0x04B0,
+  0x00C0, 0x00C0, 0x00C0, 0x1CC0, 0x00C0, 0x00C0, 0x00C0, 0x1CD0,
+  0x0330, 0x0330, 0x1CE0, 0x0C30, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x10F0, 0x1CF0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x0330, 0x1C30, 0x1D00, 0x0330, 0x0410, 0x1D10, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x1D20, 0x0330, 0x0330, 0x1D30, 0x1D40, 0x1BC0, 0x1D50, 0x1D60,
+  0x0E00, 0x0330, 0x0330, 0x1D70, 0x1D80, 0x0330, 0x0C70, 0x0C30,
+  0x1D90, 0x0330, 0x1DA0, 0x1DB0, 0x1DC0, 0x0330, 0x0330, 0x1DD0,
+  0x0E00, 0x0330, 0x0330, 0x1DE0, 0x1DF0, 0x1E00, 0x1E10, 0x1E20,
+  0x0330, 0x0640, 0x1E30, 0x1E40, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x1E50, 0x1E60, 0x1E70, 0x0330, 0x0330, 0x1E80, 0x1E90, 0x0C30,
+  0x1EA0, 0x0560, 0x0570, 0x1EB0, 0x1EC0, 0x1ED0, 0x1EE0, 0x1EF0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x0330, 0x0330, 0x0330, 0x1F00, 0x1F10, 0x1F20, 0x04B0, 0x04B0,
+  0x0330, 0x0330, 0x0330, 0x1F30, 0x1F40, 0x0C30, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x0330, 0x0330, 0x1F50, 0x1F60, 0x1F70, 0x1F80, 0x04B0, 0x04B0,
+  0x0330, 0x0330, 0x0330, 0x1F90, 0x1FA0, 0x0C30, 0x1FB0, 0x04B0,
+  0x0330, 0x0330, 0x1FC0, 0x1FD0, 0x0C30, 0x04B0, 0x04B0, 0x04B0,
+  0x0330, 0x0B00, 0x1FE0, 0x1FF0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x0330, 0x0330, 0x1E30, 0x2000, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x0970, 0x2010,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x2020, 0x0330, 0x0330, 0x2030, 0x2040, 0x2050, 0x0330, 0x0330,
+  0x2060, 0x2070, 0x2080, 0x04B0, 0x0330, 0x0330, 0x0330, 0x0C70,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x0570, 0x0330, 0x1F50, 0x2090, 0x20A0, 0x0970, 0x0B20, 0x20B0,
+  0x0330, 0x20C0, 0x20D0, 0x20E0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x20F0, 0x0330, 0x0330, 0x2100, 0x2110, 0x0C30, 0x2120, 0x0330,
+  0x2130, 0x2140, 0x0C30, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x0330, 0x2150,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0D20, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x1100, 0x1100, 0x1100, 0x1100, 0x1100, 0x1100, 0x2160, 0x2170,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x1810, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x0330, 0x0330, 0x0CB0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x13B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0C70, 0x0330, 0x0CB0, 0x16F0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x0330, 0x0CF0, 0x2180,
+  0x0330, 0x0330, 0x0330, 0x2190, 0x21A0, 0x21B0, 0x21C0, 0x21D0,
+  0x0330, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x10F0, 0x21E0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0D00, 0x21F0, 0x2200, 0x2210,
+  0x1D60, 0x2220, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x2230, 0x04B0,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x2240,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x2250,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0CB0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0D10,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x04A0, 0x09A0,
+  0x0C70, 0x2260, 0x2270, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40,
+  0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x1440,
+  0x0D40, 0x0D40, 0x2280, 0x0D40, 0x0D40, 0x0D40, 0x2290, 0x22A0,
+  0x22B0, 0x0D40, 0x22C0, 0x0D40, 0x0D40, 0x0D40, 0x22D0, 0x04B0,
+  0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x22E0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x10F0, 0x22F0,
+  0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x11F0, 0x10F0, 0x1C00,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x2300, 0x2310, 0x01F0, 0x2320, 0x2330, 0x2340, 0x2350, 0x2300,
+  0x2360, 0x2370, 0x2380, 0x2390, 0x23A0, 0x2300, 0x2310, 0x01F0,
+  0x23B0, 0x23C0, 0x01F0, 0x23D0, 0x23E0, 0x23F0, 0x2400, 0x2300,
+  0x2410, 0x01F0, 0x2300, 0x2310, 0x01F0, 0x2320, 0x2330, 0x01F0,
+  0x2350, 0x2300, 0x2360, 0x2400, 0x2300, 0x2410, 0x01F0, 0x2300,
+  0x2310, 0x01F0, 0x2420, 0x2300, 0x2430, 0x2440, 0x2450, 0x2460,
+  0x01F0, 0x2470, 0x2300, 0x2480, 0x2490, 0x24A0, 0x24B0, 0x01F0,
+  0x24C0, 0x2300, 0x24D0, 0x01F0, 0x24E0, 0x24F0, 0x24F0, 0x24F0,
+  0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40,
+  0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40,
+  0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40,
+  0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40,
+  0x0250, 0x0250, 0x0250, 0x2500, 0x0250, 0x0250, 0x2510, 0x2520,
+  0x2530, 0x2540, 0x0300, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x2550, 0x2560, 0x2570, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x2580, 0x2590, 0x04B0, 0x04B0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x25A0, 0x16F0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x1E10,
+  0x10F0, 0x10F0, 0x25B0, 0x25C0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x25D0, 0x0330, 0x25E0, 0x25F0, 0x2600, 0x2610, 0x2620, 0x2630,
+  0x2640, 0x0D10, 0x2650, 0x0D10, 0x04B0, 0x04B0, 0x04B0, 0x2660,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x0D40, 0x0D40, 0x1450, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40,
+  0x0D40, 0x1430, 0x1340, 0x2670, 0x2670, 0x2670, 0x0D40, 0x1440,
+  0x0B20, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x1450, 0x0D40,
+  0x0D40, 0x0D40, 0x2680, 0x04B0, 0x04B0, 0x04B0, 0x2690, 0x0D40,
+  0x26A0, 0x0D40, 0x0D40, 0x1450, 0x22D0, 0x26B0, 0x1440, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40,
+  0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x26C0,
+  0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40,
+  0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40,
+  0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40,
+  0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40,
+  0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40,
+  0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x26D0, 0x2680, 0x0B30,
+  0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x1430,
+  0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x0D40, 0x22D0, 0x04B0, 0x04B0,
+  0x1450, 0x0D40, 0x0D40, 0x0D40, 0x26E0, 0x0B30, 0x0D40, 0x0D40,
+  0x26E0, 0x0D40, 0x26F0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x1450, 0x0D40, 0x0D40, 0x1340, 0x0D40, 0x0D40, 0x0D40, 0x2700,
+  0x0D40, 0x0D40, 0x26A0, 0x0B30, 0x26A0, 0x0D40, 0x0D40, 0x0D40,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x26F0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x13B0, 0x04B0, 0x04B0,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0D00, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0CF0, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x2240, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0670, 0x04B0,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+  0x0330, 0x0CF0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x2710, 0x04B0, 0x2720, 0x2720, 0x2720, 0x2720, 0x2720, 0x2720,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x0250, 0x0250, 0x0250, 0x0250, 0x0250, 0x0250, 0x0250, 0x0250,
+  0x0250, 0x0250, 0x0250, 0x0250, 0x0250, 0x0250, 0x0250, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0,
+  0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0, 0x04B0
+};
+static const unsigned char cat_blocks[10032] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  28, 20, 20, 20, 22, 20, 20, 20, 21, 17, 20, 24, 20, 16, 20, 20,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 20, 20, 24, 24, 24, 20,
+  20, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 21, 20, 17, 23, 15,
+  23, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 21, 24, 17, 24, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  28, 20, 22, 22, 22, 22, 25, 20, 23, 25, 6, 19, 24, 1, 25, 23,
+  25, 24, 14, 14, 23, 3, 20, 20, 23, 14, 6, 18, 14, 14, 14, 20,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 24, 3, 3, 3, 3, 3, 3, 3, 4,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 24, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 4, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 6, 3, 3, 4, 3,
+  6, 6, 6, 6, 3, 7, 3, 3, 7, 3, 3, 7, 3, 3, 3, 3,
+  4, 3, 7, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 4, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 4, 3, 3, 4, 3, 4, 3, 3, 4, 4, 4,
+  3, 3, 4, 3, 4, 3, 3, 4, 3, 3, 3, 3, 3, 4, 4, 3,
+  4, 3, 3, 4, 4, 3, 4, 4, 4, 4, 4, 4, 4, 3, 4, 4,
+  3, 4, 4, 3, 4, 4, 4, 3, 3, 3, 3, 3, 3, 4, 4, 4,
+  4, 4, 3, 4, 6, 4, 4, 4, 4, 4, 4, 4, 4, 3, 3, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+  5, 5, 23, 23, 23, 23, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+  5, 5, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+  5, 5, 5, 5, 5, 23, 23, 23, 23, 23, 23, 23, 5, 23, 5, 23,
+  23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  3, 3, 3, 3, 5, 23, 3, 3, 255, 255, 5, 3, 3, 3, 20, 3,
+  255, 255, 255, 255, 23, 23, 3, 20, 3, 3, 3, 255, 3, 255, 3, 3,
+  4, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 255, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 8, 8, 8, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 24, 3, 3, 3, 3, 3, 4, 3, 3, 3,
+  3, 3, 25, 11, 11, 11, 11, 11, 10, 10, 3, 3, 3, 3, 3, 3,
+  255, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 255, 255, 5, 20, 20, 20, 20, 20, 20,
+  3, 3, 3, 3, 3, 3, 3, 4, 4, 20, 16, 255, 255, 25, 25, 22,
+  255, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 16, 11,
+  20, 11, 11, 20, 11, 11, 20, 11, 255, 255, 255, 255, 255, 255, 255, 255,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 255, 255, 255, 255, 6,
+  6, 6, 6, 20, 20, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  1, 1, 1, 1, 1, 1, 24, 24, 24, 20, 20, 22, 20, 20, 25, 25,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 20, 1, 255, 20, 20,
+  5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 11, 11, 11, 11, 11,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 20, 20, 20, 20, 6, 6,
+  11, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 20, 6, 11, 11, 11, 11, 11, 11, 11, 1, 25, 11,
+  11, 11, 11, 11, 11, 5, 5, 11, 11, 25, 11, 11, 11, 11, 6, 6,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 6, 6, 6, 25, 25, 6,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 255, 1,
+  6, 11, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 255, 255, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 6, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 5, 5, 25, 20, 20, 20, 5, 255, 255, 11, 22, 22,
+  6, 6, 6, 6, 6, 6, 11, 11, 11, 11, 5, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 5, 11, 11, 11, 5, 11, 11, 11, 11, 11, 255, 255,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 255,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 11, 11, 11, 255, 255, 20, 255,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  6, 6, 6, 6, 6, 255, 6, 6, 6, 6, 6, 6, 6, 6, 255, 255,
+  255, 255, 255, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 1, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 9, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 11, 9, 11, 6, 9, 9,
+  9, 11, 11, 11, 11, 11, 11, 11, 11, 9, 9, 9, 9, 11, 9, 9,
+  6, 11, 11, 11, 11, 11, 11, 11, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 11, 11, 20, 20, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  20, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 11, 9, 9, 255, 6, 6, 6, 6, 6, 6, 6, 6, 255, 255, 6,
+  6, 255, 255, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 255, 6, 6, 6, 6, 6, 6,
+  6, 255, 6, 255, 255, 255, 6, 6, 6, 6, 255, 255, 11, 6, 9, 9,
+  9, 11, 11, 11, 11, 255, 255, 9, 9, 255, 255, 9, 9, 11, 6, 255,
+  255, 255, 255, 255, 255, 255, 255, 9, 255, 255, 255, 255, 6, 6, 255, 6,
+  6, 6, 11, 11, 255, 255, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  6, 6, 22, 22, 14, 14, 14, 14, 14, 14, 25, 22, 6, 20, 11, 255,
+  255, 11, 11, 9, 255, 6, 6, 6, 6, 6, 6, 255, 255, 255, 255, 6,
+  6, 255, 6, 6, 255, 6, 6, 255, 6, 6, 255, 255, 11, 255, 9, 9,
+  9, 11, 11, 255, 255, 255, 255, 11, 11, 255, 255, 11, 11, 11, 255, 255,
+  255, 11, 255, 255, 255, 255, 255, 255, 255, 6, 6, 6, 6, 255, 6, 255,
+  255, 255, 255, 255, 255, 255, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  11, 11, 6, 6, 6, 11, 20, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 11, 11, 9, 255, 6, 6, 6, 6, 6, 6, 6, 6, 6, 255, 6,
+  6, 6, 255, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 255, 6, 6, 255, 6, 6, 6, 6, 6, 255, 255, 11, 6, 9, 9,
+  9, 11, 11, 11, 11, 11, 255, 11, 11, 9, 255, 9, 9, 11, 255, 255,
+  6, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  20, 22, 255, 255, 255, 255, 255, 255, 255, 6, 11, 11, 11, 11, 11, 11,
+  255, 11, 9, 9, 255, 6, 6, 6, 6, 6, 6, 6, 6, 255, 255, 6,
+  6, 255, 6, 6, 255, 6, 6, 6, 6, 6, 255, 255, 11, 6, 9, 11,
+  9, 11, 11, 11, 11, 255, 255, 9, 9, 255, 255, 9, 9, 11, 255, 255,
+  255, 255, 255, 255, 255, 255, 11, 9, 255, 255, 255, 255, 6, 6, 255, 6,
+  25, 6, 14, 14, 14, 14, 14, 14, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 11, 6, 255, 6, 6, 6, 6, 6, 6, 255, 255, 255, 6, 6,
+  6, 255, 6, 6, 6, 6, 255, 255, 255, 6, 6, 255, 6, 255, 6, 6,
+  255, 255, 255, 6, 6, 255, 255, 255, 6, 6, 6, 255, 255, 255, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 255, 255, 255, 255, 9, 9,
+  11, 9, 9, 255, 255, 255, 9, 9, 9, 255, 9, 9, 9, 11, 255, 255,
+  6, 255, 255, 255, 255, 255, 255, 9, 255, 255, 255, 255, 255, 255, 255, 255,
+  14, 14, 14, 25, 25, 25, 25, 25, 25, 22, 25, 255, 255, 255, 255, 255,
+  11, 9, 9, 9, 11, 6, 6, 6, 6, 6, 6, 6, 6, 255, 6, 6,
+  6, 255, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 255, 255, 255, 6, 11, 11,
+  11, 9, 9, 9, 9, 255, 11, 11, 11, 255, 11, 11, 11, 11, 255, 255,
+  255, 255, 255, 255, 255, 11, 11, 255, 6, 6, 6, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 14, 14, 14, 14, 14, 14, 14, 25,
+  6, 11, 9, 9, 20, 6, 6, 6, 6, 6, 6, 6, 6, 255, 6, 6,
+  6, 6, 6, 6, 255, 6, 6, 6, 6, 6, 255, 255, 11, 6, 9, 11,
+  9, 9, 9, 9, 9, 255, 11, 9, 9, 255, 9, 9, 11, 11, 255, 255,
+  255, 255, 255, 255, 255, 9, 9, 255, 255, 255, 255, 255, 255, 255, 6, 255,
+  255, 6, 6, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  11, 11, 9, 9, 255, 6, 6, 6, 6, 6, 6, 6, 6, 255, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 11, 11, 6, 9, 9,
+  9, 11, 11, 11, 11, 255, 9, 9, 9, 255, 9, 9, 9, 11, 6, 25,
+  255, 255, 255, 255, 6, 6, 6, 9, 14, 14, 14, 14, 14, 14, 14, 6,
+  14, 14, 14, 14, 14, 14, 14, 14, 14, 25, 6, 6, 6, 6, 6, 6,
+  255, 255, 9, 9, 255, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 255, 255, 255, 6, 6, 6, 6, 6, 6,
+  6, 6, 255, 6, 6, 6, 6, 6, 6, 6, 6, 6, 255, 6, 255, 255,
+  6, 6, 6, 6, 6, 6, 6, 255, 255, 255, 11, 255, 255, 255, 255, 9,
+  9, 9, 11, 11, 11, 255, 11, 255, 9, 9, 9, 9, 9, 9, 9, 9,
+  255, 255, 9, 9, 20, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 11, 6, 6, 11, 11, 11, 11, 11, 11, 11, 255, 255, 255, 255, 22,
+  6, 6, 6, 6, 6, 6, 5, 11, 11, 11, 11, 11, 11, 11, 11, 20,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 20, 20, 255, 255, 255, 255,
+  255, 6, 6, 255, 6, 255, 255, 6, 6, 255, 6, 255, 255, 6, 255, 255,
+  255, 255, 255, 255, 6, 6, 6, 6, 255, 6, 6, 6, 6, 6, 6, 6,
+  255, 6, 6, 6, 255, 6, 255, 6, 255, 255, 6, 6, 255, 6, 6, 6,
+  6, 11, 6, 6, 11, 11, 11, 11, 11, 11, 255, 11, 11, 6, 255, 255,
+  6, 6, 6, 6, 6, 255, 5, 255, 11, 11, 11, 11, 11, 11, 255, 255,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 255, 255, 6, 6, 6, 6,
+  6, 25, 25, 25, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  20, 20, 20, 25, 20, 25, 25, 25, 11, 11, 25, 25, 25, 25, 25, 25,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 14, 14, 14, 14, 14, 14,
+  14, 14, 14, 14, 25, 11, 25, 11, 25, 11, 21, 17, 21, 17, 9, 9,
+  6, 6, 6, 6, 6, 6, 6, 6, 255, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 255, 255, 255,
+  255, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 9,
+  11, 11, 11, 11, 11, 20, 11, 11, 6, 6, 6, 6, 6, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 255, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 255, 25, 25,
+  25, 25, 25, 25, 25, 25, 11, 25, 25, 25, 25, 25, 25, 255, 25, 25,
+  20, 20, 20, 20, 20, 25, 25, 25, 25, 20, 20, 255, 255, 255, 255, 255,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 9, 9, 11, 11, 11,
+  11, 9, 11, 11, 11, 11, 11, 11, 9, 11, 11, 9, 9, 11, 11, 6,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 20, 20, 20, 20, 20, 20,
+  6, 6, 6, 6, 6, 6, 9, 9, 11, 11, 6, 6, 6, 6, 11, 11,
+  11, 6, 9, 9, 9, 6, 6, 9, 9, 9, 9, 9, 9, 9, 6, 6,
+  6, 11, 11, 11, 11, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 11, 9, 9, 11, 11, 9, 9, 9, 9, 9, 9, 11, 6, 9,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 9, 9, 9, 11, 25, 25,
+  3, 3, 3, 3, 3, 3, 255, 3, 255, 255, 255, 255, 255, 3, 255, 255,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 20, 5, 3, 3, 3,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 255, 6, 6, 6, 6, 255, 255,
+  6, 6, 6, 6, 6, 6, 6, 255, 6, 255, 6, 6, 6, 6, 255, 255,
+  6, 255, 6, 6, 6, 6, 255, 255, 6, 6, 6, 6, 6, 6, 6, 255,
+  6, 255, 6, 6, 6, 6, 255, 255, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 255, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 255, 255, 11, 11, 11,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 14, 14, 14, 14, 14, 14, 14,
+  14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 255, 255, 255,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 255, 255, 255, 255, 255, 255,
+  3, 3, 3, 3, 3, 3, 255, 255, 3, 3, 3, 3, 3, 3, 255, 255,
+  16, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 20, 20, 6,
+  28, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 21, 17, 255, 255, 255,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 20, 20, 20, 13, 13,
+  13, 6, 6, 6, 6, 6, 6, 6, 6, 255, 255, 255, 255, 255, 255, 255,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 255, 6, 6,
+  6, 6, 11, 11, 11, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  6, 6, 11, 11, 11, 20, 20, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  6, 6, 11, 11, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  6, 255, 11, 11, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  6, 6, 6, 6, 11, 11, 9, 11, 11, 11, 11, 11, 11, 11, 9, 9,
+  9, 9, 9, 9, 9, 9, 11, 9, 9, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 20, 20, 20, 5, 20, 20, 20, 22, 6, 11, 255, 255,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 255, 255, 255, 255, 255, 255,
+  14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 255, 255, 255, 255, 255, 255,
+  20, 20, 20, 20, 20, 20, 16, 20, 20, 20, 20, 11, 11, 11, 1, 255,
+  6, 6, 6, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 255, 255, 255, 255, 255, 255, 255,
+  6, 6, 6, 6, 6, 11, 11, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 11, 6, 255, 255, 255, 255, 255,
+  6, 6, 6, 6, 6, 6, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 255,
+  11, 11, 11, 9, 9, 9, 9, 11, 11, 9, 9, 9, 255, 255, 255, 255,
+  9, 9, 11, 9, 9, 9, 9, 9, 9, 11, 11, 11, 255, 255, 255, 255,
+  25, 255, 255, 255, 20, 20, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 255, 255,
+  6, 6, 6, 6, 6, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 255, 255, 255, 255,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 255, 255, 255, 255, 255, 255,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 14, 255, 255, 255, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  6, 6, 6, 6, 6, 6, 6, 11, 11, 9, 9, 11, 255, 255, 20, 20,
+  6, 6, 6, 6, 6, 9, 11, 9, 11, 11, 11, 11, 11, 11, 11, 255,
+  11, 9, 11, 9, 9, 11, 11, 11, 11, 11, 11, 11, 11, 9, 9, 9,
+  9, 9, 9, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 255, 255, 11,
+  20, 20, 20, 20, 20, 20, 20, 5, 20, 20, 20, 20, 20, 20, 255, 255,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 10, 255,
+  11, 11, 11, 11, 9, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 11, 9, 11, 11, 11, 11, 11, 9, 11, 9, 9, 9,
+  9, 9, 11, 9, 9, 6, 6, 6, 6, 6, 6, 6, 255, 255, 255, 255,
+  20, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 25, 25, 25, 25, 25, 25, 25, 25, 25, 255, 255, 255,
+  11, 11, 9, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 9, 11, 11, 11, 11, 9, 9, 11, 11, 9, 11, 11, 11, 6, 6,
+  6, 6, 6, 6, 6, 6, 11, 9, 11, 11, 9, 9, 9, 11, 9, 11,
+  11, 11, 9, 9, 255, 255, 255, 255, 255, 255, 255, 255, 20, 20, 20, 20,
+  6, 6, 6, 6, 9, 9, 9, 9, 9, 9, 9, 9, 11, 11, 11, 11,
+  11, 11, 11, 11, 9, 9, 11, 11, 255, 255, 255, 20, 20, 20, 20, 20,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 255, 255, 255, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 5, 5, 5, 5, 5, 5, 20, 20,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 255, 255, 255, 255, 255, 255, 255,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 255, 255, 3, 3, 3,
+  20, 20, 20, 20, 20, 20, 20, 20, 255, 255, 255, 255, 255, 255, 255, 255,
+  11, 11, 11, 20, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 9, 11, 11, 11, 11, 11, 11, 11, 6, 6, 6, 6, 11, 6, 6,
+  6, 6, 9, 9, 11, 6, 6, 9, 11, 11, 255, 255, 255, 255, 255, 255,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5,
+  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 5, 3, 4, 4, 4, 3, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 255, 11, 11, 11, 11, 11,
+  3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 3, 4, 4, 3, 4,
+  4, 3, 4, 3, 4, 3, 4, 3, 255, 3, 255, 3, 255, 3, 255, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 255, 255,
+  3, 3, 3, 3, 3, 3, 3, 3, 7, 7, 7, 7, 7, 7, 7, 7,
+  3, 3, 4, 3, 4, 255, 4, 4, 3, 3, 3, 3, 7, 23, 3, 23,
+  23, 23, 4, 3, 4, 255, 4, 4, 3, 3, 3, 3, 7, 23, 23, 23,
+  3, 3, 4, 4, 255, 255, 4, 4, 3, 3, 3, 3, 255, 23, 23, 23,
+  3, 3, 4, 4, 4, 3, 4, 4, 3, 3, 3, 3, 3, 23, 23, 23,
+  255, 255, 4, 3, 4, 255, 4, 4, 3, 3, 3, 3, 7, 23, 23, 255,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 1, 1, 1, 1, 1,
+  16, 16, 16, 16, 16, 16, 20, 20, 19, 18, 21, 19, 19, 18, 21, 19,
+  20, 20, 20, 20, 20, 20, 20, 20, 26, 27, 1, 1, 1, 1, 1, 28,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 19, 18, 20, 20, 20, 20, 15,
+  15, 20, 20, 20, 24, 21, 17, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  20, 20, 24, 20, 15, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 28,
+  1, 1, 1, 1, 1, 255, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  14, 5, 255, 255, 14, 14, 14, 14, 14, 14, 24, 24, 24, 21, 17, 5,
+  14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 24, 24, 24, 21, 17, 255,
+  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 255, 255, 255,
+  22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 10, 10, 10,
+  10, 11, 10, 10, 10, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  25, 25, 8, 25, 25, 25, 25, 8, 25, 25, 4, 8, 8, 8, 4, 4,
+  8, 8, 8, 4, 25, 8, 25, 25, 24, 8, 8, 8, 8, 8, 25, 25,
+  25, 25, 25, 25, 8, 25, 3, 25, 8, 25, 3, 3, 8, 8, 25, 4,
+  8, 8, 3, 8, 4, 6, 6, 6, 6, 4, 25, 25, 4, 4, 8, 8,
+  24, 24, 24, 24, 24, 8, 4, 4, 4, 4, 25, 24, 25, 25, 3, 25,
+  14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 3, 3, 13, 13, 13, 13, 14, 25, 25, 255, 255, 255, 255,
+  24, 24, 24, 24, 24, 25, 25, 25, 25, 25, 24, 24, 25, 25, 25, 25,
+  24, 25, 25, 24, 25, 25, 24, 25, 25, 25, 25, 25, 25, 25, 24, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 24, 24,
+  25, 25, 24, 25, 24, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+  24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+  25, 25, 25, 25, 25, 25, 25, 25, 21, 17, 21, 17, 25, 25, 25, 25,
+  24, 24, 25, 25, 25, 25, 25, 25, 25, 21, 17, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 24, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 24, 24, 24, 24, 24,
+  24, 24, 24, 24, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 24, 24, 24, 24,
+  24, 24, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 255, 255, 255, 255, 255,
+  14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 14, 14, 14, 14, 14, 14,
+  25, 25, 25, 25, 25, 25, 25, 24, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 24, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 24, 24, 24, 24, 24, 24, 24, 24,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 24,
+  25, 25, 25, 25, 25, 25, 25, 25, 21, 17, 21, 17, 21, 17, 21, 17,
+  21, 17, 21, 17, 21, 17, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+  14, 14, 14, 14, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  24, 24, 24, 24, 24, 21, 17, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+  24, 24, 24, 24, 24, 24, 21, 17, 21, 17, 21, 17, 21, 17, 21, 17,
+  24, 24, 24, 21, 17, 21, 17, 21, 17, 21, 17, 21, 17, 21, 17, 21,
+  17, 21, 17, 21, 17, 21, 17, 21, 17, 24, 24, 24, 24, 24, 24, 24,
+  24, 24, 24, 24, 24, 24, 24, 24, 21, 17, 21, 17, 24, 24, 24, 24,
+  24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 21, 17, 24, 24,
+  24, 24, 24, 24, 24, 25, 25, 24, 24, 24, 24, 24, 24, 25, 25, 25,
+  25, 25, 25, 25, 255, 255, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 255, 255, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 255, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 255,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 255,
+  3, 4, 3, 3, 4, 3, 3, 4, 4, 4, 4, 4, 5, 5, 3, 3,
+  3, 3, 3, 3, 4, 25, 25, 25, 25, 25, 25, 3, 3, 3, 3, 11,
+  11, 11, 3, 3, 255, 255, 255, 255, 255, 20, 20, 20, 20, 14, 20, 20,
+  6, 6, 6, 6, 6, 6, 6, 6, 255, 255, 255, 255, 255, 255, 255, 5,
+  20, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 11,
+  6, 6, 6, 6, 6, 6, 6, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  6, 6, 6, 6, 6, 6, 6, 255, 6, 6, 6, 6, 6, 6, 6, 255,
+  20, 20, 19, 18, 19, 18, 20, 20, 20, 19, 18, 20, 19, 18, 20, 20,
+  20, 20, 20, 20, 20, 20, 20, 16, 20, 20, 16, 20, 19, 18, 20, 20,
+  19, 18, 21, 17, 21, 17, 21, 17, 21, 17, 20, 20, 20, 20, 20, 5,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 16, 16, 20, 20, 20, 20,
+  16, 20, 21, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 255,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 255, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  25, 25, 25, 25, 25, 25, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 255, 255, 255, 255,
+  28, 20, 20, 20, 25, 5, 6, 13, 21, 17, 21, 17, 21, 17, 21, 17,
+  21, 17, 25, 25, 21, 17, 21, 17, 21, 17, 21, 17, 16, 21, 17, 17,
+  25, 13, 13, 13, 13, 13, 13, 13, 13, 13, 11, 11, 11, 11, 9, 9,
+  16, 5, 5, 5, 5, 5, 25, 25, 13, 13, 13, 5, 6, 20, 25, 25,
+  6, 6, 6, 6, 6, 6, 6, 255, 255, 11, 11, 23, 23, 5, 5, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 20, 5, 5, 5, 6,
+  255, 255, 255, 255, 255, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  25, 25, 14, 14, 14, 14, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 14, 14, 14, 14, 14, 14, 14, 14,
+  25, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+  6, 6, 6, 6, 6, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 5, 20, 20, 20,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 6, 6, 255, 255, 255, 255,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 6, 11,
+  10, 10, 10, 20, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 20, 5,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 5, 5, 11, 11,
+  6, 6, 6, 6, 6, 6, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  11, 11, 20, 20, 20, 20, 20, 20, 255, 255, 255, 255, 255, 255, 255, 255,
+  23, 23, 23, 23, 23, 23, 23, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+  23, 23, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  4, 4, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  5, 4, 4, 4, 4, 4, 4, 4, 4, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 5, 23, 23, 3, 3, 3, 4, 6,
+  3, 3, 3, 3, 4, 4, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 6, 5, 5, 4, 6, 6, 6, 6, 6,
+  6, 6, 11, 6, 6, 6, 11, 6, 6, 6, 6, 11, 6, 6, 6, 6,
+  6, 6, 6, 9, 9, 11, 11, 9, 25, 25, 25, 25, 255, 255, 255, 255,
+  14, 14, 14, 14, 14, 14, 25, 25, 22, 25, 255, 255, 255, 255, 255, 255,
+  6, 6, 6, 6, 20, 20, 20, 20, 255, 255, 255, 255, 255, 255, 255, 255,
+  9, 9, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+  9, 9, 9, 9, 11, 11, 255, 255, 255, 255, 255, 255, 255, 255, 20, 20,
+  11, 11, 6, 6, 6, 6, 6, 6, 20, 20, 20, 6, 20, 6, 6, 11,
+  6, 6, 6, 6, 6, 6, 11, 11, 11, 11, 11, 11, 11, 11, 20, 20,
+  6, 6, 6, 6, 6, 6, 6, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 9, 9, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 20,
+  6, 6, 6, 11, 9, 9, 11, 11, 11, 11, 9, 9, 11, 9, 9, 9,
+  9, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 255, 5,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 255, 255, 255, 255, 20, 20,
+  6, 6, 6, 6, 6, 11, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 6, 6, 6, 6, 6, 255,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 11, 11, 11, 11, 11, 11, 9,
+  9, 11, 11, 9, 9, 11, 11, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  6, 6, 6, 11, 6, 6, 6, 6, 6, 6, 6, 6, 11, 9, 255, 255,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 255, 255, 20, 20, 20, 20,
+  5, 6, 6, 6, 6, 6, 6, 25, 25, 25, 6, 9, 11, 9, 6, 6,
+  11, 6, 11, 11, 11, 6, 6, 11, 11, 6, 6, 6, 6, 6, 11, 11,
+  6, 11, 6, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 6, 6, 5, 20, 20,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 9, 11, 11, 9, 9,
+  20, 20, 6, 5, 5, 9, 11, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 6, 6, 6, 6, 6, 6, 255, 255, 6, 6, 6, 6, 6, 6, 255,
+  255, 6, 6, 6, 6, 6, 6, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  4, 4, 4, 3, 4, 4, 4, 4, 4, 4, 4, 23, 5, 5, 5, 5,
+  4, 4, 4, 4, 4, 4, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  6, 6, 6, 9, 9, 11, 9, 9, 11, 9, 9, 20, 9, 11, 255, 255,
+  6, 6, 6, 6, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  6, 6, 6, 6, 6, 6, 6, 255, 255, 255, 255, 6, 6, 6, 6, 6,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  4, 4, 4, 4, 4, 4, 4, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 4, 4, 4, 4, 4, 255, 255, 255, 255, 255, 6, 11, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 24, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 255, 6, 6, 6, 6, 6, 255, 6, 255,
+  6, 6, 255, 6, 6, 255, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+  23, 23, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 17, 21,
+  255, 255, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 255, 255, 255, 255, 255, 255, 255, 255,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 22, 25, 255, 255,
+  20, 20, 20, 20, 20, 20, 20, 21, 17, 20, 255, 255, 255, 255, 255, 255,
+  20, 16, 16, 15, 15, 21, 17, 21, 17, 21, 17, 21, 17, 21, 17, 21,
+  17, 21, 17, 21, 17, 20, 20, 21, 17, 20, 20, 20, 20, 15, 15, 15,
+  20, 20, 20, 255, 20, 20, 20, 20, 16, 21, 17, 21, 17, 21, 17, 20,
+  20, 20, 24, 16, 24, 24, 24, 255, 20, 22, 20, 20, 255, 255, 255, 255,
+  6, 6, 6, 6, 6, 255, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 255, 255, 1,
+  255, 20, 20, 20, 22, 20, 20, 20, 21, 17, 20, 24, 20, 16, 20, 20,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 21, 24, 17, 24, 21,
+  17, 20, 21, 17, 20, 20, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 5, 5,
+  255, 255, 6, 6, 6, 6, 6, 6, 255, 255, 6, 6, 6, 6, 6, 6,
+  255, 255, 6, 6, 6, 6, 6, 6, 255, 255, 6, 6, 6, 255, 255, 255,
+  22, 22, 24, 23, 25, 22, 22, 255, 25, 24, 24, 24, 24, 25, 25, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 1, 1, 1, 25, 25, 255, 255,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 255, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 255, 6, 6, 255, 6,
+  20, 20, 20, 255, 255, 255, 255, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+  14, 14, 14, 14, 255, 255, 255, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  13, 13, 13, 13, 13, 14, 14, 14, 14, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 14, 14, 25, 25, 25, 255,
+  25, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 11, 255, 255,
+  11, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+  14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 255, 255, 255, 255,
+  14, 14, 14, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 6, 6, 6,
+  6, 13, 6, 6, 6, 6, 6, 6, 6, 6, 13, 255, 255, 255, 255, 255,
+  6, 6, 6, 6, 6, 6, 11, 11, 11, 11, 11, 255, 255, 255, 255, 255,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 255, 20,
+  6, 6, 6, 6, 255, 255, 255, 255, 6, 6, 6, 6, 6, 6, 6, 6,
+  20, 13, 13, 13, 13, 13, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  3, 3, 3, 3, 255, 255, 255, 255, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 255, 255, 255, 255,
+  6, 6, 6, 6, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 20,
+  6, 6, 6, 6, 6, 6, 255, 255, 6, 255, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 255, 6, 6, 255, 255, 255, 6, 255, 255, 6,
+  6, 6, 6, 6, 6, 6, 255, 20, 14, 14, 14, 14, 14, 14, 14, 14,
+  6, 6, 6, 6, 6, 6, 6, 25, 25, 14, 14, 14, 14, 14, 14, 14,
+  255, 255, 255, 255, 255, 255, 255, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+  6, 6, 6, 255, 6, 6, 255, 255, 255, 255, 255, 14, 14, 14, 14, 14,
+  6, 6, 6, 6, 6, 6, 14, 14, 14, 14, 14, 14, 255, 255, 255, 20,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 255, 255, 255, 255, 255, 20,
+  6, 6, 6, 6, 6, 6, 6, 6, 255, 255, 255, 255, 14, 14, 6, 6,
+  255, 255, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+  6, 11, 11, 11, 255, 11, 11, 255, 255, 255, 255, 255, 11, 11, 11, 11,
+  6, 6, 6, 6, 255, 6, 6, 6, 255, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 255, 255, 11, 11, 11, 255, 255, 255, 255, 11,
+  14, 14, 14, 14, 14, 14, 14, 14, 14, 255, 255, 255, 255, 255, 255, 255,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 255, 255, 255, 255, 255, 255, 255,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 14, 14, 20,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 14, 14, 14,
+  6, 6, 6, 6, 6, 6, 6, 6, 25, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 11, 11, 255, 255, 255, 255, 14, 14, 14, 14, 14,
+  20, 20, 20, 20, 20, 20, 20, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  6, 6, 6, 6, 6, 6, 255, 255, 255, 20, 20, 20, 20, 20, 20, 20,
+  6, 6, 6, 6, 6, 6, 255, 255, 14, 14, 14, 14, 14, 14, 14, 14,
+  6, 6, 6, 255, 255, 255, 255, 255, 14, 14, 14, 14, 14, 14, 14, 14,
+  6, 6, 255, 255, 255, 255, 255, 255, 255, 20, 20, 20, 20, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 14, 14, 14, 14, 14, 14,
+  3, 3, 3, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  3, 3, 3, 255, 255, 255, 255, 255, 255, 255, 14, 14, 14, 14, 14, 14,
+  6, 6, 6, 6, 11, 11, 11, 11, 255, 255, 255, 255, 255, 255, 255, 255,
+  14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 255,
+  14, 14, 14, 14, 14, 14, 14, 6, 255, 255, 255, 255, 255, 255, 255, 255,
+  11, 14, 14, 14, 14, 20, 20, 20, 20, 20, 255, 255, 255, 255, 255, 255,
+  9, 11, 9, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 20, 20, 20, 20, 20, 20, 20, 255, 255,
+  14, 14, 14, 14, 14, 14, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 11,
+  9, 9, 9, 11, 11, 11, 11, 9, 9, 11, 11, 20, 20, 1, 20, 20,
+  20, 20, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 1, 255, 255,
+  11, 11, 11, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 11, 11, 11, 11, 11, 9, 11, 11, 11,
+  11, 11, 11, 11, 11, 255, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  20, 20, 20, 20, 6, 9, 9, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  6, 6, 6, 11, 20, 20, 6, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  6, 6, 6, 9, 9, 9, 11, 11, 11, 11, 11, 11, 11, 11, 11, 9,
+  9, 6, 6, 6, 6, 20, 20, 20, 20, 11, 11, 11, 11, 20, 255, 255,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 6, 20, 6, 20, 20, 20,
+  255, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+  14, 14, 14, 14, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 9, 9, 9, 11,
+  11, 11, 9, 9, 11, 9, 11, 11, 20, 20, 20, 20, 20, 20, 11, 255,
+  6, 6, 6, 6, 6, 6, 6, 255, 6, 255, 6, 6, 6, 6, 255, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 255, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 20, 255, 255, 255, 255, 255, 255,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 11,
+  9, 9, 9, 11, 11, 11, 11, 11, 11, 11, 11, 255, 255, 255, 255, 255,
+  11, 11, 9, 9, 255, 6, 6, 6, 6, 6, 6, 6, 6, 255, 255, 6,
+  6, 255, 6, 6, 255, 6, 6, 6, 6, 6, 255, 11, 11, 6, 9, 9,
+  11, 9, 9, 9, 9, 255, 255, 9, 9, 255, 255, 9, 9, 9, 255, 255,
+  6, 255, 255, 255, 255, 255, 255, 9, 255, 255, 255, 255, 255, 6, 6, 6,
+  6, 6, 9, 9, 255, 255, 11, 11, 11, 11, 11, 11, 11, 255, 255, 255,
+  11, 11, 11, 11, 11, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  6, 6, 6, 6, 6, 9, 9, 9, 11, 11, 11, 11, 11, 11, 11, 11,
+  9, 9, 11, 11, 11, 9, 11, 6, 6, 6, 6, 20, 20, 20, 20, 20,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 255, 20, 255, 20, 11, 255,
+  9, 9, 9, 11, 11, 11, 11, 11, 11, 9, 11, 9, 9, 9, 9, 11,
+  11, 9, 11, 11, 6, 6, 20, 6, 255, 255, 255, 255, 255, 255, 255, 255,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 9,
+  9, 9, 11, 11, 11, 11, 255, 255, 9, 9, 9, 9, 11, 11, 9, 11,
+  11, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  20, 20, 20, 20, 20, 20, 20, 20, 6, 6, 6, 6, 11, 11, 255, 255,
+  9, 9, 9, 11, 11, 11, 11, 11, 11, 11, 11, 9, 9, 11, 9, 11,
+  11, 20, 20, 20, 6, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 255, 255, 255,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 11, 9, 11, 9, 9,
+  11, 11, 11, 11, 11, 11, 9, 11, 255, 255, 255, 255, 255, 255, 255, 255,
+  9, 9, 11, 11, 11, 11, 9, 11, 11, 11, 11, 11, 255, 255, 255, 255,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 14, 14, 20, 20, 20, 25,
+  11, 11, 11, 11, 11, 11, 11, 11, 9, 11, 11, 20, 255, 255, 255, 255,
+  14, 14, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 6,
+  6, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 6, 6, 6, 6, 6,
+  6, 6, 6, 11, 11, 11, 11, 11, 11, 9, 6, 11, 11, 11, 11, 20,
+  20, 20, 20, 20, 20, 20, 20, 11, 255, 255, 255, 255, 255, 255, 255, 255,
+  6, 11, 11, 11, 11, 11, 11, 9, 9, 11, 11, 11, 6, 6, 6, 6,
+  6, 6, 6, 6, 255, 255, 6, 6, 6, 6, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 9, 11, 11, 20, 20, 20, 6, 20, 20,
+  20, 20, 20, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  11, 11, 11, 11, 11, 11, 11, 255, 11, 11, 11, 11, 11, 11, 9, 11,
+  6, 20, 20, 20, 20, 20, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  20, 20, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  255, 255, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 255, 9, 11, 11, 11, 11, 11, 11,
+  11, 9, 11, 11, 9, 11, 11, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  6, 6, 6, 6, 6, 6, 6, 255, 6, 6, 255, 6, 6, 6, 6, 6,
+  6, 11, 11, 11, 11, 11, 11, 255, 255, 255, 11, 255, 11, 11, 255, 11,
+  11, 11, 11, 11, 11, 11, 6, 11, 255, 255, 255, 255, 255, 255, 255, 255,
+  6, 6, 6, 6, 6, 6, 255, 6, 6, 255, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 9, 9, 9, 9, 9, 255,
+  11, 11, 255, 9, 9, 11, 9, 11, 6, 255, 255, 255, 255, 255, 255, 255,
+  6, 6, 6, 11, 11, 9, 9, 20, 20, 255, 255, 255, 255, 255, 255, 255,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 255,
+  20, 20, 20, 20, 20, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  11, 11, 11, 11, 11, 20, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  11, 11, 11, 11, 11, 11, 11, 20, 20, 20, 20, 20, 25, 25, 25, 25,
+  5, 5, 5, 5, 20, 25, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 255, 14, 14, 14, 14, 14,
+  14, 14, 255, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 255, 255, 255, 255, 255, 6, 6, 6,
+  14, 14, 14, 14, 14, 14, 14, 20, 20, 20, 20, 255, 255, 255, 255, 255,
+  6, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+  9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+  9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 255,
+  11, 11, 11, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+  5, 5, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  6, 6, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  6, 6, 6, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 255, 255, 25, 11, 11, 20,
+  1, 1, 1, 1, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  25, 25, 25, 25, 25, 25, 25, 255, 255, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 9, 9, 11, 11, 11, 25, 25, 25, 9, 9, 9,
+  9, 9, 9, 1, 1, 1, 1, 1, 1, 1, 1, 11, 11, 11, 11, 11,
+  11, 11, 11, 25, 25, 11, 11, 11, 11, 11, 11, 11, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 11, 11, 11, 11, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 255, 255, 255, 255, 255, 255, 255,
+  25, 25, 11, 11, 11, 25, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  14, 14, 14, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 4, 4,
+  4, 4, 4, 4, 4, 255, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 8, 8, 8, 8, 8, 8, 8, 8,
+  8, 8, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 8, 255, 8, 8,
+  255, 255, 8, 255, 255, 8, 8, 255, 255, 8, 8, 8, 8, 255, 8, 8,
+  8, 8, 8, 8, 8, 8, 4, 4, 4, 4, 255, 4, 255, 4, 4, 4,
+  4, 4, 4, 4, 255, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 8, 8, 255, 8, 8, 8, 8, 255, 255, 8, 8, 8,
+  8, 8, 8, 8, 8, 255, 8, 8, 8, 8, 8, 8, 8, 255, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 8, 8, 255, 8, 8, 8, 8, 255,
+  8, 8, 8, 8, 8, 255, 8, 255, 255, 255, 8, 8, 8, 8, 8, 8,
+  8, 255, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 8, 8, 8, 8,
+  8, 8, 8, 8, 8, 8, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 255, 255, 8, 8, 8, 8, 8, 8, 8, 8,
+  8, 24, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 24, 4, 4, 4, 4,
+  4, 4, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 24, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 24, 4, 4, 4, 4, 4, 4, 8, 8, 8, 8,
+  8, 8, 8, 8, 8, 24, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 24,
+  4, 4, 4, 4, 4, 4, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 24,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 24, 4, 4, 4, 4, 4, 4,
+  8, 8, 8, 8, 8, 8, 8, 8, 8, 24, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 24, 4, 4, 4, 4, 4, 4, 8, 4, 255, 255, 12, 12,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  11, 11, 11, 11, 11, 11, 11, 25, 25, 25, 25, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 25, 25, 25,
+  25, 25, 25, 25, 25, 11, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 11, 25, 25, 20, 20, 20, 20, 20, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 255, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 255, 255, 11, 11, 11, 11, 11,
+  11, 11, 255, 11, 11, 255, 11, 11, 11, 11, 11, 255, 255, 255, 255, 255,
+  6, 6, 6, 6, 6, 255, 255, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+  11, 11, 11, 11, 11, 11, 11, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  3, 3, 3, 3, 11, 11, 11, 11, 11, 11, 11, 255, 255, 255, 255, 255,
+  14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 25, 14, 14, 14,
+  22, 14, 14, 14, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  6, 6, 6, 6, 255, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  255, 6, 6, 255, 6, 255, 255, 6, 255, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 255, 6, 6, 6, 6, 255, 6, 255, 6, 255, 255, 255, 255,
+  255, 255, 6, 255, 255, 255, 255, 6, 255, 6, 255, 6, 255, 6, 6, 6,
+  255, 6, 6, 255, 6, 255, 255, 6, 255, 6, 255, 6, 255, 6, 255, 6,
+  255, 6, 6, 255, 6, 255, 255, 6, 6, 6, 6, 255, 6, 6, 6, 6,
+  6, 6, 6, 255, 6, 6, 6, 6, 255, 6, 6, 6, 6, 255, 6, 255,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 255, 6, 6, 6, 6, 6,
+  255, 6, 6, 6, 255, 6, 6, 6, 6, 6, 255, 6, 6, 6, 6, 6,
+  24, 24, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  25, 25, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 23, 23, 23, 23, 23,
+  25, 25, 25, 25, 25, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  25, 25, 25, 25, 25, 25, 25, 25, 255, 255, 255, 255, 255, 255, 255, 255,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 255, 255,
+  25, 255, 255, 25, 25, 25, 25, 255, 255, 255, 25, 255, 25, 25, 25, 25,
+  255, 1, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+};
@@ -5,6 +5,7 @@
 //#include <errno.h>
 #include "local.h"
 
+#if defined (PREFER_SIZE_OVER_SPEED) || defined (__OPTIMIZE_SIZE__)
 /*
    struct caseconv_entry describes the case conversion behaviour
    of a range of Unicode characters.
@@ -138,6 +139,46 @@ touupper (wint_t c)
 
   return c;
 }
+#else
+/*
+   struct caseconv_delta describes the case conversion of a character c:
+     towlower (c) = c + lower
+     towupper (c) = c + upper
+   The staged tables generated from caseconv.t by mkstages give the index
+   in caseconv_deltas of every character.
+ */
+struct caseconv_delta {
+  int_least32_t lower;
+  int_least32_t upper;
+};
+#include "casepages.t"
+
+static const struct caseconv_delta *
+caseconv (uint_least32_t c)
+{
+  /* Latin-1 characters come first in case_blocks */
+  if (c < 0x100)
+    return &caseconv_deltas[case_blocks[c]];
+  if (c >= 0x110000)
+    return &caseconv_deltas[0];
+  return &caseconv_deltas[case_blocks[case_pages[case_index[c >> CASE_PAGE_SHIFT]
+				       + ((c >> CASE_BLOCK_SHIFT)
+					  & ((1 << (CASE_PAGE_SHIFT - CASE_BLOCK_SHIFT)) - 1))]
+			     + (c & ((1 << CASE_BLOCK_SHIFT) - 1))]];
+}
+
+static wint_t
+toulower (wint_t c)
+{
+  return c + caseconv (c)->lower;
+}
+
+static wint_t
+touupper (wint_t c)
+{
+  return c + caseconv (c)->upper;
+}
+#endif
 
 wint_t
 towctrans_l (wint_t c, wctrans_t w, struct __locale_t *locale)
@@ -37,6 +37,16 @@
 #  define TABLE_USE_SIZE_OPTIMIZATION
 #endif
 
+/*
+ * 16-bit tables are looked up in direct-index tables of all 65536 codes,
+ * built from them when they are first used, if TABLE_USE_DIRECT_INDEX is
+ * defined, for example in CFLAGS.  Each of them takes 128K of memory, so
+ * this is not done by default, nor ever with size-optimized tables.
+ */
+#ifdef TABLE_USE_SIZE_OPTIMIZATION
+#  undef TABLE_USE_DIRECT_INDEX
+#endif
+
 /* Invalid code marker */
 #define INVALC  0xFFFF
 /* Invalid block marker - marks empty blocks in speed-optimized tables */
@@ -148,6 +158,7 @@ typedef struct
   int type;               /* Table type (builtin/external) */
   int optimization;       /* Table optimization type (speed/size) */ 
   const __uint16_t *tbl; /* Table's data */
+  const __uint16_t *direct; /* Direct-index table of 16-bit CCS or NULL */
 } iconv_ccs_desc_t;
 
 /* Array containing all built-in CCS tables */
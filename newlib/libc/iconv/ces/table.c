@@ -36,11 +36,17 @@
 #include <stdlib.h>
 #include <unistd.h>
 #include <fcntl.h>
+#include <sys/lock.h>
+#include <sys/stat.h>
 #include <sys/iconvnls.h>
+#if defined (_ICONV_ENABLE_EXTERNAL_CCS) && defined (HAVE_FILE_MMAP)
+#include <sys/mman.h>
+#endif
 #include "../lib/endian.h"
 #include "../lib/local.h"
 #include "../lib/ucsconv.h"
 #include "../ccs/ccs.h"
+#include "utf-8.h"
 
 /*
  * Table-based CES converter is implemented here.  Table-based CES converter
@@ -52,10 +58,29 @@
  * subdirectory. First, converter tries to find needed CCS table among
  * linked-in tables. If not found, it tries to load it from external file
  * (only if corespondent capability was enabled in Newlib configuration). 
+ * External tables are loaded once, mapped into memory if the system has
+ * mmap (HAVE_FILE_MMAP), and shared by all conversions.
  *
- * 16 bit encodings are assumed to be Big Endian.
+ * 16 bit encodings are assumed to be Big Endian.  If TABLE_USE_DIRECT_INDEX
+ * is defined (see ccs.h), a direct-index table of all 65536 codes is built
+ * from every 16-bit table when a conversion first uses it, so that each
+ * code is found with a single load; it is shared as well.
  */
 
+#if defined (TABLE_USE_DIRECT_INDEX) || defined (_ICONV_ENABLE_EXTERNAL_CCS)
+/* Protects the lists of shared tables, which are never freed. */
+#ifndef __SINGLE_THREAD__
+__LOCK_INIT(static, __iconv_table_mutex);
+/* The dummy locks of <sys/lock.h> leave the lock variable unused. */
+#  define TABLE_LOCK   ((void) __iconv_table_mutex, \
+                        __lock_acquire (__iconv_table_mutex))
+#  define TABLE_UNLOCK __lock_release (__iconv_table_mutex)
+#else
+#  define TABLE_LOCK
+#  define TABLE_UNLOCK
+#endif
+#endif
+
 static ucs2_t
 find_code_size (ucs2_t code, const __uint16_t *tblp);
 
@@ -65,8 +90,16 @@ find_code_speed (ucs2_t code, const __uint16_t *tblp);
 static __inline ucs2_t
 find_code_speed_8bit (ucs2_t code, const unsigned char *tblp);
 
+static __inline ucs2_t
+find_code (ucs2_t code, const iconv_ccs_desc_t *ccsp);
+
+#ifdef TABLE_USE_DIRECT_INDEX
+static const __uint16_t *
+get_direct_table (struct _reent *rptr, const iconv_ccs_desc_t *ccsp);
+#endif
+
 #ifdef _ICONV_ENABLE_EXTERNAL_CCS
-static const iconv_ccs_desc_t *
+static iconv_ccs_desc_t *
 load_file (struct _reent *rptr, const char *name, int direction);
 #endif
 
@@ -77,12 +110,8 @@ static size_t
 table_close (struct _reent *rptr,
                     void *data)
 {
-  const iconv_ccs_desc_t *ccsp = (iconv_ccs_desc_t *)data;
-
-  if (ccsp->type == TABLE_EXTERNAL)
-    _free_r (rptr, (void *)ccsp->tbl);
-
-  _free_r( rptr, (void *)ccsp);
+  /* The tables themselves are shared. */
+  _free_r (rptr, data);
   return 0;
 }
 
@@ -113,15 +142,23 @@ table_init_from_ucs (struct _reent *rptr,
       ccsp->bits = biccsp->bits;
       ccsp->optimization = biccsp->from_ucs_type;
       ccsp->tbl = biccsp->from_ucs;
-      
-      return (void *)ccsp;
+      ccsp->direct = NULL;
     }
-    
+  else
+    {
 #ifdef _ICONV_ENABLE_EXTERNAL_CCS
-  return (void *)load_file (rptr, encoding, 1);
+      if ((ccsp = load_file (rptr, encoding, 1)) == NULL)
+        return NULL;
 #else
-  return NULL;
+      return NULL;
+#endif
+    }
+
+#ifdef TABLE_USE_DIRECT_INDEX
+  if (ccsp->bits == TABLE_16BIT)
+    ccsp->direct = get_direct_table (rptr, ccsp);
 #endif
+  return (void *)ccsp;
 }
 
 static size_t
@@ -147,10 +184,8 @@ table_convert_from_ucs (void *data,
       *outbytesleft -= 1;
       return 1; 
     }
-  else if (ccsp->optimization == TABLE_SPEED_OPTIMIZED)
-    code = find_code_speed ((ucs2_t)in, ccsp->tbl);
-  else
-    code = find_code_size ((ucs2_t)in, ccsp->tbl);
+
+  code = find_code ((ucs2_t)in, ccsp);
 
   if (code == INVALC)
     return (size_t)ICONV_CES_INVALID_CHARACTER;
@@ -165,6 +200,92 @@ table_convert_from_ucs (void *data,
   *outbytesleft -= 2;
   return 2; 
 }
+
+static size_t
+table_convert_from_ucs_block (void *data,
+                                     const ucs4_t *in,
+                                     size_t n,
+                                     unsigned char **outbuf,
+                                     size_t *outbytesleft)
+{
+  const iconv_ccs_desc_t *ccsp = (iconv_ccs_desc_t *)data;
+  unsigned char *cp = *outbuf;
+  size_t left = *outbytesleft;
+  size_t i;
+  ucs2_t code;
+
+  if (ccsp->bits == TABLE_8BIT)
+    {
+      const unsigned char *tblp = (const unsigned char *)ccsp->tbl;
+
+      for (i = 0; i < n && i < left; i++)
+        {
+          if (in[i] >= INVALC
+              || (code = find_code_speed_8bit ((ucs2_t)in[i], tblp)) == INVALC)
+            break;
+          cp[i] = (unsigned char)code;
+        }
+      cp += i;
+      left -= i;
+    }
+  else
+    {
+      for (i = 0; i < n && left >= 2; i++)
+        {
+          if (in[i] >= INVALC)
+            break;
+          if ((code = find_code ((ucs2_t)in[i], ccsp)) == INVALC)
+            break;
+          *cp++ = (unsigned char)(code >> 8);
+          *cp++ = (unsigned char)code;
+          left -= 2;
+        }
+    }
+
+  *outbuf = cp;
+  *outbytesleft = left;
+  return i;
+}
+
+#if defined (ICONV_TO_UCS_CES_UTF_8)
+static size_t
+table_convert_from_utf_8 (void *data,
+                                 const unsigned char **inbuf,
+                                 size_t *inbytesleft,
+                                 unsigned char **outbuf,
+                                 size_t *outbytesleft)
+{
+  const iconv_ccs_desc_t *ccsp = (iconv_ccs_desc_t *)data;
+  const unsigned char *tblp = (const unsigned char *)ccsp->tbl;
+  const unsigned char *in = *inbuf;
+  unsigned char *cp = *outbuf;
+  size_t inleft = *inbytesleft;
+  size_t outleft = *outbytesleft;
+  size_t i;
+  ucs4_t ch;
+  ucs2_t code;
+  int bytes;
+
+  if (ccsp->bits != TABLE_8BIT)
+    return 0;
+
+  for (i = 0; inleft > 0 && i < outleft; i++)
+    {
+      if ((bytes = utf_8_decode (in, inleft, &ch)) == 0 || ch > 0xFFFF
+          || (code = find_code_speed_8bit ((ucs2_t)ch, tblp)) == INVALC)
+        break;
+      cp[i] = (unsigned char)code;
+      in += bytes;
+      inleft -= bytes;
+    }
+
+  *inbuf = in;
+  *inbytesleft = inleft;
+  *outbuf = cp + i;
+  *outbytesleft = outleft - i;
+  return i;
+}
+#endif /* ICONV_TO_UCS_CES_UTF_8 */
 #endif /* ICONV_FROM_UCS_CES_TABLE */
 
 #if defined (ICONV_TO_UCS_CES_TABLE)
@@ -194,15 +315,23 @@ table_init_to_ucs (struct _reent *rptr,
       ccsp->bits = biccsp->bits;
       ccsp->optimization = biccsp->to_ucs_type;
       ccsp->tbl = biccsp->to_ucs;
-      
-      return (void *)ccsp;
+      ccsp->direct = NULL;
     }
-  
+  else
+    {
 #ifdef _ICONV_ENABLE_EXTERNAL_CCS
-  return (void *)load_file (rptr, encoding, 0);
+      if ((ccsp = load_file (rptr, encoding, 0)) == NULL)
+        return NULL;
 #else
-  return NULL;
+      return NULL;
+#endif
+    }
+
+#ifdef TABLE_USE_DIRECT_INDEX
+  if (ccsp->bits == TABLE_16BIT)
+    ccsp->direct = get_direct_table (rptr, ccsp);
 #endif
+  return (void *)ccsp;
 }
 
 static ucs4_t
@@ -231,12 +360,7 @@ table_convert_to_ucs (void *data,
   if (*inbytesleft < 2)
     return (ucs4_t)ICONV_CES_BAD_SEQUENCE;
 
-  if (ccsp->optimization == TABLE_SIZE_OPTIMIZED)
-    ucs = find_code_size((ucs2_t)**inbuf << 8 | (ucs2_t)*(*inbuf + 1),
-                         ccsp->tbl);
-  else
-    ucs = find_code_speed((ucs2_t)**inbuf << 8 | (ucs2_t)*(*inbuf + 1),
-                          ccsp->tbl);
+  ucs = find_code ((ucs2_t)**inbuf << 8 | (ucs2_t)*(*inbuf + 1), ccsp);
 
   if (ucs == INVALC)
     return (ucs4_t)ICONV_CES_INVALID_CHARACTER;
@@ -245,6 +369,90 @@ table_convert_to_ucs (void *data,
   *inbytesleft -= 2;
   return (ucs4_t)ucs; 
 }
+
+static size_t
+table_convert_to_ucs_block (void *data,
+                                   const unsigned char **inbuf,
+                                   size_t *inbytesleft,
+                                   ucs4_t *out,
+                                   size_t n)
+{
+  const iconv_ccs_desc_t *ccsp = (iconv_ccs_desc_t *)data;
+  const unsigned char *in = *inbuf;
+  size_t left = *inbytesleft;
+  size_t i;
+  ucs2_t ucs;
+
+  if (ccsp->bits == TABLE_8BIT)
+    {
+      for (i = 0; i < n && i < left; i++)
+        {
+          if ((ucs = (ucs2_t)ccsp->tbl[in[i]]) == INVALC)
+            break;
+          out[i] = (ucs4_t)ucs;
+        }
+      in += i;
+      left -= i;
+    }
+  else
+    {
+      for (i = 0; i < n && left >= 2; i++)
+        {
+          ucs = find_code ((ucs2_t)in[0] << 8 | (ucs2_t)in[1], ccsp);
+          if (ucs == INVALC)
+            break;
+          out[i] = (ucs4_t)ucs;
+          in += 2;
+          left -= 2;
+        }
+    }
+
+  *inbuf = in;
+  *inbytesleft = left;
+  return i;
+}
+
+#if defined (ICONV_FROM_UCS_CES_UTF_8)
+static size_t
+table_convert_to_utf_8 (void *data,
+                               const unsigned char **inbuf,
+                               size_t *inbytesleft,
+                               unsigned char **outbuf,
+                               size_t *outbytesleft)
+{
+  const iconv_ccs_desc_t *ccsp = (iconv_ccs_desc_t *)data;
+  const unsigned char *in = *inbuf;
+  unsigned char *cp = *outbuf;
+  size_t inleft = *inbytesleft;
+  size_t outleft = *outbytesleft;
+  size_t i;
+  ucs2_t ucs;
+  int bytes;
+
+  if (ccsp->bits != TABLE_8BIT)
+    return 0;
+
+  for (i = 0; i < inleft; i++)
+    {
+      if ((ucs = (ucs2_t)ccsp->tbl[in[i]]) < 0x80 && outleft > 0)
+        {
+          *cp++ = (unsigned char)ucs;
+          outleft--;
+          continue;
+        }
+      if (ucs == INVALC || (bytes = utf_8_encode (cp, outleft, ucs)) == 0)
+        break;
+      cp += bytes;
+      outleft -= bytes;
+    }
+
+  *inbuf = in + i;
+  *inbytesleft = inleft - i;
+  *outbuf = cp;
+  *outbytesleft = outleft;
+  return i;
+}
+#endif /* ICONV_FROM_UCS_CES_UTF_8 */
 #endif /* ICONV_TO_UCS_CES_TABLE */
 
 static int
@@ -264,7 +472,13 @@ _iconv_to_ucs_ces_handlers_table =
   NULL,
   NULL,
   NULL,
-  table_convert_to_ucs
+  table_convert_to_ucs,
+  table_convert_to_ucs_block,
+#if defined (ICONV_FROM_UCS_CES_UTF_8)
+  table_convert_to_utf_8
+#else
+  NULL
+#endif
 };
 #endif /* ICONV_FROM_UCS_CES_TABLE */
 
@@ -278,7 +492,13 @@ _iconv_from_ucs_ces_handlers_table =
   NULL,
   NULL,
   NULL,
-  table_convert_from_ucs
+  table_convert_from_ucs,
+  table_convert_from_ucs_block,
+#if defined (ICONV_TO_UCS_CES_UTF_8)
+  table_convert_from_utf_8
+#else
+  NULL
+#endif
 };
 #endif /* ICONV_TO_UCS_CES_TABLE */
 
@@ -425,6 +645,88 @@ find_code_size (ucs2_t code,
   return (ucs2_t)INVALC;
 }
 
+/*
+ * find_code - find code in 16 bit table.
+ *
+ * PARAMETERS:
+ *     ucs2_t code - code whose mapping to find.
+ *     const iconv_ccs_desc_t *ccsp - table description.
+ *
+ * RETURN:
+ *     Code that corresponds to 'code'.
+ */
+static __inline ucs2_t
+find_code (ucs2_t code,
+                  const iconv_ccs_desc_t *ccsp)
+{
+  if (ccsp->direct != NULL)
+    return (ucs2_t)ccsp->direct[code];
+  if (ccsp->optimization == TABLE_SPEED_OPTIMIZED)
+    return find_code_speed (code, ccsp->tbl);
+  return find_code_size (code, ccsp->tbl);
+}
+
+#ifdef TABLE_USE_DIRECT_INDEX
+
+/*
+ * Direct-index tables built so far.  Only modified under the table lock.
+ */
+typedef struct direct_table
+{
+  struct direct_table *next;
+  const __uint16_t *tbl;    /* Table it is built from */
+  __uint16_t code[0x10000]; /* Code that corresponds to every code */
+} direct_table_t;
+
+static direct_table_t *direct_tables;
+
+/*
+ * get_direct_table - get direct-index table of 16 bit table.
+ *
+ * PARAMETERS:
+ *     struct _reent *rptr - reent structure of current thread/process.
+ *     const iconv_ccs_desc_t *ccsp - table description.
+ *
+ * DESCRIPTION:
+ *     Returns the direct-index table built from the 'ccsp' table, and
+ *     builds it the first time it is needed.
+ *
+ * RETURN:
+ *     Direct-index table pointer, or NULL if there is not enough memory;
+ *     the 'ccsp' table is then searched instead.
+ */
+static const __uint16_t *
+get_direct_table (struct _reent *rptr,
+                         const iconv_ccs_desc_t *ccsp)
+{
+  direct_table_t *dp;
+  int i;
+
+  TABLE_LOCK;
+
+  for (dp = direct_tables; dp != NULL; dp = dp->next)
+    if (dp->tbl == ccsp->tbl)
+      break;
+
+  if (dp == NULL
+      && (dp = (direct_table_t *)
+               _malloc_r (rptr, sizeof (direct_table_t))) != NULL)
+    {
+      dp->tbl = ccsp->tbl;
+      for (i = 0; i <= 0xFFFF; i++)
+        dp->code[i] = ccsp->optimization == TABLE_SPEED_OPTIMIZED
+                      ? find_code_speed ((ucs2_t)i, ccsp->tbl)
+                      : find_code_size ((ucs2_t)i, ccsp->tbl);
+      dp->next = direct_tables;
+      direct_tables = dp;
+    }
+
+  TABLE_UNLOCK;
+
+  return dp != NULL ? dp->code : NULL;
+}
+#endif /* TABLE_USE_DIRECT_INDEX */
+
 #ifdef _ICONV_ENABLE_EXTERNAL_CCS
 
 #define _16BIT_ELT(offset) \
@@ -433,46 +735,60 @@ find_code_size (ucs2_t code,
     ICONV_BETOHL(*((__uint32_t *)(buf + (offset))))
 
 /*
- * load_file - load conversion table from external file and initialize
- *             iconv_ccs_desc_t object.
+ * External tables loaded so far.  Only modified under the table lock.
+ */
+typedef struct ccs_file
+{
+  struct ccs_file *next;
+  int direction;            /* 0 - "To UCS" table, 1 - "From UCS" table */
+  iconv_ccs_desc_t desc;    /* Table description */
+  char name[1];             /* CCS name */
+} ccs_file_t;
+
+static ccs_file_t *ccs_files;
+
+/*
+ * read_file - load conversion table from external file.
  *
  * PARAMETERS:
  *    struct _reent *rptr - reent structure of current thread/process.
- *    const char *name - encoding name.
- *    int direction - conversion direction.
+ *    ccs_file_t *fp - table with CCS name and direction.
  *
  * DESCRIPTION:
  *    Loads conversion table of appropriate endianess from external file
- *    and initializes 'iconv_ccs_desc_t' table description structure.
- *    If 'direction' is 0 - load "To UCS" table, else load "From UCS"
- *    table.
+ *    and initializes 'fp->desc' table description structure.
+ *    If 'fp->direction' is 0 - load "To UCS" table, else load "From UCS"
+ *    table.  If the system has mmap, the file is mapped into memory,
+ *    otherwise the table is read into allocated memory.
  *
  * RETURN:
- *    iconv_ccs_desc_t * pointer is success, NULL if failure.
+ *    0 if success, -1 if failure.
  */
-static const iconv_ccs_desc_t *
-load_file (struct _reent *rptr,
-                  const char *name,
-                  int direction)
+static int
+read_file (struct _reent *rptr,
+                  ccs_file_t *fp)
 {
   int fd;
   const unsigned char *buf;
   int tbllen, hdrlen;
   off_t off;
   const char *fname;
-  iconv_ccs_desc_t *ccsp = NULL;
-  int nmlen = strlen(name);
+  iconv_ccs_desc_t *ccsp = &fp->desc;
+  int res = -1;
+  int nmlen = strlen(fp->name);
   /* Since CCS table name length can vary - it is aligned (by adding extra
    * bytes to it's end) to 4-byte boundary. */
   int alignment = nmlen & 3 ? 4 - (nmlen & 3) : 0;
-  
-  nmlen = strlen(name);
+#ifdef HAVE_FILE_MMAP
+  struct stat st;
+  void *map;
+#endif
   
   hdrlen = nmlen + EXTTABLE_HEADER_LEN + alignment;
 
-  if ((fname = _iconv_nls_construct_filename (rptr, name, ICONV_SUBDIR,
+  if ((fname = _iconv_nls_construct_filename (rptr, fp->name, ICONV_SUBDIR,
                                               ICONV_DATA_EXT)) == NULL)
-    return NULL;
+    return -1;
   
   if ((fd = _open_r (rptr, fname, O_RDONLY, S_IRUSR)) == -1)
     goto error1;
@@ -485,22 +801,19 @@ load_file (struct _reent *rptr,
 
   if (_16BIT_ELT (EXTTABLE_VERSION_OFF) != TABLE_VERSION_1
       || _32BIT_ELT (EXTTABLE_CCSNAME_LEN_OFF) != nmlen
-      || strncmp (buf + EXTTABLE_CCSNAME_OFF, name, nmlen) != 0)
+      || strncmp (buf + EXTTABLE_CCSNAME_OFF, fp->name, nmlen) != 0)
     goto error3; /* Bad file */
 
-  if ((ccsp = (iconv_ccs_desc_t *)
-           _calloc_r (rptr, 1, sizeof (iconv_ccs_desc_t))) == NULL)
-    goto error3;
-  
   ccsp->bits = _16BIT_ELT (EXTTABLE_BITS_OFF);
   ccsp->type = TABLE_EXTERNAL;
+  ccsp->direct = NULL;
 
   /* Add 4-byte alignment to name length */
   nmlen += alignment;
 
   if (ccsp->bits == TABLE_8BIT)
     {
-      if (direction == 0) /* Load "To UCS" table */
+      if (fp->direction == 0) /* Load "To UCS" table */
         {
           off = (off_t)_32BIT_ELT (nmlen + EXTTABLE_TO_SPEED_OFF);
           tbllen = _32BIT_ELT (nmlen + EXTTABLE_TO_SPEED_LEN_OFF);
@@ -513,7 +826,7 @@ load_file (struct _reent *rptr,
     }
   else if (ccsp->bits == TABLE_16BIT)
     {
-      if (direction == 0) /* Load "To UCS" table */
+      if (fp->direction == 0) /* Load "To UCS" table */
         {
 #ifdef TABLE_USE_SIZE_OPTIMIZATION
           off = (off_t)_32BIT_ELT (nmlen + EXTTABLE_TO_SIZE_OFF);
@@ -540,45 +853,101 @@ load_file (struct _reent *rptr,
 #endif
     }
   else
-    goto error4; /* Bad file */
+    goto error3; /* Bad file */
 
   if (off == EXTTABLE_NO_TABLE)
-    goto error4; /* No correspondent table in file */
-
-  if ((ccsp->tbl = (ucs2_t *)_malloc_r (rptr, tbllen)) == NULL)
-    goto error4;
-
-  if (_lseek_r (rptr, fd, off, SEEK_SET) == (off_t)-1
-      || _read_r (rptr, fd, (void *)ccsp->tbl, tbllen) != tbllen)
-    goto error5;
-
-  goto normal_exit;
+    goto error3; /* No correspondent table in file */
+
+#ifdef HAVE_FILE_MMAP
+  /* The whole file stays mapped; tables are 2-byte aligned in it. */
+  if ((off & 1) == 0
+      && _fstat_r (rptr, fd, &st) == 0
+      && off + tbllen <= st.st_size
+      && (map = mmap (NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE,
+                      fd, 0)) != MAP_FAILED)
+    {
+      ccsp->tbl = (const __uint16_t *)((const char *)map + off);
+      res = 0;
+    }
+  else
+#endif
+  if ((ccsp->tbl = (ucs2_t *)_malloc_r (rptr, tbllen)) != NULL)
+    {
+      if (_lseek_r (rptr, fd, off, SEEK_SET) != (off_t)-1
+          && _read_r (rptr, fd, (void *)ccsp->tbl, tbllen) == tbllen)
+        res = 0;
+      else
+        _free_r (rptr, (void *)ccsp->tbl);
+    }
 
-error5:
-  _free_r (rptr, (void *)ccsp->tbl);
-  ccsp->tbl = NULL;
-error4:
-  _free_r (rptr, (void *)ccsp);
-  ccsp = NULL;
 error3:
-normal_exit:
   _free_r (rptr, (void *)buf);
 error2:
-  if (_close_r (rptr, fd) == -1)
+  _close_r (rptr, fd);
+error1:
+  _free_r (rptr, (void *)fname);
+  return res;
+}
+
+/*
+ * load_file - get conversion table from external file.
+ *
+ * PARAMETERS:
+ *    struct _reent *rptr - reent structure of current thread/process.
+ *    const char *name - encoding name.
+ *    int direction - conversion direction.
+ *
+ * DESCRIPTION:
+ *    Returns new 'iconv_ccs_desc_t' table description structure for the
+ *    external table of 'name' encoding. If 'direction' is 0 - for "To UCS"
+ *    table, else for "From UCS" table.  The table is loaded by read_file
+ *    the first time it is needed and then shared.
+ *
+ * RETURN:
+ *    iconv_ccs_desc_t * pointer is success, NULL if failure.
+ */
+static iconv_ccs_desc_t *
+load_file (struct _reent *rptr,
+                  const char *name,
+                  int direction)
+{
+  ccs_file_t *fp;
+  iconv_ccs_desc_t *ccsp = NULL;
+
+  TABLE_LOCK;
+
+  for (fp = ccs_files; fp != NULL; fp = fp->next)
+    if (fp->direction == direction && strcmp (fp->name, name) == 0)
+      break;
+
+  if (fp == NULL
+      && (fp = (ccs_file_t *)
+               _malloc_r (rptr, sizeof (ccs_file_t) + strlen (name))) != NULL)
     {
-      if (ccsp != NULL)
+      strcpy (fp->name, name);
+      fp->direction = direction;
+      if (read_file (rptr, fp) == 0)
+        {
+          fp->next = ccs_files;
+          ccs_files = fp;
+        }
+      else
         {
-          if (ccsp->tbl != NULL)
-            _free_r (rptr, (void *)ccsp->tbl);
-          _free_r (rptr, (void *)ccsp);
+          _free_r (rptr, (void *)fp);
+          fp = NULL;
         }
-      ccsp = NULL;
     }
-error1:
-  _free_r (rptr, (void *)fname);
+
+  if (fp != NULL
+      && (ccsp = (iconv_ccs_desc_t *)
+                 _malloc_r (rptr, sizeof (iconv_ccs_desc_t))) != NULL)
+    *ccsp = fp->desc;
+
+  TABLE_UNLOCK;
+
   return ccsp;
 }
-#endif
+#endif /* _ICONV_ENABLE_EXTERNAL_CCS */
 
 #endif /* ICONV_TO_UCS_CES_TABLE || ICONV_FROM_UCS_CES_TABLE */
 
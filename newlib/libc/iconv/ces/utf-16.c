@@ -37,6 +37,7 @@
 #include "../lib/local.h"
 #include "../lib/ucsconv.h"
 #include "../lib/endian.h"
+#include "utf-8.h"
 
 /*
  * On input UTF-16 converter interpret BOM and uses Big Endian byte order if BOM
@@ -57,6 +58,19 @@
 #define UTF_16BE "utf_16be"
 #define UTF_16LE "utf_16le"
 
+/*
+ * The block and direct converters work in the byte order known from the
+ * state, and leave the BOM to the per-character functions: they do
+ * nothing before the input byte order is known or the output BOM written.
+ * UTF16_LO gives the offset of the low byte of a 16-bit code: 0 in little
+ * endian byte order, 1 in big endian.
+ */
+#if (BYTE_ORDER == LITTLE_ENDIAN)
+#  define UTF16_LO(state) ((state) == UTF16_BIG_ENDIAN)
+#else
+#  define UTF16_LO(state) ((state) != UTF16_LITTLE_ENDIAN)
+#endif
+
 static size_t
 utf_16_close (struct _reent *rptr,
                      void *data)
@@ -163,6 +177,120 @@ utf_16_convert_from_ucs (void *data,
 
   return bytes;
 }
+
+/*
+ * Stores 'in' at 'cp' if it fits into 'left' bytes, with the low bytes of
+ * the 16-bit codes at offset 'lo'.  Returns the number of bytes written,
+ * or 0 if 'in' does not fit or is left to utf_16_convert_from_ucs.
+ */
+static __inline int
+utf_16_put (unsigned char *cp,
+                   size_t left,
+                   ucs4_t in,
+                   int lo)
+{
+  ucs2_t w1, w2;
+
+  if (in < 0x00010000)
+    {
+      if (left < 2 || (in >= 0x0000D800 && in <= 0x0000DFFF)
+          || in == 0x0000FFFF || in == 0x0000FFFE)
+        return 0;
+      cp[lo] = (unsigned char)in;
+      cp[!lo] = (unsigned char)(in >> 8);
+      return 2;
+    }
+
+  if (left < 4 || in > 0x0010FFFF)
+    return 0;
+  in -= 0x00010000;
+  w1 = ((ucs2_t)((in >> 10)) & 0x03FF) | 0xD800;
+  w2 = (ucs2_t)(in & 0x000003FF) | 0xDC00;
+  cp[lo] = (unsigned char)w1;
+  cp[!lo] = (unsigned char)(w1 >> 8);
+  cp[2 + lo] = (unsigned char)w2;
+  cp[2 + !lo] = (unsigned char)(w2 >> 8);
+  return 4;
+}
+
+static size_t
+utf_16_convert_from_ucs_block (void *data,
+                                      const ucs4_t *in,
+                                      size_t n,
+                                      unsigned char **outbuf,
+                                      size_t *outbytesleft)
+{
+  int state = *(int *)data;
+  int lo = UTF16_LO (state);
+  unsigned char *cp = *outbuf;
+  size_t left = *outbytesleft;
+  size_t i;
+  int bytes;
+
+  if (state == UTF16_SYSTEM_ENDIAN)
+    return 0;
+
+  for (i = 0; i < n; i++)
+    {
+      if ((bytes = utf_16_put (cp, left, in[i], lo)) == 0)
+        break;
+      cp += bytes;
+      left -= bytes;
+    }
+
+  *outbuf = cp;
+  *outbytesleft = left;
+  return i;
+}
+
+#if defined (ICONV_TO_UCS_CES_UTF_8)
+static size_t
+utf_16_convert_from_utf_8 (void *data,
+                                  const unsigned char **inbuf,
+                                  size_t *inbytesleft,
+                                  unsigned char **outbuf,
+                                  size_t *outbytesleft)
+{
+  int state = *(int *)data;
+  int lo = UTF16_LO (state);
+  const unsigned char *in = *inbuf;
+  unsigned char *cp = *outbuf;
+  size_t inleft = *inbytesleft;
+  size_t outleft = *outbytesleft;
+  size_t i;
+  ucs4_t ch;
+  int bytes, outbytes;
+
+  if (state == UTF16_SYSTEM_ENDIAN)
+    return 0;
+
+  for (i = 0; inleft > 0; i++)
+    {
+      if (*in < 0x80 && outleft >= 2)
+        {
+          cp[lo] = *in++;
+          cp[!lo] = 0;
+          cp += 2;
+          inleft--;
+          outleft -= 2;
+          continue;
+        }
+      if ((bytes = utf_8_decode (in, inleft, &ch)) == 0
+          || (outbytes = utf_16_put (cp, outleft, ch, lo)) == 0)
+        break;
+      in += bytes;
+      inleft -= bytes;
+      cp += outbytes;
+      outleft -= outbytes;
+    }
+
+  *inbuf = in;
+  *inbytesleft = inleft;
+  *outbuf = cp;
+  *outbytesleft = outleft;
+  return i;
+}
+#endif /* ICONV_TO_UCS_CES_UTF_8 */
 #endif /* ICONV_FROM_UCS_CES_UTF_16 */
 
 #if defined (ICONV_TO_UCS_CES_UTF_16)
@@ -260,6 +388,109 @@ utf_16_convert_to_ucs (void *data,
   
   return res;
 }
+
+/*
+ * Reads the character at 'in', of at most 'left' bytes, with the low bytes
+ * of the 16-bit codes at offset 'lo'.  Returns the number of bytes read,
+ * or 0 if it is invalid or incomplete and left to utf_16_convert_to_ucs.
+ */
+static __inline int
+utf_16_get (const unsigned char *in,
+                   size_t left,
+                   ucs4_t *res,
+                   int lo)
+{
+  ucs2_t w1, w2;
+
+  if (left < 2)
+    return 0;
+  w1 = (ucs2_t)in[lo] | ((ucs2_t)in[!lo] << 8);
+  if (w1 < 0xD800 || w1 > 0xDFFF)
+    {
+      if (w1 == 0xFFFF || w1 == 0xFFFE)
+        return 0;
+      *res = (ucs4_t)w1;
+      return 2;
+    }
+
+  if (left < 4 || w1 > 0xDBFF)
+    return 0;
+  w2 = (ucs2_t)in[2 + lo] | ((ucs2_t)in[2 + !lo] << 8);
+  if (w2 < 0xDC00 || w2 > 0xDFFF)
+    return 0;
+  *res = ((ucs4_t)(w2 & 0x03FF) | ((ucs4_t)(w1 & 0x03FF) << 10)) + 0x00010000;
+  return 4;
+}
+
+static size_t
+utf_16_convert_to_ucs_block (void *data,
+                                    const unsigned char **inbuf,
+                                    size_t *inbytesleft,
+                                    ucs4_t *out,
+                                    size_t n)
+{
+  int state = *(int *)data;
+  int lo = UTF16_LO (state);
+  const unsigned char *in = *inbuf;
+  size_t left = *inbytesleft;
+  size_t i;
+  int bytes;
+
+  if (state == UTF16_UNDEFINED)
+    return 0;
+
+  for (i = 0; i < n; i++)
+    {
+      if ((bytes = utf_16_get (in, left, &out[i], lo)) == 0)
+        break;
+      in += bytes;
+      left -= bytes;
+    }
+
+  *inbuf = in;
+  *inbytesleft = left;
+  return i;
+}
+
+#if defined (ICONV_FROM_UCS_CES_UTF_8)
+static size_t
+utf_16_convert_to_utf_8 (void *data,
+                                const unsigned char **inbuf,
+                                size_t *inbytesleft,
+                                unsigned char **outbuf,
+                                size_t *outbytesleft)
+{
+  int state = *(int *)data;
+  int lo = UTF16_LO (state);
+  const unsigned char *in = *inbuf;
+  unsigned char *cp = *outbuf;
+  size_t inleft = *inbytesleft;
+  size_t outleft = *outbytesleft;
+  size_t i;
+  ucs4_t ch;
+  int bytes, outbytes;
+
+  if (state == UTF16_UNDEFINED)
+    return 0;
+
+  for (i = 0; ; i++)
+    {
+      if ((bytes = utf_16_get (in, inleft, &ch, lo)) == 0
+          || (outbytes = utf_8_encode (cp, outleft, ch)) == 0)
+        break;
+      in += bytes;
+      inleft -= bytes;
+      cp += outbytes;
+      outleft -= outbytes;
+    }
+
+  *inbuf = in;
+  *inbytesleft = inleft;
+  *outbuf = cp;
+  *outbytesleft = outleft;
+  return i;
+}
+#endif /* ICONV_FROM_UCS_CES_UTF_8 */
 #endif /* ICONV_TO_UCS_CES_UTF_16 */
 
 static int
@@ -278,7 +509,13 @@ _iconv_to_ucs_ces_handlers_utf_16 =
   NULL,
   NULL,
   NULL,
-  utf_16_convert_to_ucs
+  utf_16_convert_to_ucs,
+  utf_16_convert_to_ucs_block,
+#if defined (ICONV_FROM_UCS_CES_UTF_8)
+  utf_16_convert_to_utf_8
+#else
+  NULL
+#endif
 };
 #endif
 
@@ -292,7 +529,13 @@ _iconv_from_ucs_ces_handlers_utf_16 =
   NULL,
   NULL,
   NULL,
-  utf_16_convert_from_ucs
+  utf_16_convert_from_ucs,
+  utf_16_convert_from_ucs_block,
+#if defined (ICONV_TO_UCS_CES_UTF_8)
+  utf_16_convert_from_utf_8
+#else
+  NULL
+#endif
 };
 #endif
 
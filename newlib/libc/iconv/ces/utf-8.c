@@ -33,6 +33,7 @@
 #include <sys/types.h>
 #include "../lib/local.h"
 #include "../lib/ucsconv.h"
+#include "utf-8.h"
 
 #define UTF8_MB_CUR_MAX 6
 
@@ -120,6 +121,37 @@ convert_from_ucs (void *data,
   
   return bytes;
 }
+
+static size_t
+convert_from_ucs_block (void *data,
+                               const ucs4_t *in,
+                               size_t n,
+                               unsigned char **outbuf,
+                               size_t *outbytesleft)
+{
+  unsigned char *cp = *outbuf;
+  size_t left = *outbytesleft;
+  size_t i;
+  int bytes;
+
+  for (i = 0; i < n; i++)
+    {
+      if (in[i] < 0x80 && left > 0)
+        {
+          *cp++ = (unsigned char)in[i];
+          left--;
+          continue;
+        }
+      if ((bytes = utf_8_encode (cp, left, in[i])) == 0)
+        break;
+      cp += bytes;
+      left -= bytes;
+    }
+
+  *outbuf = cp;
+  *outbytesleft = left;
+  return i;
+}
 #endif /* ICONV_FROM_UCS_CES_UTF_8 */
 
 #if defined (ICONV_TO_UCS_CES_UTF_8)
@@ -254,6 +286,37 @@ convert_to_ucs (void *data,
 
   return res;
 }
+
+static size_t
+convert_to_ucs_block (void *data,
+                             const unsigned char **inbuf,
+                             size_t *inbytesleft,
+                             ucs4_t *out,
+                             size_t n)
+{
+  const unsigned char *in = *inbuf;
+  size_t left = *inbytesleft;
+  size_t i;
+  int bytes;
+
+  for (i = 0; i < n && left > 0; i++)
+    {
+      if (*in < 0x80)
+        {
+          out[i] = *in++;
+          left--;
+          continue;
+        }
+      if ((bytes = utf_8_decode (in, left, &out[i])) == 0)
+        break;
+      in += bytes;
+      left -= bytes;
+    }
+
+  *inbuf = in;
+  *inbytesleft = left;
+  return i;
+}
 #endif /* ICONV_TO_UCS_CES_UTF_8 */
 
 static int
@@ -272,7 +335,9 @@ _iconv_to_ucs_ces_handlers_utf_8 =
   NULL,
   NULL,
   NULL,
-  convert_to_ucs
+  convert_to_ucs,
+  convert_to_ucs_block,
+  NULL
 };
 #endif
 
@@ -286,7 +351,9 @@ _iconv_from_ucs_ces_handlers_utf_8 =
   NULL,
   NULL,
   NULL,
-  convert_from_ucs
+  convert_from_ucs,
+  convert_from_ucs_block,
+  NULL
 };
 #endif
 
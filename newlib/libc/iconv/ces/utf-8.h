@@ -0,0 +1,114 @@
+/*
+ * utf-8.h
+ *
+ * UTF-8 helpers for the block and direct converters of the CES modules.
+ * They handle the sequences of 1 to 4 bytes with the same rules as the
+ * UTF-8 CES converter, and return 0 for everything else, which is then
+ * left to the converter's per-character functions: invalid, incomplete
+ * and 5 or 6 byte sequences, UTF-16 surrogates, U'FFFE and U'FFFF, and
+ * output that does not fit.
+ */
+#ifndef __ICONV_CES_UTF_8_H__
+#define __ICONV_CES_UTF_8_H__
+
+#include <_ansi.h>
+#include <sys/types.h>
+#include "../lib/local.h"
+
+/*
+ * utf_8_decode - decode the character at 'in', of at most 'left' bytes
+ * ('left' > 0), into '*res'.  Returns the length of its sequence, or 0.
+ */
+static __inline int
+utf_8_decode (const unsigned char *in,
+              size_t left,
+              ucs4_t *res)
+{
+  ucs4_t c = in[0];
+
+  if (c < 0x80)
+    {
+      *res = c;
+      return 1;
+    }
+  if (c < 0xC2) /* Continuation byte or overlong sequence */
+    return 0;
+  if (c < 0xE0)
+    {
+      if (left < 2 || (in[1] & 0xC0) != 0x80)
+        return 0;
+      *res = ((c & 0x1F) << 6) | (in[1] & 0x3F);
+      return 2;
+    }
+  if (c < 0xF0)
+    {
+      if (left < 3 || (in[1] & 0xC0) != 0x80 || (in[2] & 0xC0) != 0x80)
+        return 0;
+      c = ((c & 0x0F) << 12) | ((ucs4_t)(in[1] & 0x3F) << 6) | (in[2] & 0x3F);
+      if (c < 0x800 || (c >= 0xD800 && c <= 0xDFFF) || c >= 0xFFFE)
+        return 0;
+      *res = c;
+      return 3;
+    }
+  if (c < 0xF8)
+    {
+      if (left < 4 || (in[1] & 0xC0) != 0x80 || (in[2] & 0xC0) != 0x80
+          || (in[3] & 0xC0) != 0x80)
+        return 0;
+      c = ((c & 0x07) << 18) | ((ucs4_t)(in[1] & 0x3F) << 12)
+        | ((ucs4_t)(in[2] & 0x3F) << 6) | (in[3] & 0x3F);
+      if (c < 0x10000)
+        return 0;
+      *res = c;
+      return 4;
+    }
+  return 0;
+}
+
+/*
+ * utf_8_encode - encode 'in' into 'out', which has 'left' bytes of room.
+ * Returns the number of bytes written, or 0.
+ */
+static __inline int
+utf_8_encode (unsigned char *out,
+              size_t left,
+              ucs4_t in)
+{
+  if (in < 0x80)
+    {
+      if (left < 1)
+        return 0;
+      out[0] = (unsigned char)in;
+      return 1;
+    }
+  if (in < 0x800)
+    {
+      if (left < 2)
+        return 0;
+      out[0] = (unsigned char)((in >> 6) | 0xC0);
+      out[1] = (unsigned char)((in & 0x3F) | 0x80);
+      return 2;
+    }
+  if (in < 0x10000)
+    {
+      if (left < 3 || (in >= 0xD800 && in <= 0xDFFF) || in >= 0xFFFE)
+        return 0;
+      out[0] = (unsigned char)((in >> 12) | 0xE0);
+      out[1] = (unsigned char)(((in >> 6) & 0x3F) | 0x80);
+      out[2] = (unsigned char)((in & 0x3F) | 0x80);
+      return 3;
+    }
+  if (in < 0x200000)
+    {
+      if (left < 4)
+        return 0;
+      out[0] = (unsigned char)((in >> 18) | 0xF0);
+      out[1] = (unsigned char)(((in >> 12) & 0x3F) | 0x80);
+      out[2] = (unsigned char)(((in >> 6) & 0x3F) | 0x80);
+      out[3] = (unsigned char)((in & 0x3F) | 0x80);
+      return 4;
+    }
+  return 0;
+}
+
+#endif /* !__ICONV_CES_UTF_8_H__ */
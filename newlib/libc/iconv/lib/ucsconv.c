@@ -32,6 +32,10 @@
 #include "local.h"
 #include "conv.h"
 #include "ucsconv.h"
+#include "../ces/cesbi.h"
+
+/* Number of UCS-4 codes converted at once by the block functions */
+#define ICONV_UCS_BLOCK 128
 
 static int fake_data;
 
@@ -109,6 +113,24 @@ ucs_based_conversion_open (struct _reent *rptr,
   else
     uc->from_ucs.data = (void *)&fake_data;
 
+  /* Conversions from and to UTF-8 may skip UCS. */
+#ifdef ICONV_TO_UCS_CES_UTF_8
+  if (uc->to_ucs.handlers == &_iconv_to_ucs_ces_handlers_utf_8
+      && uc->from_ucs.handlers->convert_from_utf_8 != NULL)
+    {
+      uc->direct = uc->from_ucs.handlers->convert_from_utf_8;
+      uc->direct_data = uc->from_ucs.data;
+    }
+#endif
+#ifdef ICONV_FROM_UCS_CES_UTF_8
+  if (uc->from_ucs.handlers == &_iconv_from_ucs_ces_handlers_utf_8
+      && uc->to_ucs.handlers->convert_to_utf_8 != NULL)
+    {
+      uc->direct = uc->to_ucs.handlers->convert_to_utf_8;
+      uc->direct_data = uc->to_ucs.data;
+    }
+#endif
+
   return uc;
 
 error:
@@ -141,6 +163,54 @@ ucs_based_conversion_close (struct _reent *rptr,
 }
 
 
+/*
+ * Converts a run of characters through a buffer of UCS-4 codes, if both
+ * CES converters have block functions.  Returns the number of characters
+ * converted; the character after them, if any, is left to the
+ * per-character functions.
+ */
+static size_t
+convert_block (iconv_ucs_conversion_t *uc,
+                      const unsigned char **inbuf,
+                      size_t *inbytesleft,
+                      unsigned char **outbuf,
+                      size_t *outbytesleft)
+{
+  ucs4_t ucs[ICONV_UCS_BLOCK];
+  const unsigned char *inbuf_save = *inbuf;
+  size_t inbytesleft_save = *inbytesleft;
+  size_t n, m;
+
+  if (uc->to_ucs.handlers->convert_to_ucs_block == NULL
+      || uc->from_ucs.handlers->convert_from_ucs_block == NULL)
+    return 0;
+
+  n = uc->to_ucs.handlers->convert_to_ucs_block (uc->to_ucs.data,
+                                                 inbuf, inbytesleft,
+                                                 ucs, ICONV_UCS_BLOCK);
+  if (n == 0)
+    return 0;
+
+  m = uc->from_ucs.handlers->convert_from_ucs_block (uc->from_ucs.data,
+                                                     ucs, n,
+                                                     outbuf, outbytesleft);
+  if (m < n)
+    {
+      /*
+       * Only the first m characters are written: convert the input again
+       * up to them, which is where the next character starts.
+       */
+      *inbuf = inbuf_save;
+      *inbytesleft = inbytesleft_save;
+      uc->to_ucs.handlers->convert_to_ucs_block (uc->to_ucs.data,
+                                                 inbuf, inbytesleft,
+                                                 ucs, m);
+    }
+
+  return m;
+}
+
+
 static size_t
 ucs_based_conversion_convert (struct _reent *rptr,
                  void *data,
@@ -168,6 +238,21 @@ ucs_based_conversion_convert (struct _reent *rptr,
           return (size_t)-1;
         }
 
+      /*
+       * Convert as much as possible at once, then the first character
+       * that could not be, if any, one at a time below.
+       */
+      if (!(flags & ICONV_DONT_SAVE_BIT))
+        {
+          if (uc->direct != NULL
+              && uc->direct (uc->direct_data, inbuf, inbytesleft,
+                             outbuf, outbytesleft) > 0)
+            continue;
+          if (convert_block (uc, inbuf, inbytesleft,
+                             outbuf, outbytesleft) > 0)
+            continue;
+        }
+
       ch = uc->to_ucs.handlers->convert_to_ucs (uc->to_ucs.data,
                                                 inbuf, inbytesleft);
 
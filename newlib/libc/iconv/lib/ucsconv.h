@@ -158,6 +158,56 @@ typedef struct
   ucs4_t (*convert_to_ucs) (void *data,
                                  const unsigned char **inbuf,
                                  size_t *inbytesleft);
+
+  /*
+   * convert_to_ucs_block - convert a run of characters to UCS.
+   *
+   * PARAMETERS:
+   *   void *data                  - CES converter-specific data;
+   *   const unsigned char **inbuf - buffer with input byte sequence;
+   *   size_t *inbytesleft         - input buffer bytes count;
+   *   ucs4_t *out                 - buffer for the resulting UCS codes;
+   *   size_t n                    - maximum number of codes to store.
+   *
+   * DESCRIPTION:
+   *   Converts characters like convert_to_ucs does, as long as they are
+   *   valid and simple enough for the converter, and stops before the
+   *   first one that is not; that one is then left to convert_to_ucs.
+   *   Never changes the shift state, so that converting the same input
+   *   again gives the same codes.  May be NULL.
+   *
+   * RETURN:
+   *   Returns the number of codes stored in 'out'.
+   */
+  size_t (*convert_to_ucs_block) (void *data,
+                                  const unsigned char **inbuf,
+                                  size_t *inbytesleft,
+                                  ucs4_t *out,
+                                  size_t n);
+
+  /*
+   * convert_to_utf_8 - convert a run of characters directly to UTF-8.
+   *
+   * PARAMETERS:
+   *   void *data                  - CES converter-specific data;
+   *   const unsigned char **inbuf - buffer with input byte sequence;
+   *   size_t *inbytesleft         - input buffer bytes count;
+   *   unsigned char **outbuf      - output buffer for the result;
+   *   size_t *outbytesleft        - output buffer bytes count.
+   *
+   * DESCRIPTION:
+   *   Same as convert_to_ucs_block followed by the UTF-8 CES converter,
+   *   without the UCS codes in between.  Stops as well before the first
+   *   character which does not fit into the output buffer.  May be NULL.
+   *
+   * RETURN:
+   *   Returns the number of characters converted.
+   */
+  size_t (*convert_to_utf_8) (void *data,
+                              const unsigned char **inbuf,
+                              size_t *inbytesleft,
+                              unsigned char **outbuf,
+                              size_t *outbytesleft);
 } iconv_to_ucs_ces_handlers_t;
 
 
@@ -219,6 +269,55 @@ typedef struct
                                    ucs4_t in,
                                    unsigned char **outbuf,
                                    size_t *outbytesleft);
+
+  /*
+   * convert_from_ucs_block - convert a run of UCS characters.
+   *
+   * PARAMETERS:
+   *   void *data             - CES converter-specific data;
+   *   const ucs4_t *in       - input UCS-4 characters;
+   *   size_t n               - number of input characters;
+   *   unsigned char **outbuf - output buffer for the result;
+   *   size_t *outbytesleft   - output buffer bytes count.
+   *
+   * DESCRIPTION:
+   *   Converts characters like convert_from_ucs does, and stops before the
+   *   first one which has no corresponding character, which does not fit
+   *   into the output buffer or which the converter leaves to
+   *   convert_from_ucs.  Never changes the shift state.  May be NULL.
+   *
+   * RETURN:
+   *   Returns the number of characters converted.
+   */
+  size_t (*convert_from_ucs_block) (void *data,
+                                    const ucs4_t *in,
+                                    size_t n,
+                                    unsigned char **outbuf,
+                                    size_t *outbytesleft);
+
+  /*
+   * convert_from_utf_8 - convert a run of UTF-8 characters directly.
+   *
+   * PARAMETERS:
+   *   void *data                  - CES converter-specific data;
+   *   const unsigned char **inbuf - buffer with UTF-8 input;
+   *   size_t *inbytesleft         - input buffer bytes count;
+   *   unsigned char **outbuf      - output buffer for the result;
+   *   size_t *outbytesleft        - output buffer bytes count.
+   *
+   * DESCRIPTION:
+   *   Same as the UTF-8 CES converter followed by convert_from_ucs_block,
+   *   without the UCS codes in between.  Stops as well before the first
+   *   input sequence which is invalid or incomplete.  May be NULL.
+   *
+   * RETURN:
+   *   Returns the number of characters converted.
+   */
+  size_t (*convert_from_utf_8) (void *data,
+                                const unsigned char **inbuf,
+                                size_t *inbytesleft,
+                                unsigned char **outbuf,
+                                size_t *outbytesleft);
 } iconv_from_ucs_ces_handlers_t;
 
 
@@ -259,7 +358,10 @@ typedef struct
  *
  * Defines special type of conversion where every character is first
  * converted into UCS-4 (UCS-2 for table-driven), and after this the
- * resulting UCS character is converted to destination encoding. 
+ * resulting UCS character is converted to destination encoding.  Runs of
+ * characters go through a buffer of UCS-4 codes instead when both CES
+ * converters have block functions, or directly from one encoding into the
+ * other when there is a direct converter for them.
  * UCS-based conversion is composed of two *converters*, defined by 
  * iconv_ces_t structure. The iconv_ucs_conversion_t object is referred
  * from iconv_conversion_t object using 'data' field.
@@ -276,6 +378,18 @@ typedef struct
 
   /* UCS -> destination encoding CES converter. */
   iconv_from_ucs_ces_desc_t from_ucs;
+
+  /*
+   * Direct converter between the two encodings, which skips UCS, and its
+   * data; NULL if there is none.  Only conversions from and to UTF-8 have
+   * one, see convert_to_utf_8 and convert_from_utf_8.
+   */
+  size_t (*direct) (void *data,
+                    const unsigned char **inbuf,
+                    size_t *inbytesleft,
+                    unsigned char **outbuf,
+                    size_t *outbytesleft);
+  void *direct_data;
 } iconv_ucs_conversion_t;
 
 
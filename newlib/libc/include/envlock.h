@@ -12,4 +12,9 @@
 void __env_lock (struct _reent *reent);
 void __env_unlock (struct _reent *reent);
 
+/* Keep the getenv hash index in step with setenv/unsetenv; ENV_LOCK
+   must be held.  */
+void __env_index_update (char **old_env, int offset);
+void __env_index_reset (void);
+
 #endif /* _INCLUDE_ENVLOCK_H_ */
@@ -58,6 +58,14 @@ typedef struct {
 	void *(*gl_opendir)(const char *);
 	int (*gl_lstat)(const char *, struct stat *);
 	int (*gl_stat)(const char *, struct stat *);
+
+	/*
+	 * Called for each match when GLOB_STREAM is given, with
+	 * gl_matcharg as its second argument.  A nonzero return
+	 * stops the walk and makes glob return GLOB_ABEND.
+	 */
+	int (*gl_matchfunc)(const char *, void *);
+	void *gl_matcharg;
 } glob_t;
 
 #define	GLOB_APPEND	0x0001	/* Append to output from previous call. */
@@ -74,6 +82,7 @@ typedef struct {
 #define	GLOB_QUOTE	0x0400	/* Quote special chars with \. */
 #define	GLOB_TILDE	0x0800	/* Expand tilde names from the passwd file. */
 #define	GLOB_LIMIT	0x1000	/* limit number of returned paths */
+#define	GLOB_STREAM	0x2000	/* Pass matches to gl_matchfunc, unsorted. */
 
 /* backwards compatibility, this is the old name for this option */
 #define GLOB_MAXPATH	GLOB_LIMIT
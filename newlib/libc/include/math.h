@@ -505,6 +505,33 @@ extern _LONG_DOUBLE rintl (_LONG_DOUBLE);
 extern long int lrintl (_LONG_DOUBLE);
 extern long long int llrintl (_LONG_DOUBLE);
 #endif /* __i386__ */
+#ifdef __x86_64__
+/* Native 80-bit versions, see libm/machine/x86_64.  */
+extern long double atanl (long double);
+extern long double cosl (long double);
+extern long double sinl (long double);
+extern long double tanl (long double);
+extern long double ceill (long double);
+extern long double fabsl (long double);
+extern long double floorl (long double);
+extern long double log1pl (long double);
+extern long double expm1l (long double);
+extern long double rintl (long double);
+extern long double truncl (long double);
+extern long double log2l (long double);
+extern long double exp2l (long double);
+#ifndef _REENT_ONLY
+extern long double acosl (long double);
+extern long double asinl (long double);
+extern long double atan2l (long double, long double);
+extern long double expl (long double);
+extern long double logl (long double);
+extern long double log10l (long double);
+extern long double powl (long double, long double);
+extern long double fmodl (long double, long double);
+extern long double remainderl (long double, long double);
+#endif /* ! defined (_REENT_ONLY) */
+#endif /* __x86_64__ */
 #endif /* !_LDBL_EQ_DBL && !__CYGWIN__ */
 
 #endif /* __ISO_C_VISIBLE >= 1999 */
@@ -614,6 +641,26 @@ extern int *__signgam (void);
 
 #endif /* __BSD_VISIBLE */
 
+/* libm has vector variants of these (libm/common/v_math.h), which GCC can
+   call from vectorized loops under -ffast-math.  */
+#if defined (__FAST_MATH__) && !__OBSOLETE_MATH && __GNUC_PREREQ (9, 0) \
+    && !defined (__clang__) \
+    && (defined (__x86_64__) \
+	|| (defined (__aarch64__) && !defined (__ARM_FEATURE_SVE)))
+#define __VEC_MATH __attribute__ ((__simd__ ("notinbranch")))
+extern double exp (double) __VEC_MATH;
+extern double exp2 (double) __VEC_MATH;
+extern double log (double) __VEC_MATH;
+extern double (log2) (double) __VEC_MATH;
+extern double pow (double, double) __VEC_MATH;
+extern float expf (float) __VEC_MATH;
+extern float logf (float) __VEC_MATH;
+extern float powf (float, float) __VEC_MATH;
+extern float sinf (float) __VEC_MATH;
+extern float cosf (float) __VEC_MATH;
+#undef __VEC_MATH
+#endif
+
 _END_STD_C
 
 #ifdef __FAST_MATH__
@@ -338,6 +338,20 @@ extern bool_t xdr_u_longlong_t (XDR *, u_quad_t *);
 #endif /* ___int64_t_defined */
 extern u_long xdr_sizeof (xdrproc_t, void *);
 
+/*
+ * Bulk routines for fixed-length arrays of primitives; xdr_array and
+ * xdr_vector use them automatically for the matching element procs.
+ */
+extern bool_t xdr_int32_vector (XDR *, int32_t *, u_int);
+#if defined(___int64_t_defined)
+extern bool_t xdr_int64_vector (XDR *, int64_t *, u_int);
+#endif /* ___int64_t_defined */
+extern bool_t xdr_float_vector (XDR *, float *, u_int);
+extern bool_t xdr_double_vector (XDR *, double *, u_int);
+
+/* opaque data in place in the stream buffer, if it can be had */
+extern bool_t xdr_opaque_inline (XDR *, char **, u_int);
+
 /*
  * Common opaque bytes objects used by many rpc protocols;
  * declared here due to commonality.
@@ -379,6 +393,25 @@ extern bool_t xdrrec_skiprecord (XDR *);
 extern bool_t xdrrec_eof (XDR *);
 extern u_int xdrrec_readbytes (XDR *, caddr_t, u_int);
 
+/*
+ * Scatter/gather I/O for record streams.  The callbacks are like readv
+ * and writev; struct xdr_iovec has the layout of struct iovec so they
+ * can usually pass it straight through.  Large opaque data then moves
+ * between the caller's memory and the transport without a copy through
+ * the stream buffers.
+ */
+struct xdr_iovec
+{
+  void *iov_base;
+  size_t iov_len;
+};
+extern bool_t xdrrec_setiov (XDR *,
+                             int (*) (void *, const struct xdr_iovec *, int),
+                             int (*) (void *, const struct xdr_iovec *, int));
+
+/* grow the send buffer so records of this size go out in one write */
+extern bool_t xdrrec_sizehint (XDR *, u_int);
+
 /* free memory buffers for xdr */
 extern void xdr_free (xdrproc_t, void *);
 
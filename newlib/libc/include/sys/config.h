@@ -244,6 +244,7 @@
 #define __DYNAMIC_REENT__
 #define _REENT_GLOBAL_ATEXIT
 #define _REENT_GLOBAL_STDIO_STREAMS
+#define _TZ_THREAD_LOCAL _Thread_local
 #endif
 
 #ifndef __EXPORT
@@ -73,6 +73,19 @@ extern size_t strftime_l (char *__restrict _s, size_t _maxsize,
 			  const struct tm *__restrict _t, locale_t _l);
 #endif
 
+#if __MISC_VISIBLE
+typedef struct __strftime_plan strftime_plan_t;
+
+strftime_plan_t *strftime_compile (const char *_fmt);
+size_t	   strftime_exec (char *__restrict _s, size_t _maxsize,
+			  const strftime_plan_t *__restrict _plan,
+			  const struct tm *__restrict _t);
+size_t	   strftime_exec_l (char *__restrict _s, size_t _maxsize,
+			    const strftime_plan_t *__restrict _plan,
+			    const struct tm *__restrict _t, locale_t _l);
+void	   strftime_free (strftime_plan_t *_plan);
+#endif
+
 char	  *asctime_r 	(const struct tm *__restrict,
 				 char *__restrict);
 char	  *ctime_r 	(const time_t *, char *);
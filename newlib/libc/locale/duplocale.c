@@ -54,6 +54,10 @@ _duplocale_r (struct _reent *p, struct __locale_t *locobj)
   /* The "C" locale is used statically, never copied. */
   else if (locobj == __get_C_locale ())
     return __get_C_locale ();
+  /* Locale objects are shared, see newlocale, and so is a copy of the
+     global locale if another locale object has the same names. */
+  if ((new_locale = __get_shared_locale (locobj->categories)) != NULL)
+    return new_locale;
   /* Copy locale content. */
   tmp_locale = *locobj;
 #ifdef __HAVE_LOCALE_INFO__
@@ -75,7 +79,7 @@ _duplocale_r (struct _reent *p, struct __locale_t *locobj)
     goto error;
 
   *new_locale = tmp_locale;
-  return new_locale;
+  return __share_locale (p, new_locale);
 
 error:
   /* An error occured while we had already (potentially) allocated memory.
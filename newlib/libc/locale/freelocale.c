@@ -45,6 +45,9 @@ _freelocale_r (struct _reent *p, struct __locale_t *locobj)
   /* Sanity check.  The "C" locale is static, don't try to free it. */
   if (!locobj || locobj == __get_C_locale () || locobj == LC_GLOBAL_LOCALE)
     return;
+  /* Other users may still share the object. */
+  if (!__unshare_locale (locobj))
+    return;
 #ifdef __HAVE_LOCALE_INFO__
   for (int i = 1; i < _LC_LAST; ++i)
     if (locobj->lc_cat[i].buf)
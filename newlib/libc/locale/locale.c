@@ -929,6 +929,16 @@ restart:
       strcpy (loc->message_codeset, charset);
 #endif /* __HAVE_LOCALE_INFO__ */
       break;
+#ifndef __CYGWIN__
+    case LC_COLLATE:
+      /* The "C" locales, and every multibyte charset other than UTF-8,
+	 whose conversions do not give Unicode, collate by bytes.  Outside
+	 Cygwin these are JIS, EUCJP, SJIS and CP932. */
+      loc->collate_mbtowc = (locale[0] == 'C'
+			     || (mbc_max > 1 && charset[0] != 'U'))
+			    ? NULL : l_mbtowc;
+      break;
+#endif
 #ifdef __HAVE_LOCALE_INFO__
 #ifdef __CYGWIN__
   /* Right now only Cygwin supports a __collate_load_locale function at all. */
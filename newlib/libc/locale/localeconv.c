@@ -2,14 +2,12 @@
 #include <reent.h>
 #include "setlocale.h"
 
-struct lconv *
-__localeconv_l (struct __locale_t *locale)
+/* Sets the lconv of LOCALE from its numeric and monetary categories. */
+void
+__set_lconv (struct __locale_t *locale)
 {
-  struct lconv *lconv = &locale->lconv;
-  if (locale == __get_C_locale ())
-    return lconv;
-
 #ifdef __HAVE_LOCALE_INFO__
+  struct lconv *lconv = &locale->lconv;
   const struct lc_numeric_T *n = __get_numeric_locale (locale);
   const struct lc_monetary_T *m = __get_monetary_locale (locale);
 
@@ -47,7 +45,17 @@ __localeconv_l (struct __locale_t *locale)
   lconv->int_p_sign_posn = m->p_sign_posn[0];
 #endif /* !__HAVE_LOCALE_INFO_EXTENDED__ */
 #endif /* __HAVE_LOCALE_INFO__ */
-  return lconv;
+}
+
+struct lconv *
+__localeconv_l (struct __locale_t *locale)
+{
+  /* The objects made by newlocale and duplocale may be shared between
+     threads, so they get their lconv before that, in __share_locale.  Only
+     the global locale changes after it is made. */
+  if (locale == __get_global_locale () && locale != __get_C_locale ())
+    __set_lconv (locale);
+  return &locale->lconv;
 }
 
 struct lconv *
@@ -77,11 +77,112 @@ PORTABILITY
 #include <errno.h>
 #include <reent.h>
 #include <stdlib.h>
+#include <string.h>
+#include <sys/lock.h>
 #include "setlocale.h"
 
 #define LC_VALID_MASK	(LC_COLLATE_MASK | LC_CTYPE_MASK | LC_MONETARY_MASK \
 			 | LC_NUMERIC_MASK | LC_TIME_MASK | LC_MESSAGES_MASK)
 
+#ifdef _MB_CAPABLE
+/* Locale objects are never changed once made, so newlocale and duplocale
+   share one object between all the users of the same locale names,
+   counted in its refs, and freelocale only frees it when the last one
+   is done with it.  Creating a locale which is already in use is then
+   a lookup in the list of shared objects, without loading any category
+   again. */
+static struct __locale_t *shared_locales;
+
+#ifndef __SINGLE_THREAD__
+__LOCK_INIT(static, __locale_list_mutex);
+/* The dummy locks of <sys/lock.h> leave the lock variable unused. */
+#  define LIST_LOCK   ((void) __locale_list_mutex, \
+		       __lock_acquire (__locale_list_mutex))
+#  define LIST_UNLOCK __lock_release (__locale_list_mutex)
+#else
+#  define LIST_LOCK
+#  define LIST_UNLOCK
+#endif
+
+static struct __locale_t *
+find_locale (char categories[][ENCODING_LEN + 1])
+{
+  struct __locale_t *loc;
+  int i;
+
+  for (loc = shared_locales; loc; loc = loc->next)
+    {
+      for (i = 1; i < _LC_LAST; ++i)
+	if (strcmp (loc->categories[i], categories[i]))
+	  break;
+      if (i == _LC_LAST)
+	return loc;
+    }
+  return NULL;
+}
+
+/* Returns a new reference to the shared locale object with the names in
+   CATEGORIES, or NULL if there is none. */
+struct __locale_t *
+__get_shared_locale (char categories[][ENCODING_LEN + 1])
+{
+  struct __locale_t *loc;
+
+  LIST_LOCK;
+  if ((loc = find_locale (categories)) != NULL)
+    ++loc->refs;
+  LIST_UNLOCK;
+  return loc;
+}
+
+/* Shares the new locale object LOC, or frees it and returns the object
+   with the same names which was shared meanwhile by another thread. */
+struct __locale_t *
+__share_locale (struct _reent *p, struct __locale_t *loc)
+{
+  struct __locale_t *old;
+
+  /* localeconv must not write to an object other threads may use. */
+  __set_lconv (loc);
+  loc->refs = 1;
+  LIST_LOCK;
+  if ((old = find_locale (loc->categories)) != NULL)
+    ++old->refs;
+  else
+    {
+      loc->next = shared_locales;
+      shared_locales = loc;
+    }
+  LIST_UNLOCK;
+  if (old)
+    {
+      _freelocale_r (p, loc);
+      return old;
+    }
+  return loc;
+}
+
+/* Drops a reference to LOC, and returns 1 if it was the last one, after
+   taking LOC out of the list. */
+int
+__unshare_locale (struct __locale_t *loc)
+{
+  struct __locale_t **lp;
+  int last;
+
+  LIST_LOCK;
+  if ((last = (--loc->refs <= 0)))
+    for (lp = &shared_locales; *lp; lp = &(*lp)->next)
+      if (*lp == loc)
+	{
+	  *lp = loc->next;
+	  break;
+	}
+  LIST_UNLOCK;
+  return last;
+}
+#endif /* _MB_CAPABLE */
+
 struct __locale_t *
 _newlocale_r (struct _reent *p, int category_mask, const char *locale,
 	      struct __locale_t *base)
@@ -112,8 +213,6 @@ _newlocale_r (struct _reent *p, int category_mask, const char *locale,
       || (category_mask == LC_VALID_MASK
 	  && (!strcmp (locale, "C") || !strcmp (locale, "POSIX"))))
     return __get_C_locale ();
-  /* Start with setting all values to the default locale values. */
-  tmp_locale = *__get_C_locale ();
   /* Fill out new category strings. */
   for (i = 1; i < _LC_LAST; ++i)
     {
@@ -128,11 +227,18 @@ _newlocale_r (struct _reent *p, int category_mask, const char *locale,
 	      p->_errno = EINVAL;
 	      return NULL;
 	    }
-	  strcpy (new_categories[i], cat);
+	  /* "POSIX" is "C", which makes it easier to find shared
+	     locale objects. */
+	  strcpy (new_categories[i], strcmp (cat, "POSIX") ? cat : "C");
 	}
       else
 	strcpy (new_categories[i], base ? base->categories[i] : "C");
     }
+  /* If a locale object with these categories is in use, share it. */
+  if ((new_locale = __get_shared_locale (new_categories)) != NULL)
+    goto done;
+  /* Start with setting all values to the default locale values. */
+  tmp_locale = *__get_C_locale ();
   /* Now go over all categories and set them. */
   for (i = 1; i < _LC_LAST; ++i)
     {
@@ -149,12 +255,21 @@ _newlocale_r (struct _reent *p, int category_mask, const char *locale,
 	      tmp_locale.cjk_lang = base->cjk_lang;
 	      tmp_locale.ctype_ptr = base->ctype_ptr;
 	    }
+#ifndef __CYGWIN__
+	  if (i == LC_COLLATE)
+	    tmp_locale.collate_mbtowc = base->collate_mbtowc;
+#endif
 #ifdef __HAVE_LOCALE_INFO__
-	  /* Mark the values as "has still to be copied".  We do this in
-	     two steps to simplify freeing new locale types in case of a
-	     subsequent error. */
+	  /* The buffers of base may be shared with other users, so the
+	     category is loaded again, just as in duplocale. */
 	  tmp_locale.lc_cat[i].ptr = base->lc_cat[i].ptr;
-	  tmp_locale.lc_cat[i].buf = (void *) -1;
+	  if (base->lc_cat[i].buf)
+	    {
+	      tmp_locale.lc_cat[i].ptr = NULL;
+	      tmp_locale.categories[i][0] = '\0';  /* __loadlocale tests this! */
+	      if (!__loadlocale (&tmp_locale, i, new_categories[i]))
+		goto error;
+	    }
 #else /* !__HAVE_LOCALE_INFO__ */
 	  if (i == LC_CTYPE)
 	    strcpy (tmp_locale.ctype_codeset, base->ctype_codeset);
@@ -178,23 +293,12 @@ _newlocale_r (struct _reent *p, int category_mask, const char *locale,
   new_locale = (struct __locale_t *) _calloc_r (p, 1, sizeof *new_locale);
   if (!new_locale)
     goto error;
-  if (base)
-    {
-#ifdef __HAVE_LOCALE_INFO__
-      /* Step 2 of copying over..  Make sure to invalidate the copied buffer
-	 pointers in base, so the subsequent _freelocale_r (base) doesn't free
-	 the buffers now used in the new locale. */
-      for (i = 1; i < _LC_LAST; ++i)
-	if (tmp_locale.lc_cat[i].buf == (const void *) -1)
-	  {
-	    tmp_locale.lc_cat[i].buf = base->lc_cat[i].buf;
-	    base->lc_cat[i].ptr = base->lc_cat[i].buf = NULL;
-	  }
-#endif /* __HAVE_LOCALE_INFO__ */
-      _freelocale_r (p, base);
-    }
-
   *new_locale = tmp_locale;
+  new_locale = __share_locale (p, new_locale);
+
+done:
+  if (base)
+    _freelocale_r (p, base);
   return new_locale;
 
 error:
@@ -202,9 +306,7 @@ error:
      Free memory and return NULL.  errno is supposed to be set already. */
 #ifdef __HAVE_LOCALE_INFO__
   for (i = 1; i < _LC_LAST; ++i)
-    if (((1 << i) & category_mask) != 0
-	&& tmp_locale.lc_cat[i].buf
-	&& tmp_locale.lc_cat[i].buf != (const void *) -1)
+    if (tmp_locale.lc_cat[i].buf)
       {
 	_free_r (p, (void *) tmp_locale.lc_cat[i].ptr);
 	_free_r (p, tmp_locale.lc_cat[i].buf);
@@ -192,13 +192,29 @@ struct __locale_t
 #else
   struct __lc_cats	 lc_cat[_LC_LAST];
 #endif
+#ifndef __CYGWIN__
+  /* Conversion of the LC_COLLATE charset for strcoll and strxfrm, NULL
+     to collate by bytes. */
+  int			(*collate_mbtowc) (struct _reent *, wchar_t *,
+					   const char *, size_t, mbstate_t *);
+#endif
+  /* Users of a locale object made by newlocale or duplocale, which is
+     shared by all users of the same locale names, and the next shared
+     object. */
+  int			 refs;
+  struct __locale_t	*next;
 };
 
 #ifdef _MB_CAPABLE
 extern char *__loadlocale (struct __locale_t *, int, char *);
 extern const char *__get_locale_env(struct _reent *, int);
+extern struct __locale_t *__get_shared_locale (char [][ENCODING_LEN + 1]);
+extern struct __locale_t *__share_locale (struct _reent *,
+					  struct __locale_t *);
+extern int __unshare_locale (struct __locale_t *);
 #endif /* _MB_CAPABLE */
 
+extern void __set_lconv (struct __locale_t *);
 extern struct lconv *__localeconv_l (struct __locale_t *locale);
 
 extern size_t _wcsnrtombs_l (struct _reent *, char *, const wchar_t **,
@@ -393,6 +409,15 @@ __get_current_messages_locale (void)
 }
 #endif /* !__HAVE_LOCALE_INFO__ */
 
+/* Nonzero if LOCALE has the numeric data of the "C" locale, the decimal
+   point "." and no grouping, which the number conversions then need not
+   look up.  Always true without __HAVE_LOCALE_INFO__. */
+_ELIDABLE_INLINE int
+__numeric_locale_is_C (struct __locale_t *locale)
+{
+  return __get_numeric_locale (locale) == &_C_numeric_locale;
+}
+
 _ELIDABLE_INLINE const char *
 __locale_charset (struct __locale_t *locale)
 {
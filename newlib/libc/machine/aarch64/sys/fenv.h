@@ -29,10 +29,19 @@
 #ifndef	_FENV_H_
 #define	_FENV_H_
 
+#include <sys/cdefs.h>
 #include <sys/_types.h>
 
+/*
+ * libm's fenv.c defines __fenv_static to get the external definitions of
+ * <machine/fenv-fp.h>; other optimized code gets the inline versions of
+ * the most frequently called functions at the end of this file.
+ */
 #ifndef	__fenv_static
 #define	__fenv_static	static
+#if defined(__OPTIMIZE__) && !defined(__NO_INLINE__) && __GNUC_PREREQ__(4, 2)
+#define	__FENV_INLINE
+#endif
 #endif
 
 typedef	__uint64_t	fenv_t;
@@ -71,11 +80,11 @@ extern const fenv_t	*_fe_dfl_env;
 #define _FPUSW_SHIFT	8
 #define	_ENABLE_MASK	(FE_ALL_EXCEPT << _FPUSW_SHIFT)
 
-#define	__mrs_fpcr(__r)	__asm __volatile("mrs %0, fpcr" : "=r" (__r))
-#define	__msr_fpcr(__r)	__asm __volatile("msr fpcr, %0" : : "r" (__r))
+#define	__mrs_fpcr(__r)	__asm __volatile("mrs %0, fpcr" : "=r" (__r) : : "memory")
+#define	__msr_fpcr(__r)	__asm __volatile("msr fpcr, %0" : : "r" (__r) : "memory")
 
-#define	__mrs_fpsr(__r)	__asm __volatile("mrs %0, fpsr" : "=r" (__r))
-#define	__msr_fpsr(__r)	__asm __volatile("msr fpsr, %0" : : "r" (__r))
+#define	__mrs_fpsr(__r)	__asm __volatile("mrs %0, fpsr" : "=r" (__r) : : "memory")
+#define	__msr_fpsr(__r)	__asm __volatile("msr fpsr, %0" : : "r" (__r) : "memory")
 
 
 #if __BSD_VISIBLE
@@ -115,6 +124,69 @@ fegetexcept(void)
 
 #endif /* __BSD_VISIBLE */
 
+#ifdef __FENV_INLINE
+
+/*
+ * These only touch the FPCR or FPSR, and are meant for code that switches
+ * the rounding mode or tests the flags in inner loops.  With gnu_inline
+ * the out-of-line definitions stay in libm, so taking the address of one
+ * of these functions still works.  The FPCR and FPSR accessors clobber
+ * memory, so loads and stores of floating-point objects stay on their
+ * side of these functions.  The compiler can still move arithmetic on
+ * values held in registers across them, so a result that depends on the
+ * rounding mode has to be stored to an object before the mode changes
+ * again.
+ */
+#define	__fenv_inline \
+	extern __inline__ __attribute__((__gnu_inline__, __always_inline__))
+
+__fenv_inline int
+feclearexcept(int __excepts)
+{
+	fexcept_t __r;
+
+	__mrs_fpsr(__r);
+	__r &= ~__excepts;
+	__msr_fpsr(__r);
+	return (0);
+}
+
+__fenv_inline int
+fetestexcept(int __excepts)
+{
+	fexcept_t __r;
+
+	__mrs_fpsr(__r);
+	return (__r & __excepts);
+}
+
+__fenv_inline int
+fegetround(void)
+{
+	fenv_t __r;
+
+	__mrs_fpcr(__r);
+	return ((__r >> _ROUND_SHIFT) & _ROUND_MASK);
+}
+
+__fenv_inline int
+fesetround(int __round)
+{
+	fenv_t __r;
+
+	if (__round & ~_ROUND_MASK)
+		return (-1);
+	__mrs_fpcr(__r);
+	__r &= ~(_ROUND_MASK << _ROUND_SHIFT);
+	__r |= __round << _ROUND_SHIFT;
+	__msr_fpcr(__r);
+	return (0);
+}
+
+#undef	__fenv_inline
+
+#endif /* __FENV_INLINE */
+
 
 
 #endif	/* !_FENV_H_ */
@@ -163,6 +163,90 @@ extern const fenv_t *_fe_nomask_env;
 extern void _feinitialise ();
 #endif
 
+/*  Inline versions of the functions that are called in inner loops, for
+   example by interval arithmetic switching between FE_DOWNWARD and
+   FE_UPWARD.  x86_64 always has SSE, so they skip the cpuid test of the
+   library functions and read the state from the MXCSR.  The rounding mode
+   still has to be set in the x87 control word, which long double
+   arithmetic uses.  With gnu_inline the library keeps the only out-of-line
+   definitions, which are what a function pointer refers to.
+    Every asm clobbers memory, so loads and stores of floating-point
+   objects stay on their side of these functions.  GCC can still move
+   arithmetic on values held in registers across them, so a result that
+   depends on the rounding mode has to be stored to an object before the
+   mode changes again.  */
+
+#if defined (__x86_64__) && defined (__OPTIMIZE__) && !defined (__NO_INLINE__) \
+    && __GNUC_PREREQ__ (4, 2)
+
+#define __fenv_inline \
+  extern __inline__ __attribute__ ((__gnu_inline__, __always_inline__))
+
+__fenv_inline int
+feclearexcept (int __excepts)
+{
+  unsigned int __mxcsr;
+  unsigned short __sw;
+  fenv_t __env;
+
+  if (__excepts & ~FE_ALL_EXCEPT)
+    return 1;
+  __asm__ __volatile__ ("stmxcsr %0" : "=m" (__mxcsr) : : "memory");
+  __mxcsr &= ~__excepts;
+  __asm__ __volatile__ ("ldmxcsr %0" : : "m" (__mxcsr) : "memory");
+  /* The x87 flags can only be cleared individually through the whole
+     environment, which is rarely needed.  */
+  __asm__ __volatile__ ("fnstsw %0" : "=am" (__sw) : : "memory");
+  if (__sw & __excepts)
+    {
+      __asm__ __volatile__ ("fnstenv %0" : "=m" (__env._fpu) : : "memory");
+      __env._fpu._fpu_sw &= ~__excepts;
+      __asm__ __volatile__ ("fldenv %0" : : "m" (__env._fpu) : "memory");
+    }
+  return 0;
+}
+
+__fenv_inline int
+fetestexcept (int __excepts)
+{
+  unsigned int __mxcsr;
+  unsigned short __sw;
+
+  __asm__ __volatile__ ("stmxcsr %0" : "=m" (__mxcsr) : : "memory");
+  __asm__ __volatile__ ("fnstsw %0" : "=am" (__sw) : : "memory");
+  return (__sw | __mxcsr) & __excepts & FE_ALL_EXCEPT;
+}
+
+__fenv_inline int
+fegetround (void)
+{
+  unsigned int __mxcsr;
+
+  __asm__ __volatile__ ("stmxcsr %0" : "=m" (__mxcsr) : : "memory");
+  return (__mxcsr >> 13) & 3;
+}
+
+__fenv_inline int
+fesetround (int __round)
+{
+  unsigned int __mxcsr;
+  unsigned short __cw;
+
+  if (__round & ~3)
+    return 1;
+  __asm__ __volatile__ ("stmxcsr %0" : "=m" (__mxcsr) : : "memory");
+  __mxcsr = (__mxcsr & ~0x6000) | (__round << 13);
+  __asm__ __volatile__ ("ldmxcsr %0" : : "m" (__mxcsr) : "memory");
+  __asm__ __volatile__ ("fnstcw %0" : "=m" (__cw) : : "memory");
+  __cw = (__cw & ~0x0c00) | (__round << 10);
+  __asm__ __volatile__ ("fldcw %0" : : "m" (__cw) : "memory");
+  return 0;
+}
+
+#undef __fenv_inline
+
+#endif /* __x86_64__ && __OPTIMIZE__ */
+
 #ifdef __cplusplus
 }
 #endif
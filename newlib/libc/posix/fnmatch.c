@@ -57,30 +57,44 @@ static char sccsid[] = "@(#)fnmatch.c	8.2 (Berkeley) 4/16/94";
 
 static int rangematch(const char *, char, int, char **);
 
+/*
+ * The matcher never recurses.  When a '*' is seen, the positions just
+ * after it in the pattern and string are remembered; on a later
+ * mismatch the star is made to swallow one more character and matching
+ * resumes from there.  Only the most recent star needs to be retried,
+ * since anything an earlier star could absorb the later one can absorb
+ * as well, so the worst case is O(strlen(pattern) * strlen(string))
+ * instead of exponential in the number of stars.
+ */
 int
 fnmatch(pattern, string, flags)
 	const char *pattern, *string;
 	int flags;
 {
 	const char *stringstart;
+	const char *bt_pattern, *bt_string;
 	char *newp;
-	char c, test;
+	char c;
 
-	for (stringstart = string;;)
+	stringstart = string;
+	bt_pattern = bt_string = NULL;
+	for (;;) {
 		switch (c = *pattern++) {
 		case EOS:
 			if ((flags & FNM_LEADING_DIR) && *string == '/')
 				return (0);
-			return (*string == EOS ? 0 : FNM_NOMATCH);
+			if (*string == EOS)
+				return (0);
+			goto backtrack;
 		case '?':
 			if (*string == EOS)
 				return (FNM_NOMATCH);
 			if (*string == '/' && (flags & FNM_PATHNAME))
-				return (FNM_NOMATCH);
+				goto backtrack;
 			if (*string == '.' && (flags & FNM_PERIOD) &&
 			    (string == stringstart ||
 			    ((flags & FNM_PATHNAME) && *(string - 1) == '/')))
-				return (FNM_NOMATCH);
+				goto backtrack;
 			++string;
 			break;
 		case '*':
@@ -92,7 +106,7 @@ fnmatch(pattern, string, flags)
 			if (*string == '.' && (flags & FNM_PERIOD) &&
 			    (string == stringstart ||
 			    ((flags & FNM_PATHNAME) && *(string - 1) == '/')))
-				return (FNM_NOMATCH);
+				goto backtrack;
 
 			/* Optimize for pattern with * at end or before /. */
 			if (c == EOS)
@@ -108,24 +122,19 @@ fnmatch(pattern, string, flags)
 				break;
 			}
 
-			/* General case, use recursion. */
-			while ((test = *string) != EOS) {
-				if (!fnmatch(pattern, string, flags & ~FNM_PERIOD))
-					return (0);
-				if (test == '/' && flags & FNM_PATHNAME)
-					break;
-				++string;
-			}
-			return (FNM_NOMATCH);
+			/* Try the empty match first, remember where we are. */
+			bt_pattern = pattern;
+			bt_string = string;
+			break;
 		case '[':
 			if (*string == EOS)
 				return (FNM_NOMATCH);
 			if (*string == '/' && (flags & FNM_PATHNAME))
-				return (FNM_NOMATCH);
+				goto backtrack;
 			if (*string == '.' && (flags & FNM_PERIOD) &&
 			    (string == stringstart ||
 			    ((flags & FNM_PATHNAME) && *(string - 1) == '/')))
-				return (FNM_NOMATCH);
+				goto backtrack;
 
 			switch (rangematch(pattern, *string, flags, &newp)) {
 			case RANGE_ERROR:
@@ -134,7 +143,7 @@ fnmatch(pattern, string, flags)
 				pattern = newp;
 				break;
 			case RANGE_NOMATCH:
-				return (FNM_NOMATCH);
+				goto backtrack;
 			}
 			++string;
 			break;
@@ -155,10 +164,28 @@ fnmatch(pattern, string, flags)
 				  tolower((unsigned char)*string)))
 				;
 			else
-				return (FNM_NOMATCH);
+				goto backtrack;
+			/*
+			 * With FNM_PATHNAME a star cannot span a slash, so
+			 * once one has been matched the earlier components
+			 * are settled and there is nothing left to retry.
+			 */
+			if (c == '/' && (flags & FNM_PATHNAME))
+				bt_pattern = NULL;
 			string++;
 			break;
 		}
+		continue;
+
+	backtrack:
+		/* Let the most recent star absorb one more character. */
+		if (bt_pattern == NULL || *bt_string == EOS)
+			return (FNM_NOMATCH);
+		if (*bt_string == '/' && (flags & FNM_PATHNAME))
+			return (FNM_NOMATCH);
+		pattern = bt_pattern;
+		string = ++bt_string;
+	}
 	/* NOTREACHED */
 }
 
@@ -62,6 +62,9 @@ static char sccsid[] = "@(#)glob.c	8.3 (Berkeley) 10/13/93";
  *	expand ~user/foo to the /home/dir/of/user/foo
  * GLOB_BRACE:
  *	expand {1,2}{a,b} to 1a 1b 2a 2b
+ * GLOB_STREAM:
+ *	Hand each match to gl_matchfunc as soon as it is found instead of
+ *	collecting and sorting them in gl_pathv.
  * gl_matchc:
  *	Number of matches in the current invocation of glob.
  */
@@ -132,9 +135,15 @@ typedef char Char;
 #define	M_SET		META('[')
 #define	ismeta(c)	(((c)&M_QUOTE) != 0)
 
+/* What a directory entry is known to be without calling stat. */
+#define	G_UNKNOWN	0
+#define	G_DIR		1
+#define	G_OTHER		2
+
 
 static int	 compare(const void *, const void *);
 static int	 g_Ctoc(const Char *, char *, u_int);
+static int	 g_dtype(struct dirent *, glob_t *);
 static int	 g_lstat(Char *, struct stat *, glob_t *);
 static DIR	*g_opendir(Char *, glob_t *);
 static Char	*g_strchr(Char *, int);
@@ -144,7 +153,8 @@ static Char	*g_strcat(Char *, const Char *);
 static int	 g_stat(Char *, struct stat *, glob_t *);
 static int	 glob0(const Char *, glob_t *, int *);
 static int	 glob1(Char *, glob_t *, int *);
-static int	 glob2(Char *, Char *, Char *, Char *, glob_t *, int *);
+static int	 glob2(Char *, Char *, Char *, Char *, struct dirent *,
+		    glob_t *, int *);
 static int	 glob3(Char *, Char *, Char *, Char *, Char *, glob_t *, int *);
 static int	 globextend(const Char *, glob_t *, int *);
 static const Char *	
@@ -179,6 +189,8 @@ glob(pattern, flags, errfunc, pglob)
 			limit = ARG_MAX;
 	} else
 		limit = 0;
+	if (flags & GLOB_STREAM)
+		flags |= GLOB_NOSORT;
 	pglob->gl_flags = flags & ~GLOB_MAGCHAR;
 	pglob->gl_errfunc = errfunc;
 	pglob->gl_matchc = 0;
@@ -532,23 +544,28 @@ glob1(pattern, pglob, limit)
 	if (*pattern == EOS)
 		return(0);
 	return(glob2(pathbuf, pathbuf, pathbuf + MAXPATHLEN - 1,
-	    pattern, pglob, limit));
+	    pattern, NULL, pglob, limit));
 }
 
 /*
  * The functions glob2 and glob3 are mutually recursive; there is one level
  * of recursion for each segment in the pattern that contains one or more
  * meta characters.
+ *
+ * dp is the directory entry glob3 just matched for the last component of
+ * pathbuf, or NULL; while it is valid the path is known to exist and its
+ * type may be known from d_type, which saves a stat per match.
  */
 static int
-glob2(pathbuf, pathend, pathend_last, pattern, pglob, limit)
+glob2(pathbuf, pathend, pathend_last, pattern, dp, pglob, limit)
 	Char *pathbuf, *pathend, *pathend_last, *pattern;
+	struct dirent *dp;
 	glob_t *pglob;
 	int *limit;
 {
 	struct stat sb;
 	Char *p, *q;
-	int anymeta;
+	int anymeta, type;
 
 	/*
 	 * Loop over pattern segments until end of pattern or until
@@ -557,12 +574,17 @@ glob2(pathbuf, pathend, pathend_last, pattern, pglob, limit)
 	for (anymeta = 0;;) {
 		if (*pattern == EOS) {		/* End of pattern? */
 			*pathend = EOS;
-			if (g_lstat(pathbuf, &sb, pglob))
+			if (dp != NULL)
+				type = g_dtype(dp, pglob);
+			else if (g_lstat(pathbuf, &sb, pglob))
 				return(0);
+			else
+				type = S_ISDIR(sb.st_mode) ? G_DIR :
+				    S_ISLNK(sb.st_mode) ? G_UNKNOWN : G_OTHER;
 
 			if (((pglob->gl_flags & GLOB_MARK) &&
-			    pathend[-1] != SEP) && (S_ISDIR(sb.st_mode)
-			    || (S_ISLNK(sb.st_mode) &&
+			    pathend[-1] != SEP) && (type == G_DIR
+			    || (type == G_UNKNOWN &&
 			    (g_stat(pathbuf, &sb, pglob) == 0) &&
 			    S_ISDIR(sb.st_mode)))) {
 				if (pathend + 1 > pathend_last)
@@ -586,6 +608,7 @@ glob2(pathbuf, pathend, pathend_last, pattern, pglob, limit)
 		}
 
 		if (!anymeta) {		/* No expansion, do next segment. */
+			dp = NULL;
 			pathend = q;
 			pattern = p;
 			while (*pattern == SEP) {
@@ -658,8 +681,19 @@ glob3(pathbuf, pathend, pathend_last, pattern, restpattern, pglob, limit)
 			*pathend = EOS;
 			continue;
 		}
+		/*
+		 * Nothing can be found below something that is not a
+		 * directory; skip the lookup unless the caller wants to
+		 * hear about the resulting ENOTDIR.
+		 */
+		if (*restpattern != EOS && g_dtype(dp, pglob) == G_OTHER &&
+		    pglob->gl_errfunc == NULL &&
+		    !(pglob->gl_flags & GLOB_ERR)) {
+			*pathend = EOS;
+			continue;
+		}
 		err = glob2(pathbuf, --dc, pathend_last, restpattern,
-		    pglob, limit);
+		    dp, pglob, limit);
 		if (err)
 			break;
 	}
@@ -674,18 +708,31 @@ glob3(pathbuf, pathend, pathend_last, pattern, restpattern, pglob, limit)
 
 /*
  * Extend the gl_pathv member of a glob_t structure to accomodate a new item,
- * add the new item, and update gl_pathc.
+ * add the new item, and update gl_pathc.  With GLOB_STREAM the item is
+ * passed to gl_matchfunc instead and only gl_pathc is updated.
  *
- * This assumes the BSD realloc, which only copies the block when its size
- * crosses a power-of-two boundary; for v7 realloc, this would cause quadratic
- * behavior.
+ * The vector grows in power-of-two steps, so collecting n paths costs
+ * O(log n) reallocations whatever the realloc implementation does.  The
+ * allocated size is not stored anywhere; it is always globcap() of the
+ * number of slots in use.
  *
  * Return 0 if new item added, error code if memory couldn't be allocated.
  *
  * Invariant of the glob_t structure:
  *	Either gl_pathc is zero and gl_pathv is NULL; or gl_pathc > 0 and
- *	gl_pathv points to (gl_offs + gl_pathc + 1) items.
+ *	gl_pathv points to at least (gl_offs + gl_pathc + 1) items.
  */
+static u_int
+globcap(n)
+	u_int n;
+{
+	u_int cap;
+
+	for (cap = 16; cap < n; cap <<= 1)
+		continue;
+	return (cap);
+}
+
 static int
 globextend(path, pglob, limit)
 	const Char *path;
@@ -694,19 +741,33 @@ globextend(path, pglob, limit)
 {
 	char **pathv;
 	int i;
-	u_int newsize, len;
+	u_int used, len;
 	char *copy;
 	const Char *p;
+	char buf[MAXPATHLEN];
 
 	if (*limit && pglob->gl_pathc > *limit) {
 		errno = 0;
 		return (GLOB_NOSPACE);
 	}
 
-	newsize = sizeof(*pathv) * (2 + pglob->gl_pathc + pglob->gl_offs);
-	pathv = pglob->gl_pathv ?
-		    realloc((char *)pglob->gl_pathv, newsize) :
-		    malloc(newsize);
+	if (pglob->gl_flags & GLOB_STREAM) {
+		if (g_Ctoc(path, buf, sizeof(buf)))
+			return (GLOB_ABEND);
+		pglob->gl_pathc++;
+		if ((*pglob->gl_matchfunc)(buf, pglob->gl_matcharg))
+			return (GLOB_ABEND);
+		return (0);
+	}
+
+	used = 1 + pglob->gl_pathc + pglob->gl_offs;
+	if (pglob->gl_pathv == NULL)
+		pathv = malloc(sizeof(*pathv) * globcap(used + 1));
+	else if (globcap(used + 1) > globcap(used))
+		pathv = realloc((char *)pglob->gl_pathv,
+		    sizeof(*pathv) * globcap(used + 1));
+	else
+		pathv = pglob->gl_pathv;
 	if (pathv == NULL) {
 		if (pglob->gl_pathv) {
 			free(pglob->gl_pathv);
@@ -738,27 +799,30 @@ globextend(path, pglob, limit)
 }
 
 /*
- * pattern matching function for filenames.  Each occurrence of the *
- * pattern causes a recursion level.
+ * pattern matching function for filenames.  A '*' does not recurse: the
+ * positions after the most recent one are remembered and, on mismatch,
+ * it is extended by one character and matching resumes there.  This
+ * keeps the cost at O(strlen(name) * strlen(pat)) for any pattern.
  */
 static int
 match(name, pat, patend)
 	Char *name, *pat, *patend;
 {
 	int ok, negate_range;
-	Char c, k;
+	Char c, k, *nextp, *nextn;
 
-	while (pat < patend) {
+	nextp = nextn = NULL;
+	while (pat < patend || *name != EOS) {
+		if (pat == patend)
+			goto fail;
 		c = *pat++;
 		switch (c & M_MASK) {
 		case M_ALL:
 			if (pat == patend)
 				return(1);
-			do
-			    if (match(name, pat, patend))
-				    return(1);
-			while (*name++ != EOS);
-			return(0);
+			nextp = pat;
+			nextn = name;
+			break;
 		case M_ONE:
 			if (*name++ == EOS)
 				return(0);
@@ -781,15 +845,21 @@ match(name, pat, patend)
 				} else if (c == k)
 					ok = 1;
 			if (ok == negate_range)
-				return(0);
+				goto fail;
 			break;
 		default:
 			if (*name++ != c)
-				return(0);
+				goto fail;
 			break;
 		}
+		continue;
+	fail:
+		if (nextp == NULL || *nextn == EOS)
+			return(0);
+		pat = nextp;
+		name = ++nextn;
 	}
-	return(*name == EOS);
+	return(1);
 }
 
 /* Free allocated data belonging to a glob_t structure. */
@@ -864,6 +934,26 @@ g_stat(fn, sb, pglob)
 	return(stat(buf, sb));
 }
 
+/*
+ * Classify a directory entry from its d_type, where the system provides
+ * one.  Alternate readdir functions are not required to fill it in.
+ */
+static int
+g_dtype(dp, pglob)
+	struct dirent *dp;
+	glob_t *pglob;
+{
+#if defined(DT_UNKNOWN) && defined(DT_DIR) && defined(DT_LNK)
+	if (!(pglob->gl_flags & GLOB_ALTDIRFUNC)) {
+		if (dp->d_type == DT_DIR)
+			return (G_DIR);
+		if (dp->d_type != DT_UNKNOWN && dp->d_type != DT_LNK)
+			return (G_OTHER);
+	}
+#endif
+	return (G_UNKNOWN);
+}
+
 static Char *
 g_strchr(str, ch)
 	Char *str;
@@ -675,6 +675,10 @@ _VFPRINTF_R (struct _reent *data,
 	int width;		/* width from format (%8d), or 0 */
 	int prec;		/* precision from format (%.3d), or -1 */
 	char sign;		/* sign prefix (' ', '+', '-', or \0) */
+#if defined (FLOATING_POINT) || defined (_WANT_IO_C99_FORMATS)
+				/* "C" numeric data: ".", no grouping */
+	int c_numeric = __numeric_locale_is_C (__get_current_locale ());
+#endif
 #ifdef _WANT_IO_C99_FORMATS
 				/* locale specific numeric grouping */
 	char *thousands_sep = NULL;
@@ -682,8 +686,9 @@ _VFPRINTF_R (struct _reent *data,
 	const char *grouping = NULL;
 #endif
 #ifdef FLOATING_POINT
-	char *decimal_point = _localeconv_r (data)->decimal_point;
-	size_t decp_len = strlen (decimal_point);
+	char *decimal_point = c_numeric ? "."
+				: _localeconv_r (data)->decimal_point;
+	size_t decp_len = c_numeric ? 1 : strlen (decimal_point);
 	char softsign;		/* temporary negative sign for floats */
 	union { int i; _PRINTF_FLOAT_TYPE fp; } _double_ = {0};
 # define _fpvalue (_double_.fp)
@@ -948,6 +953,8 @@ rflag:		ch = *fmt++;
 reswitch:	switch (ch) {
 #ifdef _WANT_IO_C99_FORMATS
 		case '\'':
+			if (c_numeric)
+				goto rflag;
 			thousands_sep = _localeconv_r (data)->thousands_sep;
 			thsnd_len = strlen (thousands_sep);
 			grouping = _localeconv_r (data)->grouping;
@@ -425,6 +425,11 @@ __SVFSCANF_R (struct _reent *rptr,
 #ifdef _MB_CAPABLE
   mbstate_t state;              /* value to keep track of multibyte state */
 #endif
+#ifdef FLOATING_POINT
+				/* decimal point, "." in the "C" locale */
+  const char *decpt = __numeric_locale_is_C (__get_current_locale ())
+		      ? "." : _localeconv_r (rptr)->decimal_point;
+#endif
 #ifdef _WANT_IO_C99_FORMATS
 #define _WANT_IO_POSIX_EXTENSIONS
 #endif
@@ -1550,7 +1555,6 @@ __SVFSCANF_R (struct _reent *rptr,
 	  unsigned width_left = 0;
 	  char nancount = 0;
 	  char infcount = 0;
-	  const char *decpt = _localeconv_r (rptr)->decimal_point;
 #ifdef _MB_CAPABLE
 	  int decptpos = 0;
 #endif
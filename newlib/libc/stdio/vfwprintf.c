@@ -131,9 +131,7 @@ SEEALSO
 #include "local.h"
 #include "fvwrite.h"
 #include "vfieeefp.h"
-#ifdef __HAVE_LOCALE_INFO_EXTENDED__
 #include "../locale/setlocale.h"
-#endif
 
 /* Currently a test is made to see if long double processing is warranted.
    This could be changed in the future should the _ldtoa_r code be
@@ -401,6 +399,10 @@ _VFWPRINTF_R (struct _reent *data,
 	int width;		/* width from format (%8d), or 0 */
 	int prec;		/* precision from format (%.3d), or -1 */
 	wchar_t sign;		/* sign prefix (' ', '+', '-', or \0) */
+#if defined (FLOATING_POINT) || defined (_WANT_IO_C99_FORMATS)
+				/* "C" numeric data: ".", no grouping */
+	int c_numeric = __numeric_locale_is_C (__get_current_locale ());
+#endif
 #ifdef _WANT_IO_C99_FORMATS
 				/* locale specific numeric grouping */
 	wchar_t thousands_sep = L'\0';
@@ -457,6 +459,9 @@ _VFWPRINTF_R (struct _reent *data,
 	  L'0',L'0',L'0',L'0',L'0',L'0',L'0',L'0'};
 
 #ifdef FLOATING_POINT
+	if (c_numeric)
+	  decimal_point = L'.';
+	else
 #ifdef _MB_CAPABLE
 #ifdef __HAVE_LOCALE_INFO_EXTENDED__
 	decimal_point = *__get_current_numeric_locale ()->wdecimal_point;
@@ -672,6 +677,8 @@ rflag:		ch = *fmt++;
 reswitch:	switch (ch) {
 #ifdef _WANT_IO_C99_FORMATS
 		case L'\'':
+		  if (c_numeric)
+		    goto rflag;
 #ifdef _MB_CAPABLE
 #ifdef __HAVE_LOCALE_INFO_EXTENDED__
 		  thousands_sep = *__get_current_numeric_locale ()->wthousands_sep;
@@ -128,9 +128,7 @@ C99, POSIX-1.2008
 #include <math.h>
 #include <float.h>
 #include <locale.h>
-#ifdef __HAVE_LOCALE_INFO_EXTENDED__
 #include "../locale/setlocale.h"
-#endif
 
 /* Currently a test is made to see if long double processing is warranted.
    This could be changed in the future should the _ldtoa_r code be
@@ -528,6 +526,10 @@ __SVFWSCANF_R (struct _reent *rptr,
 #endif
 
 #ifdef FLOATING_POINT
+	  /* The "C" locale has ".", and needs no conversion. */
+	  if (__numeric_locale_is_C (__get_current_locale ()))
+	    decpt = L'.';
+	  else
 #ifdef _MB_CAPABLE
 #ifdef __HAVE_LOCALE_INFO_EXTENDED__
 	  decpt = *__get_current_numeric_locale ()->wdecimal_point;
@@ -52,6 +52,7 @@
 static struct _rs {
 	size_t		rs_have;	/* valid bytes at end of rs_buf */
 	size_t		rs_count;	/* bytes till reseed */
+	u_long		rs_gen;		/* bumped by every stir, never 0 */
 } *rs;
 
 /* Maybe be preserved in fork children, if _rs_allocate() decides. */
@@ -64,6 +65,23 @@ static inline int _rs_allocate(struct _rs **, struct _rsx **);
 static inline void _rs_forkdetect(void);
 #include "arc4random.h"
 
+#if defined(_ARC4RANDOM_THREAD_LOCAL) && !defined(__SINGLE_THREAD__)
+#define	RSTLSSZ	(4*BLOCKSZ)
+
+/*
+ * Per-thread cache of keystream taken from rs_buf in RSTLSSZ batches, so
+ * that most calls need not take the lock.  rt_gen ties the cache to the
+ * stir it came from: a fork child whose _rs was zeroed sees a mismatch
+ * and refills instead of repeating the bytes its parent will also hand
+ * out.
+ */
+static _ARC4RANDOM_THREAD_LOCAL struct _rs_tls {
+	u_long		rt_gen;		/* rs_gen when filled */
+	size_t		rt_have;	/* valid bytes at end of rt_buf */
+	u_char		rt_buf[RSTLSSZ];
+} _rs_tls;
+#endif
+
 static inline void _rs_rekey(u_char *dat, size_t datlen);
 
 static inline void
@@ -100,6 +118,13 @@ _rs_stir(void)
 	memset(rsx->rs_buf, 0, sizeof(rsx->rs_buf));
 
 	rs->rs_count = (SIZE_MAX <= 65535) ? 65000 : 1600000;
+#ifdef RSTLSSZ
+	__atomic_store_n(&rs->rs_gen, rs->rs_gen + 1 ? rs->rs_gen + 1 : 1,
+	    __ATOMIC_RELEASE);
+#else
+	if (++rs->rs_gen == 0)
+		rs->rs_gen = 1;
+#endif
 }
 
 static inline void
@@ -121,8 +146,8 @@ _rs_rekey(u_char *dat, size_t datlen)
 	memset(rsx->rs_buf, 0, sizeof(rsx->rs_buf));
 #endif
 	/* fill rs_buf with the keystream */
-	chacha_encrypt_bytes(&rsx->rs_chacha, rsx->rs_buf,
-	    rsx->rs_buf, sizeof(rsx->rs_buf));
+	chacha_keystream_blocks(&rsx->rs_chacha, rsx->rs_buf,
+	    sizeof(rsx->rs_buf) / BLOCKSZ);
 	/* mix in optional user provided data */
 	if (dat) {
 		size_t i, m;
@@ -175,6 +200,71 @@ _rs_random_u32(uint32_t *val)
 	rs->rs_have -= sizeof(*val);
 }
 
+#ifdef RSTLSSZ
+/*
+ * Whether RT holds N bytes of the current generation.  Only rs_gen is
+ * read without the lock: rs is set once and never freed, and a stir
+ * publishes its new rs_gen last.
+ */
+static inline int
+_rs_tls_ok(struct _rs_tls *rt, size_t n)
+{
+	struct _rs *r = __atomic_load_n(&rs, __ATOMIC_ACQUIRE);
+
+	return (r != NULL && rt->rt_have >= n &&
+	    rt->rt_gen == __atomic_load_n(&r->rs_gen, __ATOMIC_ACQUIRE));
+}
+
+/* Refill RT from the shared buffer.  */
+static void
+_rs_tls_refill(struct _rs_tls *rt)
+{
+	_ARC4_LOCK();
+	_rs_random_buf(rt->rt_buf, sizeof(rt->rt_buf));
+	rt->rt_have = sizeof(rt->rt_buf);
+	rt->rt_gen = rs->rs_gen;
+	_ARC4_UNLOCK();
+}
+
+static inline void
+_rs_tls_take(struct _rs_tls *rt, void *buf, size_t n)
+{
+	u_char *keystream;
+
+	keystream = rt->rt_buf + sizeof(rt->rt_buf) - rt->rt_have;
+	memcpy(buf, keystream, n);
+	memset(keystream, 0, n);
+	rt->rt_have -= n;
+}
+
+uint32_t
+arc4random(void)
+{
+	struct _rs_tls *rt = &_rs_tls;
+	uint32_t val;
+
+	if (!_rs_tls_ok(rt, sizeof(val)))
+		_rs_tls_refill(rt);
+	_rs_tls_take(rt, &val, sizeof(val));
+	return val;
+}
+
+void
+arc4random_buf(void *buf, size_t n)
+{
+	struct _rs_tls *rt = &_rs_tls;
+
+	if (n <= RSTLSSZ / 4) {
+		if (!_rs_tls_ok(rt, n))
+			_rs_tls_refill(rt);
+		_rs_tls_take(rt, buf, n);
+		return;
+	}
+	_ARC4_LOCK();
+	_rs_random_buf(buf, n);
+	_ARC4_UNLOCK();
+}
+#else /* !RSTLSSZ */
 uint32_t
 arc4random(void)
 {
@@ -201,3 +291,4 @@ arc4random_buf(void *buf, size_t n)
 	_ARC4_UNLOCK();
 #endif
 }
+#endif /* !RSTLSSZ */
@@ -29,8 +29,16 @@
  * define and macros
  *  o _ARC4RANDOM_DATA,
  *  o _ARC4RANDOM_GETENTROPY_FAIL(),
- *  o _ARC4RANDOM_ALLOCATE(rsp, rspx), and
- *  o _ARC4RANDOM_FORKDETECT().
+ *  o _ARC4RANDOM_ALLOCATE(rsp, rspx),
+ *  o _ARC4RANDOM_FORKDETECT(), and
+ *  o _ARC4RANDOM_THREAD_LOCAL.
+ *
+ * If _ARC4RANDOM_THREAD_LOCAL is defined to a thread-local storage class
+ * (e.g. _Thread_local), every thread keeps a small keystream cache and
+ * takes the lock only to refill it.  _ARC4RANDOM_FORKDETECT() then runs
+ * only on a refill, so a port with fork must have the _rs of a child
+ * zeroed at the fork itself (e.g. by MAP_INHERIT_ZERO or an atfork
+ * handler); that invalidates the caches the child inherited.
  */
 #include <machine/_arc4random.h>
 
@@ -219,3 +219,74 @@ chacha_encrypt_bytes(chacha_ctx *x,const u8 *m,u8 *c,u32 bytes)
 #endif
   }
 }
+
+#ifdef KEYSTREAM_ONLY
+#if defined(__GNUC__) && !defined(__CHACHA_SCALAR)
+/*
+ * Four keystream blocks at a time, one per vector lane.  GCC lowers the
+ * generic vectors to SSE2, NEON, AltiVec and the like where the target
+ * has them and to plain 32-bit arithmetic where it does not.
+ */
+typedef u32 u32x4 __attribute__((vector_size(16)));
+
+#define VROTATE(v,c) (((v) << (c)) | ((v) >> (32 - (c))))
+
+#define VQUARTERROUND(a,b,c,d) \
+  a += b; d = VROTATE(d ^ a,16); \
+  c += d; b = VROTATE(b ^ c,12); \
+  a += b; d = VROTATE(d ^ a, 8); \
+  c += d; b = VROTATE(b ^ c, 7);
+
+static void
+chacha_keystream_blocks(chacha_ctx *x,u8 *c,u32 nblocks)
+{
+  u32x4 v[16], j[16];
+  u32 lo, hi;
+  u_int i, l;
+
+  for (; nblocks >= 4; nblocks -= 4, c += 4 * 64) {
+    for (i = 0;i < 16;++i)
+      j[i] = (u32x4){ x->input[i], x->input[i], x->input[i], x->input[i] };
+    lo = x->input[12];
+    hi = x->input[13];
+    for (l = 0;l < 4;++l) {
+      j[12][l] = lo + l;
+      j[13][l] = hi + (lo + l < lo);
+    }
+    for (i = 0;i < 16;++i)
+      v[i] = j[i];
+    for (i = 20;i > 0;i -= 2) {
+      VQUARTERROUND( v[0], v[4], v[8],v[12])
+      VQUARTERROUND( v[1], v[5], v[9],v[13])
+      VQUARTERROUND( v[2], v[6],v[10],v[14])
+      VQUARTERROUND( v[3], v[7],v[11],v[15])
+      VQUARTERROUND( v[0], v[5],v[10],v[15])
+      VQUARTERROUND( v[1], v[6],v[11],v[12])
+      VQUARTERROUND( v[2], v[7], v[8],v[13])
+      VQUARTERROUND( v[3], v[4], v[9],v[14])
+    }
+    for (i = 0;i < 16;++i) {
+      v[i] += j[i];
+      for (l = 0;l < 4;++l) {
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+        u32 w = v[i][l];
+        __builtin_memcpy(c + l * 64 + i * 4, &w, 4);
+#else
+        U32TO8_LITTLE(c + l * 64 + i * 4, v[i][l]);
+#endif
+      }
+    }
+    x->input[12] = lo + 4;
+    x->input[13] = hi + (lo + 4 < lo);
+  }
+  if (nblocks)
+    chacha_encrypt_bytes(x, c, c, nblocks * 64);
+}
+#else
+static void
+chacha_keystream_blocks(chacha_ctx *x,u8 *c,u32 nblocks)
+{
+  chacha_encrypt_bytes(x, c, c, nblocks * 64);
+}
+#endif
+#endif
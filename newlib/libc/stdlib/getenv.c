@@ -77,9 +77,7 @@ _findenv (register const char *name,
 char *
 getenv (const char *name)
 {
-  int offset;
-
-  return _findenv_r (_REENT, name, &offset);
+  return _getenv_r (_REENT, name);
 }
 
 #endif /* !_REENT_ONLY */
@@ -63,6 +63,220 @@ extern char **environ;
    'environ'.  */
 static char ***p_environ = &environ;
 
+/*
+ * Once environ holds more than a handful of entries, lookups go through
+ * an open-addressed hash index instead of scanning it with strncmp.  The
+ * index is built lazily under ENV_LOCK, kept current by setenv, dropped
+ * by unsetenv and rebuilt whenever the program assigns a new array to
+ * environ.  Stores made directly into the elements of environ are not
+ * noticed; such programs must not mix them with setenv/putenv.
+ *
+ * getenv probes the index without taking ENV_LOCK.  Writers bracket
+ * every change with env_seq (odd while the index is being changed) and
+ * readers retry under the lock if the count moved.  Tables superseded by
+ * a bigger one are never freed because a reader may still be probing
+ * them; sizes double, so this wastes at most the size of the live table.
+ */
+
+#define ENV_INDEX_MIN	16	/* smallest environ worth indexing */
+
+struct env_slot
+{
+  char *str;			/* "name=value" entry of environ */
+  int offset;			/* its position in environ */
+};
+
+struct env_index
+{
+  char **env;			/* environ array described, or NULL */
+  unsigned int mask;		/* number of slots - 1 */
+  unsigned int used;		/* slots in use */
+  struct env_slot slot[1];
+};
+
+static struct env_index *env_index;
+static unsigned int env_seq;
+
+#ifndef __SINGLE_THREAD__
+#define SEQ_READ(p)		__atomic_load_n ((p), __ATOMIC_ACQUIRE)
+#define SEQ_RECHECK(p)		(__atomic_thread_fence (__ATOMIC_ACQUIRE), \
+				 __atomic_load_n ((p), __ATOMIC_RELAXED))
+#define SEQ_WRITE_BEGIN(p)	(__atomic_store_n ((p), *(p) + 1, __ATOMIC_RELAXED), \
+				 __atomic_thread_fence (__ATOMIC_RELEASE))
+#define SEQ_WRITE_END(p)	__atomic_store_n ((p), *(p) + 1, __ATOMIC_RELEASE)
+#define INDEX_LOAD()		__atomic_load_n (&env_index, __ATOMIC_ACQUIRE)
+#define INDEX_PUBLISH(x)	__atomic_store_n (&env_index, (x), __ATOMIC_RELEASE)
+#else
+#define SEQ_READ(p)		(*(p))
+#define SEQ_RECHECK(p)		(*(p))
+#define SEQ_WRITE_BEGIN(p)	((void) 0)
+#define SEQ_WRITE_END(p)	((void) 0)
+#define INDEX_LOAD()		env_index
+#define INDEX_PUBLISH(x)	(env_index = (x))
+#endif
+
+static unsigned int
+env_hash (const char *name,
+	size_t len)
+{
+  unsigned int h = 2166136261u;
+
+  while (len-- > 0)
+    h = (h ^ (unsigned char) *name++) * 16777619u;
+  return h;
+}
+
+/* Return the slot holding NAME (LEN bytes, no '='), or NULL.  Also used
+   without the lock, so bound the probe sequence by the table size.  */
+static struct env_slot *
+env_probe (struct env_index *idx,
+	const char *name,
+	size_t len,
+	unsigned int h)
+{
+  unsigned int mask = idx->mask;
+  unsigned int n;
+  struct env_slot *s;
+  char *str;
+
+  for (n = 0; n <= mask; n++, h++)
+    {
+      s = &idx->slot[h & mask];
+      if ((str = s->str) == NULL)
+	break;
+      if (!strncmp (str, name, len) && str[len] == '=')
+	return s;
+    }
+  return NULL;
+}
+
+/* Enter environ[OFFSET] unless its name is already present; the first
+   occurrence wins, as with a linear scan.  */
+static void
+env_insert (struct env_index *idx,
+	char **env,
+	int offset)
+{
+  char *str = env[offset];
+  const char *c;
+  unsigned int h;
+  struct env_slot *s;
+
+  for (c = str; *c && *c != '='; c++);
+  if (*c != '=')
+    return;
+  h = env_hash (str, c - str);
+  if ((s = env_probe (idx, str, c - str, h)) != NULL)
+    {
+      if (s->offset == offset)
+	s->str = str;
+      return;
+    }
+  while (idx->slot[h & idx->mask].str != NULL)
+    h++;
+  s = &idx->slot[h & idx->mask];
+  s->offset = offset;
+  s->str = str;
+  idx->used++;
+}
+
+/* Return an index describing the current environ, building it if need
+   be, or NULL if environ is too small to bother.  Called with ENV_LOCK
+   held.  */
+static struct env_index *
+env_index_get (struct _reent *reent_ptr)
+{
+  struct env_index *idx = env_index;
+  char **env = *p_environ;
+  unsigned int size;
+  int cnt, i;
+
+  if (idx != NULL && idx->env == env)
+    return idx;
+
+  for (cnt = 0; env[cnt]; cnt++);
+  if (cnt < ENV_INDEX_MIN)
+    {
+      if (idx != NULL && idx->env != NULL)
+	{
+	  SEQ_WRITE_BEGIN (&env_seq);
+	  idx->env = NULL;
+	  SEQ_WRITE_END (&env_seq);
+	}
+      return NULL;
+    }
+
+  for (size = 2 * ENV_INDEX_MIN; size < 2 * (unsigned int) cnt; size <<= 1);
+
+  SEQ_WRITE_BEGIN (&env_seq);
+  if (idx == NULL || idx->mask + 1 < size)
+    {
+      struct env_index *nidx;
+
+      nidx = _malloc_r (reent_ptr, sizeof (struct env_index)
+			+ (size - 1) * sizeof (struct env_slot));
+      if (nidx == NULL)
+	{
+	  if (idx != NULL)
+	    idx->env = NULL;
+	  SEQ_WRITE_END (&env_seq);
+	  return NULL;
+	}
+      nidx->mask = size - 1;
+      idx = nidx;
+    }
+  idx->env = NULL;
+  idx->used = 0;
+  memset (idx->slot, 0, (idx->mask + 1) * sizeof (struct env_slot));
+  for (i = 0; i < cnt; i++)
+    env_insert (idx, env, i);
+  idx->env = env;
+  INDEX_PUBLISH (idx);
+  SEQ_WRITE_END (&env_seq);
+  return idx;
+}
+
+/*
+ * __env_index_update --
+ *	Record that environ[offset] was stored by setenv.  OLD_ENV is the
+ *	environ array before the call, which may have since been moved.
+ *	Called with ENV_LOCK held.
+ */
+
+void
+__env_index_update (char **old_env,
+	int offset)
+{
+  struct env_index *idx = env_index;
+
+  if (idx == NULL || idx->env == NULL || idx->env != old_env)
+    return;
+  SEQ_WRITE_BEGIN (&env_seq);
+  idx->env = *p_environ;
+  env_insert (idx, *p_environ, offset);
+  if (idx->used > (idx->mask + 1) / 2)
+    idx->env = NULL;		/* grow on next lookup */
+  SEQ_WRITE_END (&env_seq);
+}
+
+/*
+ * __env_index_reset --
+ *	Forget the index after entries of environ were moved.  Called
+ *	with ENV_LOCK held.
+ */
+
+void
+__env_index_reset (void)
+{
+  struct env_index *idx = env_index;
+
+  if (idx == NULL || idx->env == NULL)
+    return;
+  SEQ_WRITE_BEGIN (&env_seq);
+  idx->env = NULL;
+  SEQ_WRITE_END (&env_seq);
+}
+
 /*
  * _findenv --
  *	Returns pointer to value associated with name, if any, else NULL.
@@ -80,6 +294,8 @@ _findenv_r (struct _reent *reent_ptr,
   register int len;
   register char **p;
   const char *c;
+  struct env_index *idx;
+  struct env_slot *s;
 
   ENV_LOCK;
 
@@ -98,6 +314,35 @@ _findenv_r (struct _reent *reent_ptr,
   if(*c != '=')
     {
     len = c - name;
+    /* Scan small environments, and the first entries of big ones until
+       their index is built, without counting them first.  */
+    if ((idx = env_index) == NULL || idx->env != *p_environ)
+      {
+	for (p = *p_environ; *p && p - *p_environ < ENV_INDEX_MIN; ++p)
+	  if (!strncmp (*p, name, len))
+	    if (*(c = *p + len) == '=')
+	      {
+		*offset = p - *p_environ;
+		ENV_UNLOCK;
+		return (char *) (++c);
+	      }
+	if (*p == NULL)
+	  {
+	    ENV_UNLOCK;
+	    return NULL;
+	  }
+      }
+    if ((idx = env_index_get (reent_ptr)) != NULL)
+      {
+	if ((s = env_probe (idx, name, len, env_hash (name, len))) != NULL)
+	  {
+	    *offset = s->offset;
+	    ENV_UNLOCK;
+	    return s->str + len + 1;
+	  }
+	ENV_UNLOCK;
+	return NULL;
+      }
     for (p = *p_environ; *p; ++p)
       if (!strncmp (*p, name, len))
         if (*(c = *p + len) == '=')
@@ -121,6 +366,29 @@ _getenv_r (struct _reent *reent_ptr,
 	const char *name)
 {
   int offset;
+  unsigned int seq;
+  struct env_index *idx;
+  struct env_slot *s;
+  const char *c;
+  char *str;
+  size_t len;
+
+  /* Try the index without the lock; fall back to _findenv_r if it is
+     absent, stale, or changed under us.  */
+  seq = SEQ_READ (&env_seq);
+  idx = INDEX_LOAD ();
+  if (!(seq & 1) && idx != NULL && idx->env != NULL
+      && idx->env == *p_environ)
+    {
+      for (c = name; *c && *c != '='; c++);
+      if (*c == '=')
+	return NULL;
+      len = c - name;
+      s = env_probe (idx, name, len, env_hash (name, len));
+      str = s != NULL ? s->str : NULL;
+      if (SEQ_RECHECK (&env_seq) == seq)
+	return str != NULL ? str + len + 1 : NULL;
+    }
 
   return _findenv_r (reent_ptr, name, &offset);
 }
@@ -69,6 +69,105 @@ PORTABILITY
 #include <stdlib.h>
 #include <stdio.h>
 #include <errno.h>
+#include "local.h"
+
+#ifdef _MB_CAPABLE
+#define LBLOCKSIZE	(sizeof (long))
+#define UNALIGNED(X)	((long) (X) & (LBLOCKSIZE - 1))
+#define ONES		(~0UL / 0xff)
+/* Nonzero unless all bytes of X are ASCII characters other than NUL.  */
+#define NOT_ASCII(X)	((((X) - ONES) | (X)) & (ONES << 7))
+
+/* Convert the UTF-8 string at S, of at most NMS bytes, into at most *LENP
+   wide characters at DST, or only count them if DST is NULL.  Stop before
+   a NUL, or before a sequence that is invalid, incomplete or would need a
+   surrogate pair, and leave those to __utf8_mbtowc.  Return the number of
+   bytes converted, and subtract the number of wide characters from *LENP.
+
+   ASCII text is read a word at a time.  The words are aligned, so that
+   reading one never goes past the page holding the NUL at the end of S,
+   whatever NMS is.  */
+static size_t
+utf8_mbsntowcs (wchar_t *dst, const unsigned char *s, size_t nms,
+		size_t *lenp)
+{
+  const unsigned char *p = s;
+  size_t len = *lenp;
+  size_t rem = nms;
+  unsigned long w;
+  wint_t c;
+  int i, n;
+
+  while (len > 0 && rem > 0)
+    {
+      c = *p;
+      if (c < 0x80)
+	{
+	  if (c == 0)
+	    break;
+	  /* Up to two words of ASCII at a time.  */
+	  while (!UNALIGNED (p) && rem >= 2 * LBLOCKSIZE
+		 && len >= 2 * LBLOCKSIZE)
+	    {
+	      w = ((const unsigned long *) p)[0];
+	      if (NOT_ASCII (w))
+		break;
+	      n = LBLOCKSIZE;
+	      w = ((const unsigned long *) p)[1];
+	      if (!NOT_ASCII (w))
+		n = 2 * LBLOCKSIZE;
+	      if (dst)
+		for (i = 0; i < n; i++)
+		  *dst++ = p[i];
+	      p += n;
+	      rem -= n;
+	      len -= n;
+	      if (n == LBLOCKSIZE)
+		break;
+	    }
+	  if (len == 0 || rem == 0 || (c = *p) >= 0x80)
+	    continue;
+	  if (c == 0)
+	    break;
+	  n = 1;
+	}
+      else if (c >= 0xc2 && c <= 0xdf)
+	{
+	  if (rem < 2 || (p[1] & 0xc0) != 0x80)
+	    break;
+	  c = ((c & 0x1f) << 6) | (p[1] & 0x3f);
+	  n = 2;
+	}
+      else if (c >= 0xe0 && c <= 0xef)
+	{
+	  if (rem < 3 || (p[1] & 0xc0) != 0x80 || (p[2] & 0xc0) != 0x80
+	      || (c == 0xe0 && p[1] < 0xa0))
+	    break;
+	  c = ((c & 0x0f) << 12) | ((p[1] & 0x3f) << 6) | (p[2] & 0x3f);
+	  n = 3;
+	}
+      else if (sizeof (wchar_t) == 4 && c >= 0xf0 && c <= 0xf4)
+	{
+	  if (rem < 4 || (p[1] & 0xc0) != 0x80 || (p[2] & 0xc0) != 0x80
+	      || (p[3] & 0xc0) != 0x80 || (c == 0xf0 && p[1] < 0x90)
+	      || (c == 0xf4 && p[1] >= 0x90))
+	    break;
+	  c = ((c & 0x07) << 18) | ((p[1] & 0x3f) << 12)
+	      | ((p[2] & 0x3f) << 6) | (p[3] & 0x3f);
+	  n = 4;
+	}
+      else
+	break;
+      if (dst)
+	*dst++ = c;
+      p += n;
+      rem -= n;
+      --len;
+    }
+  *lenp = len;
+  return p - s;
+}
+#endif /* _MB_CAPABLE */
 
 size_t
 _mbsnrtowcs_r (struct _reent *r,
@@ -102,6 +201,22 @@ _mbsnrtowcs_r (struct _reent *r,
     }      
   
   max = len;
+#ifdef _MB_CAPABLE
+  /* The bulk of UTF-8 strings, in the initial shift state.  */
+  if (ps->__count == 0 && __MBTOWC == __utf8_mbtowc)
+    {
+      size_t left = len;
+      size_t bytes = utf8_mbsntowcs (ptr, (const unsigned char *) *src,
+				     nms, &left);
+
+      *src += bytes;
+      nms -= bytes;
+      count += len - left;
+      if (dst != NULL)
+	ptr += len - left;
+      len = left;
+    }
+#endif
   while (len > 0)
     {
       bytes = _mbrtowc_r (r, ptr, *src, nms, ps);
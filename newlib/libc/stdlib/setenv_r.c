@@ -53,8 +53,10 @@ _setenv_r (struct _reent *reent_ptr,
 	const char *value,
 	int rewrite)
 {
-  static int alloced;		/* if allocated space before */
+  static char **alloced;	/* environ array we allocated, if any */
+  static int alloced_size;	/* and its number of slots */
   register char *C;
+  char **old_env;
   int l_value, offset;
 
   if (strchr(name, '='))
@@ -79,34 +81,47 @@ _setenv_r (struct _reent *reent_ptr,
           ENV_UNLOCK;
 	  return 0;
 	}
+      old_env = *p_environ;
     }
   else
     {				/* create new slot */
       register int cnt;
       register char **P;
 
+      old_env = *p_environ;
       for (P = *p_environ, cnt = 0; *P; ++P, ++cnt);
-      if (alloced)
-	{			/* just increase size */
-	  *p_environ = (char **) _realloc_r (reent_ptr, (char *) environ,
-					     (size_t) (sizeof (char *) * (cnt + 2)));
-	  if (!*p_environ)
-            {
-              ENV_UNLOCK;
-	      return -1;
-            }
+      if (alloced && alloced == *p_environ)
+	{			/* grow geometrically if full */
+	  if (cnt + 2 > alloced_size)
+	    {
+	      int size = alloced_size * 2;
+
+	      if (size < cnt + 2)
+		size = cnt + 2;
+	      P = (char **) _realloc_r (reent_ptr, (char *) alloced,
+					(size_t) (sizeof (char *) * size));
+	      if (!P)
+		{
+		  ENV_UNLOCK;
+		  return -1;
+		}
+	      *p_environ = alloced = P;
+	      alloced_size = size;
+	    }
 	}
       else
 	{			/* get new space */
-	  alloced = 1;		/* copy old entries into it */
-	  P = (char **) _malloc_r (reent_ptr, (size_t) (sizeof (char *) * (cnt + 2)));
+	  int size = cnt + 2 + (cnt + 2) / 2;
+
+	  P = (char **) _malloc_r (reent_ptr, (size_t) (sizeof (char *) * size));
 	  if (!P)
             {
               ENV_UNLOCK;
 	      return (-1);
             }
 	  memcpy((char *) P,(char *) *p_environ, cnt * sizeof (char *));
-	  *p_environ = P;
+	  *p_environ = alloced = P;
+	  alloced_size = size;
 	}
       (*p_environ)[cnt + 1] = NULL;
       offset = cnt;
@@ -120,6 +135,7 @@ _setenv_r (struct _reent *reent_ptr,
     }
   for (C = (*p_environ)[offset]; (*C = *name++) && *C != '='; ++C);
   for (*C++ = '='; (*C++ = *value++) != 0;);
+  __env_index_update (old_env, offset);
 
   ENV_UNLOCK;
 
@@ -148,6 +164,7 @@ _unsetenv_r (struct _reent *reent_ptr,
 
   while (_findenv_r (reent_ptr, name, &offset))	/* if set multiple times */
     { 
+      __env_index_reset ();
       for (P = &(*p_environ)[offset];; ++P)
         if (!(*P = *(P + 1)))
 	  break;
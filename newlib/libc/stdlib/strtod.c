@@ -263,8 +263,10 @@ _strtod_l (struct _reent *ptr, const char *__restrict s00, char **__restrict se,
 #ifdef Honor_FLT_ROUNDS
 	int rounding;
 #endif
-	const char *decimal_point = __get_numeric_locale(loc)->decimal_point;
-	int dec_len = strlen (decimal_point);
+	int c_numeric = __numeric_locale_is_C (loc);
+	const char *decimal_point = c_numeric ? "."
+				    : __get_numeric_locale(loc)->decimal_point;
+	int dec_len = c_numeric ? 1 : strlen (decimal_point);
 
 	delta = bs = bd = NULL;
 	sign = nz0 = nz = decpt = 0;
@@ -344,7 +346,7 @@ _strtod_l (struct _reent *ptr, const char *__restrict s00, char **__restrict se,
 		else
 			z = 10*z + c - '0';
 	nd0 = nd;
-	if (strncmp (s, decimal_point, dec_len) == 0)
+	if (c_numeric ? *s == '.' : strncmp (s, decimal_point, dec_len) == 0)
 		{
 		decpt = 1;
 		c = *(s += dec_len);
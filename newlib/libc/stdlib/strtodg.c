@@ -428,8 +428,10 @@ _strtodg_l (struct _reent *p, const char *s00, char **se, FPI *fpi, Long *exp,
 	Long L;
 	__ULong y, z;
 	_Bigint *ab, *bb, *bb1, *bd, *bd0, *bs, *delta, *rvb, *rvb0;
-	const char *decimal_point = __get_numeric_locale(loc)->decimal_point;
-	int dec_len = strlen (decimal_point);
+	int c_numeric = __numeric_locale_is_C (loc);
+	const char *decimal_point = c_numeric ? "."
+				    : __get_numeric_locale(loc)->decimal_point;
+	int dec_len = c_numeric ? 1 : strlen (decimal_point);
 
 	irv = STRTOG_Zero;
 	denorm = sign = nz0 = nz = 0;
@@ -488,7 +490,7 @@ _strtodg_l (struct _reent *p, const char *s00, char **se, FPI *fpi, Long *exp,
 			z = 10*z + c - '0';
 	nd0 = nd;
 #ifdef USE_LOCALE
-	if (strncmp (s, decimal_point, dec_len) == 0)
+	if (c_numeric ? *s == '.' : strncmp (s, decimal_point, dec_len) == 0)
 #else
 	if (c == '.')
 #endif
@@ -72,6 +72,100 @@ PORTABILITY
 #include "local.h"
 #include "../locale/setlocale.h"
 
+#ifdef _MB_CAPABLE
+/* Convert at most NWC wide characters at *SRC into at most LEN bytes of
+   UTF-8 at DST, or only count the bytes if DST is NULL.  Stop before a
+   NUL, a character that does not fit or is invalid, or a surrogate if
+   wchar_t is UTF-16, and leave those to __utf8_wctomb.  Return the number
+   of bytes, and advance *SRC past the characters converted.  */
+static size_t
+utf8_wcsntombs (char *dst, const wchar_t **src, size_t nwc, size_t len)
+{
+  const wchar_t *pwcs = *src;
+  unsigned char *ptr = (unsigned char *) dst;
+  size_t n = 0;
+  wint_t wch;
+
+  while (nwc > 0)
+    {
+      /* Four ASCII characters at a time, from an aligned block so that
+	 reading it never goes past the page holding the NUL at the end.  */
+      while (nwc >= 4 && len - n >= 4
+	     && !((unsigned long) pwcs & (4 * sizeof (wchar_t) - 1)))
+	{
+	  if ((((wint_t) pwcs[0] - 1) | ((wint_t) pwcs[1] - 1)
+	       | ((wint_t) pwcs[2] - 1) | ((wint_t) pwcs[3] - 1)) >= 0x7f)
+	    break;
+	  if (dst)
+	    {
+	      ptr[0] = pwcs[0];
+	      ptr[1] = pwcs[1];
+	      ptr[2] = pwcs[2];
+	      ptr[3] = pwcs[3];
+	      ptr += 4;
+	    }
+	  pwcs += 4;
+	  nwc -= 4;
+	  n += 4;
+	}
+      if (nwc == 0)
+	break;
+      wch = *pwcs;
+      if (wch - 1 < 0x7f)
+	{
+	  if (n >= len)
+	    break;
+	  if (dst)
+	    *ptr++ = wch;
+	  n += 1;
+	}
+      else if (wch >= 0x80 && wch <= 0x7ff)
+	{
+	  if (len - n < 2)
+	    break;
+	  if (dst)
+	    {
+	      *ptr++ = 0xc0 | (wch >> 6);
+	      *ptr++ = 0x80 | (wch & 0x3f);
+	    }
+	  n += 2;
+	}
+      else if (wch >= 0x800 && wch <= 0xffff)
+	{
+	  if (len - n < 3
+	      || (sizeof (wchar_t) == 2 && wch >= 0xd800 && wch <= 0xdfff))
+	    break;
+	  if (dst)
+	    {
+	      *ptr++ = 0xe0 | (wch >> 12);
+	      *ptr++ = 0x80 | ((wch >> 6) & 0x3f);
+	      *ptr++ = 0x80 | (wch & 0x3f);
+	    }
+	  n += 3;
+	}
+      else if (wch >= 0x10000 && wch <= 0x10ffff)
+	{
+	  if (len - n < 4)
+	    break;
+	  if (dst)
+	    {
+	      *ptr++ = 0xf0 | (wch >> 18);
+	      *ptr++ = 0x80 | ((wch >> 12) & 0x3f);
+	      *ptr++ = 0x80 | ((wch >> 6) & 0x3f);
+	      *ptr++ = 0x80 | (wch & 0x3f);
+	    }
+	  n += 4;
+	}
+      else
+	break;
+      pwcs++;
+      nwc--;
+    }
+  *src = pwcs;
+  return n;
+}
+#endif /* _MB_CAPABLE */
+
 size_t
 _wcsnrtombs_l (struct _reent *r, char *dst, const wchar_t **src, size_t nwc,
 	       size_t len, mbstate_t *ps, struct __locale_t *loc)
@@ -97,6 +191,23 @@ _wcsnrtombs_l (struct _reent *r, char *dst, const wchar_t **src, size_t nwc,
   n = 0;
   pwcs = (wchar_t *)(*src);
 
+#ifdef _MB_CAPABLE
+  /* The bulk of the string into UTF-8, in the initial shift state.  */
+  if (ps->__count == 0 && loc->wctomb == __utf8_wctomb)
+    {
+      const wchar_t *end = pwcs;
+
+      n = utf8_wcsntombs (dst, &end, nwc, len);
+      nwc -= end - pwcs;
+      pwcs = (wchar_t *) end;
+      if (dst)
+	{
+	  ptr += n;
+	  *src = end;
+	}
+    }
+#endif
+
   while (n < len && nwc-- > 0)
     {
       int count = ps->__count;
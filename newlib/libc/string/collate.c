@@ -0,0 +1,382 @@
+/*
+ * Collation of the locales other than "C", for strcoll, strxfrm, wcscoll
+ * and wcsxfrm.
+ *
+ * Strings are compared as by the Unicode Collation Algorithm (UTS #10),
+ * on four levels: base characters first, then accents, then case and
+ * variants, and then the code points themselves, so that only equal
+ * strings collate equal.  The collation elements of a character, its
+ * full decomposition with lowercase letters and ASCII digits, come from
+ * collate.t, which mkstages generates from UnicodeData.txt, and their
+ * weights from the Unicode general category:
+ *
+ *   level 1  spaces < punctuation < symbols < numbers < letters < other
+ *	      characters, each group in code point order; marks, control
+ *	      and format characters have no weight
+ *   level 2  the mark, higher than the common weight of everything else;
+ *	      control and format characters have no weight
+ *   level 3  the variant of a compatibility decomposition, and case
+ *   level 4  the code point of every character
+ *
+ * There is no DUCET and no tailoring, so scripts are sorted in code point
+ * order, and so are the letters of a script which do not decompose, apart
+ * from a few Latin ones listed in mkstages.
+ *
+ * strxfrm writes the weights of each level in turn, separated by 0x01,
+ * in bytes from 0x02 to 0xFF, so that comparing two keys with strcmp or
+ * memcmp gives the same result as comparing their strings with strcoll.
+ * wcsxfrm writes the same bytes as wide characters.
+ */
+
+#include <_ansi.h>
+#include <errno.h>
+#include <limits.h>
+#include <stdint.h>
+#include <string.h>
+#include <wchar.h>
+#include "collate.h"
+
+#ifdef _COLLATE_UCA
+#include "../stdlib/local.h"
+#include "../ctype/categories.h"
+#include "collate.t"
+
+#define COLLATE_LEVELS	4
+
+/* Level 1 weights are the code point plus the first weight of its group,
+   at most 6 * 0x110000 + 0x100. */
+#define MAX_CODE	0x10FFFF
+#define GROUP(g)	((uint_least32_t) (g) * (MAX_CODE + 1))
+
+/* A byte which does not start a valid character, above every code point
+   so that it differs from any of them, even from a UTF-8 encoded lone
+   surrogate. */
+#define INVALID_BYTE(b)	(MAX_CODE + 1 + (b))
+
+/* A collation element: code point and level 3 weight. */
+#define ELEMENT_CODE(e)		((e) & 0x1FFFFF)
+#define ELEMENT_TERTIARY(e)	((e) >> 21)
+
+/* Expansions in collate_blocks: flag, length and index. */
+#define EXPANSION		0x80000000
+#define EXPANSION_LENGTH(v)	(((v) >> 16) & 0x7FFF)
+#define EXPANSION_INDEX(v)	((v) & 0xFFFF)
+
+/* Source of the characters of a string, and its collation elements. */
+struct source
+{
+  const char *s;		/* Multibyte string, or NULL */
+  const wchar_t *ws;		/* Wide-character string */
+  mbtowc_p mbtowc;
+  mbstate_t state;
+  int nelem;			/* Elements of the current character */
+  int next;			/* Next one of them */
+  uint_least32_t elem[COLLATE_MAX_EXPANSION];
+};
+
+static void
+start (struct source *src, const char *s, const wchar_t *ws, mbtowc_p f)
+{
+  src->s = s;
+  src->ws = ws;
+  src->mbtowc = f;
+  memset (&src->state, 0, sizeof src->state);
+  src->nelem = src->next = 0;
+}
+
+/* The next character of SRC, or 0 at its end.  A byte which does not
+   start a valid character stands for itself, as INVALID_BYTE, and
+   characters above U+10FFFF are taken as U+10FFFF. */
+static uint_least32_t
+next_char (struct source *src)
+{
+  wchar_t wc;
+  int n;
+
+  if (!src->s)
+    {
+      if (*src->ws == L'\0')
+	return 0;
+      wc = *src->ws++;
+    }
+  else if ((n = src->mbtowc (_REENT, &wc, src->s, MB_LEN_MAX,
+			     &src->state)) > 0)
+    src->s += n;
+  else if (n == 0)
+    return 0;
+  else
+    {
+      memset (&src->state, 0, sizeof src->state);
+      return INVALID_BYTE (*(const unsigned char *) src->s++);
+    }
+  return (uint_least32_t) wc > MAX_CODE ? MAX_CODE : (uint_least32_t) wc;
+}
+
+/* Collation elements of C. */
+static int
+elements (uint_least32_t c, uint_least32_t *elem)
+{
+  uint_least32_t v;
+
+  /* Latin-1 characters come first in collate_blocks */
+  if (c < 0x100)
+    v = collate_blocks[c];
+  else if (c > MAX_CODE)
+    v = 0;
+  else
+    v = collate_blocks[collate_pages[collate_index[c >> COLLATE_PAGE_SHIFT]
+				     + ((c >> COLLATE_BLOCK_SHIFT)
+					& ((1 << (COLLATE_PAGE_SHIFT - COLLATE_BLOCK_SHIFT)) - 1))]
+			 + (c & ((1 << COLLATE_BLOCK_SHIFT) - 1))];
+  if (v == 0)
+    {
+      elem[0] = c;
+      return 1;
+    }
+  if (!(v & EXPANSION))
+    {
+      elem[0] = v;
+      return 1;
+    }
+  memcpy (elem, &collate_expansions[EXPANSION_INDEX (v)],
+	  EXPANSION_LENGTH (v) * sizeof *elem);
+  return EXPANSION_LENGTH (v);
+}
+
+/* Weight of collation element E at LEVEL (0 to 2), 0 if it has none. */
+static uint_least32_t
+weight (uint_least32_t e, int level)
+{
+  uint_least32_t c = ELEMENT_CODE (e);
+  int group;
+
+  switch ((int) category (c))
+    {
+    case CAT_Cc:
+    case CAT_Cf:
+      return 0;
+    case CAT_Mc:
+    case CAT_Me:
+    case CAT_Mn:
+      group = 0;
+      break;
+    case CAT_Zl:
+    case CAT_Zp:
+    case CAT_Zs:
+      group = 1;
+      break;
+    case CAT_Pc:
+    case CAT_Pd:
+    case CAT_Pe:
+    case CAT_Pf:
+    case CAT_Pi:
+    case CAT_Po:
+    case CAT_Ps:
+      group = 2;
+      break;
+    case CAT_Sc:
+    case CAT_Sk:
+    case CAT_Sm:
+    case CAT_So:
+      group = 3;
+      break;
+    case CAT_Nd:
+    case CAT_No:
+      group = 4;
+      break;
+    case CAT_LC:
+    case CAT_Ll:
+    case CAT_Lm:
+    case CAT_Lo:
+    case CAT_Lt:
+    case CAT_Lu:
+    case CAT_Nl:
+      group = 5;
+      break;
+    default:
+      group = 6;
+      break;
+    }
+  if (level == 0)
+    return group ? GROUP (group - 1) + c + 1 : 0;
+  if (level == 1)
+    return group ? 1 : c + 2;
+  return ELEMENT_TERTIARY (e) + 1;
+}
+
+/* The next weight of SRC at LEVEL, or 0 at its end. */
+static uint_least32_t
+next_weight (struct source *src, int level)
+{
+  uint_least32_t c, w;
+
+  for (;;)
+    {
+      if (src->next == src->nelem)
+	{
+	  if ((c = next_char (src)) == 0)
+	    return 0;
+	  if (level == COLLATE_LEVELS - 1)
+	    return c;
+	  src->nelem = elements (c, src->elem);
+	  src->next = 0;
+	}
+      if ((w = weight (src->elem[src->next++], level)) != 0)
+	return w;
+    }
+}
+
+static int
+compare (const char *sa, const wchar_t *wa, const char *sb,
+	 const wchar_t *wb, mbtowc_p f)
+{
+  struct source a, b;
+  uint_least32_t x, y;
+  int level, err = errno;
+
+  for (level = 0; level < COLLATE_LEVELS; level++)
+    {
+      start (&a, sa, wa, f);
+      start (&b, sb, wb, f);
+      do
+	{
+	  x = next_weight (&a, level);
+	  y = next_weight (&b, level);
+	}
+      while (x == y && x != 0);
+      if (x != y)
+	{
+	  errno = err;
+	  return x < y ? -1 : 1;
+	}
+    }
+  errno = err;
+  return 0;
+}
+
+/* Sort key being written to OUT or WOUT, of N elements. */
+struct key
+{
+  char *out;
+  wchar_t *wout;
+  size_t n;
+  size_t len;
+};
+
+static void
+put (struct key *key, int byte)
+{
+  if (key->len < key->n)
+    {
+      if (key->out)
+	key->out[key->len] = byte;
+      else
+	key->wout[key->len] = byte;
+    }
+  key->len++;
+}
+
+/* Puts W, less than 254^3, as three digits of base 254. */
+static void
+put3 (struct key *key, uint_least32_t w)
+{
+  put (key, w / (254 * 254) + 2);
+  put (key, w / 254 % 254 + 2);
+  put (key, w % 254 + 2);
+}
+
+/* Writes the sort key of S or WS to KEY.  Level 1 weights and the code
+   points of level 4 take three bytes, the common level 2 weight is 0x02
+   and that of a mark is 0x03 and the mark, and level 3 weights take one
+   byte; the levels are separated by 0x01, which is less than any weight,
+   so that a string sorts before its longer continuations. */
+static size_t
+transform (struct key *key, const char *s, const wchar_t *ws, mbtowc_p f)
+{
+  struct source src;
+  uint_least32_t w;
+  int level, err = errno;
+
+  for (level = 0; level < COLLATE_LEVELS; level++)
+    {
+      start (&src, s, ws, f);
+      if (level > 0)
+	put (key, 0x01);
+      while ((w = next_weight (&src, level)) != 0)
+	switch (level)
+	  {
+	  case 1:
+	    if (w == 1)
+	      put (key, 0x02);
+	    else
+	      {
+		put (key, 0x03);
+		put3 (key, w - 2);
+	      }
+	    break;
+	  case 2:
+	    put (key, w + 1);
+	    break;
+	  default:
+	    put3 (key, w);
+	    break;
+	  }
+    }
+  put (key, 0);
+  errno = err;
+  return key->len - 1;
+}
+
+int
+__collate_strcoll (const char *a,
+	const char *b,
+	struct __locale_t *locale)
+{
+  mbtowc_p f = locale->collate_mbtowc;
+  size_t i;
+
+  /* Equal characters at the start have equal weights at every level. */
+  for (i = 0; a[i] == b[i]; i++)
+    if (a[i] == '\0')
+      return 0;
+  if (f == __utf8_mbtowc)
+    while (i > 0 && (a[i] & 0xC0) == 0x80)
+      i--;
+  return compare (a + i, NULL, b + i, NULL, f);
+}
+
+size_t
+__collate_strxfrm (char *__restrict s1,
+	const char *__restrict s2,
+	size_t n,
+	struct __locale_t *locale)
+{
+  struct key key = { s1, NULL, n, 0 };
+
+  return transform (&key, s2, NULL, locale->collate_mbtowc);
+}
+
+int
+__collate_wcscoll (const wchar_t *a,
+	const wchar_t *b,
+	struct __locale_t *locale)
+{
+  size_t i;
+
+  for (i = 0; a[i] == b[i]; i++)
+    if (a[i] == L'\0')
+      return 0;
+  return compare (NULL, a + i, NULL, b + i, NULL);
+}
+
+size_t
+__collate_wcsxfrm (wchar_t *__restrict s1,
+	const wchar_t *__restrict s2,
+	size_t n,
+	struct __locale_t *locale)
+{
+  struct key key = { NULL, s1, n, 0 };
+
+  return transform (&key, NULL, s2, NULL);
+}
+#endif /* _COLLATE_UCA */
@@ -0,0 +1,22 @@
+/* Collation of the locales other than "C", see collate.c. */
+
+#ifndef _COLLATE_H_
+#define _COLLATE_H_
+
+#include <_ansi.h>
+#include <newlib.h>
+#include <wchar.h>
+#include "../locale/setlocale.h"
+
+/* Cygwin provides its own collation. */
+#if defined (_MB_CAPABLE) && !defined (__CYGWIN__)
+#define _COLLATE_UCA
+
+int __collate_strcoll (const char *, const char *, struct __locale_t *);
+size_t __collate_strxfrm (char *, const char *, size_t, struct __locale_t *);
+int __collate_wcscoll (const wchar_t *, const wchar_t *, struct __locale_t *);
+size_t __collate_wcsxfrm (wchar_t *, const wchar_t *, size_t,
+			  struct __locale_t *);
+#endif
+
+#endif /* _COLLATE_H_ */
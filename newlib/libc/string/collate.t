@@ -0,0 +1,2761 @@
+/* generated by mkstages from UnicodeData.txt, do not edit */
+
+#define COLLATE_MAX_EXPANSION 18
+
+static const uint_least32_t collate_expansions[5513] = {
+  0x04000020, 0x04000308, 0x04000020, 0x04000304, 0x04000020, 0x04000301,
+  0x04000020, 0x04000327, 0x03C00031, 0x03C02044, 0x03C00034, 0x03C00031,
+  0x03C02044, 0x03C00032, 0x03C00033, 0x03C02044, 0x03C00034, 0x00200061,
+  0x00000300, 0x00200061, 0x00000301, 0x00200061, 0x00000302, 0x00200061,
+  0x00000303, 0x00200061, 0x00000308, 0x00200061, 0x0000030A, 0x04200061,
+  0x04200065, 0x00200063, 0x00000327, 0x00200065, 0x00000300, 0x00200065,
+  0x00000301, 0x00200065, 0x00000302, 0x00200065, 0x00000308, 0x00200069,
+  0x00000300, 0x00200069, 0x00000301, 0x00200069, 0x00000302, 0x00200069,
+  0x00000308, 0x0020006E, 0x00000303, 0x0020006F, 0x00000300, 0x0020006F,
+  0x00000301, 0x0020006F, 0x00000302, 0x0020006F, 0x00000303, 0x0020006F,
+  0x00000308, 0x0020006F, 0x00000338, 0x00200075, 0x00000300, 0x00200075,
+  0x00000301, 0x00200075, 0x00000302, 0x00200075, 0x00000308, 0x00200079,
+  0x00000301, 0x04000073, 0x04000073, 0x00000061, 0x00000300, 0x00000061,
+  0x00000301, 0x00000061, 0x00000302, 0x00000061, 0x00000303, 0x00000061,
+  0x00000308, 0x00000061, 0x0000030A, 0x04000061, 0x04000065, 0x00000063,
+  0x00000327, 0x00000065, 0x00000300, 0x00000065, 0x00000301, 0x00000065,
+  0x00000302, 0x00000065, 0x00000308, 0x00000069, 0x00000300, 0x00000069,
+  0x00000301, 0x00000069, 0x00000302, 0x00000069, 0x00000308, 0x0000006E,
+  0x00000303, 0x0000006F, 0x00000300, 0x0000006F, 0x00000301, 0x0000006F,
+  0x00000302, 0x0000006F, 0x00000303, 0x0000006F, 0x00000308, 0x0000006F,
+  0x00000338, 0x00000075, 0x00000300, 0x00000075, 0x00000301, 0x00000075,
+  0x00000302, 0x00000075, 0x00000308, 0x00000079, 0x00000301, 0x00000079,
+  0x00000308, 0x00200061, 0x00000304, 0x00000061, 0x00000304, 0x00200061,
+  0x00000306, 0x00000061, 0x00000306, 0x00200061, 0x00000328, 0x00000061,
+  0x00000328, 0x00200063, 0x00000301, 0x00000063, 0x00000301, 0x00200063,
+  0x00000302, 0x00000063, 0x00000302, 0x00200063, 0x00000307, 0x00000063,
+  0x00000307, 0x00200063, 0x0000030C, 0x00000063, 0x0000030C, 0x00200064,
+  0x0000030C, 0x00000064, 0x0000030C, 0x00200064, 0x00000335, 0x00000064,
+  0x00000335, 0x00200065, 0x00000304, 0x00000065, 0x00000304, 0x00200065,
+  0x00000306, 0x00000065, 0x00000306, 0x00200065, 0x00000307, 0x00000065,
+  0x00000307, 0x00200065, 0x00000328, 0x00000065, 0x00000328, 0x00200065,
+  0x0000030C, 0x00000065, 0x0000030C, 0x00200067, 0x00000302, 0x00000067,
+  0x00000302, 0x00200067, 0x00000306, 0x00000067, 0x00000306, 0x00200067,
+  0x00000307, 0x00000067, 0x00000307, 0x00200067, 0x00000327, 0x00000067,
+  0x00000327, 0x00200068, 0x00000302, 0x00000068, 0x00000302, 0x00200068,
+  0x00000335, 0x00000068, 0x00000335, 0x00200069, 0x00000303, 0x00000069,
+  0x00000303, 0x00200069, 0x00000304, 0x00000069, 0x00000304, 0x00200069,
+  0x00000306, 0x00000069, 0x00000306, 0x00200069, 0x00000328, 0x00000069,
+  0x00000328, 0x00200069, 0x00000307, 0x04200069, 0x0420006A, 0x04000069,
+  0x0400006A, 0x0020006A, 0x00000302, 0x0000006A, 0x00000302, 0x0020006B,
+  0x00000327, 0x0000006B, 0x00000327, 0x0020006C, 0x00000301, 0x0000006C,
+  0x00000301, 0x0020006C, 0x00000327, 0x0000006C, 0x00000327, 0x0020006C,
+  0x0000030C, 0x0000006C, 0x0000030C, 0x0420006C, 0x040000B7, 0x0400006C,
+  0x040000B7, 0x0020006C, 0x00000337, 0x0000006C, 0x00000337, 0x0020006E,
+  0x00000301, 0x0000006E, 0x00000301, 0x0020006E, 0x00000327, 0x0000006E,
+  0x00000327, 0x0020006E, 0x0000030C, 0x0000006E, 0x0000030C, 0x040002BC,
+  0x0400006E, 0x0020006F, 0x00000304, 0x0000006F, 0x00000304, 0x0020006F,
+  0x00000306, 0x0000006F, 0x00000306, 0x0020006F, 0x0000030B, 0x0000006F,
+  0x0000030B, 0x0420006F, 0x04200065, 0x0400006F, 0x04000065, 0x00200072,
+  0x00000301, 0x00000072, 0x00000301, 0x00200072, 0x00000327, 0x00000072,
+  0x00000327, 0x00200072, 0x0000030C, 0x00000072, 0x0000030C, 0x00200073,
+  0x00000301, 0x00000073, 0x00000301, 0x00200073, 0x00000302, 0x00000073,
+  0x00000302, 0x00200073, 0x00000327, 0x00000073, 0x00000327, 0x00200073,
+  0x0000030C, 0x00000073, 0x0000030C, 0x00200074, 0x00000327, 0x00000074,
+  0x00000327, 0x00200074, 0x0000030C, 0x00000074, 0x0000030C, 0x00200074,
+  0x00000335, 0x00000074, 0x00000335, 0x00200075, 0x00000303, 0x00000075,
+  0x00000303, 0x00200075, 0x00000304, 0x00000075, 0x00000304, 0x00200075,
+  0x00000306, 0x00000075, 0x00000306, 0x00200075, 0x0000030A, 0x00000075,
+  0x0000030A, 0x00200075, 0x0000030B, 0x00000075, 0x0000030B, 0x00200075,
+  0x00000328, 0x00000075, 0x00000328, 0x00200077, 0x00000302, 0x00000077,
+  0x00000302, 0x00200079, 0x00000302, 0x00000079, 0x00000302, 0x00200079,
+  0x00000308, 0x0020007A, 0x00000301, 0x0000007A, 0x00000301, 0x0020007A,
+  0x00000307, 0x0000007A, 0x00000307, 0x0020007A, 0x0000030C, 0x0000007A,
+  0x0000030C, 0x0020006F, 0x0000031B, 0x0000006F, 0x0000031B, 0x00200075,
+  0x0000031B, 0x00000075, 0x0000031B, 0x04200064, 0x0420007A, 0x0400030C,
+  0x04200064, 0x0400007A, 0x0400030C, 0x04000064, 0x0400007A, 0x0400030C,
+  0x0420006C, 0x0420006A, 0x0420006C, 0x0400006A, 0x0400006C, 0x0400006A,
+  0x0420006E, 0x0420006A, 0x0420006E, 0x0400006A, 0x0400006E, 0x0400006A,
+  0x00200061, 0x0000030C, 0x00000061, 0x0000030C, 0x00200069, 0x0000030C,
+  0x00000069, 0x0000030C, 0x0020006F, 0x0000030C, 0x0000006F, 0x0000030C,
+  0x00200075, 0x0000030C, 0x00000075, 0x0000030C, 0x00200075, 0x00000308,
+  0x00000304, 0x00000075, 0x00000308, 0x00000304, 0x00200075, 0x00000308,
+  0x00000301, 0x00000075, 0x00000308, 0x00000301, 0x00200075, 0x00000308,
+  0x0000030C, 0x00000075, 0x00000308, 0x0000030C, 0x00200075, 0x00000308,
+  0x00000300, 0x00000075, 0x00000308, 0x00000300, 0x00200061, 0x00000308,
+  0x00000304, 0x00000061, 0x00000308, 0x00000304, 0x00200061, 0x00000307,
+  0x00000304, 0x00000061, 0x00000307, 0x00000304, 0x04200061, 0x04200065,
+  0x00000304, 0x04000061, 0x04000065, 0x00000304, 0x00200067, 0x0000030C,
+  0x00000067, 0x0000030C, 0x0020006B, 0x0000030C, 0x0000006B, 0x0000030C,
+  0x0020006F, 0x00000328, 0x0000006F, 0x00000328, 0x0020006F, 0x00000328,
+  0x00000304, 0x0000006F, 0x00000328, 0x00000304, 0x00200292, 0x0000030C,
+  0x00000292, 0x0000030C, 0x0000006A, 0x0000030C, 0x04200064, 0x0420007A,
+  0x04200064, 0x0400007A, 0x04000064, 0x0400007A, 0x00200067, 0x00000301,
+  0x00000067, 0x00000301, 0x0020006E, 0x00000300, 0x0000006E, 0x00000300,
+  0x00200061, 0x0000030A, 0x00000301, 0x00000061, 0x0000030A, 0x00000301,
+  0x04200061, 0x04200065, 0x00000301, 0x04000061, 0x04000065, 0x00000301,
+  0x0020006F, 0x00000338, 0x00000301, 0x0000006F, 0x00000338, 0x00000301,
+  0x00200061, 0x0000030F, 0x00000061, 0x0000030F, 0x00200061, 0x00000311,
+  0x00000061, 0x00000311, 0x00200065, 0x0000030F, 0x00000065, 0x0000030F,
+  0x00200065, 0x00000311, 0x00000065, 0x00000311, 0x00200069, 0x0000030F,
+  0x00000069, 0x0000030F, 0x00200069, 0x00000311, 0x00000069, 0x00000311,
+  0x0020006F, 0x0000030F, 0x0000006F, 0x0000030F, 0x0020006F, 0x00000311,
+  0x0000006F, 0x00000311, 0x00200072, 0x0000030F, 0x00000072, 0x0000030F,
+  0x00200072, 0x00000311, 0x00000072, 0x00000311, 0x00200075, 0x0000030F,
+  0x00000075, 0x0000030F, 0x00200075, 0x00000311, 0x00000075, 0x00000311,
+  0x00200073, 0x00000326, 0x00000073, 0x00000326, 0x00200074, 0x00000326,
+  0x00000074, 0x00000326, 0x00200068, 0x0000030C, 0x00000068, 0x0000030C,
+  0x00200061, 0x00000307, 0x00000061, 0x00000307, 0x00200065, 0x00000327,
+  0x00000065, 0x00000327, 0x0020006F, 0x00000308, 0x00000304, 0x0000006F,
+  0x00000308, 0x00000304, 0x0020006F, 0x00000303, 0x00000304, 0x0000006F,
+  0x00000303, 0x00000304, 0x0020006F, 0x00000307, 0x0000006F, 0x00000307,
+  0x0020006F, 0x00000307, 0x00000304, 0x0000006F, 0x00000307, 0x00000304,
+  0x00200079, 0x00000304, 0x00000079, 0x00000304, 0x04000020, 0x04000306,
+  0x04000020, 0x04000307, 0x04000020, 0x0400030A, 0x04000020, 0x04000328,
+  0x04000020, 0x04000303, 0x04000020, 0x0400030B, 0x00000308, 0x00000301,
+  0x04000020, 0x04000345, 0x04000020, 0x04000301, 0x04000020, 0x04000308,
+  0x00000301, 0x002003B1, 0x00000301, 0x002003B5, 0x00000301, 0x002003B7,
+  0x00000301, 0x002003B9, 0x00000301, 0x002003BF, 0x00000301, 0x002003C5,
+  0x00000301, 0x002003C9, 0x00000301, 0x000003B9, 0x00000308, 0x00000301,
+  0x002003B9, 0x00000308, 0x002003C5, 0x00000308, 0x000003B1, 0x00000301,
+  0x000003B5, 0x00000301, 0x000003B7, 0x00000301, 0x000003B9, 0x00000301,
+  0x000003C5, 0x00000308, 0x00000301, 0x000003B9, 0x00000308, 0x000003C5,
+  0x00000308, 0x000003BF, 0x00000301, 0x000003C5, 0x00000301, 0x000003C9,
+  0x00000301, 0x042003C5, 0x00000301, 0x042003C5, 0x00000308, 0x00200435,
+  0x00000300, 0x00200435, 0x00000308, 0x00200433, 0x00000301, 0x00200456,
+  0x00000308, 0x0020043A, 0x00000301, 0x00200438, 0x00000300, 0x00200443,
+  0x00000306, 0x00200438, 0x00000306, 0x00000438, 0x00000306, 0x00000435,
+  0x00000300, 0x00000435, 0x00000308, 0x00000433, 0x00000301, 0x00000456,
+  0x00000308, 0x0000043A, 0x00000301, 0x00000438, 0x00000300, 0x00000443,
+  0x00000306, 0x00200475, 0x0000030F, 0x00000475, 0x0000030F, 0x00200436,
+  0x00000306, 0x00000436, 0x00000306, 0x00200430, 0x00000306, 0x00000430,
+  0x00000306, 0x00200430, 0x00000308, 0x00000430, 0x00000308, 0x00200435,
+  0x00000306, 0x00000435, 0x00000306, 0x002004D9, 0x00000308, 0x000004D9,
+  0x00000308, 0x00200436, 0x00000308, 0x00000436, 0x00000308, 0x00200437,
+  0x00000308, 0x00000437, 0x00000308, 0x00200438, 0x00000304, 0x00000438,
+  0x00000304, 0x00200438, 0x00000308, 0x00000438, 0x00000308, 0x0020043E,
+  0x00000308, 0x0000043E, 0x00000308, 0x002004E9, 0x00000308, 0x000004E9,
+  0x00000308, 0x0020044D, 0x00000308, 0x0000044D, 0x00000308, 0x00200443,
+  0x00000304, 0x00000443, 0x00000304, 0x00200443, 0x00000308, 0x00000443,
+  0x00000308, 0x00200443, 0x0000030B, 0x00000443, 0x0000030B, 0x00200447,
+  0x00000308, 0x00000447, 0x00000308, 0x0020044B, 0x00000308, 0x0000044B,
+  0x00000308, 0x04000565, 0x04000582, 0x00000627, 0x00000653, 0x00000627,
+  0x00000654, 0x00000648, 0x00000654, 0x00000627, 0x00000655, 0x0000064A,
+  0x00000654, 0x04000627, 0x04000674, 0x04000648, 0x04000674, 0x040006C7,
+  0x04000674, 0x0400064A, 0x04000674, 0x000006D5, 0x00000654, 0x000006C1,
+  0x00000654, 0x000006D2, 0x00000654, 0x00000928, 0x0000093C, 0x00000930,
+  0x0000093C, 0x00000933, 0x0000093C, 0x00000915, 0x0000093C, 0x00000916,
+  0x0000093C, 0x00000917, 0x0000093C, 0x0000091C, 0x0000093C, 0x00000921,
+  0x0000093C, 0x00000922, 0x0000093C, 0x0000092B, 0x0000093C, 0x0000092F,
+  0x0000093C, 0x000009C7, 0x000009BE, 0x000009C7, 0x000009D7, 0x000009A1,
+  0x000009BC, 0x000009A2, 0x000009BC, 0x000009AF, 0x000009BC, 0x00000A32,
+  0x00000A3C, 0x00000A38, 0x00000A3C, 0x00000A16, 0x00000A3C, 0x00000A17,
+  0x00000A3C, 0x00000A1C, 0x00000A3C, 0x00000A2B, 0x00000A3C, 0x00000B47,
+  0x00000B56, 0x00000B47, 0x00000B3E, 0x00000B47, 0x00000B57, 0x00000B21,
+  0x00000B3C, 0x00000B22, 0x00000B3C, 0x00000B92, 0x00000BD7, 0x00000BC6,
+  0x00000BBE, 0x00000BC7, 0x00000BBE, 0x00000BC6, 0x00000BD7, 0x00000C46,
+  0x00000C56, 0x00000CBF, 0x00000CD5, 0x00000CC6, 0x00000CD5, 0x00000CC6,
+  0x00000CD6, 0x00000CC6, 0x00000CC2, 0x00000CC6, 0x00000CC2, 0x00000CD5,
+  0x00000D46, 0x00000D3E, 0x00000D47, 0x00000D3E, 0x00000D46, 0x00000D57,
+  0x00000DD9, 0x00000DCA, 0x00000DD9, 0x00000DCF, 0x00000DD9, 0x00000DCF,
+  0x00000DCA, 0x00000DD9, 0x00000DDF, 0x04000E4D, 0x04000E32, 0x04000ECD,
+  0x04000EB2, 0x04000EAB, 0x04000E99, 0x04000EAB, 0x04000EA1, 0x00000F42,
+  0x00000FB7, 0x00000F4C, 0x00000FB7, 0x00000F51, 0x00000FB7, 0x00000F56,
+  0x00000FB7, 0x00000F5B, 0x00000FB7, 0x00000F40, 0x00000FB5, 0x00000F71,
+  0x00000F72, 0x00000F71, 0x00000F74, 0x00000FB2, 0x00000F80, 0x04000FB2,
+  0x04000F71, 0x04000F80, 0x00000FB3, 0x00000F80, 0x04000FB3, 0x04000F71,
+  0x04000F80, 0x00000F71, 0x00000F80, 0x00000F92, 0x00000FB7, 0x00000F9C,
+  0x00000FB7, 0x00000FA1, 0x00000FB7, 0x00000FA6, 0x00000FB7, 0x00000FAB,
+  0x00000FB7, 0x00000F90, 0x00000FB5, 0x00001025, 0x0000102E, 0x00001B05,
+  0x00001B35, 0x00001B07, 0x00001B35, 0x00001B09, 0x00001B35, 0x00001B0B,
+  0x00001B35, 0x00001B0D, 0x00001B35, 0x00001B11, 0x00001B35, 0x00001B3A,
+  0x00001B35, 0x00001B3C, 0x00001B35, 0x00001B3E, 0x00001B35, 0x00001B3F,
+  0x00001B35, 0x00001B42, 0x00001B35, 0x04200061, 0x04200065, 0x00200061,
+  0x00000325, 0x00000061, 0x00000325, 0x00200062, 0x00000307, 0x00000062,
+  0x00000307, 0x00200062, 0x00000323, 0x00000062, 0x00000323, 0x00200062,
+  0x00000331, 0x00000062, 0x00000331, 0x00200063, 0x00000327, 0x00000301,
+  0x00000063, 0x00000327, 0x00000301, 0x00200064, 0x00000307, 0x00000064,
+  0x00000307, 0x00200064, 0x00000323, 0x00000064, 0x00000323, 0x00200064,
+  0x00000331, 0x00000064, 0x00000331, 0x00200064, 0x00000327, 0x00000064,
+  0x00000327, 0x00200064, 0x0000032D, 0x00000064, 0x0000032D, 0x00200065,
+  0x00000304, 0x00000300, 0x00000065, 0x00000304, 0x00000300, 0x00200065,
+  0x00000304, 0x00000301, 0x00000065, 0x00000304, 0x00000301, 0x00200065,
+  0x0000032D, 0x00000065, 0x0000032D, 0x00200065, 0x00000330, 0x00000065,
+  0x00000330, 0x00200065, 0x00000327, 0x00000306, 0x00000065, 0x00000327,
+  0x00000306, 0x00200066, 0x00000307, 0x00000066, 0x00000307, 0x00200067,
+  0x00000304, 0x00000067, 0x00000304, 0x00200068, 0x00000307, 0x00000068,
+  0x00000307, 0x00200068, 0x00000323, 0x00000068, 0x00000323, 0x00200068,
+  0x00000308, 0x00000068, 0x00000308, 0x00200068, 0x00000327, 0x00000068,
+  0x00000327, 0x00200068, 0x0000032E, 0x00000068, 0x0000032E, 0x00200069,
+  0x00000330, 0x00000069, 0x00000330, 0x00200069, 0x00000308, 0x00000301,
+  0x00000069, 0x00000308, 0x00000301, 0x0020006B, 0x00000301, 0x0000006B,
+  0x00000301, 0x0020006B, 0x00000323, 0x0000006B, 0x00000323, 0x0020006B,
+  0x00000331, 0x0000006B, 0x00000331, 0x0020006C, 0x00000323, 0x0000006C,
+  0x00000323, 0x0020006C, 0x00000323, 0x00000304, 0x0000006C, 0x00000323,
+  0x00000304, 0x0020006C, 0x00000331, 0x0000006C, 0x00000331, 0x0020006C,
+  0x0000032D, 0x0000006C, 0x0000032D, 0x0020006D, 0x00000301, 0x0000006D,
+  0x00000301, 0x0020006D, 0x00000307, 0x0000006D, 0x00000307, 0x0020006D,
+  0x00000323, 0x0000006D, 0x00000323, 0x0020006E, 0x00000307, 0x0000006E,
+  0x00000307, 0x0020006E, 0x00000323, 0x0000006E, 0x00000323, 0x0020006E,
+  0x00000331, 0x0000006E, 0x00000331, 0x0020006E, 0x0000032D, 0x0000006E,
+  0x0000032D, 0x0020006F, 0x00000303, 0x00000301, 0x0000006F, 0x00000303,
+  0x00000301, 0x0020006F, 0x00000303, 0x00000308, 0x0000006F, 0x00000303,
+  0x00000308, 0x0020006F, 0x00000304, 0x00000300, 0x0000006F, 0x00000304,
+  0x00000300, 0x0020006F, 0x00000304, 0x00000301, 0x0000006F, 0x00000304,
+  0x00000301, 0x00200070, 0x00000301, 0x00000070, 0x00000301, 0x00200070,
+  0x00000307, 0x00000070, 0x00000307, 0x00200072, 0x00000307, 0x00000072,
+  0x00000307, 0x00200072, 0x00000323, 0x00000072, 0x00000323, 0x00200072,
+  0x00000323, 0x00000304, 0x00000072, 0x00000323, 0x00000304, 0x00200072,
+  0x00000331, 0x00000072, 0x00000331, 0x00200073, 0x00000307, 0x00000073,
+  0x00000307, 0x00200073, 0x00000323, 0x00000073, 0x00000323, 0x00200073,
+  0x00000301, 0x00000307, 0x00000073, 0x00000301, 0x00000307, 0x00200073,
+  0x0000030C, 0x00000307, 0x00000073, 0x0000030C, 0x00000307, 0x00200073,
+  0x00000323, 0x00000307, 0x00000073, 0x00000323, 0x00000307, 0x00200074,
+  0x00000307, 0x00000074, 0x00000307, 0x00200074, 0x00000323, 0x00000074,
+  0x00000323, 0x00200074, 0x00000331, 0x00000074, 0x00000331, 0x00200074,
+  0x0000032D, 0x00000074, 0x0000032D, 0x00200075, 0x00000324, 0x00000075,
+  0x00000324, 0x00200075, 0x00000330, 0x00000075, 0x00000330, 0x00200075,
+  0x0000032D, 0x00000075, 0x0000032D, 0x00200075, 0x00000303, 0x00000301,
+  0x00000075, 0x00000303, 0x00000301, 0x00200075, 0x00000304, 0x00000308,
+  0x00000075, 0x00000304, 0x00000308, 0x00200076, 0x00000303, 0x00000076,
+  0x00000303, 0x00200076, 0x00000323, 0x00000076, 0x00000323, 0x00200077,
+  0x00000300, 0x00000077, 0x00000300, 0x00200077, 0x00000301, 0x00000077,
+  0x00000301, 0x00200077, 0x00000308, 0x00000077, 0x00000308, 0x00200077,
+  0x00000307, 0x00000077, 0x00000307, 0x00200077, 0x00000323, 0x00000077,
+  0x00000323, 0x00200078, 0x00000307, 0x00000078, 0x00000307, 0x00200078,
+  0x00000308, 0x00000078, 0x00000308, 0x00200079, 0x00000307, 0x00000079,
+  0x00000307, 0x0020007A, 0x00000302, 0x0000007A, 0x00000302, 0x0020007A,
+  0x00000323, 0x0000007A, 0x00000323, 0x0020007A, 0x00000331, 0x0000007A,
+  0x00000331, 0x00000068, 0x00000331, 0x00000074, 0x00000308, 0x00000077,
+  0x0000030A, 0x00000079, 0x0000030A, 0x04000061, 0x040002BE, 0x04000073,
+  0x00000307, 0x04200073, 0x04200073, 0x00200061, 0x00000323, 0x00000061,
+  0x00000323, 0x00200061, 0x00000309, 0x00000061, 0x00000309, 0x00200061,
+  0x00000302, 0x00000301, 0x00000061, 0x00000302, 0x00000301, 0x00200061,
+  0x00000302, 0x00000300, 0x00000061, 0x00000302, 0x00000300, 0x00200061,
+  0x00000302, 0x00000309, 0x00000061, 0x00000302, 0x00000309, 0x00200061,
+  0x00000302, 0x00000303, 0x00000061, 0x00000302, 0x00000303, 0x00200061,
+  0x00000323, 0x00000302, 0x00000061, 0x00000323, 0x00000302, 0x00200061,
+  0x00000306, 0x00000301, 0x00000061, 0x00000306, 0x00000301, 0x00200061,
+  0x00000306, 0x00000300, 0x00000061, 0x00000306, 0x00000300, 0x00200061,
+  0x00000306, 0x00000309, 0x00000061, 0x00000306, 0x00000309, 0x00200061,
+  0x00000306, 0x00000303, 0x00000061, 0x00000306, 0x00000303, 0x00200061,
+  0x00000323, 0x00000306, 0x00000061, 0x00000323, 0x00000306, 0x00200065,
+  0x00000323, 0x00000065, 0x00000323, 0x00200065, 0x00000309, 0x00000065,
+  0x00000309, 0x00200065, 0x00000303, 0x00000065, 0x00000303, 0x00200065,
+  0x00000302, 0x00000301, 0x00000065, 0x00000302, 0x00000301, 0x00200065,
+  0x00000302, 0x00000300, 0x00000065, 0x00000302, 0x00000300, 0x00200065,
+  0x00000302, 0x00000309, 0x00000065, 0x00000302, 0x00000309, 0x00200065,
+  0x00000302, 0x00000303, 0x00000065, 0x00000302, 0x00000303, 0x00200065,
+  0x00000323, 0x00000302, 0x00000065, 0x00000323, 0x00000302, 0x00200069,
+  0x00000309, 0x00000069, 0x00000309, 0x00200069, 0x00000323, 0x00000069,
+  0x00000323, 0x0020006F, 0x00000323, 0x0000006F, 0x00000323, 0x0020006F,
+  0x00000309, 0x0000006F, 0x00000309, 0x0020006F, 0x00000302, 0x00000301,
+  0x0000006F, 0x00000302, 0x00000301, 0x0020006F, 0x00000302, 0x00000300,
+  0x0000006F, 0x00000302, 0x00000300, 0x0020006F, 0x00000302, 0x00000309,
+  0x0000006F, 0x00000302, 0x00000309, 0x0020006F, 0x00000302, 0x00000303,
+  0x0000006F, 0x00000302, 0x00000303, 0x0020006F, 0x00000323, 0x00000302,
+  0x0000006F, 0x00000323, 0x00000302, 0x0020006F, 0x0000031B, 0x00000301,
+  0x0000006F, 0x0000031B, 0x00000301, 0x0020006F, 0x0000031B, 0x00000300,
+  0x0000006F, 0x0000031B, 0x00000300, 0x0020006F, 0x0000031B, 0x00000309,
+  0x0000006F, 0x0000031B, 0x00000309, 0x0020006F, 0x0000031B, 0x00000303,
+  0x0000006F, 0x0000031B, 0x00000303, 0x0020006F, 0x0000031B, 0x00000323,
+  0x0000006F, 0x0000031B, 0x00000323, 0x00200075, 0x00000323, 0x00000075,
+  0x00000323, 0x00200075, 0x00000309, 0x00000075, 0x00000309, 0x00200075,
+  0x0000031B, 0x00000301, 0x00000075, 0x0000031B, 0x00000301, 0x00200075,
+  0x0000031B, 0x00000300, 0x00000075, 0x0000031B, 0x00000300, 0x00200075,
+  0x0000031B, 0x00000309, 0x00000075, 0x0000031B, 0x00000309, 0x00200075,
+  0x0000031B, 0x00000303, 0x00000075, 0x0000031B, 0x00000303, 0x00200075,
+  0x0000031B, 0x00000323, 0x00000075, 0x0000031B, 0x00000323, 0x00200079,
+  0x00000300, 0x00000079, 0x00000300, 0x00200079, 0x00000323, 0x00000079,
+  0x00000323, 0x00200079, 0x00000309, 0x00000079, 0x00000309, 0x00200079,
+  0x00000303, 0x00000079, 0x00000303, 0x000003B1, 0x00000313, 0x000003B1,
+  0x00000314, 0x000003B1, 0x00000313, 0x00000300, 0x000003B1, 0x00000314,
+  0x00000300, 0x000003B1, 0x00000313, 0x00000301, 0x000003B1, 0x00000314,
+  0x00000301, 0x000003B1, 0x00000313, 0x00000342, 0x000003B1, 0x00000314,
+  0x00000342, 0x002003B1, 0x00000313, 0x002003B1, 0x00000314, 0x002003B1,
+  0x00000313, 0x00000300, 0x002003B1, 0x00000314, 0x00000300, 0x002003B1,
+  0x00000313, 0x00000301, 0x002003B1, 0x00000314, 0x00000301, 0x002003B1,
+  0x00000313, 0x00000342, 0x002003B1, 0x00000314, 0x00000342, 0x000003B5,
+  0x00000313, 0x000003B5, 0x00000314, 0x000003B5, 0x00000313, 0x00000300,
+  0x000003B5, 0x00000314, 0x00000300, 0x000003B5, 0x00000313, 0x00000301,
+  0x000003B5, 0x00000314, 0x00000301, 0x002003B5, 0x00000313, 0x002003B5,
+  0x00000314, 0x002003B5, 0x00000313, 0x00000300, 0x002003B5, 0x00000314,
+  0x00000300, 0x002003B5, 0x00000313, 0x00000301, 0x002003B5, 0x00000314,
+  0x00000301, 0x000003B7, 0x00000313, 0x000003B7, 0x00000314, 0x000003B7,
+  0x00000313, 0x00000300, 0x000003B7, 0x00000314, 0x00000300, 0x000003B7,
+  0x00000313, 0x00000301, 0x000003B7, 0x00000314, 0x00000301, 0x000003B7,
+  0x00000313, 0x00000342, 0x000003B7, 0x00000314, 0x00000342, 0x002003B7,
+  0x00000313, 0x002003B7, 0x00000314, 0x002003B7, 0x00000313, 0x00000300,
+  0x002003B7, 0x00000314, 0x00000300, 0x002003B7, 0x00000313, 0x00000301,
+  0x002003B7, 0x00000314, 0x00000301, 0x002003B7, 0x00000313, 0x00000342,
+  0x002003B7, 0x00000314, 0x00000342, 0x000003B9, 0x00000313, 0x000003B9,
+  0x00000314, 0x000003B9, 0x00000313, 0x00000300, 0x000003B9, 0x00000314,
+  0x00000300, 0x000003B9, 0x00000313, 0x00000301, 0x000003B9, 0x00000314,
+  0x00000301, 0x000003B9, 0x00000313, 0x00000342, 0x000003B9, 0x00000314,
+  0x00000342, 0x002003B9, 0x00000313, 0x002003B9, 0x00000314, 0x002003B9,
+  0x00000313, 0x00000300, 0x002003B9, 0x00000314, 0x00000300, 0x002003B9,
+  0x00000313, 0x00000301, 0x002003B9, 0x00000314, 0x00000301, 0x002003B9,
+  0x00000313, 0x00000342, 0x002003B9, 0x00000314, 0x00000342, 0x000003BF,
+  0x00000313, 0x000003BF, 0x00000314, 0x000003BF, 0x00000313, 0x00000300,
+  0x000003BF, 0x00000314, 0x00000300, 0x000003BF, 0x00000313, 0x00000301,
+  0x000003BF, 0x00000314, 0x00000301, 0x002003BF, 0x00000313, 0x002003BF,
+  0x00000314, 0x002003BF, 0x00000313, 0x00000300, 0x002003BF, 0x00000314,
+  0x00000300, 0x002003BF, 0x00000313, 0x00000301, 0x002003BF, 0x00000314,
+  0x00000301, 0x000003C5, 0x00000313, 0x000003C5, 0x00000314, 0x000003C5,
+  0x00000313, 0x00000300, 0x000003C5, 0x00000314, 0x00000300, 0x000003C5,
+  0x00000313, 0x00000301, 0x000003C5, 0x00000314, 0x00000301, 0x000003C5,
+  0x00000313, 0x00000342, 0x000003C5, 0x00000314, 0x00000342, 0x002003C5,
+  0x00000314, 0x002003C5, 0x00000314, 0x00000300, 0x002003C5, 0x00000314,
+  0x00000301, 0x002003C5, 0x00000314, 0x00000342, 0x000003C9, 0x00000313,
+  0x000003C9, 0x00000314, 0x000003C9, 0x00000313, 0x00000300, 0x000003C9,
+  0x00000314, 0x00000300, 0x000003C9, 0x00000313, 0x00000301, 0x000003C9,
+  0x00000314, 0x00000301, 0x000003C9, 0x00000313, 0x00000342, 0x000003C9,
+  0x00000314, 0x00000342, 0x002003C9, 0x00000313, 0x002003C9, 0x00000314,
+  0x002003C9, 0x00000313, 0x00000300, 0x002003C9, 0x00000314, 0x00000300,
+  0x002003C9, 0x00000313, 0x00000301, 0x002003C9, 0x00000314, 0x00000301,
+  0x002003C9, 0x00000313, 0x00000342, 0x002003C9, 0x00000314, 0x00000342,
+  0x000003B1, 0x00000300, 0x000003B1, 0x00000301, 0x000003B5, 0x00000300,
+  0x000003B5, 0x00000301, 0x000003B7, 0x00000300, 0x000003B7, 0x00000301,
+  0x000003B9, 0x00000300, 0x000003B9, 0x00000301, 0x000003BF, 0x00000300,
+  0x000003BF, 0x00000301, 0x000003C5, 0x00000300, 0x000003C5, 0x00000301,
+  0x000003C9, 0x00000300, 0x000003C9, 0x00000301, 0x000003B1, 0x00000313,
+  0x00000345, 0x000003B1, 0x00000314, 0x00000345, 0x000003B1, 0x00000313,
+  0x00000300, 0x00000345, 0x000003B1, 0x00000314, 0x00000300, 0x00000345,
+  0x000003B1, 0x00000313, 0x00000301, 0x00000345, 0x000003B1, 0x00000314,
+  0x00000301, 0x00000345, 0x000003B1, 0x00000313, 0x00000342, 0x00000345,
+  0x000003B1, 0x00000314, 0x00000342, 0x00000345, 0x002003B1, 0x00000313,
+  0x00000345, 0x002003B1, 0x00000314, 0x00000345, 0x002003B1, 0x00000313,
+  0x00000300, 0x00000345, 0x002003B1, 0x00000314, 0x00000300, 0x00000345,
+  0x002003B1, 0x00000313, 0x00000301, 0x00000345, 0x002003B1, 0x00000314,
+  0x00000301, 0x00000345, 0x002003B1, 0x00000313, 0x00000342, 0x00000345,
+  0x002003B1, 0x00000314, 0x00000342, 0x00000345, 0x000003B7, 0x00000313,
+  0x00000345, 0x000003B7, 0x00000314, 0x00000345, 0x000003B7, 0x00000313,
+  0x00000300, 0x00000345, 0x000003B7, 0x00000314, 0x00000300, 0x00000345,
+  0x000003B7, 0x00000313, 0x00000301, 0x00000345, 0x000003B7, 0x00000314,
+  0x00000301, 0x00000345, 0x000003B7, 0x00000313, 0x00000342, 0x00000345,
+  0x000003B7, 0x00000314, 0x00000342, 0x00000345, 0x002003B7, 0x00000313,
+  0x00000345, 0x002003B7, 0x00000314, 0x00000345, 0x002003B7, 0x00000313,
+  0x00000300, 0x00000345, 0x002003B7, 0x00000314, 0x00000300, 0x00000345,
+  0x002003B7, 0x00000313, 0x00000301, 0x00000345, 0x002003B7, 0x00000314,
+  0x00000301, 0x00000345, 0x002003B7, 0x00000313, 0x00000342, 0x00000345,
+  0x002003B7, 0x00000314, 0x00000342, 0x00000345, 0x000003C9, 0x00000313,
+  0x00000345, 0x000003C9, 0x00000314, 0x00000345, 0x000003C9, 0x00000313,
+  0x00000300, 0x00000345, 0x000003C9, 0x00000314, 0x00000300, 0x00000345,
+  0x000003C9, 0x00000313, 0x00000301, 0x00000345, 0x000003C9, 0x00000314,
+  0x00000301, 0x00000345, 0x000003C9, 0x00000313, 0x00000342, 0x00000345,
+  0x000003C9, 0x00000314, 0x00000342, 0x00000345, 0x002003C9, 0x00000313,
+  0x00000345, 0x002003C9, 0x00000314, 0x00000345, 0x002003C9, 0x00000313,
+  0x00000300, 0x00000345, 0x002003C9, 0x00000314, 0x00000300, 0x00000345,
+  0x002003C9, 0x00000313, 0x00000301, 0x00000345, 0x002003C9, 0x00000314,
+  0x00000301, 0x00000345, 0x002003C9, 0x00000313, 0x00000342, 0x00000345,
+  0x002003C9, 0x00000314, 0x00000342, 0x00000345, 0x000003B1, 0x00000306,
+  0x000003B1, 0x00000304, 0x000003B1, 0x00000300, 0x00000345, 0x000003B1,
+  0x00000345, 0x000003B1, 0x00000301, 0x00000345, 0x000003B1, 0x00000342,
+  0x000003B1, 0x00000342, 0x00000345, 0x002003B1, 0x00000306, 0x002003B1,
+  0x00000304, 0x002003B1, 0x00000300, 0x002003B1, 0x00000301, 0x002003B1,
+  0x00000345, 0x04000020, 0x04000313, 0x04000020, 0x04000313, 0x04000020,
+  0x04000342, 0x04000020, 0x04000308, 0x00000342, 0x000003B7, 0x00000300,
+  0x00000345, 0x000003B7, 0x00000345, 0x000003B7, 0x00000301, 0x00000345,
+  0x000003B7, 0x00000342, 0x000003B7, 0x00000342, 0x00000345, 0x002003B5,
+  0x00000300, 0x002003B5, 0x00000301, 0x002003B7, 0x00000300, 0x002003B7,
+  0x00000301, 0x002003B7, 0x00000345, 0x04000020, 0x04000313, 0x00000300,
+  0x04000020, 0x04000313, 0x00000301, 0x04000020, 0x04000313, 0x00000342,
+  0x000003B9, 0x00000306, 0x000003B9, 0x00000304, 0x000003B9, 0x00000308,
+  0x00000300, 0x000003B9, 0x00000308, 0x00000301, 0x000003B9, 0x00000342,
+  0x000003B9, 0x00000308, 0x00000342, 0x002003B9, 0x00000306, 0x002003B9,
+  0x00000304, 0x002003B9, 0x00000300, 0x002003B9, 0x00000301, 0x04000020,
+  0x04000314, 0x00000300, 0x04000020, 0x04000314, 0x00000301, 0x04000020,
+  0x04000314, 0x00000342, 0x000003C5, 0x00000306, 0x000003C5, 0x00000304,
+  0x000003C5, 0x00000308, 0x00000300, 0x000003C5, 0x00000308, 0x00000301,
+  0x000003C1, 0x00000313, 0x000003C1, 0x00000314, 0x000003C5, 0x00000342,
+  0x000003C5, 0x00000308, 0x00000342, 0x002003C5, 0x00000306, 0x002003C5,
+  0x00000304, 0x002003C5, 0x00000300, 0x002003C5, 0x00000301, 0x002003C1,
+  0x00000314, 0x04000020, 0x04000308, 0x00000300, 0x04000020, 0x04000308,
+  0x00000301, 0x000003C9, 0x00000300, 0x00000345, 0x000003C9, 0x00000345,
+  0x000003C9, 0x00000301, 0x00000345, 0x000003C9, 0x00000342, 0x000003C9,
+  0x00000342, 0x00000345, 0x002003BF, 0x00000300, 0x002003BF, 0x00000301,
+  0x002003C9, 0x00000300, 0x002003C9, 0x00000301, 0x002003C9, 0x00000345,
+  0x04000020, 0x04000301, 0x04000020, 0x04000314, 0x04000020, 0x04000333,
+  0x0400002E, 0x0400002E, 0x0400002E, 0x0400002E, 0x0400002E, 0x04002032,
+  0x04002032, 0x04002032, 0x04002032, 0x04002032, 0x04002035, 0x04002035,
+  0x04002035, 0x04002035, 0x04002035, 0x04000021, 0x04000021, 0x04000020,
+  0x04000305, 0x0400003F, 0x0400003F, 0x0400003F, 0x04000021, 0x04000021,
+  0x0400003F, 0x04002032, 0x04002032, 0x04002032, 0x04002032, 0x04200072,
+  0x04000073, 0x04000061, 0x0400002F, 0x04000063, 0x04000061, 0x0400002F,
+  0x04000073, 0x040000B0, 0x04200063, 0x04000063, 0x0400002F, 0x0400006F,
+  0x04000063, 0x0400002F, 0x04000075, 0x040000B0, 0x04200066, 0x00400068,
+  0x00400335, 0x0420006E, 0x0400006F, 0x02200073, 0x0220006D, 0x04200074,
+  0x04200065, 0x0420006C, 0x02200074, 0x0220006D, 0x00200061, 0x0000030A,
+  0x04200066, 0x04200061, 0x04200078, 0x03C00031, 0x03C02044, 0x03C00037,
+  0x03C00031, 0x03C02044, 0x03C00039, 0x03C00031, 0x03C02044, 0x03C00031,
+  0x03C00030, 0x03C00031, 0x03C02044, 0x03C00033, 0x03C00032, 0x03C02044,
+  0x03C00033, 0x03C00031, 0x03C02044, 0x03C00035, 0x03C00032, 0x03C02044,
+  0x03C00035, 0x03C00033, 0x03C02044, 0x03C00035, 0x03C00034, 0x03C02044,
+  0x03C00035, 0x03C00031, 0x03C02044, 0x03C00036, 0x03C00035, 0x03C02044,
+  0x03C00036, 0x03C00031, 0x03C02044, 0x03C00038, 0x03C00033, 0x03C02044,
+  0x03C00038, 0x03C00035, 0x03C02044, 0x03C00038, 0x03C00037, 0x03C02044,
+  0x03C00038, 0x03C00031, 0x03C02044, 0x04200069, 0x04200069, 0x04200069,
+  0x04200069, 0x04200069, 0x04200069, 0x04200076, 0x04200076, 0x04200069,
+  0x04200076, 0x04200069, 0x04200069, 0x04200076, 0x04200069, 0x04200069,
+  0x04200069, 0x04200069, 0x04200078, 0x04200078, 0x04200069, 0x04200078,
+  0x04200069, 0x04200069, 0x04000069, 0x04000069, 0x04000069, 0x04000069,
+  0x04000069, 0x04000069, 0x04000076, 0x04000076, 0x04000069, 0x04000076,
+  0x04000069, 0x04000069, 0x04000076, 0x04000069, 0x04000069, 0x04000069,
+  0x04000069, 0x04000078, 0x04000078, 0x04000069, 0x04000078, 0x04000069,
+  0x04000069, 0x03C00030, 0x03C02044, 0x03C00033, 0x00002190, 0x00000338,
+  0x00002192, 0x00000338, 0x00002194, 0x00000338, 0x000021D0, 0x00000338,
+  0x000021D4, 0x00000338, 0x000021D2, 0x00000338, 0x00002203, 0x00000338,
+  0x00002208, 0x00000338, 0x0000220B, 0x00000338, 0x00002223, 0x00000338,
+  0x00002225, 0x00000338, 0x0400222B, 0x0400222B, 0x0400222B, 0x0400222B,
+  0x0400222B, 0x0400222E, 0x0400222E, 0x0400222E, 0x0400222E, 0x0400222E,
+  0x0000223C, 0x00000338, 0x00002243, 0x00000338, 0x00002245, 0x00000338,
+  0x00002248, 0x00000338, 0x0000003D, 0x00000338, 0x00002261, 0x00000338,
+  0x0000224D, 0x00000338, 0x0000003C, 0x00000338, 0x0000003E, 0x00000338,
+  0x00002264, 0x00000338, 0x00002265, 0x00000338, 0x00002272, 0x00000338,
+  0x00002273, 0x00000338, 0x00002276, 0x00000338, 0x00002277, 0x00000338,
+  0x0000227A, 0x00000338, 0x0000227B, 0x00000338, 0x00002282, 0x00000338,
+  0x00002283, 0x00000338, 0x00002286, 0x00000338, 0x00002287, 0x00000338,
+  0x000022A2, 0x00000338, 0x000022A8, 0x00000338, 0x000022A9, 0x00000338,
+  0x000022AB, 0x00000338, 0x0000227C, 0x00000338, 0x0000227D, 0x00000338,
+  0x00002291, 0x00000338, 0x00002292, 0x00000338, 0x000022B2, 0x00000338,
+  0x000022B3, 0x00000338, 0x000022B4, 0x00000338, 0x000022B5, 0x00000338,
+  0x01C00031, 0x01C00030, 0x01C00031, 0x01C00031, 0x01C00031, 0x01C00032,
+  0x01C00031, 0x01C00033, 0x01C00031, 0x01C00034, 0x01C00031, 0x01C00035,
+  0x01C00031, 0x01C00036, 0x01C00031, 0x01C00037, 0x01C00031, 0x01C00038,
+  0x01C00031, 0x01C00039, 0x01C00032, 0x01C00030, 0x04000028, 0x04000031,
+  0x04000029, 0x04000028, 0x04000032, 0x04000029, 0x04000028, 0x04000033,
+  0x04000029, 0x04000028, 0x04000034, 0x04000029, 0x04000028, 0x04000035,
+  0x04000029, 0x04000028, 0x04000036, 0x04000029, 0x04000028, 0x04000037,
+  0x04000029, 0x04000028, 0x04000038, 0x04000029, 0x04000028, 0x04000039,
+  0x04000029, 0x04000028, 0x04000031, 0x04000030, 0x04000029, 0x04000028,
+  0x04000031, 0x04000031, 0x04000029, 0x04000028, 0x04000031, 0x04000032,
+  0x04000029, 0x04000028, 0x04000031, 0x04000033, 0x04000029, 0x04000028,
+  0x04000031, 0x04000034, 0x04000029, 0x04000028, 0x04000031, 0x04000035,
+  0x04000029, 0x04000028, 0x04000031, 0x04000036, 0x04000029, 0x04000028,
+  0x04000031, 0x04000037, 0x04000029, 0x04000028, 0x04000031, 0x04000038,
+  0x04000029, 0x04000028, 0x04000031, 0x04000039, 0x04000029, 0x04000028,
+  0x04000032, 0x04000030, 0x04000029, 0x04000031, 0x0400002E, 0x04000032,
+  0x0400002E, 0x04000033, 0x0400002E, 0x04000034, 0x0400002E, 0x04000035,
+  0x0400002E, 0x04000036, 0x0400002E, 0x04000037, 0x0400002E, 0x04000038,
+  0x0400002E, 0x04000039, 0x0400002E, 0x04000031, 0x04000030, 0x0400002E,
+  0x04000031, 0x04000031, 0x0400002E, 0x04000031, 0x04000032, 0x0400002E,
+  0x04000031, 0x04000033, 0x0400002E, 0x04000031, 0x04000034, 0x0400002E,
+  0x04000031, 0x04000035, 0x0400002E, 0x04000031, 0x04000036, 0x0400002E,
+  0x04000031, 0x04000037, 0x0400002E, 0x04000031, 0x04000038, 0x0400002E,
+  0x04000031, 0x04000039, 0x0400002E, 0x04000032, 0x04000030, 0x0400002E,
+  0x04000028, 0x04000061, 0x04000029, 0x04000028, 0x04000062, 0x04000029,
+  0x04000028, 0x04000063, 0x04000029, 0x04000028, 0x04000064, 0x04000029,
+  0x04000028, 0x04000065, 0x04000029, 0x04000028, 0x04000066, 0x04000029,
+  0x04000028, 0x04000067, 0x04000029, 0x04000028, 0x04000068, 0x04000029,
+  0x04000028, 0x04000069, 0x04000029, 0x04000028, 0x0400006A, 0x04000029,
+  0x04000028, 0x0400006B, 0x04000029, 0x04000028, 0x0400006C, 0x04000029,
+  0x04000028, 0x0400006D, 0x04000029, 0x04000028, 0x0400006E, 0x04000029,
+  0x04000028, 0x0400006F, 0x04000029, 0x04000028, 0x04000070, 0x04000029,
+  0x04000028, 0x04000071, 0x04000029, 0x04000028, 0x04000072, 0x04000029,
+  0x04000028, 0x04000073, 0x04000029, 0x04000028, 0x04000074, 0x04000029,
+  0x04000028, 0x04000075, 0x04000029, 0x04000028, 0x04000076, 0x04000029,
+  0x04000028, 0x04000077, 0x04000029, 0x04000028, 0x04000078, 0x04000029,
+  0x04000028, 0x04000079, 0x04000029, 0x04000028, 0x0400007A, 0x04000029,
+  0x0400222B, 0x0400222B, 0x0400222B, 0x0400222B, 0x0400003A, 0x0400003A,
+  0x0400003D, 0x0400003D, 0x0400003D, 0x0400003D, 0x0400003D, 0x0400003D,
+  0x00002ADD, 0x00000338, 0x0000304B, 0x00003099, 0x0000304D, 0x00003099,
+  0x0000304F, 0x00003099, 0x00003051, 0x00003099, 0x00003053, 0x00003099,
+  0x00003055, 0x00003099, 0x00003057, 0x00003099, 0x00003059, 0x00003099,
+  0x0000305B, 0x00003099, 0x0000305D, 0x00003099, 0x0000305F, 0x00003099,
+  0x00003061, 0x00003099, 0x00003064, 0x00003099, 0x00003066, 0x00003099,
+  0x00003068, 0x00003099, 0x0000306F, 0x00003099, 0x0000306F, 0x0000309A,
+  0x00003072, 0x00003099, 0x00003072, 0x0000309A, 0x00003075, 0x00003099,
+  0x00003075, 0x0000309A, 0x00003078, 0x00003099, 0x00003078, 0x0000309A,
+  0x0000307B, 0x00003099, 0x0000307B, 0x0000309A, 0x00003046, 0x00003099,
+  0x04000020, 0x04003099, 0x04000020, 0x0400309A, 0x0000309D, 0x00003099,
+  0x02803088, 0x0280308A, 0x000030AB, 0x00003099, 0x000030AD, 0x00003099,
+  0x000030AF, 0x00003099, 0x000030B1, 0x00003099, 0x000030B3, 0x00003099,
+  0x000030B5, 0x00003099, 0x000030B7, 0x00003099, 0x000030B9, 0x00003099,
+  0x000030BB, 0x00003099, 0x000030BD, 0x00003099, 0x000030BF, 0x00003099,
+  0x000030C1, 0x00003099, 0x000030C4, 0x00003099, 0x000030C6, 0x00003099,
+  0x000030C8, 0x00003099, 0x000030CF, 0x00003099, 0x000030CF, 0x0000309A,
+  0x000030D2, 0x00003099, 0x000030D2, 0x0000309A, 0x000030D5, 0x00003099,
+  0x000030D5, 0x0000309A, 0x000030D8, 0x00003099, 0x000030D8, 0x0000309A,
+  0x000030DB, 0x00003099, 0x000030DB, 0x0000309A, 0x000030A6, 0x00003099,
+  0x000030EF, 0x00003099, 0x000030F0, 0x00003099, 0x000030F1, 0x00003099,
+  0x000030F2, 0x00003099, 0x000030FD, 0x00003099, 0x028030B3, 0x028030C8,
+  0x04000028, 0x04001100, 0x04000029, 0x04000028, 0x04001102, 0x04000029,
+  0x04000028, 0x04001103, 0x04000029, 0x04000028, 0x04001105, 0x04000029,
+  0x04000028, 0x04001106, 0x04000029, 0x04000028, 0x04001107, 0x04000029,
+  0x04000028, 0x04001109, 0x04000029, 0x04000028, 0x0400110B, 0x04000029,
+  0x04000028, 0x0400110C, 0x04000029, 0x04000028, 0x0400110E, 0x04000029,
+  0x04000028, 0x0400110F, 0x04000029, 0x04000028, 0x04001110, 0x04000029,
+  0x04000028, 0x04001111, 0x04000029, 0x04000028, 0x04001112, 0x04000029,
+  0x04000028, 0x04001100, 0x04001161, 0x04000029, 0x04000028, 0x04001102,
+  0x04001161, 0x04000029, 0x04000028, 0x04001103, 0x04001161, 0x04000029,
+  0x04000028, 0x04001105, 0x04001161, 0x04000029, 0x04000028, 0x04001106,
+  0x04001161, 0x04000029, 0x04000028, 0x04001107, 0x04001161, 0x04000029,
+  0x04000028, 0x04001109, 0x04001161, 0x04000029, 0x04000028, 0x0400110B,
+  0x04001161, 0x04000029, 0x04000028, 0x0400110C, 0x04001161, 0x04000029,
+  0x04000028, 0x0400110E, 0x04001161, 0x04000029, 0x04000028, 0x0400110F,
+  0x04001161, 0x04000029, 0x04000028, 0x04001110, 0x04001161, 0x04000029,
+  0x04000028, 0x04001111, 0x04001161, 0x04000029, 0x04000028, 0x04001112,
+  0x04001161, 0x04000029, 0x04000028, 0x0400110C, 0x0400116E, 0x04000029,
+  0x04000028, 0x0400110B, 0x04001169, 0x0400110C, 0x04001165, 0x040011AB,
+  0x04000029, 0x04000028, 0x0400110B, 0x04001169, 0x04001112, 0x0400116E,
+  0x04000029, 0x04000028, 0x04004E00, 0x04000029, 0x04000028, 0x04004E8C,
+  0x04000029, 0x04000028, 0x04004E09, 0x04000029, 0x04000028, 0x040056DB,
+  0x04000029, 0x04000028, 0x04004E94, 0x04000029, 0x04000028, 0x0400516D,
+  0x04000029, 0x04000028, 0x04004E03, 0x04000029, 0x04000028, 0x0400516B,
+  0x04000029, 0x04000028, 0x04004E5D, 0x04000029, 0x04000028, 0x04005341,
+  0x04000029, 0x04000028, 0x04006708, 0x04000029, 0x04000028, 0x0400706B,
+  0x04000029, 0x04000028, 0x04006C34, 0x04000029, 0x04000028, 0x04006728,
+  0x04000029, 0x04000028, 0x040091D1, 0x04000029, 0x04000028, 0x0400571F,
+  0x04000029, 0x04000028, 0x040065E5, 0x04000029, 0x04000028, 0x0400682A,
+  0x04000029, 0x04000028, 0x04006709, 0x04000029, 0x04000028, 0x0400793E,
+  0x04000029, 0x04000028, 0x0400540D, 0x04000029, 0x04000028, 0x04007279,
+  0x04000029, 0x04000028, 0x04008CA1, 0x04000029, 0x04000028, 0x0400795D,
+  0x04000029, 0x04000028, 0x040052B4, 0x04000029, 0x04000028, 0x04004EE3,
+  0x04000029, 0x04000028, 0x0400547C, 0x04000029, 0x04000028, 0x04005B66,
+  0x04000029, 0x04000028, 0x040076E3, 0x04000029, 0x04000028, 0x04004F01,
+  0x04000029, 0x04000028, 0x04008CC7, 0x04000029, 0x04000028, 0x04005354,
+  0x04000029, 0x04000028, 0x0400796D, 0x04000029, 0x04000028, 0x04004F11,
+  0x04000029, 0x04000028, 0x040081EA, 0x04000029, 0x04000028, 0x040081F3,
+  0x04000029, 0x03A00070, 0x03A00074, 0x03A00065, 0x01C00032, 0x01C00031,
+  0x01C00032, 0x01C00032, 0x01C00032, 0x01C00033, 0x01C00032, 0x01C00034,
+  0x01C00032, 0x01C00035, 0x01C00032, 0x01C00036, 0x01C00032, 0x01C00037,
+  0x01C00032, 0x01C00038, 0x01C00032, 0x01C00039, 0x01C00033, 0x01C00030,
+  0x01C00033, 0x01C00031, 0x01C00033, 0x01C00032, 0x01C00033, 0x01C00033,
+  0x01C00033, 0x01C00034, 0x01C00033, 0x01C00035, 0x01C01100, 0x01C01161,
+  0x01C01102, 0x01C01161, 0x01C01103, 0x01C01161, 0x01C01105, 0x01C01161,
+  0x01C01106, 0x01C01161, 0x01C01107, 0x01C01161, 0x01C01109, 0x01C01161,
+  0x01C0110B, 0x01C01161, 0x01C0110C, 0x01C01161, 0x01C0110E, 0x01C01161,
+  0x01C0110F, 0x01C01161, 0x01C01110, 0x01C01161, 0x01C01111, 0x01C01161,
+  0x01C01112, 0x01C01161, 0x01C0110E, 0x01C01161, 0x01C011B7, 0x01C01100,
+  0x01C01169, 0x01C0110C, 0x01C0116E, 0x01C0110B, 0x01C01174, 0x01C0110B,
+  0x01C0116E, 0x01C00033, 0x01C00036, 0x01C00033, 0x01C00037, 0x01C00033,
+  0x01C00038, 0x01C00033, 0x01C00039, 0x01C00034, 0x01C00030, 0x01C00034,
+  0x01C00031, 0x01C00034, 0x01C00032, 0x01C00034, 0x01C00033, 0x01C00034,
+  0x01C00034, 0x01C00034, 0x01C00035, 0x01C00034, 0x01C00036, 0x01C00034,
+  0x01C00037, 0x01C00034, 0x01C00038, 0x01C00034, 0x01C00039, 0x01C00035,
+  0x01C00030, 0x04000031, 0x04006708, 0x04000032, 0x04006708, 0x04000033,
+  0x04006708, 0x04000034, 0x04006708, 0x04000035, 0x04006708, 0x04000036,
+  0x04006708, 0x04000037, 0x04006708, 0x04000038, 0x04006708, 0x04000039,
+  0x04006708, 0x04000031, 0x04000030, 0x04006708, 0x04000031, 0x04000031,
+  0x04006708, 0x04000031, 0x04000032, 0x04006708, 0x03A00068, 0x03800067,
+  0x03800065, 0x03800072, 0x03800067, 0x03800065, 0x03A00076, 0x03A0006C,
+  0x03A00074, 0x03A00064, 0x038030A2, 0x038030CF, 0x0380309A, 0x038030FC,
+  0x038030C8, 0x038030A2, 0x038030EB, 0x038030D5, 0x038030A1, 0x038030A2,
+  0x038030F3, 0x038030D8, 0x0380309A, 0x038030A2, 0x038030A2, 0x038030FC,
+  0x038030EB, 0x038030A4, 0x038030CB, 0x038030F3, 0x038030AF, 0x03803099,
+  0x038030A4, 0x038030F3, 0x038030C1, 0x038030A6, 0x038030A9, 0x038030F3,
+  0x038030A8, 0x038030B9, 0x038030AF, 0x038030FC, 0x038030C8, 0x03803099,
+  0x038030A8, 0x038030FC, 0x038030AB, 0x038030FC, 0x038030AA, 0x038030F3,
+  0x038030B9, 0x038030AA, 0x038030FC, 0x038030E0, 0x038030AB, 0x038030A4,
+  0x038030EA, 0x038030AB, 0x038030E9, 0x038030C3, 0x038030C8, 0x038030AB,
+  0x038030ED, 0x038030EA, 0x038030FC, 0x038030AB, 0x03803099, 0x038030ED,
+  0x038030F3, 0x038030AB, 0x03803099, 0x038030F3, 0x038030DE, 0x038030AD,
+  0x03803099, 0x038030AB, 0x03803099, 0x038030AD, 0x03803099, 0x038030CB,
+  0x038030FC, 0x038030AD, 0x038030E5, 0x038030EA, 0x038030FC, 0x038030AD,
+  0x03803099, 0x038030EB, 0x038030BF, 0x03803099, 0x038030FC, 0x038030AD,
+  0x038030ED, 0x038030AD, 0x038030ED, 0x038030AF, 0x03803099, 0x038030E9,
+  0x038030E0, 0x038030AD, 0x038030ED, 0x038030E1, 0x038030FC, 0x038030C8,
+  0x038030EB, 0x038030AD, 0x038030ED, 0x038030EF, 0x038030C3, 0x038030C8,
+  0x038030AF, 0x03803099, 0x038030E9, 0x038030E0, 0x038030AF, 0x03803099,
+  0x038030E9, 0x038030E0, 0x038030C8, 0x038030F3, 0x038030AF, 0x038030EB,
+  0x038030BB, 0x03803099, 0x038030A4, 0x038030ED, 0x038030AF, 0x038030ED,
+  0x038030FC, 0x038030CD, 0x038030B1, 0x038030FC, 0x038030B9, 0x038030B3,
+  0x038030EB, 0x038030CA, 0x038030B3, 0x038030FC, 0x038030DB, 0x0380309A,
+  0x038030B5, 0x038030A4, 0x038030AF, 0x038030EB, 0x038030B5, 0x038030F3,
+  0x038030C1, 0x038030FC, 0x038030E0, 0x038030B7, 0x038030EA, 0x038030F3,
+  0x038030AF, 0x03803099, 0x038030BB, 0x038030F3, 0x038030C1, 0x038030BB,
+  0x038030F3, 0x038030C8, 0x038030BF, 0x03803099, 0x038030FC, 0x038030B9,
+  0x038030C6, 0x03803099, 0x038030B7, 0x038030C8, 0x03803099, 0x038030EB,
+  0x038030C8, 0x038030F3, 0x038030CA, 0x038030CE, 0x038030CE, 0x038030C3,
+  0x038030C8, 0x038030CF, 0x038030A4, 0x038030C4, 0x038030CF, 0x0380309A,
+  0x038030FC, 0x038030BB, 0x038030F3, 0x038030C8, 0x038030CF, 0x0380309A,
+  0x038030FC, 0x038030C4, 0x038030CF, 0x03803099, 0x038030FC, 0x038030EC,
+  0x038030EB, 0x038030D2, 0x0380309A, 0x038030A2, 0x038030B9, 0x038030C8,
+  0x038030EB, 0x038030D2, 0x0380309A, 0x038030AF, 0x038030EB, 0x038030D2,
+  0x0380309A, 0x038030B3, 0x038030D2, 0x03803099, 0x038030EB, 0x038030D5,
+  0x038030A1, 0x038030E9, 0x038030C3, 0x038030C8, 0x03803099, 0x038030D5,
+  0x038030A3, 0x038030FC, 0x038030C8, 0x038030D5, 0x03803099, 0x038030C3,
+  0x038030B7, 0x038030A7, 0x038030EB, 0x038030D5, 0x038030E9, 0x038030F3,
+  0x038030D8, 0x038030AF, 0x038030BF, 0x038030FC, 0x038030EB, 0x038030D8,
+  0x0380309A, 0x038030BD, 0x038030D8, 0x0380309A, 0x038030CB, 0x038030D2,
+  0x038030D8, 0x038030EB, 0x038030C4, 0x038030D8, 0x0380309A, 0x038030F3,
+  0x038030B9, 0x038030D8, 0x0380309A, 0x038030FC, 0x038030B7, 0x03803099,
+  0x038030D8, 0x03803099, 0x038030FC, 0x038030BF, 0x038030DB, 0x0380309A,
+  0x038030A4, 0x038030F3, 0x038030C8, 0x038030DB, 0x03803099, 0x038030EB,
+  0x038030C8, 0x038030DB, 0x038030F3, 0x038030DB, 0x0380309A, 0x038030F3,
+  0x038030C8, 0x03803099, 0x038030DB, 0x038030FC, 0x038030EB, 0x038030DB,
+  0x038030FC, 0x038030F3, 0x038030DE, 0x038030A4, 0x038030AF, 0x038030ED,
+  0x038030DE, 0x038030A4, 0x038030EB, 0x038030DE, 0x038030C3, 0x038030CF,
+  0x038030DE, 0x038030EB, 0x038030AF, 0x038030DE, 0x038030F3, 0x038030B7,
+  0x038030E7, 0x038030F3, 0x038030DF, 0x038030AF, 0x038030ED, 0x038030F3,
+  0x038030DF, 0x038030EA, 0x038030DF, 0x038030EA, 0x038030CF, 0x03803099,
+  0x038030FC, 0x038030EB, 0x038030E1, 0x038030AB, 0x03803099, 0x038030E1,
+  0x038030AB, 0x03803099, 0x038030C8, 0x038030F3, 0x038030E1, 0x038030FC,
+  0x038030C8, 0x038030EB, 0x038030E4, 0x038030FC, 0x038030C8, 0x03803099,
+  0x038030E4, 0x038030FC, 0x038030EB, 0x038030E6, 0x038030A2, 0x038030F3,
+  0x038030EA, 0x038030C3, 0x038030C8, 0x038030EB, 0x038030EA, 0x038030E9,
+  0x038030EB, 0x038030D2, 0x0380309A, 0x038030FC, 0x038030EB, 0x038030FC,
+  0x038030D5, 0x03803099, 0x038030EB, 0x038030EC, 0x038030E0, 0x038030EC,
+  0x038030F3, 0x038030C8, 0x038030B1, 0x03803099, 0x038030F3, 0x038030EF,
+  0x038030C3, 0x038030C8, 0x04000030, 0x040070B9, 0x04000031, 0x040070B9,
+  0x04000032, 0x040070B9, 0x04000033, 0x040070B9, 0x04000034, 0x040070B9,
+  0x04000035, 0x040070B9, 0x04000036, 0x040070B9, 0x04000037, 0x040070B9,
+  0x04000038, 0x040070B9, 0x04000039, 0x040070B9, 0x04000031, 0x04000030,
+  0x040070B9, 0x04000031, 0x04000031, 0x040070B9, 0x04000031, 0x04000032,
+  0x040070B9, 0x04000031, 0x04000033, 0x040070B9, 0x04000031, 0x04000034,
+  0x040070B9, 0x04000031, 0x04000035, 0x040070B9, 0x04000031, 0x04000036,
+  0x040070B9, 0x04000031, 0x04000037, 0x040070B9, 0x04000031, 0x04000038,
+  0x040070B9, 0x04000031, 0x04000039, 0x040070B9, 0x04000032, 0x04000030,
+  0x040070B9, 0x04000032, 0x04000031, 0x040070B9, 0x04000032, 0x04000032,
+  0x040070B9, 0x04000032, 0x04000033, 0x040070B9, 0x04000032, 0x04000034,
+  0x040070B9, 0x03800068, 0x03A00070, 0x03800061, 0x03800064, 0x03800061,
+  0x03A00061, 0x03A00075, 0x03800062, 0x03800061, 0x03800072, 0x0380006F,
+  0x03A00076, 0x03800070, 0x03800063, 0x03800064, 0x0380006D, 0x03800064,
+  0x0380006D, 0x03800032, 0x03800064, 0x0380006D, 0x03800033, 0x03A00069,
+  0x03A00075, 0x03805E73, 0x03806210, 0x0380662D, 0x0380548C, 0x03805927,
+  0x03806B63, 0x0380660E, 0x03806CBB, 0x0380682A, 0x03805F0F, 0x03804F1A,
+  0x0380793E, 0x03800070, 0x03A00061, 0x0380006E, 0x03A00061, 0x038003BC,
+  0x03A00061, 0x0380006D, 0x03A00061, 0x0380006B, 0x03A00061, 0x03A0006B,
+  0x03A00062, 0x03A0006D, 0x03A00062, 0x03A00067, 0x03A00062, 0x03800063,
+  0x03800061, 0x0380006C, 0x0380006B, 0x03800063, 0x03800061, 0x0380006C,
+  0x03800070, 0x03A00066, 0x0380006E, 0x03A00066, 0x038003BC, 0x03A00066,
+  0x038003BC, 0x03800067, 0x0380006D, 0x03800067, 0x0380006B, 0x03800067,
+  0x03A00068, 0x0380007A, 0x0380006B, 0x03A00068, 0x0380007A, 0x03A0006D,
+  0x03A00068, 0x0380007A, 0x03A00067, 0x03A00068, 0x0380007A, 0x03A00074,
+  0x03A00068, 0x0380007A, 0x038003BC, 0x0380006C, 0x0380006D, 0x0380006C,
+  0x03800064, 0x0380006C, 0x0380006B, 0x0380006C, 0x03800066, 0x0380006D,
+  0x0380006E, 0x0380006D, 0x038003BC, 0x0380006D, 0x0380006D, 0x0380006D,
+  0x03800063, 0x0380006D, 0x0380006B, 0x0380006D, 0x0380006D, 0x0380006D,
+  0x03800032, 0x03800063, 0x0380006D, 0x03800032, 0x0380006D, 0x03800032,
+  0x0380006B, 0x0380006D, 0x03800032, 0x0380006D, 0x0380006D, 0x03800033,
+  0x03800063, 0x0380006D, 0x03800033, 0x0380006D, 0x03800033, 0x0380006B,
+  0x0380006D, 0x03800033, 0x0380006D, 0x03802215, 0x03800073, 0x0380006D,
+  0x03802215, 0x03800073, 0x03800032, 0x03A00070, 0x03800061, 0x0380006B,
+  0x03A00070, 0x03800061, 0x03A0006D, 0x03A00070, 0x03800061, 0x03A00067,
+  0x03A00070, 0x03800061, 0x03800072, 0x03800061, 0x03800064, 0x03800072,
+  0x03800061, 0x03800064, 0x03802215, 0x03800073, 0x03800072, 0x03800061,
+  0x03800064, 0x03802215, 0x03800073, 0x03800032, 0x03800070, 0x03800073,
+  0x0380006E, 0x03800073, 0x038003BC, 0x03800073, 0x0380006D, 0x03800073,
+  0x03800070, 0x03A00076, 0x0380006E, 0x03A00076, 0x038003BC, 0x03A00076,
+  0x0380006D, 0x03A00076, 0x0380006B, 0x03A00076, 0x03A0006D, 0x03A00076,
+  0x03800070, 0x03A00077, 0x0380006E, 0x03A00077, 0x038003BC, 0x03A00077,
+  0x0380006D, 0x03A00077, 0x0380006B, 0x03A00077, 0x03A0006D, 0x03A00077,
+  0x0380006B, 0x03A003C9, 0x03A0006D, 0x03A003C9, 0x03800061, 0x0380002E,
+  0x0380006D, 0x0380002E, 0x03A00062, 0x03800071, 0x03800063, 0x03800063,
+  0x03800063, 0x03800064, 0x03A00063, 0x03802215, 0x0380006B, 0x03800067,
+  0x03A00063, 0x0380006F, 0x0380002E, 0x03800064, 0x03A00062, 0x03A00067,
+  0x03800079, 0x03800068, 0x03800061, 0x03A00068, 0x03A00070, 0x03800069,
+  0x0380006E, 0x03A0006B, 0x03A0006B, 0x03A0006B, 0x03A0006D, 0x0380006B,
+  0x03800074, 0x0380006C, 0x0380006D, 0x0380006C, 0x0380006E, 0x0380006C,
+  0x0380006F, 0x03800067, 0x0380006C, 0x03800078, 0x0380006D, 0x03800062,
+  0x0380006D, 0x03800069, 0x0380006C, 0x0380006D, 0x0380006F, 0x0380006C,
+  0x03A00070, 0x03A00068, 0x03800070, 0x0380002E, 0x0380006D, 0x0380002E,
+  0x03A00070, 0x03A00070, 0x03A0006D, 0x03A00070, 0x03A00072, 0x03800073,
+  0x03800072, 0x03A00073, 0x03800076, 0x03A00077, 0x03800062, 0x03A00076,
+  0x03802215, 0x0380006D, 0x03A00061, 0x03802215, 0x0380006D, 0x04000031,
+  0x040065E5, 0x04000032, 0x040065E5, 0x04000033, 0x040065E5, 0x04000034,
+  0x040065E5, 0x04000035, 0x040065E5, 0x04000036, 0x040065E5, 0x04000037,
+  0x040065E5, 0x04000038, 0x040065E5, 0x04000039, 0x040065E5, 0x04000031,
+  0x04000030, 0x040065E5, 0x04000031, 0x04000031, 0x040065E5, 0x04000031,
+  0x04000032, 0x040065E5, 0x04000031, 0x04000033, 0x040065E5, 0x04000031,
+  0x04000034, 0x040065E5, 0x04000031, 0x04000035, 0x040065E5, 0x04000031,
+  0x04000036, 0x040065E5, 0x04000031, 0x04000037, 0x040065E5, 0x04000031,
+  0x04000038, 0x040065E5, 0x04000031, 0x04000039, 0x040065E5, 0x04000032,
+  0x04000030, 0x040065E5, 0x04000032, 0x04000031, 0x040065E5, 0x04000032,
+  0x04000032, 0x040065E5, 0x04000032, 0x04000033, 0x040065E5, 0x04000032,
+  0x04000034, 0x040065E5, 0x04000032, 0x04000035, 0x040065E5, 0x04000032,
+  0x04000036, 0x040065E5, 0x04000032, 0x04000037, 0x040065E5, 0x04000032,
+  0x04000038, 0x040065E5, 0x04000032, 0x04000039, 0x040065E5, 0x04000033,
+  0x04000030, 0x040065E5, 0x04000033, 0x04000031, 0x040065E5, 0x03800067,
+  0x03800061, 0x0380006C, 0x02200068, 0x02000335, 0x0400006F, 0x04000065,
+  0x04000066, 0x04000066, 0x04000066, 0x04000069, 0x04000066, 0x0400006C,
+  0x04000066, 0x04000066, 0x04000069, 0x04000066, 0x04000066, 0x0400006C,
+  0x04000073, 0x04000074, 0x04000073, 0x04000074, 0x04000574, 0x04000576,
+  0x04000574, 0x04000565, 0x04000574, 0x0400056B, 0x0400057E, 0x04000576,
+  0x04000574, 0x0400056D, 0x000005D9, 0x000005B4, 0x000005F2, 0x000005B7,
+  0x000005E9, 0x000005C1, 0x000005E9, 0x000005C2, 0x000005E9, 0x000005BC,
+  0x000005C1, 0x000005E9, 0x000005BC, 0x000005C2, 0x000005D0, 0x000005B7,
+  0x000005D0, 0x000005B8, 0x000005D0, 0x000005BC, 0x000005D1, 0x000005BC,
+  0x000005D2, 0x000005BC, 0x000005D3, 0x000005BC, 0x000005D4, 0x000005BC,
+  0x000005D5, 0x000005BC, 0x000005D6, 0x000005BC, 0x000005D8, 0x000005BC,
+  0x000005D9, 0x000005BC, 0x000005DA, 0x000005BC, 0x000005DB, 0x000005BC,
+  0x000005DC, 0x000005BC, 0x000005DE, 0x000005BC, 0x000005E0, 0x000005BC,
+  0x000005E1, 0x000005BC, 0x000005E3, 0x000005BC, 0x000005E4, 0x000005BC,
+  0x000005E6, 0x000005BC, 0x000005E7, 0x000005BC, 0x000005E8, 0x000005BC,
+  0x000005E9, 0x000005BC, 0x000005EA, 0x000005BC, 0x000005D5, 0x000005B9,
+  0x000005D1, 0x000005BF, 0x000005DB, 0x000005BF, 0x000005E4, 0x000005BF,
+  0x040005D0, 0x040005DC, 0x018006D5, 0x01800654, 0x014006D5, 0x01400654,
+  0x018006D2, 0x01800654, 0x014006D2, 0x01400654, 0x040006C7, 0x04000674,
+  0x0180064A, 0x01800654, 0x01800627, 0x0140064A, 0x01400654, 0x01400627,
+  0x0180064A, 0x01800654, 0x018006D5, 0x0140064A, 0x01400654, 0x014006D5,
+  0x0180064A, 0x01800654, 0x01800648, 0x0140064A, 0x01400654, 0x01400648,
+  0x0180064A, 0x01800654, 0x018006C7, 0x0140064A, 0x01400654, 0x014006C7,
+  0x0180064A, 0x01800654, 0x018006C6, 0x0140064A, 0x01400654, 0x014006C6,
+  0x0180064A, 0x01800654, 0x018006C8, 0x0140064A, 0x01400654, 0x014006C8,
+  0x0180064A, 0x01800654, 0x018006D0, 0x0140064A, 0x01400654, 0x014006D0,
+  0x00C0064A, 0x00C00654, 0x00C006D0, 0x0180064A, 0x01800654, 0x01800649,
+  0x0140064A, 0x01400654, 0x01400649, 0x00C0064A, 0x00C00654, 0x00C00649,
+  0x0180064A, 0x01800654, 0x0180062C, 0x0180064A, 0x01800654, 0x0180062D,
+  0x0180064A, 0x01800654, 0x01800645, 0x0180064A, 0x01800654, 0x01800649,
+  0x0180064A, 0x01800654, 0x0180064A, 0x01800628, 0x0180062C, 0x01800628,
+  0x0180062D, 0x01800628, 0x0180062E, 0x01800628, 0x01800645, 0x01800628,
+  0x01800649, 0x01800628, 0x0180064A, 0x0180062A, 0x0180062C, 0x0180062A,
+  0x0180062D, 0x0180062A, 0x0180062E, 0x0180062A, 0x01800645, 0x0180062A,
+  0x01800649, 0x0180062A, 0x0180064A, 0x0180062B, 0x0180062C, 0x0180062B,
+  0x01800645, 0x0180062B, 0x01800649, 0x0180062B, 0x0180064A, 0x0180062C,
+  0x0180062D, 0x0180062C, 0x01800645, 0x0180062D, 0x0180062C, 0x0180062D,
+  0x01800645, 0x0180062E, 0x0180062C, 0x0180062E, 0x0180062D, 0x0180062E,
+  0x01800645, 0x01800633, 0x0180062C, 0x01800633, 0x0180062D, 0x01800633,
+  0x0180062E, 0x01800633, 0x01800645, 0x01800635, 0x0180062D, 0x01800635,
+  0x01800645, 0x01800636, 0x0180062C, 0x01800636, 0x0180062D, 0x01800636,
+  0x0180062E, 0x01800636, 0x01800645, 0x01800637, 0x0180062D, 0x01800637,
+  0x01800645, 0x01800638, 0x01800645, 0x01800639, 0x0180062C, 0x01800639,
+  0x01800645, 0x0180063A, 0x0180062C, 0x0180063A, 0x01800645, 0x01800641,
+  0x0180062C, 0x01800641, 0x0180062D, 0x01800641, 0x0180062E, 0x01800641,
+  0x01800645, 0x01800641, 0x01800649, 0x01800641, 0x0180064A, 0x01800642,
+  0x0180062D, 0x01800642, 0x01800645, 0x01800642, 0x01800649, 0x01800642,
+  0x0180064A, 0x01800643, 0x01800627, 0x01800643, 0x0180062C, 0x01800643,
+  0x0180062D, 0x01800643, 0x0180062E, 0x01800643, 0x01800644, 0x01800643,
+  0x01800645, 0x01800643, 0x01800649, 0x01800643, 0x0180064A, 0x01800644,
+  0x0180062C, 0x01800644, 0x0180062D, 0x01800644, 0x0180062E, 0x01800644,
+  0x01800645, 0x01800644, 0x01800649, 0x01800644, 0x0180064A, 0x01800645,
+  0x0180062C, 0x01800645, 0x0180062D, 0x01800645, 0x0180062E, 0x01800645,
+  0x01800645, 0x01800645, 0x01800649, 0x01800645, 0x0180064A, 0x01800646,
+  0x0180062C, 0x01800646, 0x0180062D, 0x01800646, 0x0180062E, 0x01800646,
+  0x01800645, 0x01800646, 0x01800649, 0x01800646, 0x0180064A, 0x01800647,
+  0x0180062C, 0x01800647, 0x01800645, 0x01800647, 0x01800649, 0x01800647,
+  0x0180064A, 0x0180064A, 0x0180062C, 0x0180064A, 0x0180062D, 0x0180064A,
+  0x0180062E, 0x0180064A, 0x01800645, 0x0180064A, 0x01800649, 0x0180064A,
+  0x0180064A, 0x01800630, 0x01800670, 0x01800631, 0x01800670, 0x01800649,
+  0x01800670, 0x01800020, 0x0180064C, 0x01800651, 0x01800020, 0x0180064D,
+  0x01800651, 0x01800020, 0x0180064E, 0x01800651, 0x01800020, 0x0180064F,
+  0x01800651, 0x01800020, 0x01800650, 0x01800651, 0x01800020, 0x01800651,
+  0x01800670, 0x0140064A, 0x01400654, 0x01400631, 0x0140064A, 0x01400654,
+  0x01400632, 0x0140064A, 0x01400654, 0x01400645, 0x0140064A, 0x01400654,
+  0x01400646, 0x0140064A, 0x01400654, 0x01400649, 0x0140064A, 0x01400654,
+  0x0140064A, 0x01400628, 0x01400631, 0x01400628, 0x01400632, 0x01400628,
+  0x01400645, 0x01400628, 0x01400646, 0x01400628, 0x01400649, 0x01400628,
+  0x0140064A, 0x0140062A, 0x01400631, 0x0140062A, 0x01400632, 0x0140062A,
+  0x01400645, 0x0140062A, 0x01400646, 0x0140062A, 0x01400649, 0x0140062A,
+  0x0140064A, 0x0140062B, 0x01400631, 0x0140062B, 0x01400632, 0x0140062B,
+  0x01400645, 0x0140062B, 0x01400646, 0x0140062B, 0x01400649, 0x0140062B,
+  0x0140064A, 0x01400641, 0x01400649, 0x01400641, 0x0140064A, 0x01400642,
+  0x01400649, 0x01400642, 0x0140064A, 0x01400643, 0x01400627, 0x01400643,
+  0x01400644, 0x01400643, 0x01400645, 0x01400643, 0x01400649, 0x01400643,
+  0x0140064A, 0x01400644, 0x01400645, 0x01400644, 0x01400649, 0x01400644,
+  0x0140064A, 0x01400645, 0x01400627, 0x01400645, 0x01400645, 0x01400646,
+  0x01400631, 0x01400646, 0x01400632, 0x01400646, 0x01400645, 0x01400646,
+  0x01400646, 0x01400646, 0x01400649, 0x01400646, 0x0140064A, 0x01400649,
+  0x01400670, 0x0140064A, 0x01400631, 0x0140064A, 0x01400632, 0x0140064A,
+  0x01400645, 0x0140064A, 0x01400646, 0x0140064A, 0x01400649, 0x0140064A,
+  0x0140064A, 0x00C0064A, 0x00C00654, 0x00C0062C, 0x00C0064A, 0x00C00654,
+  0x00C0062D, 0x00C0064A, 0x00C00654, 0x00C0062E, 0x00C0064A, 0x00C00654,
+  0x00C00645, 0x00C0064A, 0x00C00654, 0x00C00647, 0x00C00628, 0x00C0062C,
+  0x00C00628, 0x00C0062D, 0x00C00628, 0x00C0062E, 0x00C00628, 0x00C00645,
+  0x00C00628, 0x00C00647, 0x00C0062A, 0x00C0062C, 0x00C0062A, 0x00C0062D,
+  0x00C0062A, 0x00C0062E, 0x00C0062A, 0x00C00645, 0x00C0062A, 0x00C00647,
+  0x00C0062B, 0x00C00645, 0x00C0062C, 0x00C0062D, 0x00C0062C, 0x00C00645,
+  0x00C0062D, 0x00C0062C, 0x00C0062D, 0x00C00645, 0x00C0062E, 0x00C0062C,
+  0x00C0062E, 0x00C00645, 0x00C00633, 0x00C0062C, 0x00C00633, 0x00C0062D,
+  0x00C00633, 0x00C0062E, 0x00C00633, 0x00C00645, 0x00C00635, 0x00C0062D,
+  0x00C00635, 0x00C0062E, 0x00C00635, 0x00C00645, 0x00C00636, 0x00C0062C,
+  0x00C00636, 0x00C0062D, 0x00C00636, 0x00C0062E, 0x00C00636, 0x00C00645,
+  0x00C00637, 0x00C0062D, 0x00C00638, 0x00C00645, 0x00C00639, 0x00C0062C,
+  0x00C00639, 0x00C00645, 0x00C0063A, 0x00C0062C, 0x00C0063A, 0x00C00645,
+  0x00C00641, 0x00C0062C, 0x00C00641, 0x00C0062D, 0x00C00641, 0x00C0062E,
+  0x00C00641, 0x00C00645, 0x00C00642, 0x00C0062D, 0x00C00642, 0x00C00645,
+  0x00C00643, 0x00C0062C, 0x00C00643, 0x00C0062D, 0x00C00643, 0x00C0062E,
+  0x00C00643, 0x00C00644, 0x00C00643, 0x00C00645, 0x00C00644, 0x00C0062C,
+  0x00C00644, 0x00C0062D, 0x00C00644, 0x00C0062E, 0x00C00644, 0x00C00645,
+  0x00C00644, 0x00C00647, 0x00C00645, 0x00C0062C, 0x00C00645, 0x00C0062D,
+  0x00C00645, 0x00C0062E, 0x00C00645, 0x00C00645, 0x00C00646, 0x00C0062C,
+  0x00C00646, 0x00C0062D, 0x00C00646, 0x00C0062E, 0x00C00646, 0x00C00645,
+  0x00C00646, 0x00C00647, 0x00C00647, 0x00C0062C, 0x00C00647, 0x00C00645,
+  0x00C00647, 0x00C00670, 0x00C0064A, 0x00C0062C, 0x00C0064A, 0x00C0062D,
+  0x00C0064A, 0x00C0062E, 0x00C0064A, 0x00C00645, 0x00C0064A, 0x00C00647,
+  0x0100064A, 0x01000654, 0x01000645, 0x0100064A, 0x01000654, 0x01000647,
+  0x01000628, 0x01000645, 0x01000628, 0x01000647, 0x0100062A, 0x01000645,
+  0x0100062A, 0x01000647, 0x0100062B, 0x01000645, 0x0100062B, 0x01000647,
+  0x01000633, 0x01000645, 0x01000633, 0x01000647, 0x01000634, 0x01000645,
+  0x01000634, 0x01000647, 0x01000643, 0x01000644, 0x01000643, 0x01000645,
+  0x01000644, 0x01000645, 0x01000646, 0x01000645, 0x01000646, 0x01000647,
+  0x0100064A, 0x01000645, 0x0100064A, 0x01000647, 0x01000640, 0x0100064E,
+  0x01000651, 0x01000640, 0x0100064F, 0x01000651, 0x01000640, 0x01000650,
+  0x01000651, 0x01800637, 0x01800649, 0x01800637, 0x0180064A, 0x01800639,
+  0x01800649, 0x01800639, 0x0180064A, 0x0180063A, 0x01800649, 0x0180063A,
+  0x0180064A, 0x01800633, 0x01800649, 0x01800633, 0x0180064A, 0x01800634,
+  0x01800649, 0x01800634, 0x0180064A, 0x0180062D, 0x01800649, 0x0180062D,
+  0x0180064A, 0x0180062C, 0x01800649, 0x0180062C, 0x0180064A, 0x0180062E,
+  0x01800649, 0x0180062E, 0x0180064A, 0x01800635, 0x01800649, 0x01800635,
+  0x0180064A, 0x01800636, 0x01800649, 0x01800636, 0x0180064A, 0x01800634,
+  0x0180062C, 0x01800634, 0x0180062D, 0x01800634, 0x0180062E, 0x01800634,
+  0x01800645, 0x01800634, 0x01800631, 0x01800633, 0x01800631, 0x01800635,
+  0x01800631, 0x01800636, 0x01800631, 0x01400637, 0x01400649, 0x01400637,
+  0x0140064A, 0x01400639, 0x01400649, 0x01400639, 0x0140064A, 0x0140063A,
+  0x01400649, 0x0140063A, 0x0140064A, 0x01400633, 0x01400649, 0x01400633,
+  0x0140064A, 0x01400634, 0x01400649, 0x01400634, 0x0140064A, 0x0140062D,
+  0x01400649, 0x0140062D, 0x0140064A, 0x0140062C, 0x01400649, 0x0140062C,
+  0x0140064A, 0x0140062E, 0x01400649, 0x0140062E, 0x0140064A, 0x01400635,
+  0x01400649, 0x01400635, 0x0140064A, 0x01400636, 0x01400649, 0x01400636,
+  0x0140064A, 0x01400634, 0x0140062C, 0x01400634, 0x0140062D, 0x01400634,
+  0x0140062E, 0x01400634, 0x01400645, 0x01400634, 0x01400631, 0x01400633,
+  0x01400631, 0x01400635, 0x01400631, 0x01400636, 0x01400631, 0x00C00634,
+  0x00C0062C, 0x00C00634, 0x00C0062D, 0x00C00634, 0x00C0062E, 0x00C00634,
+  0x00C00645, 0x00C00633, 0x00C00647, 0x00C00634, 0x00C00647, 0x00C00637,
+  0x00C00645, 0x01000633, 0x0100062C, 0x01000633, 0x0100062D, 0x01000633,
+  0x0100062E, 0x01000634, 0x0100062C, 0x01000634, 0x0100062D, 0x01000634,
+  0x0100062E, 0x01000637, 0x01000645, 0x01000638, 0x01000645, 0x01400627,
+  0x0140064B, 0x01800627, 0x0180064B, 0x00C0062A, 0x00C0062C, 0x00C00645,
+  0x0140062A, 0x0140062D, 0x0140062C, 0x00C0062A, 0x00C0062D, 0x00C0062C,
+  0x00C0062A, 0x00C0062D, 0x00C00645, 0x00C0062A, 0x00C0062E, 0x00C00645,
+  0x00C0062A, 0x00C00645, 0x00C0062C, 0x00C0062A, 0x00C00645, 0x00C0062D,
+  0x00C0062A, 0x00C00645, 0x00C0062E, 0x0140062C, 0x01400645, 0x0140062D,
+  0x00C0062C, 0x00C00645, 0x00C0062D, 0x0140062D, 0x01400645, 0x0140064A,
+  0x0140062D, 0x01400645, 0x01400649, 0x00C00633, 0x00C0062D, 0x00C0062C,
+  0x00C00633, 0x00C0062C, 0x00C0062D, 0x01400633, 0x0140062C, 0x01400649,
+  0x01400633, 0x01400645, 0x0140062D, 0x00C00633, 0x00C00645, 0x00C0062D,
+  0x00C00633, 0x00C00645, 0x00C0062C, 0x01400633, 0x01400645, 0x01400645,
+  0x00C00633, 0x00C00645, 0x00C00645, 0x01400635, 0x0140062D, 0x0140062D,
+  0x00C00635, 0x00C0062D, 0x00C0062D, 0x01400635, 0x01400645, 0x01400645,
+  0x01400634, 0x0140062D, 0x01400645, 0x00C00634, 0x00C0062D, 0x00C00645,
+  0x01400634, 0x0140062C, 0x0140064A, 0x01400634, 0x01400645, 0x0140062E,
+  0x00C00634, 0x00C00645, 0x00C0062E, 0x01400634, 0x01400645, 0x01400645,
+  0x00C00634, 0x00C00645, 0x00C00645, 0x01400636, 0x0140062D, 0x01400649,
+  0x01400636, 0x0140062E, 0x01400645, 0x00C00636, 0x00C0062E, 0x00C00645,
+  0x01400637, 0x01400645, 0x0140062D, 0x00C00637, 0x00C00645, 0x00C0062D,
+  0x00C00637, 0x00C00645, 0x00C00645, 0x01400637, 0x01400645, 0x0140064A,
+  0x01400639, 0x0140062C, 0x01400645, 0x01400639, 0x01400645, 0x01400645,
+  0x00C00639, 0x00C00645, 0x00C00645, 0x01400639, 0x01400645, 0x01400649,
+  0x0140063A, 0x01400645, 0x01400645, 0x0140063A, 0x01400645, 0x0140064A,
+  0x0140063A, 0x01400645, 0x01400649, 0x01400641, 0x0140062E, 0x01400645,
+  0x00C00641, 0x00C0062E, 0x00C00645, 0x01400642, 0x01400645, 0x0140062D,
+  0x01400642, 0x01400645, 0x01400645, 0x01400644, 0x0140062D, 0x01400645,
+  0x01400644, 0x0140062D, 0x0140064A, 0x01400644, 0x0140062D, 0x01400649,
+  0x00C00644, 0x00C0062C, 0x00C0062C, 0x01400644, 0x0140062C, 0x0140062C,
+  0x01400644, 0x0140062E, 0x01400645, 0x00C00644, 0x00C0062E, 0x00C00645,
+  0x01400644, 0x01400645, 0x0140062D, 0x00C00644, 0x00C00645, 0x00C0062D,
+  0x00C00645, 0x00C0062D, 0x00C0062C, 0x00C00645, 0x00C0062D, 0x00C00645,
+  0x01400645, 0x0140062D, 0x0140064A, 0x00C00645, 0x00C0062C, 0x00C0062D,
+  0x00C00645, 0x00C0062C, 0x00C00645, 0x00C00645, 0x00C0062E, 0x00C0062C,
+  0x00C00645, 0x00C0062E, 0x00C00645, 0x00C00645, 0x00C0062C, 0x00C0062E,
+  0x00C00647, 0x00C00645, 0x00C0062C, 0x00C00647, 0x00C00645, 0x00C00645,
+  0x00C00646, 0x00C0062D, 0x00C00645, 0x01400646, 0x0140062D, 0x01400649,
+  0x01400646, 0x0140062C, 0x01400645, 0x00C00646, 0x00C0062C, 0x00C00645,
+  0x01400646, 0x0140062C, 0x01400649, 0x01400646, 0x01400645, 0x0140064A,
+  0x01400646, 0x01400645, 0x01400649, 0x0140064A, 0x01400645, 0x01400645,
+  0x00C0064A, 0x00C00645, 0x00C00645, 0x01400628, 0x0140062E, 0x0140064A,
+  0x0140062A, 0x0140062C, 0x0140064A, 0x0140062A, 0x0140062C, 0x01400649,
+  0x0140062A, 0x0140062E, 0x0140064A, 0x0140062A, 0x0140062E, 0x01400649,
+  0x0140062A, 0x01400645, 0x0140064A, 0x0140062A, 0x01400645, 0x01400649,
+  0x0140062C, 0x01400645, 0x0140064A, 0x0140062C, 0x0140062D, 0x01400649,
+  0x0140062C, 0x01400645, 0x01400649, 0x01400633, 0x0140062E, 0x01400649,
+  0x01400635, 0x0140062D, 0x0140064A, 0x01400634, 0x0140062D, 0x0140064A,
+  0x01400636, 0x0140062D, 0x0140064A, 0x01400644, 0x0140062C, 0x0140064A,
+  0x01400644, 0x01400645, 0x0140064A, 0x0140064A, 0x0140062D, 0x0140064A,
+  0x0140064A, 0x0140062C, 0x0140064A, 0x0140064A, 0x01400645, 0x0140064A,
+  0x01400645, 0x01400645, 0x0140064A, 0x01400642, 0x01400645, 0x0140064A,
+  0x01400646, 0x0140062D, 0x0140064A, 0x00C00642, 0x00C00645, 0x00C0062D,
+  0x00C00644, 0x00C0062D, 0x00C00645, 0x01400639, 0x01400645, 0x0140064A,
+  0x01400643, 0x01400645, 0x0140064A, 0x00C00646, 0x00C0062C, 0x00C0062D,
+  0x01400645, 0x0140062E, 0x0140064A, 0x00C00644, 0x00C0062C, 0x00C00645,
+  0x01400643, 0x01400645, 0x01400645, 0x01400644, 0x0140062C, 0x01400645,
+  0x01400646, 0x0140062C, 0x0140062D, 0x0140062C, 0x0140062D, 0x0140064A,
+  0x0140062D, 0x0140062C, 0x0140064A, 0x01400645, 0x0140062C, 0x0140064A,
+  0x01400641, 0x01400645, 0x0140064A, 0x01400628, 0x0140062D, 0x0140064A,
+  0x00C00643, 0x00C00645, 0x00C00645, 0x00C00639, 0x00C0062C, 0x00C00645,
+  0x00C00635, 0x00C00645, 0x00C00645, 0x01400633, 0x0140062E, 0x0140064A,
+  0x01400646, 0x0140062C, 0x0140064A, 0x01800635, 0x01800644, 0x018006D2,
+  0x01800642, 0x01800644, 0x018006D2, 0x01800627, 0x01800644, 0x01800644,
+  0x01800647, 0x01800627, 0x01800643, 0x01800628, 0x01800631, 0x01800645,
+  0x0180062D, 0x01800645, 0x0180062F, 0x01800635, 0x01800644, 0x01800639,
+  0x01800645, 0x01800631, 0x01800633, 0x01800648, 0x01800644, 0x01800639,
+  0x01800644, 0x0180064A, 0x01800647, 0x01800648, 0x01800633, 0x01800644,
+  0x01800645, 0x01800635, 0x01800644, 0x01800649, 0x01800635, 0x01800644,
+  0x01800649, 0x01800020, 0x01800627, 0x01800644, 0x01800644, 0x01800647,
+  0x01800020, 0x01800639, 0x01800644, 0x0180064A, 0x01800647, 0x01800020,
+  0x01800648, 0x01800633, 0x01800644, 0x01800645, 0x0180062C, 0x01800644,
+  0x01800020, 0x0180062C, 0x01800644, 0x01800627, 0x01800644, 0x01800647,
+  0x01800631, 0x018006CC, 0x01800627, 0x01800644, 0x0400002E, 0x0400002E,
+  0x0400002E, 0x0400002E, 0x0400002E, 0x04000020, 0x04000305, 0x04000020,
+  0x04000305, 0x04000020, 0x04000305, 0x04000020, 0x04000305, 0x01800020,
+  0x0180064B, 0x01000640, 0x0100064B, 0x01800020, 0x0180064C, 0x01800020,
+  0x0180064D, 0x01800020, 0x0180064E, 0x01000640, 0x0100064E, 0x01800020,
+  0x0180064F, 0x01000640, 0x0100064F, 0x01800020, 0x01800650, 0x01000640,
+  0x01000650, 0x01800020, 0x01800651, 0x01000640, 0x01000651, 0x01800020,
+  0x01800652, 0x01000640, 0x01000652, 0x01800627, 0x01800653, 0x01400627,
+  0x01400653, 0x01800627, 0x01800654, 0x01400627, 0x01400654, 0x01800648,
+  0x01800654, 0x01400648, 0x01400654, 0x01800627, 0x01800655, 0x01400627,
+  0x01400655, 0x0180064A, 0x01800654, 0x0140064A, 0x01400654, 0x00C0064A,
+  0x00C00654, 0x0100064A, 0x01000654, 0x01800644, 0x01800627, 0x01800653,
+  0x01400644, 0x01400627, 0x01400653, 0x01800644, 0x01800627, 0x01800654,
+  0x01400644, 0x01400627, 0x01400654, 0x01800644, 0x01800627, 0x01800655,
+  0x01400644, 0x01400627, 0x01400655, 0x01800644, 0x01800627, 0x01400644,
+  0x01400627, 0x04000020, 0x04000304, 0x00011099, 0x000110BA, 0x0001109B,
+  0x000110BA, 0x000110A5, 0x000110BA, 0x00011131, 0x00011127, 0x00011132,
+  0x00011127, 0x00011347, 0x0001133E, 0x00011347, 0x00011357, 0x000114B9,
+  0x000114BA, 0x000114B9, 0x000114B0, 0x000114B9, 0x000114BD, 0x000115B8,
+  0x000115AF, 0x000115B9, 0x000115AF, 0x0001D157, 0x0001D165, 0x0001D158,
+  0x0001D165, 0x0001D158, 0x0001D165, 0x0001D16E, 0x0001D158, 0x0001D165,
+  0x0001D16F, 0x0001D158, 0x0001D165, 0x0001D170, 0x0001D158, 0x0001D165,
+  0x0001D171, 0x0001D158, 0x0001D165, 0x0001D172, 0x0001D1B9, 0x0001D165,
+  0x0001D1BA, 0x0001D165, 0x0001D1B9, 0x0001D165, 0x0001D16E, 0x0001D1BA,
+  0x0001D165, 0x0001D16E, 0x0001D1B9, 0x0001D165, 0x0001D16F, 0x0001D1BA,
+  0x0001D165, 0x0001D16F, 0x04000030, 0x0400002E, 0x04000030, 0x0400002C,
+  0x04000031, 0x0400002C, 0x04000032, 0x0400002C, 0x04000033, 0x0400002C,
+  0x04000034, 0x0400002C, 0x04000035, 0x0400002C, 0x04000036, 0x0400002C,
+  0x04000037, 0x0400002C, 0x04000038, 0x0400002C, 0x04000039, 0x0400002C,
+  0x04000028, 0x04200061, 0x04000029, 0x04000028, 0x04200062, 0x04000029,
+  0x04000028, 0x04200063, 0x04000029, 0x04000028, 0x04200064, 0x04000029,
+  0x04000028, 0x04200065, 0x04000029, 0x04000028, 0x04200066, 0x04000029,
+  0x04000028, 0x04200067, 0x04000029, 0x04000028, 0x04200068, 0x04000029,
+  0x04000028, 0x04200069, 0x04000029, 0x04000028, 0x0420006A, 0x04000029,
+  0x04000028, 0x0420006B, 0x04000029, 0x04000028, 0x0420006C, 0x04000029,
+  0x04000028, 0x0420006D, 0x04000029, 0x04000028, 0x0420006E, 0x04000029,
+  0x04000028, 0x0420006F, 0x04000029, 0x04000028, 0x04200070, 0x04000029,
+  0x04000028, 0x04200071, 0x04000029, 0x04000028, 0x04200072, 0x04000029,
+  0x04000028, 0x04200073, 0x04000029, 0x04000028, 0x04200074, 0x04000029,
+  0x04000028, 0x04200075, 0x04000029, 0x04000028, 0x04200076, 0x04000029,
+  0x04000028, 0x04200077, 0x04000029, 0x04000028, 0x04200078, 0x04000029,
+  0x04000028, 0x04200079, 0x04000029, 0x04000028, 0x0420007A, 0x04000029,
+  0x04003014, 0x04200073, 0x04003015, 0x01E00063, 0x01E00064, 0x01E00077,
+  0x01E0007A, 0x03A00068, 0x03A00076, 0x03A0006D, 0x03A00076, 0x03A00073,
+  0x03A00064, 0x03A00073, 0x03A00073, 0x03A00070, 0x03A00070, 0x03A00076,
+  0x03A00077, 0x03A00063, 0x0220006D, 0x02200063, 0x0220006D, 0x02200064,
+  0x03A00064, 0x03A0006A, 0x0380307B, 0x0380304B, 0x038030B3, 0x038030B3,
+  0x038030C6, 0x03803099, 0x04003014, 0x0400672C, 0x04003015, 0x04003014,
+  0x04004E09, 0x04003015, 0x04003014, 0x04004E8C, 0x04003015, 0x04003014,
+  0x04005B89, 0x04003015, 0x04003014, 0x040070B9, 0x04003015, 0x04003014,
+  0x04006253, 0x04003015, 0x04003014, 0x040076D7, 0x04003015, 0x04003014,
+  0x040052DD, 0x04003015, 0x04003014, 0x04006557, 0x04003015
+};
+
+#define COLLATE_PAGE_SHIFT 11
+#define COLLATE_BLOCK_SHIFT 4
+
+static const uint_least16_t collate_index[544] = {
+  0x0000, 0x0080, 0x0100, 0x0180, 0x0200, 0x0280, 0x0300, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0400, 0x0480, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0500,
+  0x0580, 0x0600, 0x0680, 0x0700, 0x0380, 0x0380, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0780, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0800, 0x0380, 0x0380, 0x0880, 0x0900, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0980,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+  0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380
+};
+static const uint_least16_t collate_pages[2560] = {
+  0x0000, 0x0010, 0x0020, 0x0030, 0x0040, 0x0050, 0x0060, 0x0070,
+  0x0080, 0x0090, 0x00A0, 0x00B0, 0x00C0, 0x00D0, 0x00E0, 0x00F0,
+  0x0100, 0x0110, 0x0120, 0x0130, 0x0140, 0x0150, 0x0160, 0x0170,
+  0x0180, 0x0190, 0x01A0, 0x01B0, 0x01C0, 0x01D0, 0x01E0, 0x01F0,
+  0x0200, 0x0210, 0x0220, 0x0230, 0x0240, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0250, 0x0000, 0x0260, 0x0270, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0280, 0x0000, 0x0000, 0x0290,
+  0x02A0, 0x02B0, 0x02C0, 0x02D0, 0x02E0, 0x02F0, 0x0300, 0x0310,
+  0x0320, 0x0330, 0x0340, 0x0350, 0x0000, 0x0360, 0x0370, 0x0380,
+  0x0390, 0x03A0, 0x03B0, 0x03C0, 0x03D0, 0x03E0, 0x03F0, 0x0400,
+  0x0410, 0x0420, 0x0430, 0x0440, 0x0450, 0x0460, 0x0000, 0x0000,
+  0x0470, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0480, 0x0000, 0x0000, 0x0000, 0x0490, 0x04A0,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x04B0, 0x04C0, 0x0000, 0x0490,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0490, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x04D0, 0x04E0, 0x0000, 0x04F0, 0x0500, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0510, 0x0520, 0x0500, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0530, 0x0000, 0x0540, 0x0500, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0500, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0550, 0x0560, 0x0500, 0x0000,
+  0x0000, 0x0570, 0x0000, 0x0000, 0x0580, 0x0000, 0x0500, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0590, 0x0000, 0x0500, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x05A0, 0x0000, 0x0500, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x05B0, 0x0000, 0x0500, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x05C0, 0x0500, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x05D0, 0x0000, 0x0490, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x05E0, 0x0000, 0x05F0, 0x0000, 0x0000,
+  0x0600, 0x0000, 0x0490, 0x0000, 0x0610, 0x0620, 0x0630, 0x0640,
+  0x0650, 0x0660, 0x0670, 0x0680, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0690, 0x0000, 0x0490, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0490, 0x06A0, 0x06B0, 0x06C0, 0x0000, 0x0000, 0x06D0,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x06E0, 0x06F0, 0x0700, 0x0710, 0x0720, 0x0730,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0490, 0x0000,
+  0x0000, 0x0490, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0500, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0490, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0490, 0x0490, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0740, 0x0750, 0x0000, 0x0760, 0x0770, 0x0490, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0490, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0490, 0x0490, 0x0000, 0x0000,
+  0x0000, 0x0780, 0x0790, 0x07A0, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x07B0, 0x07C0, 0x07D0, 0x07E0, 0x07F0, 0x0800,
+  0x0000, 0x0810, 0x0820, 0x0830, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0840, 0x0850, 0x0860, 0x0870, 0x0880, 0x0890, 0x08A0, 0x08B0,
+  0x08C0, 0x08D0, 0x08E0, 0x08F0, 0x0900, 0x0910, 0x0920, 0x0930,
+  0x0940, 0x0950, 0x0960, 0x0970, 0x0980, 0x0990, 0x09A0, 0x09B0,
+  0x09C0, 0x09D0, 0x09E0, 0x09F0, 0x0A00, 0x0A10, 0x0A20, 0x0A30,
+  0x0A40, 0x0A50, 0x0A60, 0x0A70, 0x0A80, 0x0A90, 0x0000, 0x0AA0,
+  0x0AB0, 0x0AC0, 0x0AD0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0AE0, 0x0AF0, 0x0B00, 0x0B10, 0x0B20, 0x0B30, 0x0B40, 0x0B50,
+  0x0B60, 0x0B70, 0x0B80, 0x0000, 0x0B90, 0x0000, 0x0000, 0x0000,
+  0x0BA0, 0x0000, 0x0BB0, 0x0BC0, 0x0BD0, 0x0000, 0x0BE0, 0x0BF0,
+  0x0C00, 0x0000, 0x0C10, 0x0000, 0x0000, 0x0000, 0x0C20, 0x0000,
+  0x0000, 0x0000, 0x0C30, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0C40, 0x0C50,
+  0x0C60, 0x0C70, 0x0C80, 0x0C90, 0x0CA0, 0x0CB0, 0x0CC0, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0CD0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0CE0,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0CF0, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0D00, 0x0D10, 0x0D20, 0x0000, 0x0000, 0x0000, 0x0D30, 0x0D40,
+  0x0D50, 0x0D60, 0x0D70, 0x0D80, 0x0D90, 0x0DA0, 0x0DB0, 0x0DC0,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0DD0, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0DE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0DF0,
+  0x0E00, 0x0E10, 0x0E20, 0x0E30, 0x0E40, 0x0E50, 0x0E60, 0x0E70,
+  0x0E80, 0x0E90, 0x0EA0, 0x0EB0, 0x0EC0, 0x0ED0, 0x0000, 0x0000,
+  0x0EE0, 0x0000, 0x0000, 0x0EF0, 0x0F00, 0x0F10, 0x0F20, 0x0F30,
+  0x0000, 0x0F40, 0x0F50, 0x0F60, 0x0F70, 0x0F80, 0x0000, 0x0F90,
+  0x0000, 0x0000, 0x0000, 0x0FA0, 0x0FB0, 0x0FC0, 0x0FD0, 0x0FE0,
+  0x0FF0, 0x1000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x1010, 0x1020, 0x1030, 0x1040, 0x1050, 0x1060, 0x1070, 0x1080,
+  0x1090, 0x10A0, 0x10B0, 0x10C0, 0x10D0, 0x10E0, 0x10F0, 0x1100,
+  0x1110, 0x1120, 0x1130, 0x1140, 0x1150, 0x1160, 0x1170, 0x1180,
+  0x1190, 0x11A0, 0x11B0, 0x11C0, 0x11D0, 0x11E0, 0x11F0, 0x1200,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0490, 0x0000, 0x1210, 0x1220, 0x1230, 0x0000,
+  0x1240, 0x1250, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x1260, 0x1270, 0x1280, 0x1290, 0x12A0, 0x12B0,
+  0x12C0, 0x12D0, 0x12E0, 0x12F0, 0x0000, 0x0000, 0x0000, 0x1300,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0490, 0x0000, 0x0000,
+  0x0490, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0490, 0x0000, 0x0490,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0490, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1310, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0490,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x1320, 0x1330, 0x1340, 0x1350, 0x1360, 0x1370, 0x1380, 0x1390,
+  0x13A0, 0x13B0, 0x13C0, 0x13D0, 0x13E0, 0x13F0, 0x1400, 0x1410,
+  0x1420, 0x1430, 0x1440, 0x1450, 0x1460, 0x1470, 0x1480, 0x1490,
+  0x14A0, 0x14B0, 0x14C0, 0x14D0, 0x14E0, 0x14F0, 0x0000, 0x0000,
+  0x1500, 0x1510, 0x1520, 0x1530, 0x1540, 0x1550, 0x1560, 0x1570,
+  0x1580, 0x1590, 0x15A0, 0x15B0, 0x0000, 0x15C0, 0x15D0, 0x15E0,
+  0x15F0, 0x1600, 0x1610, 0x1620, 0x1630, 0x1640, 0x1650, 0x1660,
+  0x1670, 0x1680, 0x1690, 0x16A0, 0x16B0, 0x16C0, 0x16D0, 0x16E0,
+  0x16F0, 0x1700, 0x1710, 0x1720, 0x0000, 0x1730, 0x1740, 0x1750,
+  0x1760, 0x1770, 0x1780, 0x1790, 0x17A0, 0x0000, 0x0000, 0x17B0,
+  0x0000, 0x17C0, 0x0000, 0x17D0, 0x17E0, 0x17F0, 0x1800, 0x1810,
+  0x1820, 0x1830, 0x1840, 0x1850, 0x1860, 0x1870, 0x1880, 0x1890,
+  0x18A0, 0x18B0, 0x18C0, 0x18D0, 0x18E0, 0x18F0, 0x1900, 0x1910,
+  0x1920, 0x1930, 0x1940, 0x1950, 0x1960, 0x1970, 0x1980, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x1990, 0x19A0, 0x19B0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0490, 0x19C0, 0x19D0, 0x19E0, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x19F0, 0x1A00, 0x1A10, 0x1A20, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0490, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0500, 0x0000,
+  0x0000, 0x1A30, 0x1A40, 0x0000, 0x0000, 0x0000, 0x0000, 0x0490,
+  0x0000, 0x0000, 0x1A50, 0x0500, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0490, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0490,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x1A60, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0490, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x1A70, 0x0000, 0x0490, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x1A80, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0490, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0490, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0490, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x1A90, 0x1AA0, 0x0000, 0x0000, 0x0490, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0490, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0490, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0490, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0490, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0490, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x1AB0, 0x1AC0, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1AD0, 0x1AE0, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x1AF0, 0x1B00, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x1B10, 0x1B20, 0x1B30, 0x1B40, 0x1B50, 0x1B60, 0x1B70, 0x1B80,
+  0x1B90, 0x1BA0, 0x1BB0, 0x1BC0, 0x1BD0, 0x1B10, 0x1B20, 0x1B30,
+  0x1BE0, 0x1BF0, 0x1C00, 0x1C10, 0x1C20, 0x1C30, 0x1C40, 0x1C50,
+  0x1C60, 0x1C70, 0x1B10, 0x1B20, 0x1B30, 0x1B40, 0x1B50, 0x1C00,
+  0x1B70, 0x1B80, 0x1B90, 0x1C40, 0x1C50, 0x1C60, 0x1C70, 0x1B10,
+  0x1B20, 0x1B30, 0x1C80, 0x1C90, 0x1CA0, 0x1CB0, 0x1CC0, 0x1CD0,
+  0x1CE0, 0x1CF0, 0x1D00, 0x1D10, 0x1D20, 0x1D30, 0x1D40, 0x1D50,
+  0x1D60, 0x1D70, 0x1D80, 0x1D90, 0x1DA0, 0x1DB0, 0x1DC0, 0x1DD0,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x1DE0, 0x1DF0, 0x1E00, 0x0000, 0x0000, 0x0490, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x1E10, 0x1E20, 0x1E30, 0x1E40, 0x1E50, 0x1E60, 0x1E70, 0x1E80,
+  0x1E90, 0x1EA0, 0x1EB0, 0x1EA0, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x1EC0, 0x1ED0, 0x1EE0, 0x1EF0, 0x1F00, 0x0000, 0x1F10, 0x0000,
+  0x0000, 0x1F20, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x1F30, 0x1F40, 0x1F50, 0x1F60, 0x1F70, 0x1F80, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x1F90, 0x1FA0, 0x1FB0, 0x1FC0, 0x1FD0, 0x1FE0, 0x1FF0, 0x2000,
+  0x2010, 0x2020, 0x2030, 0x2040, 0x2050, 0x2060, 0x2070, 0x2080,
+  0x2090, 0x20A0, 0x20B0, 0x20C0, 0x20D0, 0x20E0, 0x20F0, 0x2100,
+  0x2110, 0x2120, 0x2130, 0x2140, 0x2150, 0x2160, 0x2170, 0x2180,
+  0x2190, 0x21A0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+};
+static const uint_least32_t collate_blocks[8624] = {
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00200061,
+  0x00200062, 0x00200063, 0x00200064, 0x00200065, 0x00200066, 0x00200067,
+  0x00200068, 0x00200069, 0x0020006A, 0x0020006B, 0x0020006C, 0x0020006D,
+  0x0020006E, 0x0020006F, 0x00200070, 0x00200071, 0x00200072, 0x00200073,
+  0x00200074, 0x00200075, 0x00200076, 0x00200077, 0x00200078, 0x00200079,
+  0x0020007A, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00800020, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x80020000, 0x00000000, 0x02000061, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x80020002, 0x00000000, 0x00000000, 0x02000032, 0x02000033,
+  0x80020004, 0x040003BC, 0x00000000, 0x00000000, 0x80020006, 0x02000031,
+  0x0200006F, 0x00000000, 0x80030008, 0x8003000B, 0x8003000E, 0x00000000,
+  0x80020011, 0x80020013, 0x80020015, 0x80020017, 0x80020019, 0x8002001B,
+  0x8002001D, 0x8002001F, 0x80020021, 0x80020023, 0x80020025, 0x80020027,
+  0x80020029, 0x8002002B, 0x8002002D, 0x8002002F, 0x002000F0, 0x80020031,
+  0x80020033, 0x80020035, 0x80020037, 0x80020039, 0x8002003B, 0x00000000,
+  0x8002003D, 0x8002003F, 0x80020041, 0x80020043, 0x80020045, 0x80020047,
+  0x002000FE, 0x80020049, 0x8002004B, 0x8002004D, 0x8002004F, 0x80020051,
+  0x80020053, 0x80020055, 0x80020057, 0x80020059, 0x8002005B, 0x8002005D,
+  0x8002005F, 0x80020061, 0x80020063, 0x80020065, 0x80020067, 0x80020069,
+  0x00000000, 0x8002006B, 0x8002006D, 0x8002006F, 0x80020071, 0x80020073,
+  0x80020075, 0x00000000, 0x80020077, 0x80020079, 0x8002007B, 0x8002007D,
+  0x8002007F, 0x80020081, 0x00000000, 0x80020083, 0x80020085, 0x80020087,
+  0x80020089, 0x8002008B, 0x8002008D, 0x8002008F, 0x80020091, 0x80020093,
+  0x80020095, 0x80020097, 0x80020099, 0x8002009B, 0x8002009D, 0x8002009F,
+  0x800200A1, 0x800200A3, 0x800200A5, 0x800200A7, 0x800200A9, 0x800200AB,
+  0x800200AD, 0x800200AF, 0x800200B1, 0x800200B3, 0x800200B5, 0x800200B7,
+  0x800200B9, 0x800200BB, 0x800200BD, 0x800200BF, 0x800200C1, 0x800200C3,
+  0x800200C5, 0x800200C7, 0x800200C9, 0x800200CB, 0x800200CD, 0x800200CF,
+  0x800200D1, 0x800200D3, 0x800200D5, 0x800200D7, 0x800200D9, 0x800200DB,
+  0x800200DD, 0x800200DF, 0x800200E1, 0x800200E3, 0x800200E5, 0x00000000,
+  0x800200E7, 0x800200E9, 0x800200EB, 0x800200ED, 0x800200EF, 0x800200F1,
+  0x00000000, 0x800200F3, 0x800200F5, 0x800200F7, 0x800200F9, 0x800200FB,
+  0x800200FD, 0x800200FF, 0x80020101, 0x80020103, 0x80020105, 0x80020107,
+  0x80020109, 0x8002010B, 0x8002010D, 0x8002010F, 0x80020111, 0x80020113,
+  0x0020014B, 0x00000000, 0x80020115, 0x80020117, 0x80020119, 0x8002011B,
+  0x8002011D, 0x8002011F, 0x80020121, 0x80020123, 0x80020125, 0x80020127,
+  0x80020129, 0x8002012B, 0x8002012D, 0x8002012F, 0x80020131, 0x80020133,
+  0x80020135, 0x80020137, 0x80020139, 0x8002013B, 0x8002013D, 0x8002013F,
+  0x80020141, 0x80020143, 0x80020145, 0x80020147, 0x80020149, 0x8002014B,
+  0x8002014D, 0x8002014F, 0x80020151, 0x80020153, 0x80020155, 0x80020157,
+  0x80020159, 0x8002015B, 0x8002015D, 0x8002015F, 0x80020161, 0x80020163,
+  0x80020165, 0x80020167, 0x80020169, 0x8002016B, 0x8002016D, 0x8002016F,
+  0x80020171, 0x80020173, 0x80020175, 0x80020177, 0x80020179, 0x04000073,
+  0x00000000, 0x00200253, 0x00200183, 0x00000000, 0x00200185, 0x00000000,
+  0x00200254, 0x00200188, 0x00000000, 0x00200256, 0x00200257, 0x0020018C,
+  0x00000000, 0x00000000, 0x002001DD, 0x00200259, 0x0020025B, 0x00200192,
+  0x00000000, 0x00200260, 0x00200263, 0x00000000, 0x00200269, 0x00200268,
+  0x00200199, 0x00000000, 0x00000000, 0x00000000, 0x0020026F, 0x00200272,
+  0x00000000, 0x00200275, 0x8002017B, 0x8002017D, 0x002001A3, 0x00000000,
+  0x002001A5, 0x00000000, 0x00200280, 0x002001A8, 0x00000000, 0x00200283,
+  0x00000000, 0x00000000, 0x002001AD, 0x00000000, 0x00200288, 0x8002017F,
+  0x80020181, 0x0020028A, 0x0020028B, 0x002001B4, 0x00000000, 0x002001B6,
+  0x00000000, 0x00200292, 0x002001B9, 0x00000000, 0x00000000, 0x00000000,
+  0x002001BD, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x80030183, 0x80030186, 0x80030189, 0x8002018C,
+  0x8002018E, 0x80020190, 0x80020192, 0x80020194, 0x80020196, 0x80020198,
+  0x8002019A, 0x8002019C, 0x8002019E, 0x800201A0, 0x800201A2, 0x800201A4,
+  0x800201A6, 0x800301A8, 0x800301AB, 0x800301AE, 0x800301B1, 0x800301B4,
+  0x800301B7, 0x800301BA, 0x800301BD, 0x00000000, 0x800301C0, 0x800301C3,
+  0x800301C6, 0x800301C9, 0x800301CC, 0x800301CF, 0x002001E5, 0x00000000,
+  0x800201D2, 0x800201D4, 0x800201D6, 0x800201D8, 0x800201DA, 0x800201DC,
+  0x800301DE, 0x800301E1, 0x800201E4, 0x800201E6, 0x800201E8, 0x800201EA,
+  0x800201EC, 0x800201EE, 0x800201F0, 0x800201F2, 0x00200195, 0x002001BF,
+  0x800201F4, 0x800201F6, 0x800301F8, 0x800301FB, 0x800301FE, 0x80030201,
+  0x80030204, 0x80030207, 0x8002020A, 0x8002020C, 0x8002020E, 0x80020210,
+  0x80020212, 0x80020214, 0x80020216, 0x80020218, 0x8002021A, 0x8002021C,
+  0x8002021E, 0x80020220, 0x80020222, 0x80020224, 0x80020226, 0x80020228,
+  0x8002022A, 0x8002022C, 0x8002022E, 0x80020230, 0x80020232, 0x80020234,
+  0x80020236, 0x80020238, 0x8002023A, 0x8002023C, 0x8002023E, 0x80020240,
+  0x0020021D, 0x00000000, 0x80020242, 0x80020244, 0x0020019E, 0x00000000,
+  0x00200223, 0x00000000, 0x00200225, 0x00000000, 0x80020246, 0x80020248,
+  0x8002024A, 0x8002024C, 0x8003024E, 0x80030251, 0x80030254, 0x80030257,
+  0x8002025A, 0x8002025C, 0x8003025E, 0x80030261, 0x80020264, 0x80020266,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00202C65, 0x0020023C, 0x00000000, 0x0020019A, 0x00202C66, 0x00000000,
+  0x00000000, 0x00200242, 0x00000000, 0x00200180, 0x00200289, 0x0020028C,
+  0x00200247, 0x00000000, 0x00200249, 0x00000000, 0x0020024B, 0x00000000,
+  0x0020024D, 0x00000000, 0x0020024F, 0x00000000, 0x02000068, 0x02000266,
+  0x0200006A, 0x02000072, 0x02000279, 0x0200027B, 0x02000281, 0x02000077,
+  0x02000079, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x80020268, 0x8002026A,
+  0x8002026C, 0x8002026E, 0x80020270, 0x80020272, 0x00000000, 0x00000000,
+  0x02000263, 0x0200006C, 0x02000073, 0x02000078, 0x02000295, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000300, 0x00000301,
+  0x00000000, 0x00000313, 0x80020274, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00200371, 0x00000000, 0x00200373, 0x00000000,
+  0x000002B9, 0x00000000, 0x00200377, 0x00000000, 0x00000000, 0x00000000,
+  0x80020276, 0x00000000, 0x00000000, 0x00000000, 0x0000003B, 0x002003F3,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x80020278, 0x8003027A,
+  0x8002027D, 0x000000B7, 0x8002027F, 0x80020281, 0x80020283, 0x00000000,
+  0x80020285, 0x00000000, 0x80020287, 0x80020289, 0x8003028B, 0x002003B1,
+  0x002003B2, 0x002003B3, 0x002003B4, 0x002003B5, 0x002003B6, 0x002003B7,
+  0x002003B8, 0x002003B9, 0x002003BA, 0x002003BB, 0x002003BC, 0x002003BD,
+  0x002003BE, 0x002003BF, 0x002003C0, 0x002003C1, 0x00000000, 0x002003C3,
+  0x002003C4, 0x002003C5, 0x002003C6, 0x002003C7, 0x002003C8, 0x002003C9,
+  0x8002028E, 0x80020290, 0x80020292, 0x80020294, 0x80020296, 0x80020298,
+  0x8003029A, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x8002029D, 0x8002029F, 0x800202A1, 0x800202A3,
+  0x800202A5, 0x002003D7, 0x040003B2, 0x040003B8, 0x042003C5, 0x800202A7,
+  0x800202A9, 0x040003C6, 0x040003C0, 0x00000000, 0x002003D9, 0x00000000,
+  0x002003DB, 0x00000000, 0x002003DD, 0x00000000, 0x002003DF, 0x00000000,
+  0x002003E1, 0x00000000, 0x002003E3, 0x00000000, 0x002003E5, 0x00000000,
+  0x002003E7, 0x00000000, 0x002003E9, 0x00000000, 0x002003EB, 0x00000000,
+  0x002003ED, 0x00000000, 0x002003EF, 0x00000000, 0x040003BA, 0x040003C1,
+  0x040003C2, 0x00000000, 0x042003B8, 0x040003B5, 0x00000000, 0x002003F8,
+  0x00000000, 0x042003C3, 0x002003FB, 0x00000000, 0x00000000, 0x0020037B,
+  0x0020037C, 0x0020037D, 0x800202AB, 0x800202AD, 0x00200452, 0x800202AF,
+  0x00200454, 0x00200455, 0x00200456, 0x800202B1, 0x00200458, 0x00200459,
+  0x0020045A, 0x0020045B, 0x800202B3, 0x800202B5, 0x800202B7, 0x0020045F,
+  0x00200430, 0x00200431, 0x00200432, 0x00200433, 0x00200434, 0x00200435,
+  0x00200436, 0x00200437, 0x00200438, 0x800202B9, 0x0020043A, 0x0020043B,
+  0x0020043C, 0x0020043D, 0x0020043E, 0x0020043F, 0x00200440, 0x00200441,
+  0x00200442, 0x00200443, 0x00200444, 0x00200445, 0x00200446, 0x00200447,
+  0x00200448, 0x00200449, 0x0020044A, 0x0020044B, 0x0020044C, 0x0020044D,
+  0x0020044E, 0x0020044F, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x800202BB,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x800202BD, 0x800202BF, 0x00000000, 0x800202C1, 0x00000000, 0x00000000,
+  0x00000000, 0x800202C3, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x800202C5, 0x800202C7, 0x800202C9, 0x00000000, 0x00200461, 0x00000000,
+  0x00200463, 0x00000000, 0x00200465, 0x00000000, 0x00200467, 0x00000000,
+  0x00200469, 0x00000000, 0x0020046B, 0x00000000, 0x0020046D, 0x00000000,
+  0x0020046F, 0x00000000, 0x00200471, 0x00000000, 0x00200473, 0x00000000,
+  0x00200475, 0x00000000, 0x800202CB, 0x800202CD, 0x00200479, 0x00000000,
+  0x0020047B, 0x00000000, 0x0020047D, 0x00000000, 0x0020047F, 0x00000000,
+  0x00200481, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0020048B, 0x00000000,
+  0x0020048D, 0x00000000, 0x0020048F, 0x00000000, 0x00200491, 0x00000000,
+  0x00200493, 0x00000000, 0x00200495, 0x00000000, 0x00200497, 0x00000000,
+  0x00200499, 0x00000000, 0x0020049B, 0x00000000, 0x0020049D, 0x00000000,
+  0x0020049F, 0x00000000, 0x002004A1, 0x00000000, 0x002004A3, 0x00000000,
+  0x002004A5, 0x00000000, 0x002004A7, 0x00000000, 0x002004A9, 0x00000000,
+  0x002004AB, 0x00000000, 0x002004AD, 0x00000000, 0x002004AF, 0x00000000,
+  0x002004B1, 0x00000000, 0x002004B3, 0x00000000, 0x002004B5, 0x00000000,
+  0x002004B7, 0x00000000, 0x002004B9, 0x00000000, 0x002004BB, 0x00000000,
+  0x002004BD, 0x00000000, 0x002004BF, 0x00000000, 0x002004CF, 0x800202CF,
+  0x800202D1, 0x002004C4, 0x00000000, 0x002004C6, 0x00000000, 0x002004C8,
+  0x00000000, 0x002004CA, 0x00000000, 0x002004CC, 0x00000000, 0x002004CE,
+  0x00000000, 0x00000000, 0x800202D3, 0x800202D5, 0x800202D7, 0x800202D9,
+  0x002004D5, 0x00000000, 0x800202DB, 0x800202DD, 0x002004D9, 0x00000000,
+  0x800202DF, 0x800202E1, 0x800202E3, 0x800202E5, 0x800202E7, 0x800202E9,
+  0x002004E1, 0x00000000, 0x800202EB, 0x800202ED, 0x800202EF, 0x800202F1,
+  0x800202F3, 0x800202F5, 0x002004E9, 0x00000000, 0x800202F7, 0x800202F9,
+  0x800202FB, 0x800202FD, 0x800202FF, 0x80020301, 0x80020303, 0x80020305,
+  0x80020307, 0x80020309, 0x8002030B, 0x8002030D, 0x002004F7, 0x00000000,
+  0x8002030F, 0x80020311, 0x002004FB, 0x00000000, 0x002004FD, 0x00000000,
+  0x002004FF, 0x00000000, 0x00200501, 0x00000000, 0x00200503, 0x00000000,
+  0x00200505, 0x00000000, 0x00200507, 0x00000000, 0x00200509, 0x00000000,
+  0x0020050B, 0x00000000, 0x0020050D, 0x00000000, 0x0020050F, 0x00000000,
+  0x00200511, 0x00000000, 0x00200513, 0x00000000, 0x00200515, 0x00000000,
+  0x00200517, 0x00000000, 0x00200519, 0x00000000, 0x0020051B, 0x00000000,
+  0x0020051D, 0x00000000, 0x0020051F, 0x00000000, 0x00200521, 0x00000000,
+  0x00200523, 0x00000000, 0x00200525, 0x00000000, 0x00200527, 0x00000000,
+  0x00200529, 0x00000000, 0x0020052B, 0x00000000, 0x0020052D, 0x00000000,
+  0x0020052F, 0x00000000, 0x00000000, 0x00200561, 0x00200562, 0x00200563,
+  0x00200564, 0x00200565, 0x00200566, 0x00200567, 0x00200568, 0x00200569,
+  0x0020056A, 0x0020056B, 0x0020056C, 0x0020056D, 0x0020056E, 0x0020056F,
+  0x00200570, 0x00200571, 0x00200572, 0x00200573, 0x00200574, 0x00200575,
+  0x00200576, 0x00200577, 0x00200578, 0x00200579, 0x0020057A, 0x0020057B,
+  0x0020057C, 0x0020057D, 0x0020057E, 0x0020057F, 0x00200580, 0x00200581,
+  0x00200582, 0x00200583, 0x00200584, 0x00200585, 0x00200586, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x80020313, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x80020315, 0x80020317, 0x80020319, 0x8002031B,
+  0x8002031D, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x04400030, 0x04400031,
+  0x04400032, 0x04400033, 0x04400034, 0x04400035, 0x04400036, 0x04400037,
+  0x04400038, 0x04400039, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x8002031F, 0x80020321, 0x80020323, 0x80020325, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x80020327, 0x00000000, 0x80020329, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x8002032B, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x8002032D,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x8002032F, 0x00000000, 0x00000000, 0x80020331, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x80020333, 0x80020335, 0x80020337, 0x80020339, 0x8002033B, 0x8002033D,
+  0x8002033F, 0x80020341, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x04400030, 0x04400031, 0x04400032, 0x04400033,
+  0x04400034, 0x04400035, 0x04400036, 0x04400037, 0x04400038, 0x04400039,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x80020343,
+  0x80020345, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x80020347, 0x80020349,
+  0x00000000, 0x8002034B, 0x00000000, 0x00000000, 0x00000000, 0x8002034D,
+  0x00000000, 0x00000000, 0x8002034F, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x80020351, 0x80020353, 0x80020355,
+  0x00000000, 0x00000000, 0x80020357, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x80020359, 0x00000000, 0x00000000, 0x8002035B, 0x8002035D, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x8002035F, 0x80020361, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x80020363, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x80020365, 0x80020367, 0x80020369, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x8002036B, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x8002036D, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x8002036F, 0x80020371, 0x00000000, 0x80020373, 0x80030375,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x80020378, 0x8002037A, 0x8002037C, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x8002037E, 0x00000000, 0x80020380, 0x80030382, 0x80020385, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x80020387, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x80020389, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x04400030, 0x04400031, 0x04400032, 0x04400033,
+  0x04400034, 0x04400035, 0x04400036, 0x04400037, 0x04400038, 0x04400039,
+  0x00000000, 0x00000000, 0x8002038B, 0x8002038D, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00800F0B, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x8002038F, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x80020391,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x80020393, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x80020395, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x80020397, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x80020399, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x8002039B, 0x00000000, 0x8002039D, 0x8002039F, 0x800303A1,
+  0x800203A4, 0x800303A6, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x800203A9, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x800203AB, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x800203AD, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x800203AF, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x800203B1,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x800203B3, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x800203B5,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x800203B7, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00202D00, 0x00202D01,
+  0x00202D02, 0x00202D03, 0x00202D04, 0x00202D05, 0x00202D06, 0x00202D07,
+  0x00202D08, 0x00202D09, 0x00202D0A, 0x00202D0B, 0x00202D0C, 0x00202D0D,
+  0x00202D0E, 0x00202D0F, 0x00202D10, 0x00202D11, 0x00202D12, 0x00202D13,
+  0x00202D14, 0x00202D15, 0x00202D16, 0x00202D17, 0x00202D18, 0x00202D19,
+  0x00202D1A, 0x00202D1B, 0x00202D1C, 0x00202D1D, 0x00202D1E, 0x00202D1F,
+  0x00202D20, 0x00202D21, 0x00202D22, 0x00202D23, 0x00202D24, 0x00202D25,
+  0x00000000, 0x00202D27, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00202D2D, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x020010DC, 0x00000000,
+  0x00000000, 0x00000000, 0x0020AB70, 0x0020AB71, 0x0020AB72, 0x0020AB73,
+  0x0020AB74, 0x0020AB75, 0x0020AB76, 0x0020AB77, 0x0020AB78, 0x0020AB79,
+  0x0020AB7A, 0x0020AB7B, 0x0020AB7C, 0x0020AB7D, 0x0020AB7E, 0x0020AB7F,
+  0x0020AB80, 0x0020AB81, 0x0020AB82, 0x0020AB83, 0x0020AB84, 0x0020AB85,
+  0x0020AB86, 0x0020AB87, 0x0020AB88, 0x0020AB89, 0x0020AB8A, 0x0020AB8B,
+  0x0020AB8C, 0x0020AB8D, 0x0020AB8E, 0x0020AB8F, 0x0020AB90, 0x0020AB91,
+  0x0020AB92, 0x0020AB93, 0x0020AB94, 0x0020AB95, 0x0020AB96, 0x0020AB97,
+  0x0020AB98, 0x0020AB99, 0x0020AB9A, 0x0020AB9B, 0x0020AB9C, 0x0020AB9D,
+  0x0020AB9E, 0x0020AB9F, 0x0020ABA0, 0x0020ABA1, 0x0020ABA2, 0x0020ABA3,
+  0x0020ABA4, 0x0020ABA5, 0x0020ABA6, 0x0020ABA7, 0x0020ABA8, 0x0020ABA9,
+  0x0020ABAA, 0x0020ABAB, 0x0020ABAC, 0x0020ABAD, 0x0020ABAE, 0x0020ABAF,
+  0x0020ABB0, 0x0020ABB1, 0x0020ABB2, 0x0020ABB3, 0x0020ABB4, 0x0020ABB5,
+  0x0020ABB6, 0x0020ABB7, 0x0020ABB8, 0x0020ABB9, 0x0020ABBA, 0x0020ABBB,
+  0x0020ABBC, 0x0020ABBD, 0x0020ABBE, 0x0020ABBF, 0x002013F8, 0x002013F9,
+  0x002013FA, 0x002013FB, 0x002013FC, 0x002013FD, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x800203B9, 0x00000000, 0x800203BB, 0x00000000,
+  0x800203BD, 0x00000000, 0x800203BF, 0x00000000, 0x800203C1, 0x00000000,
+  0x00000000, 0x00000000, 0x800203C3, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x800203C5, 0x00000000, 0x800203C7,
+  0x00000000, 0x00000000, 0x800203C9, 0x800203CB, 0x00000000, 0x800203CD,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x002010D0, 0x002010D1, 0x002010D2, 0x002010D3, 0x002010D4, 0x002010D5,
+  0x002010D6, 0x002010D7, 0x002010D8, 0x002010D9, 0x002010DA, 0x002010DB,
+  0x002010DC, 0x002010DD, 0x002010DE, 0x002010DF, 0x002010E0, 0x002010E1,
+  0x002010E2, 0x002010E3, 0x002010E4, 0x002010E5, 0x002010E6, 0x002010E7,
+  0x002010E8, 0x002010E9, 0x002010EA, 0x002010EB, 0x002010EC, 0x002010ED,
+  0x002010EE, 0x002010EF, 0x002010F0, 0x002010F1, 0x002010F2, 0x002010F3,
+  0x002010F4, 0x002010F5, 0x002010F6, 0x002010F7, 0x002010F8, 0x002010F9,
+  0x002010FA, 0x00000000, 0x00000000, 0x002010FD, 0x002010FE, 0x002010FF,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x02200061, 0x800203CF, 0x02200062, 0x00000000, 0x02200064, 0x02200065,
+  0x022001DD, 0x02200067, 0x02200068, 0x02200069, 0x0220006A, 0x0220006B,
+  0x0220006C, 0x0220006D, 0x0220006E, 0x00000000, 0x0220006F, 0x02200223,
+  0x02200070, 0x02200072, 0x02200074, 0x02200075, 0x02200077, 0x02000061,
+  0x02000250, 0x02000251, 0x02001D02, 0x02000062, 0x02000064, 0x02000065,
+  0x02000259, 0x0200025B, 0x0200025C, 0x02000067, 0x00000000, 0x0200006B,
+  0x0200006D, 0x0200014B, 0x0200006F, 0x02000254, 0x02001D16, 0x02001D17,
+  0x02000070, 0x02000074, 0x02000075, 0x02001D1D, 0x0200026F, 0x02000076,
+  0x02001D25, 0x020003B2, 0x020003B3, 0x020003B4, 0x020003C6, 0x020003C7,
+  0x02400069, 0x02400072, 0x02400075, 0x02400076, 0x024003B2, 0x024003B3,
+  0x024003C1, 0x024003C6, 0x024003C7, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0200043D, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02000252,
+  0x02000063, 0x02000255, 0x020000F0, 0x0200025C, 0x02000066, 0x0200025F,
+  0x02000261, 0x02000265, 0x02000268, 0x02000269, 0x0200026A, 0x02001D7B,
+  0x0200029D, 0x0200026D, 0x02001D85, 0x0200029F, 0x02000271, 0x02000270,
+  0x02000272, 0x02000273, 0x02000274, 0x02000275, 0x02000278, 0x02000282,
+  0x02000283, 0x020001AB, 0x02000289, 0x0200028A, 0x02001D1C, 0x0200028B,
+  0x0200028C, 0x0200007A, 0x02000290, 0x02000291, 0x02000292, 0x020003B8,
+  0x800203D1, 0x800203D3, 0x800203D5, 0x800203D7, 0x800203D9, 0x800203DB,
+  0x800203DD, 0x800203DF, 0x800303E1, 0x800303E4, 0x800203E7, 0x800203E9,
+  0x800203EB, 0x800203ED, 0x800203EF, 0x800203F1, 0x800203F3, 0x800203F5,
+  0x800203F7, 0x800203F9, 0x800303FB, 0x800303FE, 0x80030401, 0x80030404,
+  0x80020407, 0x80020409, 0x8002040B, 0x8002040D, 0x8003040F, 0x80030412,
+  0x80020415, 0x80020417, 0x80020419, 0x8002041B, 0x8002041D, 0x8002041F,
+  0x80020421, 0x80020423, 0x80020425, 0x80020427, 0x80020429, 0x8002042B,
+  0x8002042D, 0x8002042F, 0x80020431, 0x80020433, 0x80030435, 0x80030438,
+  0x8002043B, 0x8002043D, 0x8002043F, 0x80020441, 0x80020443, 0x80020445,
+  0x80020447, 0x80020449, 0x8003044B, 0x8003044E, 0x80020451, 0x80020453,
+  0x80020455, 0x80020457, 0x80020459, 0x8002045B, 0x8002045D, 0x8002045F,
+  0x80020461, 0x80020463, 0x80020465, 0x80020467, 0x80020469, 0x8002046B,
+  0x8002046D, 0x8002046F, 0x80020471, 0x80020473, 0x80030475, 0x80030478,
+  0x8003047B, 0x8003047E, 0x80030481, 0x80030484, 0x80030487, 0x8003048A,
+  0x8002048D, 0x8002048F, 0x80020491, 0x80020493, 0x80020495, 0x80020497,
+  0x80020499, 0x8002049B, 0x8003049D, 0x800304A0, 0x800204A3, 0x800204A5,
+  0x800204A7, 0x800204A9, 0x800204AB, 0x800204AD, 0x800304AF, 0x800304B2,
+  0x800304B5, 0x800304B8, 0x800304BB, 0x800304BE, 0x800204C1, 0x800204C3,
+  0x800204C5, 0x800204C7, 0x800204C9, 0x800204CB, 0x800204CD, 0x800204CF,
+  0x800204D1, 0x800204D3, 0x800204D5, 0x800204D7, 0x800204D9, 0x800204DB,
+  0x800304DD, 0x800304E0, 0x800304E3, 0x800304E6, 0x800204E9, 0x800204EB,
+  0x800204ED, 0x800204EF, 0x800204F1, 0x800204F3, 0x800204F5, 0x800204F7,
+  0x800204F9, 0x800204FB, 0x800204FD, 0x800204FF, 0x80020501, 0x80020503,
+  0x80020505, 0x80020507, 0x80020509, 0x8002050B, 0x8002050D, 0x8002050F,
+  0x80020511, 0x80020513, 0x80020515, 0x80020517, 0x80020519, 0x8002051B,
+  0x8002051D, 0x8002051F, 0x80020521, 0x80020523, 0x80020525, 0x80020527,
+  0x00000000, 0x00000000, 0x80020529, 0x00000000, 0x8002052B, 0x8002052D,
+  0x8002052F, 0x80020531, 0x80030533, 0x80030536, 0x80030539, 0x8003053C,
+  0x8003053F, 0x80030542, 0x80030545, 0x80030548, 0x8003054B, 0x8003054E,
+  0x80030551, 0x80030554, 0x80030557, 0x8003055A, 0x8003055D, 0x80030560,
+  0x80030563, 0x80030566, 0x80030569, 0x8003056C, 0x8002056F, 0x80020571,
+  0x80020573, 0x80020575, 0x80020577, 0x80020579, 0x8003057B, 0x8003057E,
+  0x80030581, 0x80030584, 0x80030587, 0x8003058A, 0x8003058D, 0x80030590,
+  0x80030593, 0x80030596, 0x80020599, 0x8002059B, 0x8002059D, 0x8002059F,
+  0x800205A1, 0x800205A3, 0x800205A5, 0x800205A7, 0x800305A9, 0x800305AC,
+  0x800305AF, 0x800305B2, 0x800305B5, 0x800305B8, 0x800305BB, 0x800305BE,
+  0x800305C1, 0x800305C4, 0x800305C7, 0x800305CA, 0x800305CD, 0x800305D0,
+  0x800305D3, 0x800305D6, 0x800305D9, 0x800305DC, 0x800305DF, 0x800305E2,
+  0x800205E5, 0x800205E7, 0x800205E9, 0x800205EB, 0x800305ED, 0x800305F0,
+  0x800305F3, 0x800305F6, 0x800305F9, 0x800305FC, 0x800305FF, 0x80030602,
+  0x80030605, 0x80030608, 0x8002060B, 0x8002060D, 0x8002060F, 0x80020611,
+  0x80020613, 0x80020615, 0x80020617, 0x80020619, 0x00201EFB, 0x00000000,
+  0x00201EFD, 0x00000000, 0x00201EFF, 0x00000000, 0x8002061B, 0x8002061D,
+  0x8003061F, 0x80030622, 0x80030625, 0x80030628, 0x8003062B, 0x8003062E,
+  0x80020631, 0x80020633, 0x80030635, 0x80030638, 0x8003063B, 0x8003063E,
+  0x80030641, 0x80030644, 0x80020647, 0x80020649, 0x8003064B, 0x8003064E,
+  0x80030651, 0x80030654, 0x00000000, 0x00000000, 0x80020657, 0x80020659,
+  0x8003065B, 0x8003065E, 0x80030661, 0x80030664, 0x00000000, 0x00000000,
+  0x80020667, 0x80020669, 0x8003066B, 0x8003066E, 0x80030671, 0x80030674,
+  0x80030677, 0x8003067A, 0x8002067D, 0x8002067F, 0x80030681, 0x80030684,
+  0x80030687, 0x8003068A, 0x8003068D, 0x80030690, 0x80020693, 0x80020695,
+  0x80030697, 0x8003069A, 0x8003069D, 0x800306A0, 0x800306A3, 0x800306A6,
+  0x800206A9, 0x800206AB, 0x800306AD, 0x800306B0, 0x800306B3, 0x800306B6,
+  0x800306B9, 0x800306BC, 0x800206BF, 0x800206C1, 0x800306C3, 0x800306C6,
+  0x800306C9, 0x800306CC, 0x00000000, 0x00000000, 0x800206CF, 0x800206D1,
+  0x800306D3, 0x800306D6, 0x800306D9, 0x800306DC, 0x00000000, 0x00000000,
+  0x800206DF, 0x800206E1, 0x800306E3, 0x800306E6, 0x800306E9, 0x800306EC,
+  0x800306EF, 0x800306F2, 0x00000000, 0x800206F5, 0x00000000, 0x800306F7,
+  0x00000000, 0x800306FA, 0x00000000, 0x800306FD, 0x80020700, 0x80020702,
+  0x80030704, 0x80030707, 0x8003070A, 0x8003070D, 0x80030710, 0x80030713,
+  0x80020716, 0x80020718, 0x8003071A, 0x8003071D, 0x80030720, 0x80030723,
+  0x80030726, 0x80030729, 0x8002072C, 0x8002072E, 0x80020730, 0x80020732,
+  0x80020734, 0x80020736, 0x80020738, 0x8002073A, 0x8002073C, 0x8002073E,
+  0x80020740, 0x80020742, 0x80020744, 0x80020746, 0x00000000, 0x00000000,
+  0x80030748, 0x8003074B, 0x8004074E, 0x80040752, 0x80040756, 0x8004075A,
+  0x8004075E, 0x80040762, 0x80030766, 0x80030769, 0x8004076C, 0x80040770,
+  0x80040774, 0x80040778, 0x8004077C, 0x80040780, 0x80030784, 0x80030787,
+  0x8004078A, 0x8004078E, 0x80040792, 0x80040796, 0x8004079A, 0x8004079E,
+  0x800307A2, 0x800307A5, 0x800407A8, 0x800407AC, 0x800407B0, 0x800407B4,
+  0x800407B8, 0x800407BC, 0x800307C0, 0x800307C3, 0x800407C6, 0x800407CA,
+  0x800407CE, 0x800407D2, 0x800407D6, 0x800407DA, 0x800307DE, 0x800307E1,
+  0x800407E4, 0x800407E8, 0x800407EC, 0x800407F0, 0x800407F4, 0x800407F8,
+  0x800207FC, 0x800207FE, 0x80030800, 0x80020803, 0x80030805, 0x00000000,
+  0x80020808, 0x8003080A, 0x8002080D, 0x8002080F, 0x80020811, 0x80020813,
+  0x80020815, 0x80020817, 0x000003B9, 0x80020819, 0x8002081B, 0x8003081D,
+  0x80030820, 0x80020823, 0x80030825, 0x00000000, 0x80020828, 0x8003082A,
+  0x8002082D, 0x8002082F, 0x80020831, 0x80020833, 0x80020835, 0x80030837,
+  0x8003083A, 0x8003083D, 0x80020840, 0x80020842, 0x80030844, 0x80030847,
+  0x00000000, 0x00000000, 0x8002084A, 0x8003084C, 0x8002084F, 0x80020851,
+  0x80020853, 0x80020855, 0x00000000, 0x80030857, 0x8003085A, 0x8003085D,
+  0x80020860, 0x80020862, 0x80030864, 0x80030867, 0x8002086A, 0x8002086C,
+  0x8002086E, 0x80030870, 0x80020873, 0x80020875, 0x80020877, 0x80020879,
+  0x8002087B, 0x8003087D, 0x80030880, 0x00000060, 0x00000000, 0x00000000,
+  0x80030883, 0x80020886, 0x80030888, 0x00000000, 0x8002088B, 0x8003088D,
+  0x80020890, 0x80020892, 0x80020894, 0x80020896, 0x80020898, 0x8002089A,
+  0x8002089C, 0x00000000, 0x04000020, 0x04000020, 0x04000020, 0x04000020,
+  0x04000020, 0x04000020, 0x04000020, 0x00800020, 0x04000020, 0x04000020,
+  0x04000020, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00802010, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x8002089E, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x0400002E, 0x800208A0, 0x800308A2, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00800020, 0x00000000, 0x00000000, 0x00000000, 0x800208A5,
+  0x800308A7, 0x00000000, 0x800208AA, 0x800308AC, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x800208AF, 0x00000000, 0x800208B1, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x800208B3, 0x800208B5, 0x800208B7, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x800408B9,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x04000020, 0x02000030, 0x02000069, 0x00000000, 0x00000000,
+  0x02000034, 0x02000035, 0x02000036, 0x02000037, 0x02000038, 0x02000039,
+  0x0200002B, 0x02002212, 0x0200003D, 0x02000028, 0x02000029, 0x0200006E,
+  0x02400030, 0x02400031, 0x02400032, 0x02400033, 0x02400034, 0x02400035,
+  0x02400036, 0x02400037, 0x02400038, 0x02400039, 0x0240002B, 0x02402212,
+  0x0240003D, 0x02400028, 0x02400029, 0x00000000, 0x02400061, 0x02400065,
+  0x0240006F, 0x02400078, 0x02400259, 0x02400068, 0x0240006B, 0x0240006C,
+  0x0240006D, 0x0240006E, 0x02400070, 0x02400073, 0x02400074, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x800208BD, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x800308BF, 0x800308C2, 0x00600063, 0x800208C5, 0x00000000, 0x800308C7,
+  0x800308CA, 0x0420025B, 0x00000000, 0x800208CD, 0x00400067, 0x00600068,
+  0x00600068, 0x00600068, 0x00400068, 0x800208CF, 0x00600069, 0x00600069,
+  0x0060006C, 0x0040006C, 0x00000000, 0x0060006E, 0x800208D1, 0x00000000,
+  0x00000000, 0x00600070, 0x00600071, 0x00600072, 0x00600072, 0x00600072,
+  0x00000000, 0x00000000, 0x800208D3, 0x800308D5, 0x800208D8, 0x00000000,
+  0x0060007A, 0x00000000, 0x002003C9, 0x00000000, 0x0060007A, 0x00000000,
+  0x0020006B, 0x800208DA, 0x00600062, 0x00600063, 0x00000000, 0x00400065,
+  0x00600065, 0x00600066, 0x0020214E, 0x0060006D, 0x0040006F, 0x040005D0,
+  0x040005D1, 0x040005D2, 0x040005D3, 0x00400069, 0x00000000, 0x800308DC,
+  0x004003C0, 0x004003B3, 0x006003B3, 0x006003C0, 0x00402211, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00600064, 0x00400064, 0x00400065,
+  0x00400069, 0x0040006A, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x800308DF, 0x800308E2, 0x800408E5, 0x800308E9,
+  0x800308EC, 0x800308EF, 0x800308F2, 0x800308F5, 0x800308F8, 0x800308FB,
+  0x800308FE, 0x80030901, 0x80030904, 0x80030907, 0x8003090A, 0x8002090D,
+  0x04200069, 0x8002090F, 0x80030911, 0x80020914, 0x04200076, 0x80020916,
+  0x80030918, 0x8004091B, 0x8002091F, 0x04200078, 0x80020921, 0x80030923,
+  0x0420006C, 0x04200063, 0x04200064, 0x0420006D, 0x04000069, 0x80020926,
+  0x80030928, 0x8002092B, 0x04000076, 0x8002092D, 0x8003092F, 0x80040932,
+  0x80020936, 0x04000078, 0x80020938, 0x8003093A, 0x0400006C, 0x04000063,
+  0x04000064, 0x0400006D, 0x00000000, 0x00000000, 0x00000000, 0x00202184,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x8003093D,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x80020940, 0x80020942,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x80020944, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x80020946, 0x80020948, 0x8002094A,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x8002094C, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x8002094E, 0x00000000, 0x00000000,
+  0x80020950, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x80020952, 0x00000000, 0x80020954, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x80020956, 0x80030958,
+  0x00000000, 0x8002095B, 0x8003095D, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x80020960, 0x00000000, 0x00000000, 0x80020962, 0x00000000,
+  0x00000000, 0x80020964, 0x00000000, 0x80020966, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x80020968, 0x00000000,
+  0x8002096A, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x8002096C,
+  0x8002096E, 0x80020970, 0x80020972, 0x80020974, 0x00000000, 0x00000000,
+  0x80020976, 0x80020978, 0x00000000, 0x00000000, 0x8002097A, 0x8002097C,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x8002097E, 0x80020980, 0x00000000, 0x00000000, 0x80020982, 0x80020984,
+  0x00000000, 0x00000000, 0x80020986, 0x80020988, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x8002098A, 0x8002098C,
+  0x8002098E, 0x80020990, 0x80020992, 0x80020994, 0x80020996, 0x80020998,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x8002099A, 0x8002099C, 0x8002099E, 0x800209A0, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00003008, 0x00003009, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01C00031, 0x01C00032,
+  0x01C00033, 0x01C00034, 0x01C00035, 0x01C00036, 0x01C00037, 0x01C00038,
+  0x01C00039, 0x800209A2, 0x800209A4, 0x800209A6, 0x800209A8, 0x800209AA,
+  0x800209AC, 0x800209AE, 0x800209B0, 0x800209B2, 0x800209B4, 0x800209B6,
+  0x800309B8, 0x800309BB, 0x800309BE, 0x800309C1, 0x800309C4, 0x800309C7,
+  0x800309CA, 0x800309CD, 0x800309D0, 0x800409D3, 0x800409D7, 0x800409DB,
+  0x800409DF, 0x800409E3, 0x800409E7, 0x800409EB, 0x800409EF, 0x800409F3,
+  0x800409F7, 0x800409FB, 0x800209FF, 0x80020A01, 0x80020A03, 0x80020A05,
+  0x80020A07, 0x80020A09, 0x80020A0B, 0x80020A0D, 0x80020A0F, 0x80030A11,
+  0x80030A14, 0x80030A17, 0x80030A1A, 0x80030A1D, 0x80030A20, 0x80030A23,
+  0x80030A26, 0x80030A29, 0x80030A2C, 0x80030A2F, 0x80030A32, 0x80030A35,
+  0x80030A38, 0x80030A3B, 0x80030A3E, 0x80030A41, 0x80030A44, 0x80030A47,
+  0x80030A4A, 0x80030A4D, 0x80030A50, 0x80030A53, 0x80030A56, 0x80030A59,
+  0x80030A5C, 0x80030A5F, 0x80030A62, 0x80030A65, 0x80030A68, 0x80030A6B,
+  0x80030A6E, 0x80030A71, 0x80030A74, 0x80030A77, 0x80030A7A, 0x80030A7D,
+  0x01E00061, 0x01E00062, 0x01E00063, 0x01E00064, 0x01E00065, 0x01E00066,
+  0x01E00067, 0x01E00068, 0x01E00069, 0x01E0006A, 0x01E0006B, 0x01E0006C,
+  0x01E0006D, 0x01E0006E, 0x01E0006F, 0x01E00070, 0x01E00071, 0x01E00072,
+  0x01E00073, 0x01E00074, 0x01E00075, 0x01E00076, 0x01E00077, 0x01E00078,
+  0x01E00079, 0x01E0007A, 0x01C00061, 0x01C00062, 0x01C00063, 0x01C00064,
+  0x01C00065, 0x01C00066, 0x01C00067, 0x01C00068, 0x01C00069, 0x01C0006A,
+  0x01C0006B, 0x01C0006C, 0x01C0006D, 0x01C0006E, 0x01C0006F, 0x01C00070,
+  0x01C00071, 0x01C00072, 0x01C00073, 0x01C00074, 0x01C00075, 0x01C00076,
+  0x01C00077, 0x01C00078, 0x01C00079, 0x01C0007A, 0x01C00030, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x80040A80, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x80030A84, 0x80020A87, 0x80030A89, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x80020A8C, 0x00000000, 0x00000000, 0x00000000, 0x00202C30, 0x00202C31,
+  0x00202C32, 0x00202C33, 0x00202C34, 0x00202C35, 0x00202C36, 0x00202C37,
+  0x00202C38, 0x00202C39, 0x00202C3A, 0x00202C3B, 0x00202C3C, 0x00202C3D,
+  0x00202C3E, 0x00202C3F, 0x00202C40, 0x00202C41, 0x00202C42, 0x00202C43,
+  0x00202C44, 0x00202C45, 0x00202C46, 0x00202C47, 0x00202C48, 0x00202C49,
+  0x00202C4A, 0x00202C4B, 0x00202C4C, 0x00202C4D, 0x00202C4E, 0x00202C4F,
+  0x00202C50, 0x00202C51, 0x00202C52, 0x00202C53, 0x00202C54, 0x00202C55,
+  0x00202C56, 0x00202C57, 0x00202C58, 0x00202C59, 0x00202C5A, 0x00202C5B,
+  0x00202C5C, 0x00202C5D, 0x00202C5E, 0x00000000, 0x00202C61, 0x00000000,
+  0x0020026B, 0x00201D7D, 0x0020027D, 0x00000000, 0x00000000, 0x00202C68,
+  0x00000000, 0x00202C6A, 0x00000000, 0x00202C6C, 0x00000000, 0x00200251,
+  0x00200271, 0x00200250, 0x00200252, 0x00000000, 0x00202C73, 0x00000000,
+  0x00000000, 0x00202C76, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x0240006A, 0x02200076, 0x0020023F, 0x00200240,
+  0x00202C81, 0x00000000, 0x00202C83, 0x00000000, 0x00202C85, 0x00000000,
+  0x00202C87, 0x00000000, 0x00202C89, 0x00000000, 0x00202C8B, 0x00000000,
+  0x00202C8D, 0x00000000, 0x00202C8F, 0x00000000, 0x00202C91, 0x00000000,
+  0x00202C93, 0x00000000, 0x00202C95, 0x00000000, 0x00202C97, 0x00000000,
+  0x00202C99, 0x00000000, 0x00202C9B, 0x00000000, 0x00202C9D, 0x00000000,
+  0x00202C9F, 0x00000000, 0x00202CA1, 0x00000000, 0x00202CA3, 0x00000000,
+  0x00202CA5, 0x00000000, 0x00202CA7, 0x00000000, 0x00202CA9, 0x00000000,
+  0x00202CAB, 0x00000000, 0x00202CAD, 0x00000000, 0x00202CAF, 0x00000000,
+  0x00202CB1, 0x00000000, 0x00202CB3, 0x00000000, 0x00202CB5, 0x00000000,
+  0x00202CB7, 0x00000000, 0x00202CB9, 0x00000000, 0x00202CBB, 0x00000000,
+  0x00202CBD, 0x00000000, 0x00202CBF, 0x00000000, 0x00202CC1, 0x00000000,
+  0x00202CC3, 0x00000000, 0x00202CC5, 0x00000000, 0x00202CC7, 0x00000000,
+  0x00202CC9, 0x00000000, 0x00202CCB, 0x00000000, 0x00202CCD, 0x00000000,
+  0x00202CCF, 0x00000000, 0x00202CD1, 0x00000000, 0x00202CD3, 0x00000000,
+  0x00202CD5, 0x00000000, 0x00202CD7, 0x00000000, 0x00202CD9, 0x00000000,
+  0x00202CDB, 0x00000000, 0x00202CDD, 0x00000000, 0x00202CDF, 0x00000000,
+  0x00202CE1, 0x00000000, 0x00202CE3, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00202CEC,
+  0x00000000, 0x00202CEE, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00202CF3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02002D61,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x04006BCD, 0x00000000, 0x00000000,
+  0x00000000, 0x04009F9F, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x04004E00, 0x04004E28, 0x04004E36, 0x04004E3F,
+  0x04004E59, 0x04004E85, 0x04004E8C, 0x04004EA0, 0x04004EBA, 0x0400513F,
+  0x04005165, 0x0400516B, 0x04005182, 0x04005196, 0x040051AB, 0x040051E0,
+  0x040051F5, 0x04005200, 0x0400529B, 0x040052F9, 0x04005315, 0x0400531A,
+  0x04005338, 0x04005341, 0x0400535C, 0x04005369, 0x04005382, 0x040053B6,
+  0x040053C8, 0x040053E3, 0x040056D7, 0x0400571F, 0x040058EB, 0x04005902,
+  0x0400590A, 0x04005915, 0x04005927, 0x04005973, 0x04005B50, 0x04005B80,
+  0x04005BF8, 0x04005C0F, 0x04005C22, 0x04005C38, 0x04005C6E, 0x04005C71,
+  0x04005DDB, 0x04005DE5, 0x04005DF1, 0x04005DFE, 0x04005E72, 0x04005E7A,
+  0x04005E7F, 0x04005EF4, 0x04005EFE, 0x04005F0B, 0x04005F13, 0x04005F50,
+  0x04005F61, 0x04005F73, 0x04005FC3, 0x04006208, 0x04006236, 0x0400624B,
+  0x0400652F, 0x04006534, 0x04006587, 0x04006597, 0x040065A4, 0x040065B9,
+  0x040065E0, 0x040065E5, 0x040066F0, 0x04006708, 0x04006728, 0x04006B20,
+  0x04006B62, 0x04006B79, 0x04006BB3, 0x04006BCB, 0x04006BD4, 0x04006BDB,
+  0x04006C0F, 0x04006C14, 0x04006C34, 0x0400706B, 0x0400722A, 0x04007236,
+  0x0400723B, 0x0400723F, 0x04007247, 0x04007259, 0x0400725B, 0x040072AC,
+  0x04007384, 0x04007389, 0x040074DC, 0x040074E6, 0x04007518, 0x0400751F,
+  0x04007528, 0x04007530, 0x0400758B, 0x04007592, 0x04007676, 0x0400767D,
+  0x040076AE, 0x040076BF, 0x040076EE, 0x040077DB, 0x040077E2, 0x040077F3,
+  0x0400793A, 0x040079B8, 0x040079BE, 0x04007A74, 0x04007ACB, 0x04007AF9,
+  0x04007C73, 0x04007CF8, 0x04007F36, 0x04007F51, 0x04007F8A, 0x04007FBD,
+  0x04008001, 0x0400800C, 0x04008012, 0x04008033, 0x0400807F, 0x04008089,
+  0x040081E3, 0x040081EA, 0x040081F3, 0x040081FC, 0x0400820C, 0x0400821B,
+  0x0400821F, 0x0400826E, 0x04008272, 0x04008278, 0x0400864D, 0x0400866B,
+  0x04008840, 0x0400884C, 0x04008863, 0x0400897E, 0x0400898B, 0x040089D2,
+  0x04008A00, 0x04008C37, 0x04008C46, 0x04008C55, 0x04008C78, 0x04008C9D,
+  0x04008D64, 0x04008D70, 0x04008DB3, 0x04008EAB, 0x04008ECA, 0x04008F9B,
+  0x04008FB0, 0x04008FB5, 0x04009091, 0x04009149, 0x040091C6, 0x040091CC,
+  0x040091D1, 0x04009577, 0x04009580, 0x0400961C, 0x040096B6, 0x040096B9,
+  0x040096E8, 0x04009751, 0x0400975E, 0x04009762, 0x04009769, 0x040097CB,
+  0x040097ED, 0x040097F3, 0x04009801, 0x040098A8, 0x040098DB, 0x040098DF,
+  0x04009996, 0x04009999, 0x040099AC, 0x04009AA8, 0x04009AD8, 0x04009ADF,
+  0x04009B25, 0x04009B2F, 0x04009B32, 0x04009B3C, 0x04009B5A, 0x04009CE5,
+  0x04009E75, 0x04009E7F, 0x04009EA5, 0x04009EBB, 0x04009EC3, 0x04009ECD,
+  0x04009ED1, 0x04009EF9, 0x04009EFD, 0x04009F0E, 0x04009F13, 0x04009F20,
+  0x04009F3B, 0x04009F4A, 0x04009F52, 0x04009F8D, 0x04009F9C, 0x04009FA0,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02C00020, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x04003012, 0x00000000, 0x04005341, 0x04005344,
+  0x04005345, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x80020A8E, 0x00000000, 0x80020A90, 0x00000000, 0x80020A92, 0x00000000,
+  0x80020A94, 0x00000000, 0x80020A96, 0x00000000, 0x80020A98, 0x00000000,
+  0x80020A9A, 0x00000000, 0x80020A9C, 0x00000000, 0x80020A9E, 0x00000000,
+  0x80020AA0, 0x00000000, 0x80020AA2, 0x00000000, 0x80020AA4, 0x00000000,
+  0x00000000, 0x80020AA6, 0x00000000, 0x80020AA8, 0x00000000, 0x80020AAA,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x80020AAC, 0x80020AAE, 0x00000000, 0x80020AB0, 0x80020AB2, 0x00000000,
+  0x80020AB4, 0x80020AB6, 0x00000000, 0x80020AB8, 0x80020ABA, 0x00000000,
+  0x80020ABC, 0x80020ABE, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x80020AC0, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x80020AC2, 0x80020AC4, 0x00000000,
+  0x80020AC6, 0x80020AC8, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x80020ACA, 0x00000000, 0x80020ACC, 0x00000000,
+  0x80020ACE, 0x00000000, 0x80020AD0, 0x00000000, 0x80020AD2, 0x00000000,
+  0x80020AD4, 0x00000000, 0x80020AD6, 0x00000000, 0x80020AD8, 0x00000000,
+  0x80020ADA, 0x00000000, 0x80020ADC, 0x00000000, 0x80020ADE, 0x00000000,
+  0x80020AE0, 0x00000000, 0x00000000, 0x80020AE2, 0x00000000, 0x80020AE4,
+  0x00000000, 0x80020AE6, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x80020AE8, 0x80020AEA, 0x00000000, 0x80020AEC,
+  0x80020AEE, 0x00000000, 0x80020AF0, 0x80020AF2, 0x00000000, 0x80020AF4,
+  0x80020AF6, 0x00000000, 0x80020AF8, 0x80020AFA, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x80020AFC, 0x00000000,
+  0x00000000, 0x80020AFE, 0x80020B00, 0x80020B02, 0x80020B04, 0x00000000,
+  0x00000000, 0x00000000, 0x80020B06, 0x80020B08, 0x00000000, 0x04001100,
+  0x04001101, 0x040011AA, 0x04001102, 0x040011AC, 0x040011AD, 0x04001103,
+  0x04001104, 0x04001105, 0x040011B0, 0x040011B1, 0x040011B2, 0x040011B3,
+  0x040011B4, 0x040011B5, 0x0400111A, 0x04001106, 0x04001107, 0x04001108,
+  0x04001121, 0x04001109, 0x0400110A, 0x0400110B, 0x0400110C, 0x0400110D,
+  0x0400110E, 0x0400110F, 0x04001110, 0x04001111, 0x04001112, 0x04001161,
+  0x04001162, 0x04001163, 0x04001164, 0x04001165, 0x04001166, 0x04001167,
+  0x04001168, 0x04001169, 0x0400116A, 0x0400116B, 0x0400116C, 0x0400116D,
+  0x0400116E, 0x0400116F, 0x04001170, 0x04001171, 0x04001172, 0x04001173,
+  0x04001174, 0x04001175, 0x04001160, 0x04001114, 0x04001115, 0x040011C7,
+  0x040011C8, 0x040011CC, 0x040011CE, 0x040011D3, 0x040011D7, 0x040011D9,
+  0x0400111C, 0x040011DD, 0x040011DF, 0x0400111D, 0x0400111E, 0x04001120,
+  0x04001122, 0x04001123, 0x04001127, 0x04001129, 0x0400112B, 0x0400112C,
+  0x0400112D, 0x0400112E, 0x0400112F, 0x04001132, 0x04001136, 0x04001140,
+  0x04001147, 0x0400114C, 0x040011F1, 0x040011F2, 0x04001157, 0x04001158,
+  0x04001159, 0x04001184, 0x04001185, 0x04001188, 0x04001191, 0x04001192,
+  0x04001194, 0x0400119E, 0x040011A1, 0x00000000, 0x00000000, 0x00000000,
+  0x02004E00, 0x02004E8C, 0x02004E09, 0x020056DB, 0x02004E0A, 0x02004E2D,
+  0x02004E0B, 0x02007532, 0x02004E59, 0x02004E19, 0x02004E01, 0x02005929,
+  0x02005730, 0x02004EBA, 0x80030B0A, 0x80030B0D, 0x80030B10, 0x80030B13,
+  0x80030B16, 0x80030B19, 0x80030B1C, 0x80030B1F, 0x80030B22, 0x80030B25,
+  0x80030B28, 0x80030B2B, 0x80030B2E, 0x80030B31, 0x80040B34, 0x80040B38,
+  0x80040B3C, 0x80040B40, 0x80040B44, 0x80040B48, 0x80040B4C, 0x80040B50,
+  0x80040B54, 0x80040B58, 0x80040B5C, 0x80040B60, 0x80040B64, 0x80040B68,
+  0x80040B6C, 0x80070B70, 0x80060B77, 0x00000000, 0x80030B7D, 0x80030B80,
+  0x80030B83, 0x80030B86, 0x80030B89, 0x80030B8C, 0x80030B8F, 0x80030B92,
+  0x80030B95, 0x80030B98, 0x80030B9B, 0x80030B9E, 0x80030BA1, 0x80030BA4,
+  0x80030BA7, 0x80030BAA, 0x80030BAD, 0x80030BB0, 0x80030BB3, 0x80030BB6,
+  0x80030BB9, 0x80030BBC, 0x80030BBF, 0x80030BC2, 0x80030BC5, 0x80030BC8,
+  0x80030BCB, 0x80030BCE, 0x80030BD1, 0x80030BD4, 0x80030BD7, 0x80030BDA,
+  0x80030BDD, 0x80030BE0, 0x80030BE3, 0x80030BE6, 0x01C0554F, 0x01C05E7C,
+  0x01C06587, 0x01C07B8F, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x80030BE9, 0x80020BEC,
+  0x80020BEE, 0x80020BF0, 0x80020BF2, 0x80020BF4, 0x80020BF6, 0x80020BF8,
+  0x80020BFA, 0x80020BFC, 0x80020BFE, 0x80020C00, 0x80020C02, 0x80020C04,
+  0x80020C06, 0x80020C08, 0x01C01100, 0x01C01102, 0x01C01103, 0x01C01105,
+  0x01C01106, 0x01C01107, 0x01C01109, 0x01C0110B, 0x01C0110C, 0x01C0110E,
+  0x01C0110F, 0x01C01110, 0x01C01111, 0x01C01112, 0x80020C0A, 0x80020C0C,
+  0x80020C0E, 0x80020C10, 0x80020C12, 0x80020C14, 0x80020C16, 0x80020C18,
+  0x80020C1A, 0x80020C1C, 0x80020C1E, 0x80020C20, 0x80020C22, 0x80020C24,
+  0x80050C26, 0x80040C2B, 0x80020C2F, 0x00000000, 0x01C04E00, 0x01C04E8C,
+  0x01C04E09, 0x01C056DB, 0x01C04E94, 0x01C0516D, 0x01C04E03, 0x01C0516B,
+  0x01C04E5D, 0x01C05341, 0x01C06708, 0x01C0706B, 0x01C06C34, 0x01C06728,
+  0x01C091D1, 0x01C0571F, 0x01C065E5, 0x01C0682A, 0x01C06709, 0x01C0793E,
+  0x01C0540D, 0x01C07279, 0x01C08CA1, 0x01C0795D, 0x01C052B4, 0x01C079D8,
+  0x01C07537, 0x01C05973, 0x01C09069, 0x01C0512A, 0x01C05370, 0x01C06CE8,
+  0x01C09805, 0x01C04F11, 0x01C05199, 0x01C06B63, 0x01C04E0A, 0x01C04E2D,
+  0x01C04E0B, 0x01C05DE6, 0x01C053F3, 0x01C0533B, 0x01C05B97, 0x01C05B66,
+  0x01C076E3, 0x01C04F01, 0x01C08CC7, 0x01C05354, 0x01C0591C, 0x80020C31,
+  0x80020C33, 0x80020C35, 0x80020C37, 0x80020C39, 0x80020C3B, 0x80020C3D,
+  0x80020C3F, 0x80020C41, 0x80020C43, 0x80020C45, 0x80020C47, 0x80020C49,
+  0x80020C4B, 0x80020C4D, 0x80020C4F, 0x80020C51, 0x80020C53, 0x80020C55,
+  0x80020C57, 0x80020C59, 0x80020C5B, 0x80020C5D, 0x80020C5F, 0x80030C61,
+  0x80030C64, 0x80030C67, 0x80020C6A, 0x80030C6C, 0x80020C6F, 0x80030C71,
+  0x01C030A2, 0x01C030A4, 0x01C030A6, 0x01C030A8, 0x01C030AA, 0x01C030AB,
+  0x01C030AD, 0x01C030AF, 0x01C030B1, 0x01C030B3, 0x01C030B5, 0x01C030B7,
+  0x01C030B9, 0x01C030BB, 0x01C030BD, 0x01C030BF, 0x01C030C1, 0x01C030C4,
+  0x01C030C6, 0x01C030C8, 0x01C030CA, 0x01C030CB, 0x01C030CC, 0x01C030CD,
+  0x01C030CE, 0x01C030CF, 0x01C030D2, 0x01C030D5, 0x01C030D8, 0x01C030DB,
+  0x01C030DE, 0x01C030DF, 0x01C030E0, 0x01C030E1, 0x01C030E2, 0x01C030E4,
+  0x01C030E6, 0x01C030E8, 0x01C030E9, 0x01C030EA, 0x01C030EB, 0x01C030EC,
+  0x01C030ED, 0x01C030EF, 0x01C030F0, 0x01C030F1, 0x01C030F2, 0x00000000,
+  0x80050C74, 0x80040C79, 0x80050C7D, 0x80030C82, 0x80050C85, 0x80030C8A,
+  0x80030C8D, 0x80060C90, 0x80040C96, 0x80030C9A, 0x80030C9D, 0x80030CA0,
+  0x80040CA3, 0x80040CA7, 0x80040CAB, 0x80040CAF, 0x80040CB3, 0x80040CB7,
+  0x80040CBB, 0x80060CBF, 0x80020CC5, 0x80060CC7, 0x80060CCD, 0x80050CD3,
+  0x80040CD8, 0x80060CDC, 0x80060CE2, 0x80040CE8, 0x80030CEC, 0x80030CEF,
+  0x80040CF2, 0x80040CF6, 0x80050CFA, 0x80050CFF, 0x80030D04, 0x80030D07,
+  0x80040D0A, 0x80030D0E, 0x80030D11, 0x80020D14, 0x80020D16, 0x80030D18,
+  0x80030D1B, 0x80060D1E, 0x80040D24, 0x80050D28, 0x80060D2D, 0x80040D33,
+  0x80030D37, 0x80030D3A, 0x80060D3D, 0x80040D43, 0x80060D47, 0x80030D4D,
+  0x80050D50, 0x80030D55, 0x80040D58, 0x80030D5C, 0x80040D5F, 0x80050D63,
+  0x80040D68, 0x80050D6C, 0x80040D71, 0x80020D75, 0x80050D77, 0x80030D7C,
+  0x80030D7F, 0x80040D82, 0x80030D86, 0x80030D89, 0x80030D8C, 0x80050D8F,
+  0x80040D94, 0x80020D98, 0x80060D9A, 0x80030DA0, 0x80050DA3, 0x80040DA8,
+  0x80040DAC, 0x80030DB0, 0x80030DB3, 0x80040DB6, 0x80020DBA, 0x80040DBC,
+  0x80050DC0, 0x80020DC5, 0x80060DC7, 0x80030DCD, 0x80020DD0, 0x80020DD2,
+  0x80020DD4, 0x80020DD6, 0x80020DD8, 0x80020DDA, 0x80020DDC, 0x80020DDE,
+  0x80020DE0, 0x80020DE2, 0x80030DE4, 0x80030DE7, 0x80030DEA, 0x80030DED,
+  0x80030DF0, 0x80030DF3, 0x80030DF6, 0x80030DF9, 0x80030DFC, 0x80030DFF,
+  0x80030E02, 0x80030E05, 0x80030E08, 0x80030E0B, 0x80030E0E, 0x80030E11,
+  0x80020E14, 0x80020E16, 0x80030E18, 0x80020E1B, 0x80020E1D, 0x80020E1F,
+  0x80030E21, 0x80030E24, 0x80020E27, 0x80020E29, 0x80020E2B, 0x80020E2D,
+  0x80020E2F, 0x80040E31, 0x80020E35, 0x80020E37, 0x80020E39, 0x80020E3B,
+  0x80020E3D, 0x80020E3F, 0x80020E41, 0x80020E43, 0x80030E45, 0x80040E48,
+  0x80020E4C, 0x80020E4E, 0x80020E50, 0x80020E52, 0x80020E54, 0x80020E56,
+  0x80020E58, 0x80030E5A, 0x80030E5D, 0x80030E60, 0x80030E63, 0x80020E66,
+  0x80020E68, 0x80020E6A, 0x80020E6C, 0x80020E6E, 0x80020E70, 0x80020E72,
+  0x80020E74, 0x80020E76, 0x80020E78, 0x80030E7A, 0x80030E7D, 0x80020E80,
+  0x80030E82, 0x80030E85, 0x80030E88, 0x80020E8B, 0x80030E8D, 0x80030E90,
+  0x80040E93, 0x80020E97, 0x80030E99, 0x80030E9C, 0x80030E9F, 0x80030EA2,
+  0x80050EA5, 0x80060EAA, 0x80020EB0, 0x80020EB2, 0x80020EB4, 0x80020EB6,
+  0x80020EB8, 0x80020EBA, 0x80020EBC, 0x80020EBE, 0x80020EC0, 0x80020EC2,
+  0x80020EC4, 0x80020EC6, 0x80020EC8, 0x80020ECA, 0x80020ECC, 0x80020ECE,
+  0x80020ED0, 0x80020ED2, 0x80040ED4, 0x80020ED8, 0x80020EDA, 0x80020EDC,
+  0x80040EDE, 0x80030EE2, 0x80020EE5, 0x80020EE7, 0x80020EE9, 0x80020EEB,
+  0x80020EED, 0x80020EEF, 0x80020EF1, 0x80020EF3, 0x80020EF5, 0x80020EF7,
+  0x80030EF9, 0x80020EFC, 0x80020EFE, 0x80030F00, 0x80030F03, 0x80020F06,
+  0x80040F08, 0x80030F0C, 0x80020F0F, 0x80020F11, 0x80020F13, 0x80020F15,
+  0x80030F17, 0x80030F1A, 0x80020F1D, 0x80020F1F, 0x80020F21, 0x80020F23,
+  0x80020F25, 0x80020F27, 0x80020F29, 0x80020F2B, 0x80020F2D, 0x80030F2F,
+  0x80030F32, 0x80030F35, 0x80030F38, 0x80030F3B, 0x80030F3E, 0x80030F41,
+  0x80030F44, 0x80030F47, 0x80030F4A, 0x80030F4D, 0x80030F50, 0x80030F53,
+  0x80030F56, 0x80030F59, 0x80030F5C, 0x80030F5F, 0x80030F62, 0x80030F65,
+  0x80030F68, 0x80030F6B, 0x80030F6E, 0x80030F71, 0x0020A641, 0x00000000,
+  0x0020A643, 0x00000000, 0x0020A645, 0x00000000, 0x0020A647, 0x00000000,
+  0x0020A649, 0x00000000, 0x0020A64B, 0x00000000, 0x0020A64D, 0x00000000,
+  0x0020A64F, 0x00000000, 0x0020A651, 0x00000000, 0x0020A653, 0x00000000,
+  0x0020A655, 0x00000000, 0x0020A657, 0x00000000, 0x0020A659, 0x00000000,
+  0x0020A65B, 0x00000000, 0x0020A65D, 0x00000000, 0x0020A65F, 0x00000000,
+  0x0020A661, 0x00000000, 0x0020A663, 0x00000000, 0x0020A665, 0x00000000,
+  0x0020A667, 0x00000000, 0x0020A669, 0x00000000, 0x0020A66B, 0x00000000,
+  0x0020A66D, 0x00000000, 0x00000000, 0x00000000, 0x0020A681, 0x00000000,
+  0x0020A683, 0x00000000, 0x0020A685, 0x00000000, 0x0020A687, 0x00000000,
+  0x0020A689, 0x00000000, 0x0020A68B, 0x00000000, 0x0020A68D, 0x00000000,
+  0x0020A68F, 0x00000000, 0x0020A691, 0x00000000, 0x0020A693, 0x00000000,
+  0x0020A695, 0x00000000, 0x0020A697, 0x00000000, 0x0020A699, 0x00000000,
+  0x0020A69B, 0x00000000, 0x0200044A, 0x0200044C, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x0020A723, 0x00000000, 0x0020A725, 0x00000000,
+  0x0020A727, 0x00000000, 0x0020A729, 0x00000000, 0x0020A72B, 0x00000000,
+  0x0020A72D, 0x00000000, 0x0020A72F, 0x00000000, 0x00000000, 0x00000000,
+  0x0020A733, 0x00000000, 0x0020A735, 0x00000000, 0x0020A737, 0x00000000,
+  0x0020A739, 0x00000000, 0x0020A73B, 0x00000000, 0x0020A73D, 0x00000000,
+  0x0020A73F, 0x00000000, 0x0020A741, 0x00000000, 0x0020A743, 0x00000000,
+  0x0020A745, 0x00000000, 0x0020A747, 0x00000000, 0x0020A749, 0x00000000,
+  0x0020A74B, 0x00000000, 0x0020A74D, 0x00000000, 0x0020A74F, 0x00000000,
+  0x0020A751, 0x00000000, 0x0020A753, 0x00000000, 0x0020A755, 0x00000000,
+  0x0020A757, 0x00000000, 0x0020A759, 0x00000000, 0x0020A75B, 0x00000000,
+  0x0020A75D, 0x00000000, 0x0020A75F, 0x00000000, 0x0020A761, 0x00000000,
+  0x0020A763, 0x00000000, 0x0020A765, 0x00000000, 0x0020A767, 0x00000000,
+  0x0020A769, 0x00000000, 0x0020A76B, 0x00000000, 0x0020A76D, 0x00000000,
+  0x0020A76F, 0x00000000, 0x0200A76F, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0020A77A,
+  0x00000000, 0x0020A77C, 0x00000000, 0x00201D79, 0x0020A77F, 0x00000000,
+  0x0020A781, 0x00000000, 0x0020A783, 0x00000000, 0x0020A785, 0x00000000,
+  0x0020A787, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0020A78C,
+  0x00000000, 0x00200265, 0x00000000, 0x00000000, 0x0020A791, 0x00000000,
+  0x0020A793, 0x00000000, 0x00000000, 0x00000000, 0x0020A797, 0x00000000,
+  0x0020A799, 0x00000000, 0x0020A79B, 0x00000000, 0x0020A79D, 0x00000000,
+  0x0020A79F, 0x00000000, 0x0020A7A1, 0x00000000, 0x0020A7A3, 0x00000000,
+  0x0020A7A5, 0x00000000, 0x0020A7A7, 0x00000000, 0x0020A7A9, 0x00000000,
+  0x00200266, 0x0020025C, 0x00200261, 0x0020026C, 0x0020026A, 0x00000000,
+  0x0020029E, 0x00200287, 0x0020029D, 0x0020AB53, 0x0020A7B5, 0x00000000,
+  0x0020A7B7, 0x00000000, 0x0020A7B9, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x80020F74, 0x80020F76, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x0200A727, 0x0200AB37, 0x0200026B, 0x0200AB52,
+  0x00008C48, 0x000066F4, 0x00008ECA, 0x00008CC8, 0x00006ED1, 0x00004E32,
+  0x000053E5, 0x00009F9C, 0x00009F9C, 0x00005951, 0x000091D1, 0x00005587,
+  0x00005948, 0x000061F6, 0x00007669, 0x00007F85, 0x0000863F, 0x000087BA,
+  0x000088F8, 0x0000908F, 0x00006A02, 0x00006D1B, 0x000070D9, 0x000073DE,
+  0x0000843D, 0x0000916A, 0x000099F1, 0x00004E82, 0x00005375, 0x00006B04,
+  0x0000721B, 0x0000862D, 0x00009E1E, 0x00005D50, 0x00006FEB, 0x000085CD,
+  0x00008964, 0x000062C9, 0x000081D8, 0x0000881F, 0x00005ECA, 0x00006717,
+  0x00006D6A, 0x000072FC, 0x000090CE, 0x00004F86, 0x000051B7, 0x000052DE,
+  0x000064C4, 0x00006AD3, 0x00007210, 0x000076E7, 0x00008001, 0x00008606,
+  0x0000865C, 0x00008DEF, 0x00009732, 0x00009B6F, 0x00009DFA, 0x0000788C,
+  0x0000797F, 0x00007DA0, 0x000083C9, 0x00009304, 0x00009E7F, 0x00008AD6,
+  0x000058DF, 0x00005F04, 0x00007C60, 0x0000807E, 0x00007262, 0x000078CA,
+  0x00008CC2, 0x000096F7, 0x000058D8, 0x00005C62, 0x00006A13, 0x00006DDA,
+  0x00006F0F, 0x00007D2F, 0x00007E37, 0x0000964B, 0x000052D2, 0x0000808B,
+  0x000051DC, 0x000051CC, 0x00007A1C, 0x00007DBE, 0x000083F1, 0x00009675,
+  0x00008B80, 0x000062CF, 0x00006A02, 0x00008AFE, 0x00004E39, 0x00005BE7,
+  0x00006012, 0x00007387, 0x00007570, 0x00005317, 0x000078FB, 0x00004FBF,
+  0x00005FA9, 0x00004E0D, 0x00006CCC, 0x00006578, 0x00007D22, 0x000053C3,
+  0x0000585E, 0x00007701, 0x00008449, 0x00008AAA, 0x00006BBA, 0x00008FB0,
+  0x00006C88, 0x000062FE, 0x000082E5, 0x000063A0, 0x00007565, 0x00004EAE,
+  0x00005169, 0x000051C9, 0x00006881, 0x00007CE7, 0x0000826F, 0x00008AD2,
+  0x000091CF, 0x000052F5, 0x00005442, 0x00005973, 0x00005EEC, 0x000065C5,
+  0x00006FFE, 0x0000792A, 0x000095AD, 0x00009A6A, 0x00009E97, 0x00009ECE,
+  0x0000529B, 0x000066C6, 0x00006B77, 0x00008F62, 0x00005E74, 0x00006190,
+  0x00006200, 0x0000649A, 0x00006F23, 0x00007149, 0x00007489, 0x000079CA,
+  0x00007DF4, 0x0000806F, 0x00008F26, 0x000084EE, 0x00009023, 0x0000934A,
+  0x00005217, 0x000052A3, 0x000054BD, 0x000070C8, 0x000088C2, 0x00008AAA,
+  0x00005EC9, 0x00005FF5, 0x0000637B, 0x00006BAE, 0x00007C3E, 0x00007375,
+  0x00004EE4, 0x000056F9, 0x00005BE7, 0x00005DBA, 0x0000601C, 0x000073B2,
+  0x00007469, 0x00007F9A, 0x00008046, 0x00009234, 0x000096F6, 0x00009748,
+  0x00009818, 0x00004F8B, 0x000079AE, 0x000091B4, 0x000096B8, 0x000060E1,
+  0x00004E86, 0x000050DA, 0x00005BEE, 0x00005C3F, 0x00006599, 0x00006A02,
+  0x000071CE, 0x00007642, 0x000084FC, 0x0000907C, 0x00009F8D, 0x00006688,
+  0x0000962E, 0x00005289, 0x0000677B, 0x000067F3, 0x00006D41, 0x00006E9C,
+  0x00007409, 0x00007559, 0x0000786B, 0x00007D10, 0x0000985E, 0x0000516D,
+  0x0000622E, 0x00009678, 0x0000502B, 0x00005D19, 0x00006DEA, 0x00008F2A,
+  0x00005F8B, 0x00006144, 0x00006817, 0x00007387, 0x00009686, 0x00005229,
+  0x0000540F, 0x00005C65, 0x00006613, 0x0000674E, 0x000068A8, 0x00006CE5,
+  0x00007406, 0x000075E2, 0x00007F79, 0x000088CF, 0x000088E1, 0x000091CC,
+  0x000096E2, 0x0000533F, 0x00006EBA, 0x0000541D, 0x000071D0, 0x00007498,
+  0x000085FA, 0x000096A3, 0x00009C57, 0x00009E9F, 0x00006797, 0x00006DCB,
+  0x000081E8, 0x00007ACB, 0x00007B20, 0x00007C92, 0x000072C0, 0x00007099,
+  0x00008B58, 0x00004EC0, 0x00008336, 0x0000523A, 0x00005207, 0x00005EA6,
+  0x000062D3, 0x00007CD6, 0x00005B85, 0x00006D1E, 0x000066B4, 0x00008F3B,
+  0x0000884C, 0x0000964D, 0x0000898B, 0x00005ED3, 0x00005140, 0x000055C0,
+  0x00000000, 0x00000000, 0x0000585A, 0x00000000, 0x00006674, 0x00000000,
+  0x00000000, 0x000051DE, 0x0000732A, 0x000076CA, 0x0000793C, 0x0000795E,
+  0x00007965, 0x0000798F, 0x00009756, 0x00007CBE, 0x00007FBD, 0x00000000,
+  0x00008612, 0x00000000, 0x00008AF8, 0x00000000, 0x00000000, 0x00009038,
+  0x000090FD, 0x00000000, 0x00000000, 0x00000000, 0x000098EF, 0x000098FC,
+  0x00009928, 0x00009DB4, 0x000090DE, 0x000096B7, 0x00004FAE, 0x000050E7,
+  0x0000514D, 0x000052C9, 0x000052E4, 0x00005351, 0x0000559D, 0x00005606,
+  0x00005668, 0x00005840, 0x000058A8, 0x00005C64, 0x00005C6E, 0x00006094,
+  0x00006168, 0x0000618E, 0x000061F2, 0x0000654F, 0x000065E2, 0x00006691,
+  0x00006885, 0x00006D77, 0x00006E1A, 0x00006F22, 0x0000716E, 0x0000722B,
+  0x00007422, 0x00007891, 0x0000793E, 0x00007949, 0x00007948, 0x00007950,
+  0x00007956, 0x0000795D, 0x0000798D, 0x0000798E, 0x00007A40, 0x00007A81,
+  0x00007BC0, 0x00007DF4, 0x00007E09, 0x00007E41, 0x00007F72, 0x00008005,
+  0x000081ED, 0x00008279, 0x00008279, 0x00008457, 0x00008910, 0x00008996,
+  0x00008B01, 0x00008B39, 0x00008CD3, 0x00008D08, 0x00008FB6, 0x00009038,
+  0x000096E3, 0x000097FF, 0x0000983B, 0x00006075, 0x000242EE, 0x00008218,
+  0x00000000, 0x00000000, 0x00004E26, 0x000051B5, 0x00005168, 0x00004F80,
+  0x00005145, 0x00005180, 0x000052C7, 0x000052FA, 0x0000559D, 0x00005555,
+  0x00005599, 0x000055E2, 0x0000585A, 0x000058B3, 0x00005944, 0x00005954,
+  0x00005A62, 0x00005B28, 0x00005ED2, 0x00005ED9, 0x00005F69, 0x00005FAD,
+  0x000060D8, 0x0000614E, 0x00006108, 0x0000618E, 0x00006160, 0x000061F2,
+  0x00006234, 0x000063C4, 0x0000641C, 0x00006452, 0x00006556, 0x00006674,
+  0x00006717, 0x0000671B, 0x00006756, 0x00006B79, 0x00006BBA, 0x00006D41,
+  0x00006EDB, 0x00006ECB, 0x00006F22, 0x0000701E, 0x0000716E, 0x000077A7,
+  0x00007235, 0x000072AF, 0x0000732A, 0x00007471, 0x00007506, 0x0000753B,
+  0x0000761D, 0x0000761F, 0x000076CA, 0x000076DB, 0x000076F4, 0x0000774A,
+  0x00007740, 0x000078CC, 0x00007AB1, 0x00007BC0, 0x00007C7B, 0x00007D5B,
+  0x00007DF4, 0x00007F3E, 0x00008005, 0x00008352, 0x000083EF, 0x00008779,
+  0x00008941, 0x00008986, 0x00008996, 0x00008ABF, 0x00008AF8, 0x00008ACB,
+  0x00008B01, 0x00008AFE, 0x00008AED, 0x00008B39, 0x00008B8A, 0x00008D08,
+  0x00008F38, 0x00009072, 0x00009199, 0x00009276, 0x0000967C, 0x000096E3,
+  0x00009756, 0x000097DB, 0x000097FF, 0x0000980B, 0x0000983B, 0x00009B12,
+  0x00009F9C, 0x0002284A, 0x00022844, 0x000233D5, 0x00003B9D, 0x00004018,
+  0x00004039, 0x00025249, 0x00025CD0, 0x00027ED3, 0x00009F43, 0x00009F8E,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x80020F78, 0x80020F7A, 0x80020F7C, 0x80030F7E, 0x80030F81, 0x80020F84,
+  0x80020F86, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x80020F88, 0x80020F8A, 0x80020F8C, 0x80020F8E, 0x80020F90,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x80020F92,
+  0x00000000, 0x80020F94, 0x004005E2, 0x004005D0, 0x004005D3, 0x004005D4,
+  0x004005DB, 0x004005DC, 0x004005DD, 0x004005E8, 0x004005EA, 0x0040002B,
+  0x80020F96, 0x80020F98, 0x80030F9A, 0x80030F9D, 0x80020FA0, 0x80020FA2,
+  0x80020FA4, 0x80020FA6, 0x80020FA8, 0x80020FAA, 0x80020FAC, 0x80020FAE,
+  0x80020FB0, 0x00000000, 0x80020FB2, 0x80020FB4, 0x80020FB6, 0x80020FB8,
+  0x80020FBA, 0x00000000, 0x80020FBC, 0x00000000, 0x80020FBE, 0x80020FC0,
+  0x00000000, 0x80020FC2, 0x80020FC4, 0x00000000, 0x80020FC6, 0x80020FC8,
+  0x80020FCA, 0x80020FCC, 0x80020FCE, 0x80020FD0, 0x80020FD2, 0x80020FD4,
+  0x80020FD6, 0x80020FD8, 0x01800671, 0x01400671, 0x0180067B, 0x0140067B,
+  0x00C0067B, 0x0100067B, 0x0180067E, 0x0140067E, 0x00C0067E, 0x0100067E,
+  0x01800680, 0x01400680, 0x00C00680, 0x01000680, 0x0180067A, 0x0140067A,
+  0x00C0067A, 0x0100067A, 0x0180067F, 0x0140067F, 0x00C0067F, 0x0100067F,
+  0x01800679, 0x01400679, 0x00C00679, 0x01000679, 0x018006A4, 0x014006A4,
+  0x00C006A4, 0x010006A4, 0x018006A6, 0x014006A6, 0x00C006A6, 0x010006A6,
+  0x01800684, 0x01400684, 0x00C00684, 0x01000684, 0x01800683, 0x01400683,
+  0x00C00683, 0x01000683, 0x01800686, 0x01400686, 0x00C00686, 0x01000686,
+  0x01800687, 0x01400687, 0x00C00687, 0x01000687, 0x0180068D, 0x0140068D,
+  0x0180068C, 0x0140068C, 0x0180068E, 0x0140068E, 0x01800688, 0x01400688,
+  0x01800698, 0x01400698, 0x01800691, 0x01400691, 0x018006A9, 0x014006A9,
+  0x00C006A9, 0x010006A9, 0x018006AF, 0x014006AF, 0x00C006AF, 0x010006AF,
+  0x018006B3, 0x014006B3, 0x00C006B3, 0x010006B3, 0x018006B1, 0x014006B1,
+  0x00C006B1, 0x010006B1, 0x018006BA, 0x014006BA, 0x018006BB, 0x014006BB,
+  0x00C006BB, 0x010006BB, 0x80020FDA, 0x80020FDC, 0x018006C1, 0x014006C1,
+  0x00C006C1, 0x010006C1, 0x018006BE, 0x014006BE, 0x00C006BE, 0x010006BE,
+  0x018006D2, 0x014006D2, 0x80020FDE, 0x80020FE0, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x018006AD, 0x014006AD, 0x00C006AD,
+  0x010006AD, 0x018006C7, 0x014006C7, 0x018006C6, 0x014006C6, 0x018006C8,
+  0x014006C8, 0x80020FE2, 0x018006CB, 0x014006CB, 0x018006C5, 0x014006C5,
+  0x018006C9, 0x014006C9, 0x018006D0, 0x014006D0, 0x00C006D0, 0x010006D0,
+  0x00C00649, 0x01000649, 0x80030FE4, 0x80030FE7, 0x80030FEA, 0x80030FED,
+  0x80030FF0, 0x80030FF3, 0x80030FF6, 0x80030FF9, 0x80030FFC, 0x80030FFF,
+  0x80031002, 0x80031005, 0x80031008, 0x8003100B, 0x8003100E, 0x80031011,
+  0x80031014, 0x80031017, 0x018006CC, 0x014006CC, 0x00C006CC, 0x010006CC,
+  0x8003101A, 0x8003101D, 0x80031020, 0x80031023, 0x80031026, 0x80021029,
+  0x8002102B, 0x8002102D, 0x8002102F, 0x80021031, 0x80021033, 0x80021035,
+  0x80021037, 0x80021039, 0x8002103B, 0x8002103D, 0x8002103F, 0x80021041,
+  0x80021043, 0x80021045, 0x80021047, 0x80021049, 0x8002104B, 0x8002104D,
+  0x8002104F, 0x80021051, 0x80021053, 0x80021055, 0x80021057, 0x80021059,
+  0x8002105B, 0x8002105D, 0x8002105F, 0x80021061, 0x80021063, 0x80021065,
+  0x80021067, 0x80021069, 0x8002106B, 0x8002106D, 0x8002106F, 0x80021071,
+  0x80021073, 0x80021075, 0x80021077, 0x80021079, 0x8002107B, 0x8002107D,
+  0x8002107F, 0x80021081, 0x80021083, 0x80021085, 0x80021087, 0x80021089,
+  0x8002108B, 0x8002108D, 0x8002108F, 0x80021091, 0x80021093, 0x80021095,
+  0x80021097, 0x80021099, 0x8002109B, 0x8002109D, 0x8002109F, 0x800210A1,
+  0x800210A3, 0x800210A5, 0x800210A7, 0x800210A9, 0x800210AB, 0x800210AD,
+  0x800210AF, 0x800210B1, 0x800210B3, 0x800210B5, 0x800210B7, 0x800210B9,
+  0x800210BB, 0x800210BD, 0x800210BF, 0x800210C1, 0x800210C3, 0x800210C5,
+  0x800210C7, 0x800210C9, 0x800210CB, 0x800210CD, 0x800210CF, 0x800210D1,
+  0x800210D3, 0x800210D5, 0x800210D7, 0x800210D9, 0x800310DB, 0x800310DE,
+  0x800310E1, 0x800310E4, 0x800310E7, 0x800310EA, 0x800310ED, 0x800310F0,
+  0x800310F3, 0x800310F6, 0x800310F9, 0x800310FC, 0x800210FF, 0x80021101,
+  0x80021103, 0x80021105, 0x80021107, 0x80021109, 0x8002110B, 0x8002110D,
+  0x8002110F, 0x80021111, 0x80021113, 0x80021115, 0x80021117, 0x80021119,
+  0x8002111B, 0x8002111D, 0x8002111F, 0x80021121, 0x80021123, 0x80021125,
+  0x80021127, 0x80021129, 0x8002112B, 0x8002112D, 0x8002112F, 0x80021131,
+  0x80021133, 0x80021135, 0x80021137, 0x80021139, 0x8002113B, 0x8002113D,
+  0x8002113F, 0x80021141, 0x80021143, 0x80021145, 0x80021147, 0x80021149,
+  0x8002114B, 0x8002114D, 0x8002114F, 0x80021151, 0x80021153, 0x80021155,
+  0x80021157, 0x80031159, 0x8003115C, 0x8003115F, 0x80031162, 0x80031165,
+  0x80021168, 0x8002116A, 0x8002116C, 0x8002116E, 0x80021170, 0x80021172,
+  0x80021174, 0x80021176, 0x80021178, 0x8002117A, 0x8002117C, 0x8002117E,
+  0x80021180, 0x80021182, 0x80021184, 0x80021186, 0x80021188, 0x8002118A,
+  0x8002118C, 0x8002118E, 0x80021190, 0x80021192, 0x80021194, 0x80021196,
+  0x80021198, 0x8002119A, 0x8002119C, 0x8002119E, 0x800211A0, 0x800211A2,
+  0x800211A4, 0x800211A6, 0x800211A8, 0x800211AA, 0x800211AC, 0x800211AE,
+  0x800211B0, 0x800211B2, 0x800211B4, 0x800211B6, 0x800211B8, 0x800211BA,
+  0x800211BC, 0x800211BE, 0x800211C0, 0x800211C2, 0x800211C4, 0x800211C6,
+  0x800211C8, 0x800211CA, 0x800211CC, 0x800211CE, 0x800211D0, 0x800211D2,
+  0x800211D4, 0x800211D6, 0x800211D8, 0x800211DA, 0x800211DC, 0x800211DE,
+  0x800211E0, 0x800211E2, 0x800211E4, 0x800211E6, 0x800211E8, 0x800211EA,
+  0x800211EC, 0x800311EE, 0x800311F1, 0x800211F4, 0x800211F6, 0x800211F8,
+  0x800211FA, 0x800211FC, 0x800211FE, 0x80021200, 0x80021202, 0x80021204,
+  0x80021206, 0x80021208, 0x8002120A, 0x8002120C, 0x8002120E, 0x80021210,
+  0x80021212, 0x80021214, 0x80031216, 0x80031219, 0x8003121C, 0x8002121F,
+  0x80021221, 0x80021223, 0x80021225, 0x80021227, 0x80021229, 0x8002122B,
+  0x8002122D, 0x8002122F, 0x80021231, 0x80021233, 0x80021235, 0x80021237,
+  0x80021239, 0x8002123B, 0x8002123D, 0x8002123F, 0x80021241, 0x80021243,
+  0x80021245, 0x80021247, 0x80021249, 0x8002124B, 0x8002124D, 0x8002124F,
+  0x80021251, 0x80021253, 0x80021255, 0x80021257, 0x80021259, 0x8002125B,
+  0x8002125D, 0x8002125F, 0x80021261, 0x80021263, 0x80021265, 0x80021267,
+  0x80021269, 0x8002126B, 0x8002126D, 0x8002126F, 0x80021271, 0x80021273,
+  0x80021275, 0x80021277, 0x80021279, 0x8002127B, 0x8002127D, 0x8002127F,
+  0x80021281, 0x80021283, 0x80021285, 0x80021287, 0x80021289, 0x8002128B,
+  0x8002128D, 0x8002128F, 0x80021291, 0x80021293, 0x80021295, 0x80021297,
+  0x80021299, 0x8002129B, 0x8002129D, 0x8002129F, 0x800212A1, 0x800212A3,
+  0x800212A5, 0x800212A7, 0x800212A9, 0x800212AB, 0x800212AD, 0x800212AF,
+  0x00000000, 0x00000000, 0x800312B1, 0x800312B4, 0x800312B7, 0x800312BA,
+  0x800312BD, 0x800312C0, 0x800312C3, 0x800312C6, 0x800312C9, 0x800312CC,
+  0x800312CF, 0x800312D2, 0x800312D5, 0x800312D8, 0x800312DB, 0x800312DE,
+  0x800312E1, 0x800312E4, 0x800312E7, 0x800312EA, 0x800312ED, 0x800312F0,
+  0x800312F3, 0x800312F6, 0x800312F9, 0x800312FC, 0x800312FF, 0x80031302,
+  0x80031305, 0x80031308, 0x8003130B, 0x8003130E, 0x80031311, 0x80031314,
+  0x80031317, 0x8003131A, 0x8003131D, 0x80031320, 0x80031323, 0x80031326,
+  0x80031329, 0x8003132C, 0x8003132F, 0x80031332, 0x80031335, 0x80031338,
+  0x8003133B, 0x8003133E, 0x80031341, 0x80031344, 0x80031347, 0x8003134A,
+  0x8003134D, 0x80031350, 0x80031353, 0x80031356, 0x80031359, 0x8003135C,
+  0x8003135F, 0x80031362, 0x80031365, 0x80031368, 0x8003136B, 0x8003136E,
+  0x00000000, 0x00000000, 0x80031371, 0x80031374, 0x80031377, 0x8003137A,
+  0x8003137D, 0x80031380, 0x80031383, 0x80031386, 0x80031389, 0x8003138C,
+  0x8003138F, 0x80031392, 0x80031395, 0x80031398, 0x8003139B, 0x8003139E,
+  0x800313A1, 0x800313A4, 0x800313A7, 0x800313AA, 0x800313AD, 0x800313B0,
+  0x800313B3, 0x800313B6, 0x800313B9, 0x800313BC, 0x800313BF, 0x800313C2,
+  0x800313C5, 0x800313C8, 0x800313CB, 0x800313CE, 0x800313D1, 0x800313D4,
+  0x800313D7, 0x800313DA, 0x800313DD, 0x800313E0, 0x800313E3, 0x800313E6,
+  0x800313E9, 0x800313EC, 0x800313EF, 0x800313F2, 0x800313F5, 0x800313F8,
+  0x800313FB, 0x800313FE, 0x80031401, 0x80031404, 0x80031407, 0x8003140A,
+  0x8003140D, 0x80031410, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x80031413, 0x80031416,
+  0x80041419, 0x8004141D, 0x80041421, 0x80041425, 0x80041429, 0x8004142D,
+  0x80041431, 0x80031435, 0x80121438, 0x8008144A, 0x80041452, 0x00000000,
+  0x00000000, 0x00000000, 0x0280002C, 0x02803001, 0x02803002, 0x0280003A,
+  0x0280003B, 0x02800021, 0x0280003F, 0x02803016, 0x02803017, 0x80031456,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x80021459, 0x02802014, 0x02802013, 0x0280005F, 0x0280005F, 0x02800028,
+  0x02800029, 0x0280007B, 0x0280007D, 0x02803014, 0x02803015, 0x02803010,
+  0x02803011, 0x0280300A, 0x0280300B, 0x02803008, 0x02803009, 0x0280300C,
+  0x0280300D, 0x0280300E, 0x0280300F, 0x00000000, 0x00000000, 0x0280005B,
+  0x0280005D, 0x8002145B, 0x8002145D, 0x8002145F, 0x80021461, 0x0400005F,
+  0x0400005F, 0x0400005F, 0x0340002C, 0x03403001, 0x0340002E, 0x00000000,
+  0x0340003B, 0x0340003A, 0x0340003F, 0x03400021, 0x03402014, 0x03400028,
+  0x03400029, 0x0340007B, 0x0340007D, 0x03403014, 0x03403015, 0x03400023,
+  0x03400026, 0x0340002A, 0x0340002B, 0x0340002D, 0x0340003C, 0x0340003E,
+  0x0340003D, 0x00000000, 0x0340005C, 0x03400024, 0x03400025, 0x03400040,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x80021463, 0x80021465,
+  0x80021467, 0x00000000, 0x80021469, 0x00000000, 0x8002146B, 0x8002146D,
+  0x8002146F, 0x80021471, 0x80021473, 0x80021475, 0x80021477, 0x80021479,
+  0x8002147B, 0x8002147D, 0x01800621, 0x8002147F, 0x80021481, 0x80021483,
+  0x80021485, 0x80021487, 0x80021489, 0x8002148B, 0x8002148D, 0x8002148F,
+  0x80021491, 0x80021493, 0x80021495, 0x01800627, 0x01400627, 0x01800628,
+  0x01400628, 0x00C00628, 0x01000628, 0x01800629, 0x01400629, 0x0180062A,
+  0x0140062A, 0x00C0062A, 0x0100062A, 0x0180062B, 0x0140062B, 0x00C0062B,
+  0x0100062B, 0x0180062C, 0x0140062C, 0x00C0062C, 0x0100062C, 0x0180062D,
+  0x0140062D, 0x00C0062D, 0x0100062D, 0x0180062E, 0x0140062E, 0x00C0062E,
+  0x0100062E, 0x0180062F, 0x0140062F, 0x01800630, 0x01400630, 0x01800631,
+  0x01400631, 0x01800632, 0x01400632, 0x01800633, 0x01400633, 0x00C00633,
+  0x01000633, 0x01800634, 0x01400634, 0x00C00634, 0x01000634, 0x01800635,
+  0x01400635, 0x00C00635, 0x01000635, 0x01800636, 0x01400636, 0x00C00636,
+  0x01000636, 0x01800637, 0x01400637, 0x00C00637, 0x01000637, 0x01800638,
+  0x01400638, 0x00C00638, 0x01000638, 0x01800639, 0x01400639, 0x00C00639,
+  0x01000639, 0x0180063A, 0x0140063A, 0x00C0063A, 0x0100063A, 0x01800641,
+  0x01400641, 0x00C00641, 0x01000641, 0x01800642, 0x01400642, 0x00C00642,
+  0x01000642, 0x01800643, 0x01400643, 0x00C00643, 0x01000643, 0x01800644,
+  0x01400644, 0x00C00644, 0x01000644, 0x01800645, 0x01400645, 0x00C00645,
+  0x01000645, 0x01800646, 0x01400646, 0x00C00646, 0x01000646, 0x01800647,
+  0x01400647, 0x00C00647, 0x01000647, 0x01800648, 0x01400648, 0x01800649,
+  0x01400649, 0x0180064A, 0x0140064A, 0x00C0064A, 0x0100064A, 0x80031497,
+  0x8003149A, 0x8003149D, 0x800314A0, 0x800314A3, 0x800314A6, 0x800214A9,
+  0x800214AB, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02C00021,
+  0x02C00022, 0x02C00023, 0x02C00024, 0x02C00025, 0x02C00026, 0x02C00027,
+  0x02C00028, 0x02C00029, 0x02C0002A, 0x02C0002B, 0x02C0002C, 0x02C0002D,
+  0x02C0002E, 0x02C0002F, 0x02C00030, 0x02C00031, 0x02C00032, 0x02C00033,
+  0x02C00034, 0x02C00035, 0x02C00036, 0x02C00037, 0x02C00038, 0x02C00039,
+  0x02C0003A, 0x02C0003B, 0x02C0003C, 0x02C0003D, 0x02C0003E, 0x02C0003F,
+  0x02C00040, 0x02E00061, 0x02E00062, 0x02E00063, 0x02E00064, 0x02E00065,
+  0x02E00066, 0x02E00067, 0x02E00068, 0x02E00069, 0x02E0006A, 0x02E0006B,
+  0x02E0006C, 0x02E0006D, 0x02E0006E, 0x02E0006F, 0x02E00070, 0x02E00071,
+  0x02E00072, 0x02E00073, 0x02E00074, 0x02E00075, 0x02E00076, 0x02E00077,
+  0x02E00078, 0x02E00079, 0x02E0007A, 0x02C0005B, 0x02C0005C, 0x02C0005D,
+  0x02C0005E, 0x02C0005F, 0x02C00060, 0x02C00061, 0x02C00062, 0x02C00063,
+  0x02C00064, 0x02C00065, 0x02C00066, 0x02C00067, 0x02C00068, 0x02C00069,
+  0x02C0006A, 0x02C0006B, 0x02C0006C, 0x02C0006D, 0x02C0006E, 0x02C0006F,
+  0x02C00070, 0x02C00071, 0x02C00072, 0x02C00073, 0x02C00074, 0x02C00075,
+  0x02C00076, 0x02C00077, 0x02C00078, 0x02C00079, 0x02C0007A, 0x02C0007B,
+  0x02C0007C, 0x02C0007D, 0x02C0007E, 0x02C02985, 0x02C02986, 0x03003002,
+  0x0300300C, 0x0300300D, 0x03003001, 0x030030FB, 0x030030F2, 0x030030A1,
+  0x030030A3, 0x030030A5, 0x030030A7, 0x030030A9, 0x030030E3, 0x030030E5,
+  0x030030E7, 0x030030C3, 0x030030FC, 0x030030A2, 0x030030A4, 0x030030A6,
+  0x030030A8, 0x030030AA, 0x030030AB, 0x030030AD, 0x030030AF, 0x030030B1,
+  0x030030B3, 0x030030B5, 0x030030B7, 0x030030B9, 0x030030BB, 0x030030BD,
+  0x030030BF, 0x030030C1, 0x030030C4, 0x030030C6, 0x030030C8, 0x030030CA,
+  0x030030CB, 0x030030CC, 0x030030CD, 0x030030CE, 0x030030CF, 0x030030D2,
+  0x030030D5, 0x030030D8, 0x030030DB, 0x030030DE, 0x030030DF, 0x030030E0,
+  0x030030E1, 0x030030E2, 0x030030E4, 0x030030E6, 0x030030E8, 0x030030E9,
+  0x030030EA, 0x030030EB, 0x030030EC, 0x030030ED, 0x030030EF, 0x030030F3,
+  0x03003099, 0x0300309A, 0x04001160, 0x04001100, 0x04001101, 0x040011AA,
+  0x04001102, 0x040011AC, 0x040011AD, 0x04001103, 0x04001104, 0x04001105,
+  0x040011B0, 0x040011B1, 0x040011B2, 0x040011B3, 0x040011B4, 0x040011B5,
+  0x0400111A, 0x04001106, 0x04001107, 0x04001108, 0x04001121, 0x04001109,
+  0x0400110A, 0x0400110B, 0x0400110C, 0x0400110D, 0x0400110E, 0x0400110F,
+  0x04001110, 0x04001111, 0x04001112, 0x00000000, 0x00000000, 0x00000000,
+  0x04001161, 0x04001162, 0x04001163, 0x04001164, 0x04001165, 0x04001166,
+  0x00000000, 0x00000000, 0x04001167, 0x04001168, 0x04001169, 0x0400116A,
+  0x0400116B, 0x0400116C, 0x00000000, 0x00000000, 0x0400116D, 0x0400116E,
+  0x0400116F, 0x04001170, 0x04001171, 0x04001172, 0x00000000, 0x00000000,
+  0x04001173, 0x04001174, 0x04001175, 0x00000000, 0x00000000, 0x00000000,
+  0x02C000A2, 0x02C000A3, 0x02C000AC, 0x800214AD, 0x02C000A6, 0x02C000A5,
+  0x02C020A9, 0x00000000, 0x03002502, 0x03002190, 0x03002191, 0x03002192,
+  0x03002193, 0x030025A0, 0x030025CB, 0x00000000, 0x00210428, 0x00210429,
+  0x0021042A, 0x0021042B, 0x0021042C, 0x0021042D, 0x0021042E, 0x0021042F,
+  0x00210430, 0x00210431, 0x00210432, 0x00210433, 0x00210434, 0x00210435,
+  0x00210436, 0x00210437, 0x00210438, 0x00210439, 0x0021043A, 0x0021043B,
+  0x0021043C, 0x0021043D, 0x0021043E, 0x0021043F, 0x00210440, 0x00210441,
+  0x00210442, 0x00210443, 0x00210444, 0x00210445, 0x00210446, 0x00210447,
+  0x00210448, 0x00210449, 0x0021044A, 0x0021044B, 0x0021044C, 0x0021044D,
+  0x0021044E, 0x0021044F, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x002104D8, 0x002104D9,
+  0x002104DA, 0x002104DB, 0x002104DC, 0x002104DD, 0x002104DE, 0x002104DF,
+  0x002104E0, 0x002104E1, 0x002104E2, 0x002104E3, 0x002104E4, 0x002104E5,
+  0x002104E6, 0x002104E7, 0x002104E8, 0x002104E9, 0x002104EA, 0x002104EB,
+  0x002104EC, 0x002104ED, 0x002104EE, 0x002104EF, 0x002104F0, 0x002104F1,
+  0x002104F2, 0x002104F3, 0x002104F4, 0x002104F5, 0x002104F6, 0x002104F7,
+  0x002104F8, 0x002104F9, 0x002104FA, 0x002104FB, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00210CC0, 0x00210CC1,
+  0x00210CC2, 0x00210CC3, 0x00210CC4, 0x00210CC5, 0x00210CC6, 0x00210CC7,
+  0x00210CC8, 0x00210CC9, 0x00210CCA, 0x00210CCB, 0x00210CCC, 0x00210CCD,
+  0x00210CCE, 0x00210CCF, 0x00210CD0, 0x00210CD1, 0x00210CD2, 0x00210CD3,
+  0x00210CD4, 0x00210CD5, 0x00210CD6, 0x00210CD7, 0x00210CD8, 0x00210CD9,
+  0x00210CDA, 0x00210CDB, 0x00210CDC, 0x00210CDD, 0x00210CDE, 0x00210CDF,
+  0x00210CE0, 0x00210CE1, 0x00210CE2, 0x00210CE3, 0x00210CE4, 0x00210CE5,
+  0x00210CE6, 0x00210CE7, 0x00210CE8, 0x00210CE9, 0x00210CEA, 0x00210CEB,
+  0x00210CEC, 0x00210CED, 0x00210CEE, 0x00210CEF, 0x00210CF0, 0x00210CF1,
+  0x00210CF2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x800214AF, 0x00000000, 0x800214B1, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x800214B3,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x800214B5, 0x800214B7, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x800214B9, 0x800214BB, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x800214BD,
+  0x800214BF, 0x00000000, 0x800214C1, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x800214C3, 0x800214C5, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x002118C0, 0x002118C1, 0x002118C2, 0x002118C3,
+  0x002118C4, 0x002118C5, 0x002118C6, 0x002118C7, 0x002118C8, 0x002118C9,
+  0x002118CA, 0x002118CB, 0x002118CC, 0x002118CD, 0x002118CE, 0x002118CF,
+  0x002118D0, 0x002118D1, 0x002118D2, 0x002118D3, 0x002118D4, 0x002118D5,
+  0x002118D6, 0x002118D7, 0x002118D8, 0x002118D9, 0x002118DA, 0x002118DB,
+  0x002118DC, 0x002118DD, 0x002118DE, 0x002118DF, 0x00216E60, 0x00216E61,
+  0x00216E62, 0x00216E63, 0x00216E64, 0x00216E65, 0x00216E66, 0x00216E67,
+  0x00216E68, 0x00216E69, 0x00216E6A, 0x00216E6B, 0x00216E6C, 0x00216E6D,
+  0x00216E6E, 0x00216E6F, 0x00216E70, 0x00216E71, 0x00216E72, 0x00216E73,
+  0x00216E74, 0x00216E75, 0x00216E76, 0x00216E77, 0x00216E78, 0x00216E79,
+  0x00216E7A, 0x00216E7B, 0x00216E7C, 0x00216E7D, 0x00216E7E, 0x00216E7F,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x800214C7, 0x800214C9, 0x800314CB, 0x800314CE,
+  0x800314D1, 0x800314D4, 0x800314D7, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x800214DA, 0x800214DC, 0x800314DE, 0x800314E1, 0x800314E4,
+  0x800314E7, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00600061, 0x00600062,
+  0x00600063, 0x00600064, 0x00600065, 0x00600066, 0x00600067, 0x00600068,
+  0x00600069, 0x0060006A, 0x0060006B, 0x0060006C, 0x0060006D, 0x0060006E,
+  0x0060006F, 0x00600070, 0x00600071, 0x00600072, 0x00600073, 0x00600074,
+  0x00600075, 0x00600076, 0x00600077, 0x00600078, 0x00600079, 0x0060007A,
+  0x00400061, 0x00400062, 0x00400063, 0x00400064, 0x00400065, 0x00400066,
+  0x00400067, 0x00400068, 0x00400069, 0x0040006A, 0x0040006B, 0x0040006C,
+  0x0040006D, 0x0040006E, 0x0040006F, 0x00400070, 0x00400071, 0x00400072,
+  0x00400073, 0x00400074, 0x00400075, 0x00400076, 0x00400077, 0x00400078,
+  0x00400079, 0x0040007A, 0x00600061, 0x00600062, 0x00600063, 0x00600064,
+  0x00600065, 0x00600066, 0x00600067, 0x00600068, 0x00600069, 0x0060006A,
+  0x0060006B, 0x0060006C, 0x0060006D, 0x0060006E, 0x0060006F, 0x00600070,
+  0x00600071, 0x00600072, 0x00600073, 0x00600074, 0x00600075, 0x00600076,
+  0x00600077, 0x00600078, 0x00600079, 0x0060007A, 0x00400061, 0x00400062,
+  0x00400063, 0x00400064, 0x00400065, 0x00400066, 0x00400067, 0x00000000,
+  0x00400069, 0x0040006A, 0x0040006B, 0x0040006C, 0x0040006D, 0x0040006E,
+  0x0040006F, 0x00400070, 0x00400071, 0x00400072, 0x00400073, 0x00400074,
+  0x00400075, 0x00400076, 0x00400077, 0x00400078, 0x00400079, 0x0040007A,
+  0x00600061, 0x00600062, 0x00600063, 0x00600064, 0x00600065, 0x00600066,
+  0x00600067, 0x00600068, 0x00600069, 0x0060006A, 0x0060006B, 0x0060006C,
+  0x0060006D, 0x0060006E, 0x0060006F, 0x00600070, 0x00600071, 0x00600072,
+  0x00600073, 0x00600074, 0x00600075, 0x00600076, 0x00600077, 0x00600078,
+  0x00600079, 0x0060007A, 0x00400061, 0x00400062, 0x00400063, 0x00400064,
+  0x00400065, 0x00400066, 0x00400067, 0x00400068, 0x00400069, 0x0040006A,
+  0x0040006B, 0x0040006C, 0x0040006D, 0x0040006E, 0x0040006F, 0x00400070,
+  0x00400071, 0x00400072, 0x00400073, 0x00400074, 0x00400075, 0x00400076,
+  0x00400077, 0x00400078, 0x00400079, 0x0040007A, 0x00600061, 0x00000000,
+  0x00600063, 0x00600064, 0x00000000, 0x00000000, 0x00600067, 0x00000000,
+  0x00000000, 0x0060006A, 0x0060006B, 0x00000000, 0x00000000, 0x0060006E,
+  0x0060006F, 0x00600070, 0x00600071, 0x00000000, 0x00600073, 0x00600074,
+  0x00600075, 0x00600076, 0x00600077, 0x00600078, 0x00600079, 0x0060007A,
+  0x00400061, 0x00400062, 0x00400063, 0x00400064, 0x00000000, 0x00400066,
+  0x00000000, 0x00400068, 0x00400069, 0x0040006A, 0x0040006B, 0x0040006C,
+  0x0040006D, 0x0040006E, 0x00000000, 0x00400070, 0x00400071, 0x00400072,
+  0x00400073, 0x00400074, 0x00400075, 0x00400076, 0x00400077, 0x00400078,
+  0x00400079, 0x0040007A, 0x00400077, 0x00400078, 0x00400079, 0x0040007A,
+  0x00600061, 0x00600062, 0x00000000, 0x00600064, 0x00600065, 0x00600066,
+  0x00600067, 0x00000000, 0x00000000, 0x0060006A, 0x0060006B, 0x0060006C,
+  0x0060006D, 0x0060006E, 0x0060006F, 0x00600070, 0x00600071, 0x00000000,
+  0x00600073, 0x00600074, 0x00600075, 0x00600076, 0x00600077, 0x00600078,
+  0x00600079, 0x00000000, 0x00400061, 0x00400062, 0x00400063, 0x00400064,
+  0x00400065, 0x00400066, 0x00400067, 0x00400068, 0x00400069, 0x0040006A,
+  0x0040006B, 0x0040006C, 0x0040006D, 0x0040006E, 0x0040006F, 0x00400070,
+  0x00400071, 0x00400072, 0x00400073, 0x00400074, 0x00400075, 0x00400076,
+  0x00400077, 0x00400078, 0x00400079, 0x0040007A, 0x00600061, 0x00600062,
+  0x00000000, 0x00600064, 0x00600065, 0x00600066, 0x00600067, 0x00000000,
+  0x00600069, 0x0060006A, 0x0060006B, 0x0060006C, 0x0060006D, 0x00000000,
+  0x0060006F, 0x00000000, 0x00000000, 0x00000000, 0x00600073, 0x00600074,
+  0x00600075, 0x00600076, 0x00600077, 0x00600078, 0x00600079, 0x00000000,
+  0x00400061, 0x00400062, 0x00400063, 0x00400064, 0x00400065, 0x00400066,
+  0x00400067, 0x00400068, 0x00400069, 0x0040006A, 0x0040006B, 0x0040006C,
+  0x0040006D, 0x0040006E, 0x0040006F, 0x00400070, 0x00400071, 0x00400072,
+  0x00400073, 0x00400074, 0x00400075, 0x00400076, 0x00400077, 0x00400078,
+  0x00400079, 0x0040007A, 0x00600061, 0x00600062, 0x00600063, 0x00600064,
+  0x00600065, 0x00600066, 0x00600067, 0x00600068, 0x00600069, 0x0060006A,
+  0x0060006B, 0x0060006C, 0x0060006D, 0x0060006E, 0x0060006F, 0x00600070,
+  0x00600071, 0x00600072, 0x00600073, 0x00600074, 0x00600075, 0x00600076,
+  0x00600077, 0x00600078, 0x00600079, 0x0060007A, 0x00400061, 0x00400062,
+  0x00400063, 0x00400064, 0x00400065, 0x00400066, 0x00400067, 0x00400068,
+  0x00400069, 0x0040006A, 0x0040006B, 0x0040006C, 0x0040006D, 0x0040006E,
+  0x0040006F, 0x00400070, 0x00400071, 0x00400072, 0x00400073, 0x00400074,
+  0x00400075, 0x00400076, 0x00400077, 0x00400078, 0x00400079, 0x0040007A,
+  0x00400077, 0x00400078, 0x00400079, 0x0040007A, 0x00400131, 0x00400237,
+  0x00000000, 0x00000000, 0x006003B1, 0x006003B2, 0x006003B3, 0x006003B4,
+  0x006003B5, 0x006003B6, 0x006003B7, 0x006003B8, 0x006003B9, 0x006003BA,
+  0x006003BB, 0x006003BC, 0x006003BD, 0x006003BE, 0x006003BF, 0x006003C0,
+  0x006003C1, 0x042003B8, 0x006003C3, 0x006003C4, 0x006003C5, 0x006003C6,
+  0x006003C7, 0x006003C8, 0x006003C9, 0x00402207, 0x004003B1, 0x004003B2,
+  0x004003B3, 0x004003B4, 0x004003B5, 0x004003B6, 0x004003B7, 0x004003B8,
+  0x004003B9, 0x004003BA, 0x004003BB, 0x004003BC, 0x004003BD, 0x004003BE,
+  0x004003BF, 0x004003C0, 0x004003C1, 0x004003C2, 0x004003C3, 0x004003C4,
+  0x004003C5, 0x004003C6, 0x004003C7, 0x004003C8, 0x004003C9, 0x00402202,
+  0x040003B5, 0x040003B8, 0x040003BA, 0x040003C6, 0x040003C1, 0x040003C0,
+  0x006003B1, 0x006003B2, 0x006003B3, 0x006003B4, 0x006003B5, 0x006003B6,
+  0x006003B7, 0x006003B8, 0x006003B9, 0x006003BA, 0x006003BB, 0x006003BC,
+  0x006003BD, 0x006003BE, 0x006003BF, 0x006003C0, 0x006003C1, 0x042003B8,
+  0x006003C3, 0x006003C4, 0x006003C5, 0x006003C6, 0x006003C7, 0x006003C8,
+  0x006003C9, 0x00402207, 0x004003B1, 0x004003B2, 0x004003B3, 0x004003B4,
+  0x004003B5, 0x004003B6, 0x004003B7, 0x004003B8, 0x004003B9, 0x004003BA,
+  0x004003BB, 0x004003BC, 0x004003BD, 0x004003BE, 0x004003BF, 0x004003C0,
+  0x004003C1, 0x004003C2, 0x004003C3, 0x004003C4, 0x004003C5, 0x004003C6,
+  0x004003C7, 0x004003C8, 0x004003C9, 0x00402202, 0x040003B5, 0x040003B8,
+  0x040003BA, 0x040003C6, 0x040003C1, 0x040003C0, 0x006003B1, 0x006003B2,
+  0x006003B3, 0x006003B4, 0x006003B5, 0x006003B6, 0x006003B7, 0x006003B8,
+  0x006003B9, 0x006003BA, 0x006003BB, 0x006003BC, 0x006003BD, 0x006003BE,
+  0x006003BF, 0x006003C0, 0x006003C1, 0x042003B8, 0x006003C3, 0x006003C4,
+  0x006003C5, 0x006003C6, 0x006003C7, 0x006003C8, 0x006003C9, 0x00402207,
+  0x004003B1, 0x004003B2, 0x004003B3, 0x004003B4, 0x004003B5, 0x004003B6,
+  0x004003B7, 0x004003B8, 0x004003B9, 0x004003BA, 0x004003BB, 0x004003BC,
+  0x004003BD, 0x004003BE, 0x004003BF, 0x004003C0, 0x004003C1, 0x004003C2,
+  0x004003C3, 0x004003C4, 0x004003C5, 0x004003C6, 0x004003C7, 0x004003C8,
+  0x004003C9, 0x00402202, 0x040003B5, 0x040003B8, 0x040003BA, 0x040003C6,
+  0x040003C1, 0x040003C0, 0x006003B1, 0x006003B2, 0x006003B3, 0x006003B4,
+  0x006003B5, 0x006003B6, 0x006003B7, 0x006003B8, 0x006003B9, 0x006003BA,
+  0x006003BB, 0x006003BC, 0x006003BD, 0x006003BE, 0x006003BF, 0x006003C0,
+  0x006003C1, 0x042003B8, 0x006003C3, 0x006003C4, 0x006003C5, 0x006003C6,
+  0x006003C7, 0x006003C8, 0x006003C9, 0x00402207, 0x004003B1, 0x004003B2,
+  0x004003B3, 0x004003B4, 0x004003B5, 0x004003B6, 0x004003B7, 0x004003B8,
+  0x004003B9, 0x004003BA, 0x004003BB, 0x004003BC, 0x004003BD, 0x004003BE,
+  0x004003BF, 0x004003C0, 0x004003C1, 0x004003C2, 0x004003C3, 0x004003C4,
+  0x004003C5, 0x004003C6, 0x004003C7, 0x004003C8, 0x004003C9, 0x00402202,
+  0x040003B5, 0x040003B8, 0x040003BA, 0x040003C6, 0x040003C1, 0x040003C0,
+  0x006003B1, 0x006003B2, 0x006003B3, 0x006003B4, 0x006003B5, 0x006003B6,
+  0x006003B7, 0x006003B8, 0x006003B9, 0x006003BA, 0x006003BB, 0x006003BC,
+  0x006003BD, 0x006003BE, 0x006003BF, 0x006003C0, 0x006003C1, 0x042003B8,
+  0x006003C3, 0x006003C4, 0x006003C5, 0x006003C6, 0x006003C7, 0x006003C8,
+  0x006003C9, 0x00402207, 0x004003B1, 0x004003B2, 0x004003B3, 0x004003B4,
+  0x004003B5, 0x004003B6, 0x004003B7, 0x004003B8, 0x004003B9, 0x004003BA,
+  0x004003BB, 0x004003BC, 0x004003BD, 0x004003BE, 0x004003BF, 0x004003C0,
+  0x004003C1, 0x004003C2, 0x004003C3, 0x004003C4, 0x004003C5, 0x004003C6,
+  0x004003C7, 0x004003C8, 0x004003C9, 0x00402202, 0x040003B5, 0x040003B8,
+  0x040003BA, 0x040003C6, 0x040003C1, 0x040003C0, 0x006003DD, 0x004003DD,
+  0x00000000, 0x00000000, 0x00400030, 0x00400031, 0x00400032, 0x00400033,
+  0x00400034, 0x00400035, 0x00400036, 0x00400037, 0x00400038, 0x00400039,
+  0x00400030, 0x00400031, 0x00400032, 0x00400033, 0x00400034, 0x00400035,
+  0x00400036, 0x00400037, 0x00400038, 0x00400039, 0x00400030, 0x00400031,
+  0x00400032, 0x00400033, 0x00400034, 0x00400035, 0x00400036, 0x00400037,
+  0x00400038, 0x00400039, 0x00400030, 0x00400031, 0x00400032, 0x00400033,
+  0x00400034, 0x00400035, 0x00400036, 0x00400037, 0x00400038, 0x00400039,
+  0x00400030, 0x00400031, 0x00400032, 0x00400033, 0x00400034, 0x00400035,
+  0x00400036, 0x00400037, 0x00400038, 0x00400039, 0x0021E922, 0x0021E923,
+  0x0021E924, 0x0021E925, 0x0021E926, 0x0021E927, 0x0021E928, 0x0021E929,
+  0x0021E92A, 0x0021E92B, 0x0021E92C, 0x0021E92D, 0x0021E92E, 0x0021E92F,
+  0x0021E930, 0x0021E931, 0x0021E932, 0x0021E933, 0x0021E934, 0x0021E935,
+  0x0021E936, 0x0021E937, 0x0021E938, 0x0021E939, 0x0021E93A, 0x0021E93B,
+  0x0021E93C, 0x0021E93D, 0x0021E93E, 0x0021E93F, 0x0021E940, 0x0021E941,
+  0x0021E942, 0x0021E943, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00400627, 0x00400628,
+  0x0040062C, 0x0040062F, 0x00000000, 0x00400648, 0x00400632, 0x0040062D,
+  0x00400637, 0x0040064A, 0x00400643, 0x00400644, 0x00400645, 0x00400646,
+  0x00400633, 0x00400639, 0x00400641, 0x00400635, 0x00400642, 0x00400631,
+  0x00400634, 0x0040062A, 0x0040062B, 0x0040062E, 0x00400630, 0x00400636,
+  0x00400638, 0x0040063A, 0x0040066E, 0x004006BA, 0x004006A1, 0x0040066F,
+  0x00000000, 0x00400628, 0x0040062C, 0x00000000, 0x00400647, 0x00000000,
+  0x00000000, 0x0040062D, 0x00000000, 0x0040064A, 0x00400643, 0x00400644,
+  0x00400645, 0x00400646, 0x00400633, 0x00400639, 0x00400641, 0x00400635,
+  0x00400642, 0x00000000, 0x00400634, 0x0040062A, 0x0040062B, 0x0040062E,
+  0x00000000, 0x00400636, 0x00000000, 0x0040063A, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0040062C, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x0040062D, 0x00000000, 0x0040064A,
+  0x00000000, 0x00400644, 0x00000000, 0x00400646, 0x00400633, 0x00400639,
+  0x00000000, 0x00400635, 0x00400642, 0x00000000, 0x00400634, 0x00000000,
+  0x00000000, 0x0040062E, 0x00000000, 0x00400636, 0x00000000, 0x0040063A,
+  0x00000000, 0x004006BA, 0x00000000, 0x0040066F, 0x00000000, 0x00400628,
+  0x0040062C, 0x00000000, 0x00400647, 0x00000000, 0x00000000, 0x0040062D,
+  0x00400637, 0x0040064A, 0x00400643, 0x00000000, 0x00400645, 0x00400646,
+  0x00400633, 0x00400639, 0x00400641, 0x00400635, 0x00400642, 0x00000000,
+  0x00400634, 0x0040062A, 0x0040062B, 0x0040062E, 0x00000000, 0x00400636,
+  0x00400638, 0x0040063A, 0x0040066E, 0x00000000, 0x004006A1, 0x00000000,
+  0x00400627, 0x00400628, 0x0040062C, 0x0040062F, 0x00400647, 0x00400648,
+  0x00400632, 0x0040062D, 0x00400637, 0x0040064A, 0x00000000, 0x00400644,
+  0x00400645, 0x00400646, 0x00400633, 0x00400639, 0x00400641, 0x00400635,
+  0x00400642, 0x00400631, 0x00400634, 0x0040062A, 0x0040062B, 0x0040062E,
+  0x00400630, 0x00400636, 0x00400638, 0x0040063A, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00400628, 0x0040062C, 0x0040062F,
+  0x00000000, 0x00400648, 0x00400632, 0x0040062D, 0x00400637, 0x0040064A,
+  0x00000000, 0x00400644, 0x00400645, 0x00400646, 0x00400633, 0x00400639,
+  0x800214EA, 0x800214EC, 0x800214EE, 0x800214F0, 0x800214F2, 0x800214F4,
+  0x800214F6, 0x800214F8, 0x800214FA, 0x800214FC, 0x800214FE, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x80031500, 0x80031503,
+  0x80031506, 0x80031509, 0x8003150C, 0x8003150F, 0x80031512, 0x80031515,
+  0x80031518, 0x8003151B, 0x8003151E, 0x80031521, 0x80031524, 0x80031527,
+  0x8003152A, 0x8003152D, 0x80031530, 0x80031533, 0x80031536, 0x80031539,
+  0x8003153C, 0x8003153F, 0x80031542, 0x80031545, 0x80031548, 0x8003154B,
+  0x8003154E, 0x01E00063, 0x01E00072, 0x80021551, 0x80021553, 0x00000000,
+  0x03A00061, 0x03A00062, 0x03A00063, 0x03A00064, 0x03A00065, 0x03A00066,
+  0x03A00067, 0x03A00068, 0x03A00069, 0x03A0006A, 0x03A0006B, 0x03A0006C,
+  0x03A0006D, 0x03A0006E, 0x03A0006F, 0x03A00070, 0x03A00071, 0x03A00072,
+  0x03A00073, 0x03A00074, 0x03A00075, 0x03A00076, 0x03A00077, 0x03A00078,
+  0x03A00079, 0x03A0007A, 0x80021555, 0x80021557, 0x80021559, 0x8002155B,
+  0x8003155D, 0x80021560, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x80021562, 0x80021564, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x80021566, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x80021568, 0x8002156A,
+  0x038030B5, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x0380624B, 0x03805B57, 0x038053CC, 0x8002156C,
+  0x03804E8C, 0x0380591A, 0x038089E3, 0x03805929, 0x03804EA4, 0x03806620,
+  0x03807121, 0x03806599, 0x0380524D, 0x03805F8C, 0x0380518D, 0x038065B0,
+  0x0380521D, 0x03807D42, 0x0380751F, 0x03808CA9, 0x038058F0, 0x03805439,
+  0x03806F14, 0x03806295, 0x03806355, 0x03804E00, 0x03804E09, 0x0380904A,
+  0x03805DE6, 0x03804E2D, 0x038053F3, 0x03806307, 0x03808D70, 0x03806253,
+  0x03807981, 0x03807A7A, 0x03805408, 0x03806E80, 0x03806709, 0x03806708,
+  0x03807533, 0x03805272, 0x038055B6, 0x0380914D, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x8003156E, 0x80031571, 0x80031574, 0x80031577,
+  0x8003157A, 0x8003157D, 0x80031580, 0x80031583, 0x80031586, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x01C05F97, 0x01C053EF, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00004E3D, 0x00004E38,
+  0x00004E41, 0x00020122, 0x00004F60, 0x00004FAE, 0x00004FBB, 0x00005002,
+  0x0000507A, 0x00005099, 0x000050E7, 0x000050CF, 0x0000349E, 0x0002063A,
+  0x0000514D, 0x00005154, 0x00005164, 0x00005177, 0x0002051C, 0x000034B9,
+  0x00005167, 0x0000518D, 0x0002054B, 0x00005197, 0x000051A4, 0x00004ECC,
+  0x000051AC, 0x000051B5, 0x000291DF, 0x000051F5, 0x00005203, 0x000034DF,
+  0x0000523B, 0x00005246, 0x00005272, 0x00005277, 0x00003515, 0x000052C7,
+  0x000052C9, 0x000052E4, 0x000052FA, 0x00005305, 0x00005306, 0x00005317,
+  0x00005349, 0x00005351, 0x0000535A, 0x00005373, 0x0000537D, 0x0000537F,
+  0x0000537F, 0x0000537F, 0x00020A2C, 0x00007070, 0x000053CA, 0x000053DF,
+  0x00020B63, 0x000053EB, 0x000053F1, 0x00005406, 0x0000549E, 0x00005438,
+  0x00005448, 0x00005468, 0x000054A2, 0x000054F6, 0x00005510, 0x00005553,
+  0x00005563, 0x00005584, 0x00005584, 0x00005599, 0x000055AB, 0x000055B3,
+  0x000055C2, 0x00005716, 0x00005606, 0x00005717, 0x00005651, 0x00005674,
+  0x00005207, 0x000058EE, 0x000057CE, 0x000057F4, 0x0000580D, 0x0000578B,
+  0x00005832, 0x00005831, 0x000058AC, 0x000214E4, 0x000058F2, 0x000058F7,
+  0x00005906, 0x0000591A, 0x00005922, 0x00005962, 0x000216A8, 0x000216EA,
+  0x000059EC, 0x00005A1B, 0x00005A27, 0x000059D8, 0x00005A66, 0x000036EE,
+  0x000036FC, 0x00005B08, 0x00005B3E, 0x00005B3E, 0x000219C8, 0x00005BC3,
+  0x00005BD8, 0x00005BE7, 0x00005BF3, 0x00021B18, 0x00005BFF, 0x00005C06,
+  0x00005F53, 0x00005C22, 0x00003781, 0x00005C60, 0x00005C6E, 0x00005CC0,
+  0x00005C8D, 0x00021DE4, 0x00005D43, 0x00021DE6, 0x00005D6E, 0x00005D6B,
+  0x00005D7C, 0x00005DE1, 0x00005DE2, 0x0000382F, 0x00005DFD, 0x00005E28,
+  0x00005E3D, 0x00005E69, 0x00003862, 0x00022183, 0x0000387C, 0x00005EB0,
+  0x00005EB3, 0x00005EB6, 0x00005ECA, 0x0002A392, 0x00005EFE, 0x00022331,
+  0x00022331, 0x00008201, 0x00005F22, 0x00005F22, 0x000038C7, 0x000232B8,
+  0x000261DA, 0x00005F62, 0x00005F6B, 0x000038E3, 0x00005F9A, 0x00005FCD,
+  0x00005FD7, 0x00005FF9, 0x00006081, 0x0000393A, 0x0000391C, 0x00006094,
+  0x000226D4, 0x000060C7, 0x00006148, 0x0000614C, 0x0000614E, 0x0000614C,
+  0x0000617A, 0x0000618E, 0x000061B2, 0x000061A4, 0x000061AF, 0x000061DE,
+  0x000061F2, 0x000061F6, 0x00006210, 0x0000621B, 0x0000625D, 0x000062B1,
+  0x000062D4, 0x00006350, 0x00022B0C, 0x0000633D, 0x000062FC, 0x00006368,
+  0x00006383, 0x000063E4, 0x00022BF1, 0x00006422, 0x000063C5, 0x000063A9,
+  0x00003A2E, 0x00006469, 0x0000647E, 0x0000649D, 0x00006477, 0x00003A6C,
+  0x0000654F, 0x0000656C, 0x0002300A, 0x000065E3, 0x000066F8, 0x00006649,
+  0x00003B19, 0x00006691, 0x00003B08, 0x00003AE4, 0x00005192, 0x00005195,
+  0x00006700, 0x0000669C, 0x000080AD, 0x000043D9, 0x00006717, 0x0000671B,
+  0x00006721, 0x0000675E, 0x00006753, 0x000233C3, 0x00003B49, 0x000067FA,
+  0x00006785, 0x00006852, 0x00006885, 0x0002346D, 0x0000688E, 0x0000681F,
+  0x00006914, 0x00003B9D, 0x00006942, 0x000069A3, 0x000069EA, 0x00006AA8,
+  0x000236A3, 0x00006ADB, 0x00003C18, 0x00006B21, 0x000238A7, 0x00006B54,
+  0x00003C4E, 0x00006B72, 0x00006B9F, 0x00006BBA, 0x00006BBB, 0x00023A8D,
+  0x00021D0B, 0x00023AFA, 0x00006C4E, 0x00023CBC, 0x00006CBF, 0x00006CCD,
+  0x00006C67, 0x00006D16, 0x00006D3E, 0x00006D77, 0x00006D41, 0x00006D69,
+  0x00006D78, 0x00006D85, 0x00023D1E, 0x00006D34, 0x00006E2F, 0x00006E6E,
+  0x00003D33, 0x00006ECB, 0x00006EC7, 0x00023ED1, 0x00006DF9, 0x00006F6E,
+  0x00023F5E, 0x00023F8E, 0x00006FC6, 0x00007039, 0x0000701E, 0x0000701B,
+  0x00003D96, 0x0000704A, 0x0000707D, 0x00007077, 0x000070AD, 0x00020525,
+  0x00007145, 0x00024263, 0x0000719C, 0x000243AB, 0x00007228, 0x00007235,
+  0x00007250, 0x00024608, 0x00007280, 0x00007295, 0x00024735, 0x00024814,
+  0x0000737A, 0x0000738B, 0x00003EAC, 0x000073A5, 0x00003EB8, 0x00003EB8,
+  0x00007447, 0x0000745C, 0x00007471, 0x00007485, 0x000074CA, 0x00003F1B,
+  0x00007524, 0x00024C36, 0x0000753E, 0x00024C92, 0x00007570, 0x0002219F,
+  0x00007610, 0x00024FA1, 0x00024FB8, 0x00025044, 0x00003FFC, 0x00004008,
+  0x000076F4, 0x000250F3, 0x000250F2, 0x00025119, 0x00025133, 0x0000771E,
+  0x0000771F, 0x0000771F, 0x0000774A, 0x00004039, 0x0000778B, 0x00004046,
+  0x00004096, 0x0002541D, 0x0000784E, 0x0000788C, 0x000078CC, 0x000040E3,
+  0x00025626, 0x00007956, 0x0002569A, 0x000256C5, 0x0000798F, 0x000079EB,
+  0x0000412F, 0x00007A40, 0x00007A4A, 0x00007A4F, 0x0002597C, 0x00025AA7,
+  0x00025AA7, 0x00007AEE, 0x00004202, 0x00025BAB, 0x00007BC6, 0x00007BC9,
+  0x00004227, 0x00025C80, 0x00007CD2, 0x000042A0, 0x00007CE8, 0x00007CE3,
+  0x00007D00, 0x00025F86, 0x00007D63, 0x00004301, 0x00007DC7, 0x00007E02,
+  0x00007E45, 0x00004334, 0x00026228, 0x00026247, 0x00004359, 0x000262D9,
+  0x00007F7A, 0x0002633E, 0x00007F95, 0x00007FFA, 0x00008005, 0x000264DA,
+  0x00026523, 0x00008060, 0x000265A8, 0x00008070, 0x0002335F, 0x000043D5,
+  0x000080B2, 0x00008103, 0x0000440B, 0x0000813E, 0x00005AB5, 0x000267A7,
+  0x000267B5, 0x00023393, 0x0002339C, 0x00008201, 0x00008204, 0x00008F9E,
+  0x0000446B, 0x00008291, 0x0000828B, 0x0000829D, 0x000052B3, 0x000082B1,
+  0x000082B3, 0x000082BD, 0x000082E6, 0x00026B3C, 0x000082E5, 0x0000831D,
+  0x00008363, 0x000083AD, 0x00008323, 0x000083BD, 0x000083E7, 0x00008457,
+  0x00008353, 0x000083CA, 0x000083CC, 0x000083DC, 0x00026C36, 0x00026D6B,
+  0x00026CD5, 0x0000452B, 0x000084F1, 0x000084F3, 0x00008516, 0x000273CA,
+  0x00008564, 0x00026F2C, 0x0000455D, 0x00004561, 0x00026FB1, 0x000270D2,
+  0x0000456B, 0x00008650, 0x0000865C, 0x00008667, 0x00008669, 0x000086A9,
+  0x00008688, 0x0000870E, 0x000086E2, 0x00008779, 0x00008728, 0x0000876B,
+  0x00008786, 0x000045D7, 0x000087E1, 0x00008801, 0x000045F9, 0x00008860,
+  0x00008863, 0x00027667, 0x000088D7, 0x000088DE, 0x00004635, 0x000088FA,
+  0x000034BB, 0x000278AE, 0x00027966, 0x000046BE, 0x000046C7, 0x00008AA0,
+  0x00008AED, 0x00008B8A, 0x00008C55, 0x00027CA8, 0x00008CAB, 0x00008CC1,
+  0x00008D1B, 0x00008D77, 0x00027F2F, 0x00020804, 0x00008DCB, 0x00008DBC,
+  0x00008DF0, 0x000208DE, 0x00008ED4, 0x00008F38, 0x000285D2, 0x000285ED,
+  0x00009094, 0x000090F1, 0x00009111, 0x0002872E, 0x0000911B, 0x00009238,
+  0x000092D7, 0x000092D8, 0x0000927C, 0x000093F9, 0x00009415, 0x00028BFA,
+  0x0000958B, 0x00004995, 0x000095B7, 0x00028D77, 0x000049E6, 0x000096C3,
+  0x00005DB2, 0x00009723, 0x00029145, 0x0002921A, 0x00004A6E, 0x00004A76,
+  0x000097E0, 0x0002940A, 0x00004AB2, 0x00029496, 0x0000980B, 0x0000980B,
+  0x00009829, 0x000295B6, 0x000098E2, 0x00004B33, 0x00009929, 0x000099A7,
+  0x000099C2, 0x000099FE, 0x00004BCE, 0x00029B30, 0x00009B12, 0x00009C40,
+  0x00009CFD, 0x00004CCE, 0x00004CED, 0x00009D67, 0x0002A0CE, 0x00004CF8,
+  0x0002A105, 0x0002A20E, 0x0002A291, 0x00009EBB, 0x00004D56, 0x00009EF9,
+  0x00009EFE, 0x00009F05, 0x00009F0F, 0x00009F16, 0x00009F3B, 0x0002A600,
+  0x00000000, 0x00000000
+};
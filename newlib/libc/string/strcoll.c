@@ -14,8 +14,13 @@ DESCRIPTION
 	the string pointed to by <[strb]>, using an interpretation
 	appropriate to the current <<LC_COLLATE>> state.
 
-	(NOT Cygwin:) The current implementation of <<strcoll>> simply
-	uses <<strcmp>> and does not support any language-specific sorting.
+	(NOT Cygwin:) In the "C" locales, and with every multibyte
+	charset other than UTF-8, that is JIS, EUCJP, SJIS and CP932,
+	<<strcoll>> simply uses <<strcmp>>.  In the other locales it
+	compares the strings as by the Unicode Collation Algorithm, with
+	an ordering derived from the Unicode character data and no
+	language-specific tailoring: base characters first, then
+	accents, then case, and then the characters themselves.
 
 RETURNS
 	If the first string is greater than the second string,
@@ -34,11 +39,18 @@ QUICKREF
 */
 
 #include <string.h>
+#include "collate.h"
 
 int
 strcoll (const char *a,
 	const char *b)
 
 {
+#ifdef _COLLATE_UCA
+  struct __locale_t *locale = __get_current_locale ();
+
+  if (locale->collate_mbtowc)
+    return __collate_strcoll (a, b, locale);
+#endif
   return strcmp (a, b);
 }
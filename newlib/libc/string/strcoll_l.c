@@ -15,8 +15,13 @@ DESCRIPTION
 	the string pointed to by <[strb]>, using an interpretation
 	appropriate to the current <<LC_COLLATE>> state.
 
-	(NOT Cygwin:) The current implementation of <<strcoll_l>> simply
-	uses <<strcmp>> and does not support any language-specific sorting.
+	(NOT Cygwin:) In the "C" locales, and with every multibyte
+	charset other than UTF-8, that is JIS, EUCJP, SJIS and CP932,
+	<<strcoll_l>> simply uses <<strcmp>>.  In the other locales it
+	compares the strings as by the Unicode Collation Algorithm, with
+	an ordering derived from the Unicode character data and no
+	language-specific tailoring: base characters first, then
+	accents, then case, and then the characters themselves.
 
 	If <[locale]> is LC_GLOBAL_LOCALE or not a valid locale object, the
 	behaviour is undefined.
@@ -38,9 +43,14 @@ QUICKREF
 */
 
 #include <string.h>
+#include "collate.h"
 
 int
 strcoll_l (const char *a, const char *b, struct __locale_t *locale)
 {
+#ifdef _COLLATE_UCA
+  if (locale->collate_mbtowc)
+    return __collate_strcoll (a, b, locale);
+#endif
   return strcmp (a, b);
 }
@@ -25,8 +25,12 @@ DESCRIPTION
 	copying takes place between objects that overlap, the behavior
 	is undefined.
 
-	(NOT Cygwin:) The current implementation of <<strxfrm>> simply copies
-	the input and does not support any language-specific transformations.
+	(NOT Cygwin:) In the "C" locales, and with every multibyte
+	charset other than UTF-8, that is JIS, EUCJP, SJIS and CP932,
+	<<strxfrm>> simply copies the input.  In the other locales it
+	writes a sort key of the Unicode Collation Algorithm, as used by
+	<<strcoll>>, of about eight bytes for each character of the
+	input.
 
 RETURNS
 	The <<strxfrm>> function returns the length of the transformed string
@@ -44,6 +48,7 @@ QUICKREF
 */
 
 #include <string.h>
+#include "collate.h"
 
 size_t
 strxfrm (char *__restrict s1,
@@ -51,6 +56,12 @@ strxfrm (char *__restrict s1,
 	size_t n)
 {
   size_t res;
+#ifdef _COLLATE_UCA
+  struct __locale_t *locale = __get_current_locale ();
+
+  if (locale->collate_mbtowc)
+    return __collate_strxfrm (s1, s2, n, locale);
+#endif
   res = 0;
   while (n-- > 0)
     {
@@ -25,8 +25,12 @@ DESCRIPTION
 	copying takes place between objects that overlap, the behavior
 	is undefined.
 
-	(NOT Cygwin:) The current implementation of <<strxfrm_l>> simply copies
-	the input and does not support any language-specific transformations.
+	(NOT Cygwin:) In the "C" locales, and with every multibyte
+	charset other than UTF-8, that is JIS, EUCJP, SJIS and CP932,
+	<<strxfrm_l>> simply copies the input.  In the other locales it
+	writes a sort key of the Unicode Collation Algorithm, as used by
+	<<strcoll_l>>, of about eight bytes for each character of the
+	input.
 
 	If <[locale]> is LC_GLOBAL_LOCALE or not a valid locale object, the
 	behaviour is undefined.
@@ -47,12 +51,17 @@ QUICKREF
 */
 
 #include <string.h>
+#include "collate.h"
 
 size_t
 strxfrm_l (char *__restrict s1, const char *__restrict s2, size_t n,
 	   struct __locale_t *locale)
 {
   size_t res;
+#ifdef _COLLATE_UCA
+  if (locale->collate_mbtowc)
+    return __collate_strxfrm (s1, s2, n, locale);
+#endif
   res = 0;
   while (n-- > 0)
     {
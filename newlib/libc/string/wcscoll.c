@@ -15,8 +15,13 @@ DESCRIPTION
 	using an interpretation appropriate to the current <<LC_COLLATE>>
 	state.
 
-	(NOT Cygwin:) The current implementation of <<wcscoll>> simply
-	uses <<wcscmp>> and does not support any language-specific sorting.
+	(NOT Cygwin:) In the "C" locales, and with every multibyte
+	charset other than UTF-8, that is JIS, EUCJP, SJIS and CP932,
+	<<wcscoll>> simply uses <<wcscmp>>.  In the other locales it
+	compares the strings as by the Unicode Collation Algorithm, with
+	an ordering derived from the Unicode character data and no
+	language-specific tailoring: base characters first, then
+	accents, then case, and then the characters themselves.
 
 RETURNS
 	If the first string is greater than the second string,
@@ -31,11 +36,18 @@ PORTABILITY
 
 #include <_ansi.h>
 #include <wchar.h>
+#include "collate.h"
 
 int
 wcscoll (const wchar_t *a,
 	const wchar_t *b)
 
 {
+#ifdef _COLLATE_UCA
+  struct __locale_t *locale = __get_current_locale ();
+
+  if (locale->collate_mbtowc)
+    return __collate_wcscoll (a, b, locale);
+#endif
   return wcscmp (a, b);
 }
@@ -20,8 +20,12 @@ DESCRIPTION
 
 	If <[n]> is 0, <[stra]> may be a NULL pointer.
 
-	(NOT Cygwin:) The current implementation of <<wcsxfrm>> simply uses
-	<<wcslcpy>> and does not support any language-specific transformations.
+	(NOT Cygwin:) In the "C" locales, and with every multibyte
+	charset other than UTF-8, that is JIS, EUCJP, SJIS and CP932,
+	<<wcsxfrm>> simply uses <<wcslcpy>>.  In the other locales it
+	writes a sort key of the Unicode Collation Algorithm, as used by
+	<<wcscoll>>, of about eight wide characters for each character
+	of the input.
 
 RETURNS
 	<<wcsxfrm>> returns the length of the transformed wide character
@@ -34,6 +38,7 @@ PORTABILITY
 
 #include <_ansi.h>
 #include <wchar.h>
+#include "collate.h"
 
 size_t
 wcsxfrm (wchar_t *__restrict a,
@@ -41,5 +46,11 @@ wcsxfrm (wchar_t *__restrict a,
 	size_t n)
 
 {
+#ifdef _COLLATE_UCA
+  struct __locale_t *locale = __get_current_locale ();
+
+  if (locale->collate_mbtowc)
+    return __collate_wcsxfrm (a, b, n, locale);
+#endif
   return wcslcpy (a, b, n);
 }
@@ -24,8 +24,12 @@ DESCRIPTION
 	If <[locale]> is LC_GLOBAL_LOCALE or not a valid locale object, the
 	behaviour is undefined.
 
-	(NOT Cygwin:) The current implementation of <<wcsxfrm_l>> simply uses
-	<<wcslcpy>> and does not support any language-specific transformations.
+	(NOT Cygwin:) In the "C" locales, and with every multibyte
+	charset other than UTF-8, that is JIS, EUCJP, SJIS and CP932,
+	<<wcsxfrm_l>> simply uses <<wcslcpy>>.  In the other locales it
+	writes a sort key of the Unicode Collation Algorithm, as used by
+	<<wcscoll_l>>, of about eight wide characters for each character
+	of the input.
 
 RETURNS
 	<<wcsxfrm_l>> returns the length of the transformed wide character
@@ -38,10 +42,15 @@ PORTABILITY
 
 #include <_ansi.h>
 #include <wchar.h>
+#include "collate.h"
 
 size_t
 wcsxfrm_l (wchar_t *__restrict a, const wchar_t *__restrict b, size_t n,
 	   struct __locale_t *locale)
 {
+#ifdef _COLLATE_UCA
+  if (locale->collate_mbtowc)
+    return __collate_wcsxfrm (a, b, n, locale);
+#endif
   return wcslcpy (a, b, n);
 }
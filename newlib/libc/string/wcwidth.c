@@ -90,12 +90,14 @@ PORTABILITY
 
 #include <_ansi.h>
 #include <wchar.h>
+#include <stdint.h>
 #ifndef _MB_CAPABLE
 #include <wctype.h> /* iswprint, iswcntrl */
 #endif
 #include "local.h"
 
 #ifdef _MB_CAPABLE
+#if defined (PREFER_SIZE_OVER_SPEED) || defined (__OPTIMIZE_SIZE__)
 struct interval
 {
   int first;
@@ -124,6 +126,14 @@ bisearch(wint_t ucs, const struct interval *table, int max)
 
   return 0;
 }
+#else
+/* staged tables generated from ambiguous.t, combining.t and wide.t by
+   mkstages; the value of a character is made of these bits */
+#define WIDTH_AMBIGUOUS	1
+#define WIDTH_COMBINING	2
+#define WIDTH_WIDE	4
+#include "widthpages.t"
+#endif
 #endif /* _MB_CAPABLE */
 
 /* The following function defines the column width of an ISO 10646
@@ -167,6 +177,7 @@ int
 __wcwidth (const wint_t ucs)
 {
 #ifdef _MB_CAPABLE
+#if defined (PREFER_SIZE_OVER_SPEED) || defined (__OPTIMIZE_SIZE__)
   /* sorted list of non-overlapping intervals of East Asian Ambiguous chars */
   static const struct interval ambiguous[] =
 #include "ambiguous.t"
@@ -220,6 +231,50 @@ __wcwidth (const wint_t ucs)
     return 2;
   else
     return 1;
+#else
+  uint_least32_t c;
+  unsigned int width;
+  int cjk_lang;
+
+  /* Test for NUL character */
+  if (ucs == 0)
+    return 0;
+
+  /* Test for printable ASCII characters */
+  if (ucs >= 0x20 && ucs < 0x7f)
+    return 1;
+
+  /* Test for control characters */
+  if (ucs < 0xa0)
+    return -1;
+
+  /* Test for surrogate pair values. */
+  if (ucs >= 0xd800 && ucs <= 0xdfff)
+    return -1;
+
+  /* Latin-1 characters come first in width_blocks */
+  c = ucs;
+  if (c < 0x100)
+    width = width_blocks[c];
+  else if (c < 0x110000)
+    width = width_blocks[width_pages[width_index[c >> WIDTH_PAGE_SHIFT]
+				     + ((c >> WIDTH_BLOCK_SHIFT)
+					& ((1 << (WIDTH_PAGE_SHIFT - WIDTH_BLOCK_SHIFT)) - 1))]
+			 + (c & ((1 << WIDTH_BLOCK_SHIFT) - 1))];
+  else
+    width = 0;
+
+  /* check CJK width mode (1: ambiguous-wide, 0: normal, -1: disabled) */
+  cjk_lang = __locale_cjk_lang ();
+
+  if (cjk_lang > 0 && (width & WIDTH_AMBIGUOUS))
+    return 2;
+  if (width & WIDTH_COMBINING)
+    return 0;
+  if (cjk_lang >= 0 && (width & WIDTH_WIDE))
+    return 2;
+  return 1;
+#endif
 #else /* !_MB_CAPABLE */
   if (iswprint (ucs))
     return 1;
@@ -32,4 +32,6 @@ void _arc4random_getentropy_fail(void);
 
 #define _ARC4RANDOM_GETENTROPY_FAIL() _arc4random_getentropy_fail()
 
+#define _ARC4RANDOM_THREAD_LOCAL _Thread_local
+
 __END_DECLS
@@ -22,33 +22,40 @@ localtime_r (const time_t *__restrict tim_p,
   long offset;
   int hours, mins, secs;
   int year;
-  __tzinfo_type *const tz = __gettzinfo ();
+  const struct __tzstate *st;
   const int *ip;
+  time_t change[2];
 
   res = gmtime_r (tim_p, res);
 
   year = res->tm_year + YEAR_BASE;
   ip = __month_lengths[isleap(year)];
 
-  TZ_LOCK;
-  _tzset_unlocked ();
-  if (_daylight)
+  /* The time zone state is immutable, so no lock is needed unless TZ
+     changed and tzset has to make a new one.  */
+  st = __tzstate_get ();
+#ifdef _WANT_TZFILE
+  if (st->zone != NULL)
+    offset = __tzfile_offset (st->zone, *tim_p, &res->tm_isdst);
+  else
+#endif
     {
-      if (year == tz->__tzyear || __tzcalc_limits (year))
-	res->tm_isdst = (tz->__tznorth
-	  ? (*tim_p >= tz->__tzrule[0].change
-	  && *tim_p < tz->__tzrule[1].change)
-	  : (*tim_p >= tz->__tzrule[0].change
-	  || *tim_p < tz->__tzrule[1].change));
+      if (st->daylight)
+	{
+	  if (__tzcalc_limits_cached (&st->rules, year, change))
+	    res->tm_isdst = (change[0] < change[1]
+			     ? (*tim_p >= change[0] && *tim_p < change[1])
+			     : (*tim_p >= change[0] || *tim_p < change[1]));
+	  else
+	    res->tm_isdst = -1;
+	}
       else
-	res->tm_isdst = -1;
-    }
-  else
-    res->tm_isdst = 0;
+	res->tm_isdst = 0;
 
-  offset = (res->tm_isdst == 1
-    ? tz->__tzrule[1].offset
-    : tz->__tzrule[0].offset);
+      offset = (res->tm_isdst == 1
+		? st->rules.__tzrule[1].offset
+		: st->rules.__tzrule[0].offset);
+    }
 
   hours = (int) (offset / SECSPERHOUR);
   offset = offset % SECSPERHOUR;
@@ -120,7 +127,6 @@ localtime_r (const time_t *__restrict tim_p,
 	  res->tm_mday = ip[res->tm_mon];
 	}
     }
-  TZ_UNLOCK;
 
   return (res);
 }
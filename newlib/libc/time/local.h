@@ -20,6 +20,9 @@
 #define isleap(y) ((((y) % 4) == 0 && ((y) % 100) != 0) || ((y) % 400) == 0)
 
 int         __tzcalc_limits (int __year);
+int         __tzcalc_limits_tz (__tzinfo_type *__tz, int __year);
+int         __tzparse (const char *__tzenv, __tzinfo_type *__tz,
+		       char *__std, char *__dst);
 
 extern const int __month_lengths[2][MONSPERYEAR];
 
@@ -38,3 +41,64 @@ void _tzset_unlocked (void);
 void __tz_lock (void);
 void __tz_unlock (void);
 
+#ifdef _WANT_TZFILE
+/* A zone loaded from a TZif file.  It is never modified or freed once
+   loaded.  */
+struct __tztype
+{
+  long offset;			/* Same sign as __tzrule_type.offset.  */
+  int isdst;
+  const char *abbr;
+};
+
+struct __tzfile
+{
+  struct __tzfile *next;	/* Loaded zones, searched by name.  */
+  const char *name;
+  int timecnt;
+  int typecnt;
+  const time_t *trans;		/* Transition times, ascending.  */
+  const unsigned char *idx;	/* Type in effect from each transition.  */
+  const struct __tztype *types;
+  int rule;			/* 0 none, 1 std only, 2 std and dst.  */
+  __tzinfo_type rules;		/* Rule for times after the last transition.  */
+};
+#endif
+
+/* The time zone made by tzset from a value of TZ.  tzset publishes it
+   with a release store and never modifies or frees it afterwards, so
+   localtime_r, mktime and strftime use it without TZ_LOCK.  States are
+   kept and reused when TZ takes the same value again.  */
+struct __tzstate
+{
+  struct __tzstate *next;	/* States made, searched by TZ.  */
+  const char *tzenv;		/* Value of TZ, NULL if unset.  */
+  const struct __tzstate *base;	/* State kept for an invalid TZ, or NULL.  */
+  __tzinfo_type rules;		/* Offsets, and the DST rules if daylight.  */
+  int daylight;
+  const char *tzname[2];
+  char names[2][11];		/* Storage for tzname of a POSIX rule.  */
+#ifdef _WANT_TZFILE
+  const struct __tzfile *zone;	/* Zone from a TZif file, or NULL.  */
+#endif
+};
+
+extern const struct __tzstate *__tzstate;
+
+#ifndef __SINGLE_THREAD__
+#define TZSTATE()		__atomic_load_n (&__tzstate, __ATOMIC_ACQUIRE)
+#define TZSTATE_PUBLISH(st)	__atomic_store_n (&__tzstate, (st), \
+						  __ATOMIC_RELEASE)
+#else
+#define TZSTATE()		(__tzstate)
+#define TZSTATE_PUBLISH(st)	(__tzstate = (st))
+#endif
+
+const struct __tzstate *__tzstate_get (void);
+int __tzcalc_limits_cached (const __tzinfo_type *, int, time_t *);
+
+#ifdef _WANT_TZFILE
+const struct __tzfile *__tzfile_load (struct _reent *, const char *);
+void __tzfile_state (struct __tzstate *, const struct __tzfile *);
+long __tzfile_offset (const struct __tzfile *, time_t, int *);
+#endif
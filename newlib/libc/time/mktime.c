@@ -147,13 +147,67 @@ validate_structure (struct tm *tim_p)
     }
 }
 
+#ifdef _WANT_TZFILE
+/* mktime for a zone from a TZif file.  LOCAL is the local time counted
+   like a UTC time_t.  The offset is the one in effect at the result, and
+   in an overlap the one of the type that agrees with tm_isdst.  A time in
+   a gap is taken with the offset in effect before it, and a tm_isdst that
+   is wrong for the date with ALT, the current standard or daylight saving
+   time offset, as for a POSIX rule; the result is normalized.  */
+static time_t
+mktime_tzfile (const struct __tzfile *zone, time_t local, struct tm *tim_p,
+	       long alt)
+{
+  int isdst = tim_p->tm_isdst > 0 ? 1 : tim_p->tm_isdst;
+  int dst, dst2, i;
+  long off, off2;
+  time_t t;
+
+  off = __tzfile_offset (zone, local, &dst);
+  t = local + off;
+  off = __tzfile_offset (zone, t, &dst);
+  t = local + off;
+  off2 = __tzfile_offset (zone, t, &dst2);
+  if (off2 != off)
+    {
+      /* In a gap, which the clocks skipped by going from the larger
+	 offset to the smaller.  */
+      if (off2 > off)
+	{
+	  off = off2;
+	  dst = dst2;
+	}
+      t = local + off;
+    }
+  if (isdst >= 0 && dst != isdst)
+    {
+      /* In an overlap the other type is in effect a day before or after.  */
+      for (i = -1; i <= 1; i += 2)
+	{
+	  off2 = __tzfile_offset (zone, t + i * _SEC_IN_DAY, &dst2);
+	  if (dst2 != isdst)
+	    continue;
+	  __tzfile_offset (zone, local + off2, &dst2);
+	  if (dst2 == isdst)
+	    break;
+	}
+      t = local + (i <= 1 ? off2 : alt);
+    }
+  if (localtime_r (&t, tim_p) == NULL)
+    return (time_t) -1;
+  return t;
+}
+#endif
+
 time_t 
 mktime (struct tm *tim_p)
 {
   time_t tim = 0;
   long days = 0;
   int year, isdst=0;
-  __tzinfo_type *tz = __gettzinfo ();
+  const struct __tzstate *st;
+  const __tzinfo_type *tz;
+  time_t change[2];
 
   /* validate structure */
   validate_structure (tim_p);
@@ -190,11 +244,16 @@ mktime (struct tm *tim_p)
   /* compute total seconds */
   tim += (time_t)days * _SEC_IN_DAY;
 
-  TZ_LOCK;
+  st = __tzstate_get ();
+  tz = &st->rules;
 
-  _tzset_unlocked ();
+#ifdef _WANT_TZFILE
+  if (st->zone != NULL)
+    return mktime_tzfile (st->zone, tim, tim_p,
+			  tz->__tzrule[tim_p->tm_isdst > 0].offset);
+#endif
 
-  if (_daylight)
+  if (st->daylight)
     {
       int tm_isdst;
       int y = tim_p->tm_year + YEAR_BASE;
@@ -202,22 +261,22 @@ mktime (struct tm *tim_p)
       tm_isdst = tim_p->tm_isdst > 0  ?  1 : tim_p->tm_isdst;
       isdst = tm_isdst;
 
-      if (y == tz->__tzyear || __tzcalc_limits (y))
+      if (__tzcalc_limits_cached (tz, y, change))
 	{
 	  /* calculate start of dst in dst local time and 
 	     start of std in both std local time and dst local time */
-          time_t startdst_dst = tz->__tzrule[0].change
+          time_t startdst_dst = change[0]
 	    - (time_t) tz->__tzrule[1].offset;
-	  time_t startstd_dst = tz->__tzrule[1].change
+	  time_t startstd_dst = change[1]
 	    - (time_t) tz->__tzrule[1].offset;
-	  time_t startstd_std = tz->__tzrule[1].change
+	  time_t startstd_std = change[1]
 	    - (time_t) tz->__tzrule[0].offset;
 	  /* if the time is in the overlap between dst and std local times */
 	  if (tim >= startstd_std && tim < startstd_dst)
 	    ; /* we let user decide or leave as -1 */
           else
 	    {
-	      isdst = (tz->__tznorth
+	      isdst = (change[0] < change[1]
 		       ? (tim >= startdst_dst && tim < startstd_std)
 		       : (tim >= startdst_dst || tim < startstd_std));
  	      /* if user committed and was wrong, perform correction, but not
@@ -269,8 +328,6 @@ mktime (struct tm *tim_p)
   else /* otherwise assume std time */
     tim += (time_t) tz->__tzrule[0].offset;
 
-  TZ_UNLOCK;
-
   /* reset isdst flag to what we have calculated */
   tim_p->tm_isdst = isdst;
 
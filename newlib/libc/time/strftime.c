@@ -25,6 +25,18 @@ INDEX
 INDEX
 	strftime_l
 
+INDEX
+	strftime_compile
+
+INDEX
+	strftime_exec
+
+INDEX
+	strftime_exec_l
+
+INDEX
+	strftime_free
+
 SYNOPSIS
 	#include <time.h>
 	size_t strftime(char *restrict <[s]>, size_t <[maxsize]>,
@@ -34,6 +46,15 @@ SYNOPSIS
 			  const char *restrict <[format]>,
 			  const struct tm *restrict <[timp]>,
 			  locale_t <[locale]>);
+	strftime_plan_t *strftime_compile(const char *<[format]>);
+	size_t strftime_exec(char *restrict <[s]>, size_t <[maxsize]>,
+			const strftime_plan_t *restrict <[plan]>,
+			const struct tm *restrict <[timp]>);
+	size_t strftime_exec_l(char *restrict <[s]>, size_t <[maxsize]>,
+			const strftime_plan_t *restrict <[plan]>,
+			const struct tm *restrict <[timp]>,
+			locale_t <[locale]>);
+	void strftime_free(strftime_plan_t *<[plan]>);
 
 DESCRIPTION
 <<strftime>> converts a <<struct tm>> representation of the time (at
@@ -44,6 +65,13 @@ no more than <[maxsize]> characters.
 as expected in locale <[locale]>.  If <[locale]> is LC_GLOBAL_LOCALE or
 not a valid locale object, the behaviour is undefined.
 
+<<strftime_compile>> parses <[format]> once into a plan, which
+<<strftime_exec>> and <<strftime_exec_l>> then use like <<strftime>> and
+<<strftime_l>> use <[format]>, without parsing it again.  The plan keeps
+its own copy of <[format]> and is released with <<strftime_free>>.  It
+does not depend on the locale or the time zone, which are looked up on
+each call.
+
 You control the format of the output using the string at <[format]>.
 <<*<[format]>>> can contain two kinds of specifications: text to be
 copied literally into the formatted string, and time conversion
@@ -249,7 +277,12 @@ the result is the length of the formatted string.  Otherwise, if the
 formatting operation was abandoned due to lack of room, the result is
 <<0>>, and the string starting at <[s]> corresponds to just those
 parts of <<*<[format]>>> that could be completely filled in within the
-<[maxsize]> limit.
+<[maxsize]> limit.  <<strftime_exec>> and <<strftime_exec_l>> return
+the same as <<strftime>>.
+
+<<strftime_compile>> returns the plan, or NULL with <<errno>> set to
+<<EINVAL>> if <[format]> holds an unknown conversion, or to <<ENOMEM>> if
+there is not enough memory.
 
 PORTABILITY
 ANSI C requires <<strftime>>, but does not specify the contents of
@@ -261,7 +294,8 @@ value beforehand to distinguish between failure and an empty string.
 This implementation does not support <<s>> being NULL, nor overlapping
 <<s>> and <<format>>.
 
-<<strftime_l>> is POSIX-1.2008.
+<<strftime_l>> is POSIX-1.2008.  <<strftime_compile>>, <<strftime_exec>>,
+<<strftime_exec_l>> and <<strftime_free>> are newlib extensions.
 
 <<strftime>> and <<strftime_l>> require no supporting OS subroutines.
 
@@ -274,6 +308,7 @@ locale, hard-coding the "C" locale settings.
 #include <sys/config.h>
 #include <stddef.h>
 #include <stdio.h>
+#include <errno.h>
 #include <time.h>
 #include <string.h>
 #include <stdlib.h>
@@ -332,6 +367,26 @@ locale, hard-coding the "C" locale settings.
 #  endif
 #endif  /* MAKE_WCSFTIME */
 
+/* The time zone for %s, %z and %Z.  Cygwin has a tzset of its own, which
+   needs the lock; elsewhere the time zone state is immutable.  */
+#if defined (__CYGWIN__)
+#define TZ_BEGIN()	do { TZ_LOCK; \
+			     if (!tzset_called) \
+			       { \
+				 _tzset_unlocked (); \
+				 tzset_called = 1; \
+			       } \
+			   } while (0)
+#define TZ_END()	TZ_UNLOCK
+#define TZNAME(dst)	(_tzname[dst])
+#else
+#define TZ_BEGIN()	do { if (tzs == NULL) \
+			       tzs = __tzstate_get (); \
+			   } while (0)
+#define TZ_END()
+#define TZNAME(dst)	(tzs->tzname[dst])
+#endif
+
 #define CHECK_LENGTH()	if (len < 0 || (count += len) >= maxsize) \
 			  return 0
 
@@ -663,63 +718,151 @@ conv_to_alt_digits (CHAR *buf, size_t bufsiz, unsigned num, alt_digits_t *adi)
   return 0;
 }
 
-static size_t
-__strftime (CHAR *s, size_t maxsize, const CHAR *format,
-	    const struct tm *tim_p, struct __locale_t *locale,
-	    era_info_t **era_info, alt_digits_t **alt_digits)
 #else /* !_WANT_C99_TIME_FORMATS */
-static size_t
-__strftime (CHAR *s, size_t maxsize, const CHAR *format,
-	    const struct tm *tim_p, struct __locale_t *locale)
-
-#define __strftime(s,m,f,t,l,e,a)	__strftime((s),(m),(f),(t),(l))
+/* Without the C99 formats these are never used, and always NULL.  */
+typedef void era_info_t;
+typedef void alt_digits_t;
 #endif /* !_WANT_C99_TIME_FORMATS */
+
+/* "00" to "99", for the numeric fields of two digits.  */
+static const char digit_pairs[] =
+  "000102030405060708091011121314151617181920212223242526272829"
+  "303132333435363738394041424344454647484950515253545556575859"
+  "606162636465666768697071727374757677787980818283848586878889"
+  "90919293949596979899";
+
+#define IS2(n)		((unsigned) (n) < 100)
+#define PUT2(p, n)	((p)[0] = digit_pairs[2 * (n)], \
+			 (p)[1] = digit_pairs[2 * (n) + 1])
+
+/* Put N at S like snprintf with "%.2d", or "%2d" if SPACE is nonzero, and
+   return the same length.  */
+static int
+put2 (CHAR *s, size_t size, int n, int space)
 {
-  size_t count = 0;
-  int len = 0;
-  const CHAR *ctloc;
-#if defined (MAKE_WCSFTIME) && !defined (__HAVE_LOCALE_INFO_EXTENDED__)
-  CHAR ctlocbuf[CTLOCBUFLEN];
-#endif
-  size_t i, ctloclen;
-  CHAR alt;
-  CHAR pad;
+  if (!IS2 (n))
+    return snprintf (s, size, space ? CQ("%2d") : CQ("%.2d"), n);
+  if (size > 2)
+    {
+      PUT2 (s, n);
+      if (space && n < 10)
+	s[0] = CQ(' ');
+    }
+  return 2;
+}
+
+/* A format split up by parse_format: a run of literal characters, and the
+   conversion following it, if any, with its flag, width and modifier.  */
+struct strftime_op
+{
+  const CHAR *lit;
+  size_t litlen;
   unsigned long width;
-  int tzset_called = 0;
+  CHAR conv;
+  CHAR pad;
+  CHAR alt;
+};
 
-  const struct lc_time_T *_CurrentTimeLocale = __get_time_locale (locale);
-  for (;;)
+/* Number of steps __strftime parses at a time.  */
+#define STRFTIME_OPS	8
+
+static const CHAR valid_conv[] =
+  CQ("aAbBcCdDeFgGhHIjklmMnpPrRsStTuUVwWxXyYzZ%");
+
+/* Parse at most N steps of the format at *FMTP into OP.  Set *FMTP to
+   where to continue, or to NULL at the end of the format.  Return the
+   number of steps, or -1 for an unknown conversion.  */
+static int
+parse_format (const CHAR **fmtp, struct strftime_op *op, int n)
+{
+  const CHAR *format = *fmtp;
+  int i;
+
+  for (i = 0; i < n; i++, op++)
     {
+      op->lit = format;
       while (*format && *format != CQ('%'))
+	format++;
+      op->litlen = format - op->lit;
+      op->conv = op->pad = op->alt = CQ('\0');
+      op->width = 0;
+      if (*format == CQ('\0'))
 	{
-	  if (count < maxsize - 1)
-	    s[count++] = *format++;
-	  else
-	    return 0;
+	  *fmtp = NULL;
+	  return i + 1;
 	}
-      if (*format == CQ('\0'))
-	break;
       format++;
-      pad = '\0';
-      width = 0;
 
       /* POSIX-1.2008 feature: '0' and '+' modifiers require 0-padding with
          slightly different semantics. */
       if (*format == CQ('0') || *format == CQ('+'))
-	pad = *format++;
+	op->pad = *format++;
 
       /* POSIX-1.2008 feature: A minimum field width can be specified. */
       if (*format >= CQ('1') && *format <= CQ('9'))
       	{
 	  CHAR *fp;
-	  width = STRTOUL (format, &fp, 10);
+	  op->width = STRTOUL (format, &fp, 10);
 	  format = fp;
 	}
 
-      alt = CQ('\0');
-      if (*format == CQ('E'))
+      if (*format == CQ('E') || *format == CQ('O'))
+	op->alt = *format++;
+
+      if (*format == CQ('\0') || !STRCHR (valid_conv, *format))
+	return -1;
+      op->conv = *format++;
+    }
+  *fmtp = *format ? format : NULL;
+  return n;
+}
+
+static size_t __strftime (CHAR *, size_t, const CHAR *, const struct tm *,
+			  struct __locale_t *, era_info_t **, alt_digits_t **);
+
+/* Append the N steps at OP to S, which holds *COUNTP characters.  Return
+   0 if they do not fit, otherwise update *COUNTP and return 1.  */
+static int
+strftime_run (CHAR *s, size_t maxsize, size_t *countp,
+	      const struct strftime_op *op, int n, const struct tm *tim_p,
+	      struct __locale_t *locale,
+	      era_info_t **era_info, alt_digits_t **alt_digits)
+{
+  size_t count = *countp;
+  int len = 0;
+  const CHAR *ctloc;
+#if defined (MAKE_WCSFTIME) && !defined (__HAVE_LOCALE_INFO_EXTENDED__)
+  CHAR ctlocbuf[CTLOCBUFLEN];
+#endif
+  size_t i, ctloclen;
+  CHAR conv;
+  CHAR alt;
+  CHAR pad;
+  unsigned long width;
+#if defined (__CYGWIN__)
+  int tzset_called = 0;
+#else
+  const struct __tzstate *tzs = NULL;
+#endif
+
+  const struct lc_time_T *_CurrentTimeLocale = __get_time_locale (locale);
+  for (; n > 0; n--, op++)
+    {
+      if (op->litlen)
+	{
+	  if (op->litlen >= maxsize - count)
+	    return 0;
+	  memcpy (&s[count], op->lit, op->litlen * sizeof (CHAR));
+	  count += op->litlen;
+	}
+      if ((conv = op->conv) == CQ('\0'))
+	break;
+      pad = op->pad;
+      width = op->width;
+      alt = op->alt;
+
+      if (alt == CQ('E'))
 	{
-	  alt = *format++;
 #ifdef _WANT_C99_TIME_FORMATS
 #if defined (MAKE_WCSFTIME) && defined (__HAVE_LOCALE_INFO_EXTENDED__)
 	  if (!*era_info && *_CurrentTimeLocale->wera)
@@ -730,9 +873,8 @@ __strftime (CHAR *s, size_t maxsize, const CHAR *format,
 #endif
 #endif /* _WANT_C99_TIME_FORMATS */
 	}
-      else if (*format == CQ('O'))
+      else if (alt == CQ('O'))
 	{
-	  alt = *format++;
 #ifdef _WANT_C99_TIME_FORMATS
 #if defined (MAKE_WCSFTIME) && defined (__HAVE_LOCALE_INFO_EXTENDED__)
 	  if (!*alt_digits && *_CurrentTimeLocale->walt_digits)
@@ -744,7 +886,7 @@ __strftime (CHAR *s, size_t maxsize, const CHAR *format,
 #endif /* _WANT_C99_TIME_FORMATS */
 	}
 
-      switch (*format)
+      switch (conv)
 	{
 	case CQ('a'):
 	  _ctloc (wday[tim_p->tm_wday]);
@@ -881,14 +1023,14 @@ recurse:
 	    {
 	      if (tim_p->tm_mday < 10)
 	      	{
-		  if (*format == CQ('d'))
+		  if (conv == CQ('d'))
 		    {
 		      if (maxsize - count < 2) return 0;
 		      len = conv_to_alt_digits (&s[count], maxsize - count,
 						0, *alt_digits);
 		      CHECK_LENGTH ();
 		    }
-		  if (*format == CQ('e') || len == 0)
+		  if (conv == CQ('e') || len == 0)
 		    s[count++] = CQ(' ');
 		}
 	      len = conv_to_alt_digits (&s[count], maxsize - count,
@@ -898,24 +1040,57 @@ recurse:
 		break;
 	    }
 #endif /* _WANT_C99_TIME_FORMATS */
-	  len = snprintf (&s[count], maxsize - count,
-			  *format == CQ('d') ? CQ("%.2d") : CQ("%2d"),
-			  tim_p->tm_mday);
+	  len = put2 (&s[count], maxsize - count, tim_p->tm_mday,
+		      conv == CQ('e'));
 	  CHECK_LENGTH ();
 	  break;
 	case CQ('D'):
 	  /* %m/%d/%y */
-	  len = snprintf (&s[count], maxsize - count,
-			  CQ("%.2d/%.2d/%.2d"),
-			  tim_p->tm_mon + 1, tim_p->tm_mday,
-			  tim_p->tm_year >= 0 ? tim_p->tm_year % 100
-			  : abs (tim_p->tm_year + YEAR_BASE) % 100);
-          CHECK_LENGTH ();
+	  {
+	    int year = tim_p->tm_year >= 0 ? tim_p->tm_year % 100
+		       : abs (tim_p->tm_year + YEAR_BASE) % 100;
+	    if (IS2 (tim_p->tm_mon + 1) && IS2 (tim_p->tm_mday))
+	      {
+		len = 8;
+		if (maxsize - count > 8)
+		  {
+		    PUT2 (&s[count], tim_p->tm_mon + 1);
+		    s[count + 2] = CQ('/');
+		    PUT2 (&s[count + 3], tim_p->tm_mday);
+		    s[count + 5] = CQ('/');
+		    PUT2 (&s[count + 6], year);
+		  }
+	      }
+	    else
+	      len = snprintf (&s[count], maxsize - count,
+			      CQ("%.2d/%.2d/%.2d"),
+			      tim_p->tm_mon + 1, tim_p->tm_mday, year);
+            CHECK_LENGTH ();
+	  }
 	  break;
 	case CQ('F'):
 	  { /* %F is equivalent to "%+4Y-%m-%d", flags and width can change
 	       that.  Recurse to avoid need to replicate %Y formation. */
 	    CHAR fmtbuf[32], *fmt = fmtbuf;
+	    unsigned year = (unsigned) tim_p->tm_year + (unsigned) YEAR_BASE;
+
+	    if (!pad && year - 1000 < 9000 && IS2 (tim_p->tm_mon + 1)
+		&& IS2 (tim_p->tm_mday))
+	      {
+		/* The common case of "YYYY-mm-dd".  */
+		len = 10;
+		if (maxsize - count > 10)
+		  {
+		    PUT2 (&s[count], year / 100);
+		    PUT2 (&s[count + 2], year % 100);
+		    s[count + 4] = CQ('-');
+		    PUT2 (&s[count + 5], tim_p->tm_mon + 1);
+		    s[count + 7] = CQ('-');
+		    PUT2 (&s[count + 8], tim_p->tm_mday);
+		  }
+		CHECK_LENGTH ();
+		break;
+	      }
 
 	    *fmt++ = CQ('%');
 	    if (pad) /* '0' or '+' */
@@ -953,8 +1128,8 @@ recurse:
 		adjust = 1;
 	    else if (adjust > 0 && tim_p->tm_year < -YEAR_BASE)
 		adjust = -1;
-	    len = snprintf (&s[count], maxsize - count, CQ("%.2d"),
-			    ((year + adjust) % 100 + 100) % 100);
+	    len = put2 (&s[count], maxsize - count,
+			((year + adjust) % 100 + 100) % 100, 0);
             CHECK_LENGTH ();
 	  }
           break;
@@ -1019,9 +1194,8 @@ recurse:
 #endif /* _WANT_C99_TIME_FORMATS */
 	  /*FALLTHRU*/
 	case CQ('k'):	/* newlib extension */
-	  len = snprintf (&s[count], maxsize - count,
-			  *format == CQ('k') ? CQ("%2d") : CQ("%.2d"),
-			  tim_p->tm_hour);
+	  len = put2 (&s[count], maxsize - count, tim_p->tm_hour,
+		      conv == CQ('k'));
           CHECK_LENGTH ();
 	  break;
 	case CQ('l'):	/* newlib extension */
@@ -1038,14 +1212,23 @@ recurse:
 		|| !(len = conv_to_alt_digits (&s[count], maxsize - count,
 					       h12, *alt_digits)))
 #endif /* _WANT_C99_TIME_FORMATS */
-	      len = snprintf (&s[count], maxsize - count,
-			      *format == CQ('I') ? CQ("%.2d") : CQ("%2d"), h12);
+	      len = put2 (&s[count], maxsize - count, h12, conv == CQ('l'));
 	    CHECK_LENGTH ();
 	  }
 	  break;
 	case CQ('j'):
-	  len = snprintf (&s[count], maxsize - count, CQ("%.3d"),
-			  tim_p->tm_yday + 1);
+	  if ((unsigned) tim_p->tm_yday < 999)
+	    {
+	      len = 3;
+	      if (maxsize - count > 3)
+		{
+		  s[count] = CQ('0') + (tim_p->tm_yday + 1) / 100;
+		  PUT2 (&s[count + 1], (tim_p->tm_yday + 1) % 100);
+		}
+	    }
+	  else
+	    len = snprintf (&s[count], maxsize - count, CQ("%.3d"),
+			    tim_p->tm_yday + 1);
           CHECK_LENGTH ();
 	  break;
 	case CQ('m'):
@@ -1054,8 +1237,7 @@ recurse:
 	      || !(len = conv_to_alt_digits (&s[count], maxsize - count,
 					     tim_p->tm_mon + 1, *alt_digits)))
 #endif /* _WANT_C99_TIME_FORMATS */
-	    len = snprintf (&s[count], maxsize - count, CQ("%.2d"),
-			    tim_p->tm_mon + 1);
+	    len = put2 (&s[count], maxsize - count, tim_p->tm_mon + 1, 0);
           CHECK_LENGTH ();
 	  break;
 	case CQ('M'):
@@ -1064,8 +1246,7 @@ recurse:
 	      || !(len = conv_to_alt_digits (&s[count], maxsize - count,
 					     tim_p->tm_min, *alt_digits)))
 #endif /* _WANT_C99_TIME_FORMATS */
-	    len = snprintf (&s[count], maxsize - count, CQ("%.2d"),
-			    tim_p->tm_min);
+	    len = put2 (&s[count], maxsize - count, tim_p->tm_min, 0);
           CHECK_LENGTH ();
 	  break;
 	case CQ('n'):
@@ -1080,15 +1261,26 @@ recurse:
 	  for (i = 0; i < ctloclen; i++)
 	    {
 	      if (count < maxsize - 1)
-		s[count++] = (*format == CQ('P') ? TOLOWER (ctloc[i])
+		s[count++] = (conv == CQ('P') ? TOLOWER (ctloc[i])
 						 : ctloc[i]);
 	      else
 		return 0;
 	    }
 	  break;
 	case CQ('R'):
-          len = snprintf (&s[count], maxsize - count, CQ("%.2d:%.2d"),
-			  tim_p->tm_hour, tim_p->tm_min);
+	  if (IS2 (tim_p->tm_hour) && IS2 (tim_p->tm_min))
+	    {
+	      len = 5;
+	      if (maxsize - count > 5)
+		{
+		  PUT2 (&s[count], tim_p->tm_hour);
+		  s[count + 2] = CQ(':');
+		  PUT2 (&s[count + 3], tim_p->tm_min);
+		}
+	    }
+	  else
+	    len = snprintf (&s[count], maxsize - count, CQ("%.2d:%.2d"),
+			    tim_p->tm_hour, tim_p->tm_min);
           CHECK_LENGTH ();
           break;
 	case CQ('s'):
@@ -1123,12 +1315,7 @@ recurse:
 
 	    if (tim_p->tm_isdst >= 0)
 	      {
-		TZ_LOCK;
-		if (!tzset_called)
-		  {
-		    _tzset_unlocked ();
-		    tzset_called = 1;
-		  }
+		TZ_BEGIN ();
 
 #if defined (__CYGWIN__)
 		/* Cygwin must check if the application has been built with or
@@ -1141,13 +1328,12 @@ recurse:
 #elif defined (__TM_GMTOFF)
 		offset = tim_p->__TM_GMTOFF;
 #else
-		__tzinfo_type *tz = __gettzinfo ();
 		/* The sign of this is exactly opposite the envvar TZ.  We
 		   could directly use the global _timezone for tm_isdst==0,
 		   but have to use __tzrule for daylight savings.  */
-		offset = -tz->__tzrule[tim_p->tm_isdst > 0].offset;
+		offset = -tzs->rules.__tzrule[tim_p->tm_isdst > 0].offset;
 #endif
-		TZ_UNLOCK;
+		TZ_END ();
 	      }
 	    len = snprintf (&s[count], maxsize - count, CQ("%lld"),
 			    (((((long long)tim_p->tm_year - 69)/4
@@ -1165,8 +1351,7 @@ recurse:
 	      || !(len = conv_to_alt_digits (&s[count], maxsize - count,
 					     tim_p->tm_sec, *alt_digits)))
 #endif /* _WANT_C99_TIME_FORMATS */
-	    len = snprintf (&s[count], maxsize - count, CQ("%.2d"),
-			    tim_p->tm_sec);
+	    len = put2 (&s[count], maxsize - count, tim_p->tm_sec, 0);
           CHECK_LENGTH ();
 	  break;
 	case CQ('t'):
@@ -1176,8 +1361,23 @@ recurse:
 	    return 0;
 	  break;
 	case CQ('T'):
-          len = snprintf (&s[count], maxsize - count, CQ("%.2d:%.2d:%.2d"),
-			  tim_p->tm_hour, tim_p->tm_min, tim_p->tm_sec);
+	  if (IS2 (tim_p->tm_hour) && IS2 (tim_p->tm_min)
+	      && IS2 (tim_p->tm_sec))
+	    {
+	      len = 8;
+	      if (maxsize - count > 8)
+		{
+		  PUT2 (&s[count], tim_p->tm_hour);
+		  s[count + 2] = CQ(':');
+		  PUT2 (&s[count + 3], tim_p->tm_min);
+		  s[count + 5] = CQ(':');
+		  PUT2 (&s[count + 6], tim_p->tm_sec);
+		}
+	    }
+	  else
+	    len = snprintf (&s[count], maxsize - count,
+			    CQ("%.2d:%.2d:%.2d"),
+			    tim_p->tm_hour, tim_p->tm_min, tim_p->tm_sec);
           CHECK_LENGTH ();
           break;
 	case CQ('u'):
@@ -1211,9 +1411,8 @@ recurse:
 					      tim_p->tm_wday) / 7,
 					     *alt_digits)))
 #endif /* _WANT_C99_TIME_FORMATS */
-	    len = snprintf (&s[count], maxsize - count, CQ("%.2d"),
-			 (tim_p->tm_yday + 7 -
-			  tim_p->tm_wday) / 7);
+	    len = put2 (&s[count], maxsize - count,
+			(tim_p->tm_yday + 7 - tim_p->tm_wday) / 7, 0);
           CHECK_LENGTH ();
 	  break;
 	case CQ('V'):
@@ -1237,7 +1436,7 @@ recurse:
 		|| !(len = conv_to_alt_digits (&s[count], maxsize - count,
 					       week, *alt_digits)))
 #endif /* _WANT_C99_TIME_FORMATS */
-	      len = snprintf (&s[count], maxsize - count, CQ("%.2d"), week);
+	      len = put2 (&s[count], maxsize - count, week, 0);
             CHECK_LENGTH ();
 	  }
           break;
@@ -1266,7 +1465,7 @@ recurse:
 		|| !(len = conv_to_alt_digits (&s[count], maxsize - count,
 					       wday, *alt_digits)))
 #endif /* _WANT_C99_TIME_FORMATS */
-	      len = snprintf (&s[count], maxsize - count, CQ("%.2d"), wday);
+	      len = put2 (&s[count], maxsize - count, wday, 0);
             CHECK_LENGTH ();
 	  }
 	  break;
@@ -1288,8 +1487,7 @@ recurse:
 		      || !(len = conv_to_alt_digits (&s[count], maxsize - count,
 						     year, *alt_digits)))
 #endif /* _WANT_C99_TIME_FORMATS */
-		    len = snprintf (&s[count], maxsize - count, CQ("%.2d"),
-				    year);
+		    len = put2 (&s[count], maxsize - count, year, 0);
 		}
               CHECK_LENGTH ();
 	    }
@@ -1309,6 +1507,18 @@ recurse:
 	      /* int potentially overflows, so use unsigned instead.  */
 	      register unsigned year = (unsigned) tim_p->tm_year
 				       + (unsigned) YEAR_BASE;
+	      if (year - 1000 < 9000 && width <= 4)
+		{
+		  /* The common case of four digits.  */
+		  len = 4;
+		  if (maxsize - count > 4)
+		    {
+		      PUT2 (&s[count], year / 100);
+		      PUT2 (&s[count + 2], year % 100);
+		    }
+		  CHECK_LENGTH ();
+		  break;
+		}
 	      if (sign)
 		{
 		  *fmt++ = CQ('-');
@@ -1335,12 +1545,7 @@ recurse:
             {
 	      long offset;
 
-	      TZ_LOCK;
-	      if (!tzset_called)
-		{
-		  _tzset_unlocked ();
-		  tzset_called = 1;
-		}
+	      TZ_BEGIN ();
 
 #if defined (__CYGWIN__)
 	      /* Cygwin must check if the application has been built with or
@@ -1353,16 +1558,26 @@ recurse:
 #elif defined (__TM_GMTOFF)
 	      offset = tim_p->__TM_GMTOFF;
 #else
-	      __tzinfo_type *tz = __gettzinfo ();
 	      /* The sign of this is exactly opposite the envvar TZ.  We
 		 could directly use the global _timezone for tm_isdst==0,
 		 but have to use __tzrule for daylight savings.  */
-	      offset = -tz->__tzrule[tim_p->tm_isdst > 0].offset;
+	      offset = -tzs->rules.__tzrule[tim_p->tm_isdst > 0].offset;
 #endif
-	      TZ_UNLOCK;
-	      len = snprintf (&s[count], maxsize - count, CQ("%+03ld%.2ld"),
-			      offset / SECSPERHOUR,
-			      labs (offset / SECSPERMIN) % 60L);
+	      TZ_END ();
+	      if (offset > -100L * SECSPERHOUR && offset < 100L * SECSPERHOUR)
+		{
+		  len = 5;
+		  if (maxsize - count > 5)
+		    {
+		      s[count] = offset <= -SECSPERHOUR ? CQ('-') : CQ('+');
+		      PUT2 (&s[count + 1], labs (offset / SECSPERHOUR));
+		      PUT2 (&s[count + 3], labs (offset / SECSPERMIN) % 60L);
+		    }
+		}
+	      else
+		len = snprintf (&s[count], maxsize - count,
+				CQ("%+03ld%.2ld"), offset / SECSPERHOUR,
+				labs (offset / SECSPERMIN) % 60L);
               CHECK_LENGTH ();
             }
           break;
@@ -1372,12 +1587,7 @@ recurse:
 	      size_t size;
 	      const char *tznam = NULL;
 
-	      TZ_LOCK;
-	      if (!tzset_called)
-		{
-		  _tzset_unlocked ();
-		  tzset_called = 1;
-		}
+	      TZ_BEGIN ();
 #if defined (__CYGWIN__)
 	      /* See above. */
 	      extern const char *__cygwin_gettzname (const struct tm *tmp);
@@ -1386,7 +1596,7 @@ recurse:
 	      tznam = tim_p->__TM_ZONE;
 #endif
 	      if (!tznam)
-		tznam = _tzname[tim_p->tm_isdst > 0];
+		tznam = TZNAME (tim_p->tm_isdst > 0);
 	      /* Note that in case of wcsftime this loop only works for
 	         timezone abbreviations using the portable codeset (aka ASCII).
 		 This seems to be the case, but if that ever changes, this
@@ -1398,11 +1608,11 @@ recurse:
 		    s[count++] = tznam[i];
 		  else
 		    {
-		      TZ_UNLOCK;
+		      TZ_END ();
 		      return 0;
 		    }
 		}
-	      TZ_UNLOCK;
+	      TZ_END ();
 	    }
 	  break;
 	case CQ('%'):
@@ -1414,10 +1624,26 @@ recurse:
 	default:
 	  return 0;
 	}
-      if (*format)
-	format++;
-      else
-	break;
+    }
+  *countp = count;
+  return 1;
+}
+
+static size_t
+__strftime (CHAR *s, size_t maxsize, const CHAR *format,
+	    const struct tm *tim_p, struct __locale_t *locale,
+	    era_info_t **era_info, alt_digits_t **alt_digits)
+{
+  struct strftime_op op[STRFTIME_OPS];
+  size_t count = 0;
+  int n;
+
+  while (format)
+    {
+      n = parse_format (&format, op, STRFTIME_OPS);
+      if (n < 0 || !strftime_run (s, maxsize, &count, op, n, tim_p, locale,
+				  era_info, alt_digits))
+	return 0;
     }
   if (maxsize)
     s[count] = CQ('\0');
@@ -1466,6 +1692,86 @@ strftime_l (CHAR *__restrict s, size_t maxsize, const CHAR *__restrict format,
 #endif /* !_WANT_C99_TIME_FORMATS */
 }
 
+#if !defined (MAKE_WCSFTIME)
+/* A compiled format: the steps, followed by the copy of the format their
+   literal runs point into.  */
+struct __strftime_plan
+{
+  int n;
+  struct strftime_op op[1];
+};
+
+strftime_plan_t *
+strftime_compile (const char *format)
+{
+  strftime_plan_t *plan;
+  const char *p;
+  size_t len;
+  int n = 1;
+
+  /* Every step but the last ends in a conversion.  */
+  for (p = format; *p; p++)
+    if (*p == '%')
+      n++;
+  len = p - format + 1;
+  plan = (strftime_plan_t *) malloc (sizeof (*plan)
+				     + (n - 1) * sizeof (plan->op[0]) + len);
+  if (!plan)
+    return NULL;
+  p = memcpy (&plan->op[n], format, len);
+  if ((plan->n = parse_format (&p, plan->op, n)) < 0)
+    {
+      free (plan);
+      errno = EINVAL;
+      return NULL;
+    }
+  return plan;
+}
+
+size_t
+strftime_exec_l (char *__restrict s, size_t maxsize,
+		 const strftime_plan_t *__restrict plan,
+		 const struct tm *__restrict tim_p, struct __locale_t *locale)
+{
+  size_t count = 0;
+#ifdef _WANT_C99_TIME_FORMATS
+  era_info_t *era_info = NULL;
+  alt_digits_t *alt_digits = NULL;
+
+  if (!strftime_run (s, maxsize, &count, plan->op, plan->n, tim_p, locale,
+		     &era_info, &alt_digits))
+    count = 0;
+  else if (maxsize)
+    s[count] = '\0';
+  if (era_info)
+    free_era_info (era_info);
+  if (alt_digits)
+    free_alt_digits (alt_digits);
+#else /* !_WANT_C99_TIME_FORMATS */
+  if (!strftime_run (s, maxsize, &count, plan->op, plan->n, tim_p, locale,
+		     NULL, NULL))
+    count = 0;
+  else if (maxsize)
+    s[count] = '\0';
+#endif /* !_WANT_C99_TIME_FORMATS */
+  return count;
+}
+
+size_t
+strftime_exec (char *__restrict s, size_t maxsize,
+	       const strftime_plan_t *__restrict plan,
+	       const struct tm *__restrict tim_p)
+{
+  return strftime_exec_l (s, maxsize, plan, tim_p, __get_current_locale ());
+}
+
+void
+strftime_free (strftime_plan_t *plan)
+{
+  free (plan);
+}
+#endif /* !MAKE_WCSFTIME */
+
 /* The remainder of this file can serve as a regression test.  Compile
  *  with -D_REGRESSION_TEST.  */
 #if defined(_REGRESSION_TEST)	/* [Test code:  */
@@ -12,10 +12,16 @@
 
 int
 __tzcalc_limits (int year)
+{
+  return __tzcalc_limits_tz (__gettzinfo (), year);
+}
+
+/* Same for the rules at TZ, which need not be the global ones.  */
+int
+__tzcalc_limits_tz (__tzinfo_type *tz, int year)
 {
   int days, year_days, years;
   int i, j;
-  __tzinfo_type *const tz = __gettzinfo ();
 
   if (year < EPOCH_YEAR)
     return 0;
@@ -74,3 +80,107 @@ __tzcalc_limits (int year)
 
   return 1;
 }
+
+/* Cache of the limits of the last years used.  Ports with thread-local
+   storage enable a per-thread cache by defining _TZ_THREAD_LOCAL to its
+   storage class in <sys/config.h>.  Other multi-threaded builds share
+   one entry, which readers copy without a lock and check against a
+   sequence count that is odd while the entry is being changed.  */
+struct tz_limits
+{
+  const __tzinfo_type *tz;
+  int year;
+  time_t change[2];
+};
+
+#if defined (__SINGLE_THREAD__) || defined (_TZ_THREAD_LOCAL)
+#define TZ_CACHE_SIZE 4		/* Power of 2.  */
+
+#ifdef __SINGLE_THREAD__
+static struct tz_limits tz_cache[TZ_CACHE_SIZE];
+#else
+static _TZ_THREAD_LOCAL struct tz_limits tz_cache[TZ_CACHE_SIZE];
+#endif
+
+static int
+cache_get (const __tzinfo_type *tz, int year, time_t *change)
+{
+  struct tz_limits *e = &tz_cache[year & (TZ_CACHE_SIZE - 1)];
+
+  if (e->tz != tz || e->year != year)
+    return 0;
+  change[0] = e->change[0];
+  change[1] = e->change[1];
+  return 1;
+}
+
+static void
+cache_put (const __tzinfo_type *tz, int year, const time_t *change)
+{
+  struct tz_limits *e = &tz_cache[year & (TZ_CACHE_SIZE - 1)];
+
+  e->tz = tz;
+  e->year = year;
+  e->change[0] = change[0];
+  e->change[1] = change[1];
+}
+#else
+static struct tz_limits tz_cache;
+static unsigned int tz_cache_seq;
+
+static int
+cache_get (const __tzinfo_type *tz, int year, time_t *change)
+{
+  unsigned int seq = __atomic_load_n (&tz_cache_seq, __ATOMIC_ACQUIRE);
+
+  if ((seq & 1) != 0 || tz_cache.tz != tz || tz_cache.year != year)
+    return 0;
+  change[0] = tz_cache.change[0];
+  change[1] = tz_cache.change[1];
+  __atomic_thread_fence (__ATOMIC_ACQUIRE);
+  return __atomic_load_n (&tz_cache_seq, __ATOMIC_RELAXED) == seq;
+}
+
+/* Only one thread changes the entry, the others leave it.  */
+static void
+cache_put (const __tzinfo_type *tz, int year, const time_t *change)
+{
+  unsigned int seq = __atomic_load_n (&tz_cache_seq, __ATOMIC_RELAXED);
+
+  if ((seq & 1) != 0
+      || !__atomic_compare_exchange_n (&tz_cache_seq, &seq, seq + 1, 0,
+				       __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+    return;
+  __atomic_thread_fence (__ATOMIC_RELEASE);
+  tz_cache.tz = tz;
+  tz_cache.year = year;
+  tz_cache.change[0] = change[0];
+  tz_cache.change[1] = change[1];
+  __atomic_store_n (&tz_cache_seq, seq + 2, __ATOMIC_RELEASE);
+}
+#endif
+
+/* Store in CHANGE the times at which the rules TZ switch to daylight
+   saving time and back in YEAR, and return 0 if they cannot.  TZ must
+   not be modified afterwards, like the rules of a time zone state.  */
+int
+__tzcalc_limits_cached (const __tzinfo_type *tz, int year, time_t *change)
+{
+  __tzinfo_type rules;
+
+  if (year == tz->__tzyear && year >= EPOCH_YEAR)
+    {
+      change[0] = tz->__tzrule[0].change;
+      change[1] = tz->__tzrule[1].change;
+      return 1;
+    }
+  if (cache_get (tz, year, change))
+    return 1;
+  rules = *tz;
+  if (!__tzcalc_limits_tz (&rules, year))
+    return 0;
+  change[0] = rules.__tzrule[0].change;
+  change[1] = rules.__tzrule[1].change;
+  cache_put (tz, year, change);
+  return 1;
+}
@@ -0,0 +1,360 @@
+/*
+ * tzfile.c
+ *
+ * Loads time zones from the TZif files of the tz database (RFC 8536),
+ * usually installed in /usr/share/zoneinfo, for tzset.  Version 1 files
+ * and the 64-bit data of version 2 and later files are understood,
+ * including the footer rule that covers the times after the last
+ * transition.  Files with leap second records are refused, since time_t
+ * does not count leap seconds here.
+ *
+ * A file is read and checked once; the zone built from it is immutable
+ * and stays in a list for as long as the program runs, so that the
+ * time zone states of tzset can refer to it and localtime_r can use it
+ * without the time zone lock.
+ */
+
+#include <_ansi.h>
+#include <reent.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "local.h"
+
+#ifdef _WANT_TZFILE
+
+#ifndef TZDIR
+#define TZDIR "/usr/share/zoneinfo"
+#endif
+
+/* Larger files are not time zones.  */
+#define TZFILE_MAX 0x10000
+
+#define TZIF_HEADER 44
+
+/* Counts in the header, in file order.  */
+enum { ISUTCNT, ISSTDCNT, LEAPCNT, TIMECNT, TYPECNT, CHARCNT };
+
+/* Loaded zones, only modified under TZ_LOCK.  */
+static struct __tzfile *zones;
+
+static __int64_t
+get32 (const unsigned char *p)
+{
+  return (__int32_t) ((__uint32_t) p[0] << 24 | (__uint32_t) p[1] << 16
+		      | (__uint32_t) p[2] << 8 | p[3]);
+}
+
+static __int64_t
+get64 (const unsigned char *p)
+{
+  return (__int64_t) ((__uint64_t) get32 (p) << 32 | (__uint32_t) get32 (p + 4));
+}
+
+/* Read the counts of the header at P and return the size of the data
+   block that follows it, or 0 if it is invalid.  TSIZE is the size of
+   the transition times.  */
+static size_t
+header (const unsigned char *p, int tsize, __int64_t *cnt)
+{
+  int i;
+
+  if (memcmp (p, "TZif", 4) != 0)
+    return 0;
+  for (i = 0; i < 6; i++)
+    if ((cnt[i] = get32 (p + 20 + 4 * i)) < 0 || cnt[i] > TZFILE_MAX)
+      return 0;
+  if (cnt[TYPECNT] == 0 || cnt[TYPECNT] > 256 || cnt[CHARCNT] == 0
+      || (cnt[ISUTCNT] != 0 && cnt[ISUTCNT] != cnt[TYPECNT])
+      || (cnt[ISSTDCNT] != 0 && cnt[ISSTDCNT] != cnt[TYPECNT]))
+    return 0;
+  return cnt[TIMECNT] * (tsize + 1) + cnt[TYPECNT] * 6 + cnt[CHARCNT]
+    + cnt[LEAPCNT] * (tsize + 4) + cnt[ISSTDCNT] + cnt[ISUTCNT];
+}
+
+/* Build a zone from the LEN bytes of the file at P.  */
+static struct __tzfile *
+parse (struct _reent *ptr, const char *name, const unsigned char *p,
+       size_t len)
+{
+  const unsigned char *end = p + len, *q, *nl;
+  __int64_t cnt[6];
+  size_t size;
+  int tsize = 4, i;
+  struct __tzfile *z;
+  time_t *trans;
+  struct __tztype *types;
+  unsigned char *idx;
+  char *abbrs, *s;
+  char rule[64], std[11], dst[11];
+
+  if (len < TZIF_HEADER || (size = header (p, 4, cnt)) == 0)
+    return NULL;
+  if (p[4] >= '2')
+    {
+      /* Skip the 32-bit data for the second header.  */
+      p += TZIF_HEADER + size;
+      tsize = 8;
+      if (end - p < TZIF_HEADER || (size = header (p, 8, cnt)) == 0)
+	return NULL;
+    }
+  if (cnt[LEAPCNT] != 0 || end - p - TZIF_HEADER < size)
+    return NULL;
+  p += TZIF_HEADER;
+
+  rule[0] = '\0';
+  if (tsize == 8 && end - p > size && p[size] == '\n'
+      && (nl = memchr (p + size + 1, '\n', end - p - size - 1)) != NULL
+      && nl - (p + size + 1) < sizeof (rule))
+    {
+      memcpy (rule, p + size + 1, nl - (p + size + 1));
+      rule[nl - (p + size + 1)] = '\0';
+    }
+
+  z = _calloc_r (ptr, 1, sizeof (*z) + cnt[TIMECNT] * sizeof (time_t)
+		 + cnt[TYPECNT] * sizeof (struct __tztype) + cnt[TIMECNT]
+		 + cnt[CHARCNT] + 1 + strlen (name) + 1);
+  if (z == NULL)
+    return NULL;
+  trans = (time_t *) (z + 1);
+  types = (struct __tztype *) (trans + cnt[TIMECNT]);
+  idx = (unsigned char *) (types + cnt[TYPECNT]);
+  abbrs = (char *) (idx + cnt[TIMECNT]);
+  s = abbrs + cnt[CHARCNT] + 1;
+
+  for (i = 0; i < cnt[TIMECNT]; i++)
+    {
+      __int64_t t = tsize == 8 ? get64 (p + 8 * i) : get32 (p + 4 * i);
+
+      if (sizeof (time_t) < 8 && (time_t) t != t)
+	t = t < 0 ? LONG_MIN : LONG_MAX;
+      trans[i] = t;
+    }
+  q = p + cnt[TIMECNT] * tsize;
+  for (i = 0; i < cnt[TIMECNT]; i++)
+    if ((idx[i] = q[i]) >= cnt[TYPECNT])
+      goto fail;
+  q += cnt[TIMECNT];
+  memcpy (abbrs, q + cnt[TYPECNT] * 6, cnt[CHARCNT]);
+  for (i = 0; i < cnt[TYPECNT]; i++, q += 6)
+    {
+      if (q[5] >= cnt[CHARCNT])
+	goto fail;
+      types[i].offset = -get32 (q);
+      types[i].isdst = q[4] != 0;
+      types[i].abbr = abbrs + q[5];
+    }
+
+  if (rule[0] != '\0')
+    z->rule = __tzparse (rule, &z->rules, std, dst);
+  z->name = strcpy (s, name);
+  z->timecnt = cnt[TIMECNT];
+  z->typecnt = cnt[TYPECNT];
+  z->trans = trans;
+  z->idx = idx;
+  z->types = types;
+  return z;
+
+fail:
+  _free_r (ptr, z);
+  return NULL;
+}
+
+/* Read the file at PATH, of at most TZFILE_MAX bytes.  */
+static unsigned char *
+read_file (struct _reent *ptr, const char *path, size_t *len)
+{
+  int fd;
+  _ssize_t n;
+  size_t size = 4096;
+  unsigned char *buf, *nbuf;
+
+  if ((fd = _open_r (ptr, path, O_RDONLY, 0)) == -1)
+    return NULL;
+  *len = 0;
+  buf = _malloc_r (ptr, size);
+  while (buf != NULL)
+    {
+      if ((n = _read_r (ptr, fd, buf + *len, size - *len)) <= 0)
+	{
+	  if (n < 0)
+	    {
+	      _free_r (ptr, buf);
+	      buf = NULL;
+	    }
+	  break;
+	}
+      *len += n;
+      if (*len == size)
+	{
+	  if (size >= TZFILE_MAX
+	      || (nbuf = _realloc_r (ptr, buf, 2 * size)) == NULL)
+	    {
+	      _free_r (ptr, buf);
+	      buf = NULL;
+	      break;
+	    }
+	  buf = nbuf;
+	  size *= 2;
+	}
+    }
+  _close_r (ptr, fd);
+  return buf;
+}
+
+/* Return the zone NAME, a path relative to the TZDIR environment variable
+   or the zoneinfo directory, or an absolute path.  Called under TZ_LOCK.  */
+const struct __tzfile *
+__tzfile_load (struct _reent *ptr, const char *name)
+{
+  struct __tzfile *z;
+  const char *dir;
+  char *path = NULL;
+  unsigned char *buf;
+  size_t len;
+
+  for (z = zones; z != NULL; z = z->next)
+    if (strcmp (z->name, name) == 0)
+      return z;
+  if (*name == '\0')
+    return NULL;
+
+  if (*name != '/')
+    {
+      if ((dir = _getenv_r (ptr, "TZDIR")) == NULL || *dir == '\0')
+	dir = TZDIR;
+      if ((path = _malloc_r (ptr, strlen (dir) + strlen (name) + 2)) == NULL)
+	return NULL;
+      strcat (strcat (strcpy (path, dir), "/"), name);
+    }
+  buf = read_file (ptr, path != NULL ? path : name, &len);
+  _free_r (ptr, path);
+  if (buf == NULL)
+    return NULL;
+  z = parse (ptr, name, buf, len);
+  _free_r (ptr, buf);
+  if (z == NULL)
+    return NULL;
+  z->next = zones;
+  zones = z;
+  return z;
+}
+
+/* Set the time zone state ST for the zone Z from its most recent standard
+   and daylight saving time types.  Called under TZ_LOCK.  */
+void
+__tzfile_state (struct __tzstate *st, const struct __tzfile *z)
+{
+  const struct __tztype *tt, *std = NULL, *dst = NULL;
+  int i;
+
+  for (i = z->timecnt - 1; i >= 0 && (std == NULL || dst == NULL); i--)
+    {
+      tt = &z->types[z->idx[i]];
+      if (!tt->isdst && std == NULL)
+	std = tt;
+      else if (tt->isdst && dst == NULL)
+	dst = tt;
+    }
+  if (std == NULL)
+    std = &z->types[0];
+  if (z->rule == 1)
+    dst = NULL;
+  if (dst == NULL)
+    dst = std;
+  st->zone = z;
+  st->tzname[0] = std->abbr;
+  st->tzname[1] = dst->abbr;
+  st->daylight = dst != std;
+  /* strftime takes %z from these.  */
+  st->rules = z->rules;
+  st->rules.__tzrule[0].offset = std->offset;
+  st->rules.__tzrule[1].offset = dst->offset;
+}
+
+/* Floor of A / B for B > 0.  */
+#define FLOOR_DIV(a, b)	((a) / (b) - ((a) % (b) < 0))
+
+/* Days from the epoch to 1 January of YEAR, which may be before 1970 or
+   even before year 1.  */
+static long long
+year_start (long long year)
+{
+  long long y = year - 1;
+
+  return (year - EPOCH_YEAR) * 365 + FLOOR_DIV (y, 4) - FLOOR_DIV (y, 100)
+	 + FLOOR_DIV (y, 400) - 477;
+}
+
+/* __tzcalc_limits counts the days to the changes of a year in an int, so
+   the rule is only used within this many days of the epoch, which is
+   about five million years.  */
+#define RULE_MAX_DAYS	(5000000 * 365LL)
+
+/* Offset and DST flag from the footer rule of Z.  */
+static long
+rule_offset (const struct __tzfile *z, time_t t, int *isdst)
+{
+  const __tzinfo_type *tz = &z->rules;
+  long long days = FLOOR_DIV ((long long) t, SECSPERDAY);
+  long long year;
+  time_t change[2];
+
+  /* Further away, like before 1970, there is only standard time.  */
+  if (days < -RULE_MAX_DAYS || days > RULE_MAX_DAYS)
+    {
+      *isdst = 0;
+      return tz->__tzrule[0].offset;
+    }
+  /* The estimate is at most two years off.  */
+  year = EPOCH_YEAR + days * 400 / 146097;
+  while (year_start (year) > days)
+    year--;
+  while (year_start (year + 1) <= days)
+    year++;
+  if (z->rule == 1 || !__tzcalc_limits_cached (tz, (int) year, change))
+    {
+      *isdst = 0;
+      return tz->__tzrule[0].offset;
+    }
+  /* The rule is northern if daylight saving time starts first.  */
+  *isdst = (change[0] < change[1]
+	    ? (t >= change[0] && t < change[1])
+	    : (t >= change[0] || t < change[1]));
+  return tz->__tzrule[*isdst].offset;
+}
+
+/* Return the offset of zone Z at time T, to be added to local time to get
+   UTC like __tzrule_type.offset, and set *ISDST.  Needs no lock.  */
+long
+__tzfile_offset (const struct __tzfile *z, time_t t, int *isdst)
+{
+  const struct __tztype *tt;
+  int lo, hi, mid;
+
+  if (z->rule != 0 && (z->timecnt == 0 || t >= z->trans[z->timecnt - 1]))
+    return rule_offset (z, t, isdst);
+  if (z->timecnt == 0 || t < z->trans[0])
+    tt = &z->types[0];
+  else
+    {
+      /* The last transition at or before T.  */
+      lo = 0;
+      hi = z->timecnt - 1;
+      while (lo < hi)
+	{
+	  mid = hi - (hi - lo) / 2;
+	  if (z->trans[mid] <= t)
+	    lo = mid;
+	  else
+	    hi = mid - 1;
+	}
+      tt = &z->types[z->idx[lo]];
+    }
+  *isdst = tt->isdst;
+  return tt->offset;
+}
+
+#endif /* _WANT_TZFILE */
@@ -42,7 +42,22 @@ where: std is the name of the standard time-zone (minimum 3 chars)
 
 Note that there is no white-space padding between fields.  Also note that
 if TZ is null, the default is Universal GMT which has no daylight-savings
-time.  If TZ is empty, the default EST5EDT is used.
+time.  If TZ is empty, the default EST5EDT is used.  The std and dst
+names may also be quoted in angle brackets, like <+0330>, to allow
+digits and signs in them.
+
+If newlib is configured with --enable-newlib-tzfile, TZ may also name a
+TZif file of the tz database, like "Europe/Paris" or ":Europe/Paris",
+relative to the directory in the TZDIR environment variable or to
+/usr/share/zoneinfo, or as an absolute path.  The file is used if TZ
+begins with a colon or is not a valid rule, and gives the offsets
+and daylight-savings time of all the years it covers.
+
+Each value of TZ is examined only once: <<tzset>> keeps the time zone
+made from it and reuses it if TZ takes that value again.  A file is
+thus read once, even if it changes later.  <<localtime_r>>, <<mktime>>
+and <<strftime>> only call <<tzset>> if TZ has changed, and otherwise
+do not need to lock the time zone variables.
 
 The function <<_tzset_r>> is identical to <<tzset>> only it is reentrant
 and is used for applications that use multiple threads.
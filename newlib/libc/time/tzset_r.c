@@ -9,44 +9,46 @@
 
 #define sscanf siscanf	/* avoid to pull in FP functions. */
 
-static char __tzname_std[11];
-static char __tzname_dst[11];
-static char *prev_tzenv = NULL;
+/* In effect until TZ is examined, and whenever it is unset.  */
+static const struct __tzstate gmt_state = {
+  NULL, NULL, NULL,
+  {1, 0, { {'J', 0, 0, 0, 0, (time_t)0, 0L },
+	   {'J', 0, 0, 0, 0, (time_t)0, 0L } } },
+  0, { "GMT", "GMT" }
+};
 
-void
-_tzset_unlocked_r (struct _reent *reent_ptr)
-{
-  char *tzenv;
-  unsigned short hh, mm, ss, m, w, d;
-  int sign, n;
-  int i, ch;
-  __tzinfo_type *tz = __gettzinfo ();
+const struct __tzstate *__tzstate = &gmt_state;
 
-  if ((tzenv = _getenv_r (reent_ptr, "TZ")) == NULL)
-      {
-	_timezone = 0;
-	_daylight = 0;
-	_tzname[0] = "GMT";
-	_tzname[1] = "GMT";
-	free(prev_tzenv);
-	prev_tzenv = NULL;
-	return;
-      }
+/* States made so far, only modified under TZ_LOCK.  */
+static struct __tzstate *states;
 
-  if (prev_tzenv != NULL && strcmp(tzenv, prev_tzenv) == 0)
-    return;
+/* Read a zone name, alphabetic or quoted in angle brackets like "<+0330>",
+   into NAME.  Returns the number of characters consumed, 0 if there is
+   no name.  */
+static int
+parse_name (const char *tzenv, char *name)
+{
+  int n = 0;
 
-  free(prev_tzenv);
-  prev_tzenv = _malloc_r (reent_ptr, strlen(tzenv) + 1);
-  if (prev_tzenv != NULL)
-    strcpy (prev_tzenv, tzenv);
+  if (*tzenv == '<')
+    sscanf (tzenv, "<%10[^>]>%n", name, &n);
+  else if (sscanf (tzenv, "%10[^0-9,+-]%n", name, &n) <= 0)
+    n = 0;
+  return n;
+}
 
-  /* ignore implementation-specific format specifier */
-  if (*tzenv == ':')
-    ++tzenv;  
+/* Parse the POSIX rule string TZENV into TZ and the zone names STD and
+   DST, which have room for 10 characters.  Returns 0 if TZENV is not a
+   valid rule, 1 if it has no daylight saving time and 2 if it does.  */
+int
+__tzparse (const char *tzenv, __tzinfo_type *tz, char *std, char *dst)
+{
+  unsigned short hh, mm, ss, m, w, d;
+  int sign, n;
+  int i, ch;
 
-  if (sscanf (tzenv, "%10[^0-9,+-]%n", __tzname_std, &n) <= 0)
-    return;
+  if ((n = parse_name (tzenv, std)) == 0)
+    return 0;
  
   tzenv += n;
 
@@ -63,21 +65,13 @@ _tzset_unlocked_r (struct _reent *reent_ptr)
   ss = 0;
  
   if (sscanf (tzenv, "%hu%n:%hu%n:%hu%n", &hh, &n, &mm, &n, &ss, &n) < 1)
-    return;
+    return 0;
   
   tz->__tzrule[0].offset = sign * (ss + SECSPERMIN * mm + SECSPERHOUR * hh);
-  _tzname[0] = __tzname_std;
   tzenv += n;
   
-  if (sscanf (tzenv, "%10[^0-9,+-]%n", __tzname_dst, &n) <= 0)
-    { /* No dst */
-      _tzname[1] = _tzname[0];
-      _timezone = tz->__tzrule[0].offset;
-      _daylight = 0;
-      return;
-    }
-  else
-    _tzname[1] = __tzname_dst;
+  if ((n = parse_name (tzenv, dst)) == 0)
+    return 1; /* No dst */
 
   tzenv += n;
 
@@ -112,7 +106,7 @@ _tzset_unlocked_r (struct _reent *reent_ptr)
 	{
 	  if (sscanf (tzenv, "M%hu%n.%hu%n.%hu%n", &m, &n, &w, &n, &d, &n) != 3 ||
 	      m < 1 || m > 12 || w < 1 || w > 5 || d > 6)
-	    return;
+	    return 0;
 	  
 	  tz->__tzrule[i].ch = 'M';
 	  tz->__tzrule[i].m = m;
@@ -177,9 +171,133 @@ _tzset_unlocked_r (struct _reent *reent_ptr)
       tzenv += n;
     }
 
-  __tzcalc_limits (tz->__tzyear);
-  _timezone = tz->__tzrule[0].offset;  
-  _daylight = tz->__tzrule[0].offset != tz->__tzrule[1].offset;
+  return 2;
+}
+
+/* Whether TZENV, the value of TZ, is the one ST was made from.  */
+static int
+same_tzenv (const struct __tzstate *st, const char *tzenv)
+{
+  if (tzenv == NULL || st->tzenv == NULL)
+    return tzenv == st->tzenv;
+  return strcmp (tzenv, st->tzenv) == 0;
+}
+
+/* Make ST the current state and set the global variables from it.  */
+static void
+publish (const struct __tzstate *st)
+{
+  *__gettzinfo () = st->rules;
+  _tzname[0] = (char *) st->tzname[0];
+  _tzname[1] = (char *) st->tzname[1];
+  _timezone = st->rules.__tzrule[0].offset;
+  _daylight = st->daylight;
+  TZSTATE_PUBLISH (st);
+}
+
+void
+_tzset_unlocked_r (struct _reent *reent_ptr)
+{
+  char *tzenv;
+  const struct __tzstate *cur = TZSTATE ();
+  const struct __tzstate *base = cur->base != NULL ? cur->base : cur;
+  struct __tzstate *st;
+  int n;
+#ifdef _WANT_TZFILE
+  const struct __tzfile *zone;
+#endif
+
+  tzenv = _getenv_r (reent_ptr, "TZ");
+  if (same_tzenv (cur, tzenv))
+    return;
+  if (tzenv == NULL)
+    {
+      publish (&gmt_state);
+      return;
+    }
+
+  /* A state kept for an invalid TZ repeats the one it replaced, so it
+     only serves again after that same state.  */
+  for (st = states; st != NULL; st = st->next)
+    if (same_tzenv (st, tzenv) && (st->base == NULL || st->base == base))
+      {
+	publish (st);
+	return;
+      }
+
+  st = _malloc_r (reent_ptr, sizeof (*st) + strlen (tzenv) + 1);
+  if (st == NULL)
+    return;
+  memset (st, 0, sizeof (*st));
+  st->tzenv = strcpy ((char *) (st + 1), tzenv);
+  st->rules = cur->rules;
+
+#ifdef _WANT_TZFILE
+  /* ":name" names a TZif file first of all.  */
+  if (*tzenv == ':' && (zone = __tzfile_load (reent_ptr, tzenv + 1)) != NULL)
+    __tzfile_state (st, zone);
+  else
+#endif
+    {
+      /* ignore implementation-specific format specifier */
+      if (*tzenv == ':')
+	++tzenv;
+
+      if ((n = __tzparse (tzenv, &st->rules, st->names[0], st->names[1])) != 0)
+	{
+	  st->tzname[0] = st->names[0];
+	  if (n == 1)
+	    {
+	      st->tzname[1] = st->tzname[0];
+	      st->rules.__tzrule[1].offset = st->rules.__tzrule[0].offset;
+	    }
+	  else
+	    {
+	      st->tzname[1] = st->names[1];
+	      __tzcalc_limits_tz (&st->rules, st->rules.__tzyear);
+	      st->daylight = (st->rules.__tzrule[0].offset
+			      != st->rules.__tzrule[1].offset);
+	    }
+	}
+#ifdef _WANT_TZFILE
+      /* Not a rule, but possibly a zone name like "Europe/Paris".  */
+      else if ((zone = __tzfile_load (reent_ptr, tzenv)) != NULL)
+	__tzfile_state (st, zone);
+#endif
+      else
+	{
+	  /* Leave the time zone as it was.  */
+	  st->base = base;
+	  st->rules = base->rules;
+	  st->daylight = base->daylight;
+	  st->tzname[0] = base->tzname[0];
+	  st->tzname[1] = base->tzname[1];
+#ifdef _WANT_TZFILE
+	  st->zone = base->zone;
+#endif
+	}
+    }
+
+  st->next = states;
+  states = st;
+  publish (st);
+}
+
+/* Return the state for the current value of TZ, calling tzset only if
+   TZ changed since the last call.  */
+const struct __tzstate *
+__tzstate_get (void)
+{
+  const struct __tzstate *st = TZSTATE ();
+
+  if (!same_tzenv (st, _getenv_r (_REENT, "TZ")))
+    {
+      TZ_LOCK;
+      _tzset_unlocked ();
+      st = TZSTATE ();
+      TZ_UNLOCK;
+    }
+  return st;
 }
 
 void
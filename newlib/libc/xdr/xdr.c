@@ -36,6 +36,7 @@
  * xdr.
  */
 
+#include <limits.h>
 #include <stdlib.h>
 #include <string.h>
 #include <errno.h>
@@ -629,6 +630,40 @@ xdr_opaque (XDR * xdrs,
   return FALSE;
 }
 
+/*
+ * XDR opaque data without copying it.
+ * On decode *cpp is set to point at the cnt bytes inside the stream's
+ * own buffer; they stay valid until the next operation on xdrs.  On
+ * encode *cpp is set to where the caller must store cnt bytes, and the
+ * padding is already zeroed.  Fails without consuming anything if the
+ * stream cannot provide the bytes contiguously; use xdr_opaque then.
+ */
+bool_t
+xdr_opaque_inline (XDR * xdrs,
+	char ** cpp,
+	u_int cnt)
+{
+  u_int len;
+  char *buf;
+
+  if (xdrs->x_op == XDR_FREE)
+    return TRUE;
+  if (cnt > UINT_MAX - BYTES_PER_XDR_UNIT)
+    return FALSE;
+  len = RNDUP (cnt);
+  if (len == 0)
+    {
+      *cpp = NULL;
+      return TRUE;
+    }
+  if ((buf = (char *) XDR_INLINE (xdrs, len)) == NULL)
+    return FALSE;
+  if (xdrs->x_op == XDR_ENCODE && len > cnt)
+    memset (buf + cnt, 0, len - cnt);
+  *cpp = buf;
+  return TRUE;
+}
+
 /*
  * XDR counted bytes
  * *cpp is a pointer to the bytes, *sizep is the count.
@@ -46,6 +46,16 @@
 
 #include "xdr_private.h"
 
+#ifndef ntohl
+# define ntohl(x) xdr_ntohl(x)
+#endif
+#ifndef htonl
+# define htonl(x) xdr_htonl(x)
+#endif
+
+static bool_t xdr_vector_prim (XDR *, char *, u_int, u_int, xdrproc_t,
+                               bool_t *);
+
 /*
  * XDR an array of arbitrary elements
  * *addrp is a pointer to the array, *sizep is the number of elements.
@@ -109,11 +119,12 @@ xdr_array (XDR * xdrs,
   /*
    * now we xdr each element of array
    */
-  for (i = 0; (i < c) && stat; i++)
-    {
-      stat = (*elproc) (xdrs, target);
-      target += elsize;
-    }
+  if (!xdr_vector_prim (xdrs, target, c, elsize, elproc, &stat))
+    for (i = 0; (i < c) && stat; i++)
+      {
+        stat = (*elproc) (xdrs, target);
+        target += elsize;
+      }
 
   /*
    * the array may need freeing
@@ -145,6 +156,10 @@ xdr_vector (XDR * xdrs,
 {
   u_int i;
   char *elptr;
+  bool_t stat;
+
+  if (xdr_vector_prim (xdrs, basep, nelem, elemsize, xdr_elem, &stat))
+    return stat;
 
   elptr = basep;
   for (i = 0; i < nelem; i++)
@@ -157,3 +172,224 @@ xdr_vector (XDR * xdrs,
     }
   return TRUE;
 }
+
+/*
+ * Bulk conversion of arrays of 32- and 64-bit primitives.
+ *
+ * Rather than going through the stream's x_ops once per element, take
+ * as large a piece of the stream buffer as XDR_INLINE will give and
+ * convert it in one tight loop, which the compiler can unroll and
+ * vectorize.  The piece asked for is halved whenever the stream refuses
+ * it and doubled after each success, so record streams settle on their
+ * buffer size, while streams that never inline (xdr_stdio, unaligned
+ * xdr_mem) pay one failed XDR_INLINE per BULK_MIN_UNITS elements.
+ */
+#define BULK_MIN_UNITS 16
+#define BULK_MAX_UNITS (1U << 20)
+
+/*
+ * XDR n four-byte units at p.  With pairswap the units are 64-bit
+ * quantities stored low word first in memory, which go on the wire
+ * high word first.
+ */
+static bool_t
+xdr_units (XDR * xdrs,
+	u_int32_t * p,
+	u_int n,
+	int pairswap)
+{
+  u_int chunk, i, step, hi;
+  u_int32_t *buf;
+
+  step = pairswap ? 2 : 1;
+  hi = pairswap ? 1 : 0;
+  chunk = BULK_MAX_UNITS;
+  while (n > 0)
+    {
+      if (chunk > n)
+        chunk = n;
+      buf = (u_int32_t *) XDR_INLINE (xdrs, chunk * BYTES_PER_XDR_UNIT);
+      if (buf == NULL && chunk > BULK_MIN_UNITS)
+        {
+          chunk = (chunk / 2) & ~(step - 1);
+          continue;
+        }
+      if (buf == NULL)
+        {
+          /* not even a small piece is contiguous; do it the slow way */
+          for (i = 0; i < chunk; i += step)
+            {
+              if (xdrs->x_op == XDR_ENCODE)
+                {
+                  if (!XDR_PUTINT32 (xdrs, (int32_t *) &p[i + hi]))
+                    return FALSE;
+                  if (pairswap && !XDR_PUTINT32 (xdrs, (int32_t *) &p[i]))
+                    return FALSE;
+                }
+              else
+                {
+                  if (!XDR_GETINT32 (xdrs, (int32_t *) &p[i + hi]))
+                    return FALSE;
+                  if (pairswap && !XDR_GETINT32 (xdrs, (int32_t *) &p[i]))
+                    return FALSE;
+                }
+            }
+        }
+      else if (xdrs->x_op == XDR_ENCODE)
+        {
+          if (pairswap)
+            for (i = 0; i < chunk; i += 2)
+              {
+                buf[i] = htonl (p[i + 1]);
+                buf[i + 1] = htonl (p[i]);
+              }
+          else
+            for (i = 0; i < chunk; i++)
+              buf[i] = htonl (p[i]);
+        }
+      else
+        {
+          if (pairswap)
+            for (i = 0; i < chunk; i += 2)
+              {
+                p[i + 1] = ntohl (buf[i]);
+                p[i] = ntohl (buf[i + 1]);
+              }
+          else
+            for (i = 0; i < chunk; i++)
+              p[i] = ntohl (buf[i]);
+        }
+      p += chunk;
+      n -= chunk;
+      if (buf != NULL && chunk <= BULK_MAX_UNITS / 2)
+        chunk *= 2;
+    }
+  return TRUE;
+}
+
+static bool_t
+xdr_units_op (XDR * xdrs,
+	void * p,
+	u_int nelem,
+	u_int units,
+	int pairswap)
+{
+  switch (xdrs->x_op)
+    {
+    case XDR_ENCODE:
+    case XDR_DECODE:
+      if (nelem > UINT_MAX / units)
+        return FALSE;
+      return xdr_units (xdrs, (u_int32_t *) p, nelem * units, pairswap);
+
+    case XDR_FREE:
+      return TRUE;
+    }
+  return FALSE;
+}
+
+/*
+ * XDR fixed-length arrays of 32-bit integers.
+ */
+bool_t
+xdr_int32_vector (XDR * xdrs,
+	int32_t * ip,
+	u_int nelem)
+{
+  return xdr_units_op (xdrs, ip, nelem, 1, 0);
+}
+
+#if defined(___int64_t_defined)
+/*
+ * XDR fixed-length arrays of 64-bit integers (hypers).
+ */
+bool_t
+xdr_int64_vector (XDR * xdrs,
+	int64_t * llp,
+	u_int nelem)
+{
+  return xdr_units_op (xdrs, llp, nelem, 2, BYTE_ORDER == LITTLE_ENDIAN);
+}
+#endif /* ___int64_t_defined */
+
+/*
+ * XDR fixed-length arrays of floats and doubles.  Only IEEE machines
+ * can move the bits unchanged; anything else goes element by element.
+ */
+bool_t
+xdr_float_vector (XDR * xdrs,
+	float * fp,
+	u_int nelem)
+{
+#if defined(__IEEE_LITTLE_ENDIAN) || defined(__IEEE_BIG_ENDIAN)
+  return xdr_units_op (xdrs, fp, nelem, 1, 0);
+#else
+  return xdr_vector (xdrs, (char *) fp, nelem, sizeof (float),
+                     (xdrproc_t) xdr_float);
+#endif
+}
+
+#if !defined(_DOUBLE_IS_32BITS)
+bool_t
+xdr_double_vector (XDR * xdrs,
+	double * dp,
+	u_int nelem)
+{
+#if defined(__IEEE_LITTLE_ENDIAN) || defined(__IEEE_BIG_ENDIAN)
+  /* same word order as xdr_double */
+# if defined(__IEEE_BIG_ENDIAN)
+  return xdr_units_op (xdrs, dp, nelem, 2, 0);
+# else
+  return xdr_units_op (xdrs, dp, nelem, 2, 1);
+# endif
+#else
+  return xdr_vector (xdrs, (char *) dp, nelem, sizeof (double),
+                     (xdrproc_t) xdr_double);
+#endif
+}
+#endif /* !_DOUBLE_IS_32BITS */
+
+/*
+ * If elproc is one of the primitives above and elsize is its natural
+ * size, XDR the whole array in bulk and return TRUE with the outcome in
+ * *statp.  Otherwise return FALSE and leave the work to the caller.
+ */
+static bool_t
+xdr_vector_prim (XDR * xdrs,
+	char * basep,
+	u_int nelem,
+	u_int elsize,
+	xdrproc_t elproc,
+	bool_t * statp)
+{
+  if (elsize == sizeof (int32_t)
+      && (elproc == (xdrproc_t) xdr_int32_t
+          || elproc == (xdrproc_t) xdr_uint32_t
+          || elproc == (xdrproc_t) xdr_u_int32_t
+          || (sizeof (int) == sizeof (int32_t)
+              && (elproc == (xdrproc_t) xdr_int
+                  || elproc == (xdrproc_t) xdr_u_int))))
+    *statp = xdr_int32_vector (xdrs, (int32_t *) basep, nelem);
+#if defined(___int64_t_defined)
+  else if (elsize == sizeof (int64_t)
+           && (elproc == (xdrproc_t) xdr_int64_t
+               || elproc == (xdrproc_t) xdr_uint64_t
+               || elproc == (xdrproc_t) xdr_u_int64_t
+               || elproc == (xdrproc_t) xdr_hyper
+               || elproc == (xdrproc_t) xdr_u_hyper
+               || elproc == (xdrproc_t) xdr_longlong_t
+               || elproc == (xdrproc_t) xdr_u_longlong_t))
+    *statp = xdr_int64_vector (xdrs, (int64_t *) basep, nelem);
+#endif
+#if defined(__IEEE_LITTLE_ENDIAN) || defined(__IEEE_BIG_ENDIAN)
+  else if (elsize == sizeof (float) && elproc == (xdrproc_t) xdr_float)
+    *statp = xdr_float_vector (xdrs, (float *) basep, nelem);
+#if !defined(_DOUBLE_IS_32BITS)
+  else if (elsize == sizeof (double) && elproc == (xdrproc_t) xdr_double)
+    *statp = xdr_double_vector (xdrs, (double *) basep, nelem);
+#endif
+#endif
+  else
+    return FALSE;
+  return TRUE;
+}
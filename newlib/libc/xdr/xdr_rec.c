@@ -111,6 +111,12 @@ static const struct xdr_ops xdrrec_ops = {
 
 #define LAST_FRAG ((u_int32_t)(UINT32_C(1) << 31))
 
+/*
+ * With scatter/gather callbacks, opaque data at least this big is moved
+ * between the caller's memory and the transport directly.
+ */
+#define DIRECT_IO_MIN 4096
+
 typedef struct rec_strm
 {
   caddr_t tcp_handle;
@@ -124,11 +130,13 @@ typedef struct rec_strm
   caddr_t out_boundry;          /* data cannot up to this address */
   u_int32_t *frag_header;       /* beginning of curren fragment */
   bool_t frag_sent;             /* true if buffer sent in middle of record */
+  int (*writevit) (void *, const struct xdr_iovec *, int);
   /*
    * in-coming bits
    */
   caddr_t in_buffer;            /* buffer as allocated; may not be aligned */
   int (*readit) (void *, void *, int);
+  int (*readvit) (void *, const struct xdr_iovec *, int);
   u_long in_size;               /* fixed size of the input buffer */
   caddr_t in_base;
   caddr_t in_finger;            /* location of next byte to be had */
@@ -150,8 +158,11 @@ typedef struct rec_strm
 
 static u_int fix_buf_size (u_int);
 static bool_t flush_out (RECSTREAM *, bool_t);
+static bool_t flush_out_with (RECSTREAM *, const char *, u_int);
 static bool_t fill_input_buf (RECSTREAM *);
 static bool_t get_input_bytes (RECSTREAM *, char *, size_t);
+static bool_t gather_input_bytes (RECSTREAM *, size_t);
+static int read_input_direct (RECSTREAM *, char *, size_t);
 static bool_t set_input_fragment (RECSTREAM *);
 static bool_t skip_input_bytes (RECSTREAM *, long);
 static bool_t realloc_stream (RECSTREAM *, int);
@@ -235,6 +246,8 @@ xdrrec_create (XDR * xdrs,
   rstrm->tcp_handle = tcp_handle;
   rstrm->readit = readit;
   rstrm->writeit = writeit;
+  rstrm->readvit = NULL;
+  rstrm->writevit = NULL;
   rstrm->out_finger = rstrm->out_boundry = rstrm->out_base;
   rstrm->frag_header = (u_int32_t *) (void *) rstrm->out_base;
   rstrm->out_finger += sizeof (u_int32_t);
@@ -350,6 +363,18 @@ xdrrec_putbytes (XDR * xdrs,
     {
       current = (size_t) ((u_long) rstrm->out_boundry -
                           (u_long) rstrm->out_finger);
+      if (rstrm->writevit != NULL && (len >= DIRECT_IO_MIN || len > current))
+        {
+          /* send the buffer and the data as one fragment, uncopied */
+          current = (len < INT_MAX - rstrm->sendsize)
+            ? len : INT_MAX - rstrm->sendsize;
+          rstrm->frag_sent = TRUE;
+          if (!flush_out_with (rstrm, addr, current))
+            return FALSE;
+          addr += current;
+          len -= current;
+          continue;
+        }
       current = (len < current) ? len : current;
       memmove (rstrm->out_finger, addr, current);
       rstrm->out_finger += current;
@@ -450,6 +475,17 @@ xdrrec_inline (XDR * xdrs,
     {
 
     case XDR_ENCODE:
+      /*
+       * If the request would fit in an empty buffer, send what is
+       * there now rather than fail.
+       */
+      if ((rstrm->out_finger + len) > rstrm->out_boundry
+          && len <= rstrm->sendsize - sizeof (u_int32_t))
+        {
+          rstrm->frag_sent = TRUE;
+          if (!flush_out (rstrm, FALSE))
+            break;
+        }
       if ((rstrm->out_finger + len) <= rstrm->out_boundry)
         {
           buf = (int32_t *) (void *) rstrm->out_finger;
@@ -458,8 +494,13 @@ xdrrec_inline (XDR * xdrs,
       break;
 
     case XDR_DECODE:
+      /*
+       * Data that straddles the end of the buffer but lies within the
+       * current fragment is gathered at the start of the buffer.
+       */
       if (((long)len <= rstrm->fbtbc) &&
-          ((rstrm->in_finger + len) <= rstrm->in_boundry))
+          ((rstrm->in_finger + len) <= rstrm->in_boundry
+           || gather_input_bytes (rstrm, len)))
         {
           buf = (int32_t *) (void *) rstrm->in_finger;
           rstrm->fbtbc -= len;
@@ -734,6 +775,62 @@ __xdrrec_setnonblock (XDR * xdrs,
   return TRUE;
 }
 
+/*
+ * Install scatter/gather versions of the read and write callbacks.
+ * Either may be NULL to keep using the plain one for that direction.
+ */
+bool_t
+xdrrec_setiov (XDR * xdrs,
+        int (*readvit) (void *, const struct xdr_iovec *, int),
+        int (*writevit) (void *, const struct xdr_iovec *, int))
+{
+  RECSTREAM *rstrm = (RECSTREAM *) (xdrs->x_private);
+
+  rstrm->readvit = readvit;
+  rstrm->writevit = writevit;
+  return TRUE;
+}
+
+/*
+ * Hint that records of about size bytes are coming.  The send buffer is
+ * grown, if need be, so that such a record is sent with a single write
+ * by xdrrec_endofrecord rather than in buffer-sized fragments.  Whatever
+ * is already buffered is kept.
+ */
+bool_t
+xdrrec_sizehint (XDR * xdrs,
+	u_int size)
+{
+  RECSTREAM *rstrm = (RECSTREAM *) (xdrs->x_private);
+  caddr_t buffer, base;
+  u_int sendsize;
+
+  if (size >= (u_int) INT_MAX - 2 * sizeof (u_int32_t))
+    return FALSE;
+  sendsize = fix_buf_size (size + 2 * sizeof (u_int32_t));
+  if (sendsize <= rstrm->sendsize)
+    return TRUE;
+
+  buffer = mem_alloc (sendsize + BYTES_PER_XDR_UNIT);
+  if (buffer == NULL)
+    {
+      errno = ENOMEM;
+      return FALSE;
+    }
+  for (base = buffer; (long) base % BYTES_PER_XDR_UNIT != 0; base++)
+    ;
+  memcpy (base, rstrm->out_base, rstrm->out_finger - rstrm->out_base);
+  rstrm->frag_header = (u_int32_t *) (void *)
+    (base + ((caddr_t) rstrm->frag_header - rstrm->out_base));
+  rstrm->out_finger = base + (rstrm->out_finger - rstrm->out_base);
+  rstrm->out_boundry = base + sendsize;
+  mem_free (rstrm->out_buffer, rstrm->sendsize + BYTES_PER_XDR_UNIT);
+  rstrm->out_buffer = buffer;
+  rstrm->out_base = base;
+  rstrm->sendsize = sendsize;
+  return TRUE;
+}
+
 /*
  * Internal useful routines
  */
@@ -757,6 +854,34 @@ flush_out (RECSTREAM * rstrm,
   return TRUE;
 }
 
+/*
+ * Like flush_out (rstrm, FALSE), but the len bytes at addr are appended
+ * to the current fragment and go out in the same write.
+ */
+static bool_t
+flush_out_with (RECSTREAM * rstrm,
+	const char *addr,
+	u_int len)
+{
+  struct xdr_iovec iov[2];
+  u_int32_t fraglen = (u_int32_t) ((u_long) (rstrm->out_finger) -
+                                   (u_long) (rstrm->frag_header) -
+                                   sizeof (u_int32_t)) + len;
+
+  *(rstrm->frag_header) = htonl (fraglen);
+  iov[0].iov_base = rstrm->out_base;
+  iov[0].iov_len = (size_t) ((u_long) (rstrm->out_finger) -
+                             (u_long) (rstrm->out_base));
+  iov[1].iov_base = (void *) addr;
+  iov[1].iov_len = len;
+  if ((*(rstrm->writevit)) (rstrm->tcp_handle, iov, 2)
+      != (int) (iov[0].iov_len + len))
+    return FALSE;
+  rstrm->frag_header = (u_int32_t *) (void *) rstrm->out_base;
+  rstrm->out_finger = (char *) rstrm->out_base + sizeof (u_int32_t);
+  return TRUE;
+}
+
 static bool_t                   /* knows nothing about records!  Only about input buffers */
 fill_input_buf (RECSTREAM * rstrm)
 {
@@ -779,12 +904,55 @@ fill_input_buf (RECSTREAM * rstrm)
   return TRUE;
 }
 
+/*
+ * Read into the caller's memory instead of the empty input buffer.  With
+ * a readv callback, whatever follows is read into the input buffer by
+ * the same call.  Returns the number of bytes stored at addr, or -1.
+ */
+static int                      /* knows nothing about records!  Only about input buffers */
+read_input_direct (RECSTREAM * rstrm,
+	char *addr,
+	size_t len)
+{
+  struct xdr_iovec iov[2];
+  u_int32_t i;
+  int n;
+
+  if (len > INT_MAX / 2)
+    len = INT_MAX / 2;
+  /* place the read-ahead the way fill_input_buf would have */
+  i = (u_int32_t) (((u_long) rstrm->in_boundry + len) % BYTES_PER_XDR_UNIT);
+  if (rstrm->readvit != NULL)
+    {
+      iov[0].iov_base = addr;
+      iov[0].iov_len = len;
+      iov[1].iov_base = rstrm->in_base + i;
+      iov[1].iov_len = rstrm->in_size - i;
+      n = (*(rstrm->readvit)) (rstrm->tcp_handle, iov, 2);
+    }
+  else
+    n = (*(rstrm->readit)) (rstrm->tcp_handle, addr, (int) len);
+  if (n <= 0)
+    return -1;
+  if ((size_t) n <= len)
+    {
+      rstrm->in_boundry = rstrm->in_base +
+        (((u_long) rstrm->in_boundry + n) % BYTES_PER_XDR_UNIT);
+      rstrm->in_finger = rstrm->in_boundry;
+      return n;
+    }
+  rstrm->in_finger = rstrm->in_base + i;
+  rstrm->in_boundry = rstrm->in_finger + (n - len);
+  return (int) len;
+}
+
 static bool_t                   /* knows nothing about records!  Only about input buffers */
 get_input_bytes (RECSTREAM * rstrm,
 	char *addr,
 	size_t len)
 {
   size_t current;
+  int n;
 
   if (rstrm->nonblock)
     {
@@ -801,6 +969,15 @@ get_input_bytes (RECSTREAM * rstrm,
       current = (size_t) ((long) rstrm->in_boundry - (long) rstrm->in_finger);
       if (current == 0)
         {
+          if (len >= DIRECT_IO_MIN
+              && (rstrm->readvit != NULL || len >= rstrm->in_size))
+            {
+              if ((n = read_input_direct (rstrm, addr, len)) < 0)
+                return FALSE;
+              addr += n;
+              len -= n;
+              continue;
+            }
           if (!fill_input_buf (rstrm))
             return FALSE;
           continue;
@@ -814,6 +991,40 @@ get_input_bytes (RECSTREAM * rstrm,
   return TRUE;
 }
 
+static bool_t                   /* knows nothing about records!  Only about input buffers */
+gather_input_bytes (RECSTREAM * rstrm,
+	size_t len)
+{
+  size_t have;
+  char *where;
+  int n;
+
+  if (rstrm->nonblock || len > rstrm->in_size - BYTES_PER_XDR_UNIT)
+    return FALSE;
+  if (rstrm->in_boundry < rstrm->in_finger)
+    return FALSE;
+  have = (size_t) (rstrm->in_boundry - rstrm->in_finger);
+
+  /* slide what is left down, keeping its alignment */
+  where = rstrm->in_base + ((u_long) rstrm->in_finger % BYTES_PER_XDR_UNIT);
+  if (where != rstrm->in_finger)
+    memmove (where, rstrm->in_finger, have);
+  rstrm->in_finger = where;
+  rstrm->in_boundry = where + have;
+
+  while (have < len)
+    {
+      n = (*(rstrm->readit)) (rstrm->tcp_handle, rstrm->in_boundry,
+                              (int) (rstrm->in_base + rstrm->in_size
+                                     - rstrm->in_boundry));
+      if (n <= 0)
+        return FALSE;
+      rstrm->in_boundry += n;
+      have += n;
+    }
+  return TRUE;
+}
+
 static bool_t                   /* next two bytes of the input stream are treated as a header */
 set_input_fragment (RECSTREAM * rstrm)
 {
@@ -0,0 +1,55 @@
+/* Double-precision acos function.
+   Copyright (c) 2026 The newlib contributors.
+
+   Permission to use, copy, modify, and distribute this software
+   is freely granted, provided that this notice is preserved.  */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include <math.h>
+#include <stdint.h>
+#include "math_config.h"
+#include "asin_inline.h"
+
+#define D __asin_data
+
+/* acos(x) = pi/2 - asin(x) for |x| < 0.5, 2 asin(s) for x >= 0.5 and
+   pi - 2 asin(s) for x <= -0.5 with s = sqrt((1-|x|)/2), see
+   asin_inline.h.  Worst-case error is 0.70 ULP.  */
+double
+acos (double x)
+{
+  uint64_t ia;
+  int sign;
+  /* double_t for better performance on targets with FLT_EVAL_METHOD==2.  */
+  double_t ax, s, lo, hi, e, x2;
+
+  ia = asuint64 (x) & 0x7fffffffffffffff;
+  sign = asuint64 (x) >> 63;
+  if (ia < asuint64 (0.5))
+    {
+      if (unlikely (ia < asuint64 (0x1p-27)))
+	/* acos(x) rounds to pi/2 - x.  */
+	return D.pio2_hi + (D.pio2_lo - x);
+      x2 = x * x;
+      hi = D.pio2_hi - x;
+      e = (D.pio2_hi - hi) - x;
+      return hi + (e + (D.pio2_lo - x * x2 * asin_poly (x2)));
+    }
+  if (unlikely (ia >= asuint64 (1.0)))
+    {
+      if (ia == asuint64 (1.0))
+	/* acos(1) = 0 exactly, acos(-1) = pi with inexact.  */
+	return sign ? D.pi_hi + D.pi_lo : 0.0;
+      return __math_invalid (x);
+    }
+  ax = asdouble (ia);
+  s = asin_sqrt_inline (ax, &lo);
+  if (!sign)
+    return 2.0 * s + 2.0 * lo;
+  hi = D.pi_hi - 2.0 * s;
+  e = (D.pi_hi - hi) - 2.0 * s;
+  return hi + (e + (D.pi_lo - 2.0 * lo));
+}
+#endif
@@ -0,0 +1,58 @@
+/* Double-precision asin function.
+   Copyright (c) 2026 The newlib contributors.
+
+   Permission to use, copy, modify, and distribute this software
+   is freely granted, provided that this notice is preserved.  */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include <math.h>
+#include <stdint.h>
+#include "math_config.h"
+#include "asin_inline.h"
+
+#define D __asin_data
+
+/* Worst-case error is 0.67 ULP for |x| < 0.5 and 0.69 ULP above, where
+   asin(x) = pi/2 - 2 asin(sqrt((1-|x|)/2)) is summed in double-double
+   arithmetic.  */
+double
+asin (double x)
+{
+  uint64_t ia;
+  int sign;
+  /* double_t for better performance on targets with FLT_EVAL_METHOD==2.  */
+  double_t ax, s, lo, hi, e, y;
+
+  ia = asuint64 (x) & 0x7fffffffffffffff;
+  sign = asuint64 (x) >> 63;
+  if (ia < asuint64 (0.5))
+    {
+      if (unlikely (ia < asuint64 (0x1p-27)))
+	{
+	  /* Raise inexact, and underflow if x is subnormal.  */
+	  force_eval_double (ia < 0x0010000000000000 ? x / 0x1p120
+						     : x + 0x1p120);
+	  return x;
+	}
+      return x + x * (x * x) * asin_poly (x * x);
+    }
+  if (unlikely (ia >= asuint64 (1.0)))
+    {
+      if (ia == asuint64 (1.0))
+	{
+	  /* pi/2 rounded, with inexact.  */
+	  y = D.pio2_hi + D.pio2_lo;
+	  return sign ? -y : y;
+	}
+      return __math_invalid (x);
+    }
+  ax = asdouble (ia);
+  s = asin_sqrt_inline (ax, &lo);
+  hi = D.pio2_hi - 2.0 * s;
+  e = (D.pio2_hi - hi) - 2.0 * s;
+  y = hi + (e + (D.pio2_lo - 2.0 * lo));
+  return sign ? -y : y;
+}
+#endif
@@ -0,0 +1,36 @@
+/* Shared data between asin and acos.
+   Copyright (c) 2026 The newlib contributors.
+
+   Permission to use, copy, modify, and distribute this software
+   is freely granted, provided that this notice is preserved.  */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include "math_config.h"
+
+const struct asin_data __asin_data = {
+.pio2_hi = 0x1.921fb54442d18p+0,
+.pio2_lo = 0x1.1a62633145c07p-54,
+.pi_hi = 0x1.921fb54442d18p+1,
+.pi_lo = 0x1.1a62633145c07p-53,
+.poly = {
+// asin(x) ~= x + x^3 * poly(x^2)
+// relative error: 2^-57.4
+// in [-0.5, 0.5]
+0x1.5555555555556p-3,
+0x1.3333333332ecap-4,
+0x1.6db6db6e31f13p-5,
+0x1.f1c71c1db0623p-6,
+0x1.6e8bb1c8209a2p-6,
+0x1.1c4d35cf95421p-6,
+0x1.c9cf07674736ap-7,
+0x1.782651caa6547p-7,
+0x1.52420b04b37bep-7,
+0x1.65a9c4dfcf8b2p-8,
+0x1.1d189408314eep-6,
+-0x1.e6aaa8a0a04ccp-7,
+0x1.d72b2bc8155f8p-6,
+},
+};
+#endif
@@ -0,0 +1,52 @@
+/* Inline asin kernels shared by asin and acos.
+   Copyright (c) 2026 The newlib contributors.
+
+   Permission to use, copy, modify, and distribute this software
+   is freely granted, provided that this notice is preserved.  */
+
+#include <math.h>
+#include <stdint.h>
+#include "math_config.h"
+
+#define P __asin_data.poly
+
+/* asin(x) ~= x + x^3 P(x^2) for |x| <= 0.5, return P(z) with z = x^2.  */
+static inline double_t
+asin_poly (double_t z)
+{
+  double_t z2, z4, z8;
+
+  z2 = z * z;
+  z4 = z2 * z2;
+  z8 = z4 * z4;
+  return P[0] + z * P[1] + z2 * (P[2] + z * P[3])
+	 + z4 * (P[4] + z * P[5] + z2 * (P[6] + z * P[7]))
+	 + z8 * (P[8] + z * P[9] + z2 * (P[10] + z * P[11]) + z4 * P[12]);
+}
+
+/* For 0.5 <= ax < 1, asin(ax) = pi/2 - 2 asin(s) with s = sqrt((1-ax)/2).
+   Return s and set *LO so that s + *LO ~= asin(s).  The rounding error of
+   the square root is added back in, so the error of the sum is dominated
+   by the rounding of s * z * P(z).  */
+static inline double_t
+asin_sqrt_inline (double_t ax, double_t *lo)
+{
+  double_t z, s, res;
+
+  /* Exact.  */
+  z = 0.5 - 0.5 * ax;
+  s = sqrt (z);
+  /* z - s^2 exactly.  */
+#if HAVE_FAST_FMA
+  res = fma (-s, s, z);
+#else
+  {
+    double_t shi, slo;
+    shi = asdouble (asuint64 (s) & -1ULL << 27);
+    slo = s - shi;
+    res = z - shi * shi - 2.0 * shi * slo - slo * slo;
+  }
+#endif
+  *lo = res / (s + s) + s * z * asin_poly (z);
+  return s;
+}
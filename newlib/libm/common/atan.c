@@ -0,0 +1,67 @@
+/* Double-precision atan function.
+   Copyright (c) 2026 The newlib contributors.
+
+   Permission to use, copy, modify, and distribute this software
+   is freely granted, provided that this notice is preserved.  */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include <math.h>
+#include <stdint.h>
+#include "math_config.h"
+#include "atan_inline.h"
+
+/* atan(x) = atan(c) + atan((x - c)/(1 + x c)) with c the top bits of x
+   for 0x1p-6 <= |x| < 0x1.1p6, see atan_inline.h; the numerator is exact.
+   Above that atan(x) = pi/2 - atan(1/x), where the rounding error of 1/x
+   does not matter.  Only one division is needed in each case.  Worst-case
+   error is 0.55 ULP.  */
+double
+atan (double x)
+{
+  uint64_t ia;
+  uint32_t i;
+  int sign;
+  /* double_t for better performance on targets with FLT_EVAL_METHOD==2.  */
+  double_t ax, c, t, z, y;
+
+  ia = asuint64 (x) & 0x7fffffffffffffff;
+  sign = asuint64 (x) >> 63;
+  ax = asdouble (ia);
+  i = (ia >> (52 - ATAN_TABLE_BITS)) - (0x3f9 << ATAN_TABLE_BITS);
+  if (likely (i < ATAN_TABLE_SIZE))
+    {
+      c = asdouble ((ia & -1ULL << (52 - ATAN_TABLE_BITS))
+		    | 1ULL << (51 - ATAN_TABLE_BITS));
+      t = (ax - c) / (1.0 + ax * c);
+      y = __atan_data.tab[i].hi
+	  + (t + (__atan_data.tab[i].lo + atan_poly (t)));
+    }
+  else if (ia < asuint64 (0x1p-6))
+    {
+      if (unlikely (ia < asuint64 (0x1p-27)))
+	{
+	  /* Raise inexact, and underflow if x is subnormal.  */
+	  force_eval_double (ia < 0x0010000000000000 ? x / 0x1p120
+						     : x + 0x1p120);
+	  return x;
+	}
+      return x + atan_poly (x);
+    }
+  else
+    {
+      if (unlikely (ia >= asuint64 (0x1p54)))
+	{
+	  if (ia > asuint64 (INFINITY))
+	    return x + x;
+	  /* pi/2 rounded, with inexact.  */
+	  y = __atan_data.pio2_hi + __atan_data.pio2_lo;
+	  return sign ? -y : y;
+	}
+      z = 1.0 / ax;
+      y = __atan_data.pio2_hi + (__atan_data.pio2_lo - (z + atan_poly (z)));
+    }
+  return sign ? -y : y;
+}
+#endif
@@ -0,0 +1,103 @@
+/* Double-precision atan2 function.
+   Copyright (c) 2026 The newlib contributors.
+
+   Permission to use, copy, modify, and distribute this software
+   is freely granted, provided that this notice is preserved.  */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include <math.h>
+#include <stdint.h>
+#include "math_config.h"
+#include "atan_inline.h"
+
+#define D __atan_data
+
+/* atan2(y, x) = k +- atan(a/b) where a/b = min/max of |x| and |y| and k
+   is 0, pi/2 or pi depending on the octant; k is added in double-double
+   arithmetic.  Worst-case error is 0.55 ULP.  */
+double
+atan2 (double y, double x)
+{
+  uint64_t ix, iy;
+  uint32_t ex, ey;
+  int sx, sy, swap;
+  /* double_t for better performance on targets with FLT_EVAL_METHOD==2.  */
+  double_t a, b, hi, lo, khi, klo, s, e, r;
+
+  ix = asuint64 (x);
+  iy = asuint64 (y);
+  sx = ix >> 63;
+  sy = iy >> 63;
+  ix &= 0x7fffffffffffffff;
+  iy &= 0x7fffffffffffffff;
+  if (unlikely (ix > asuint64 (INFINITY) || iy > asuint64 (INFINITY)))
+    return x + y;
+  ex = ix >> 52;
+  ey = iy >> 52;
+  if (unlikely (ex == 0x7ff || ey == 0x7ff || ix == 0 || iy == 0))
+    {
+      if (iy == 0)
+	/* atan2(+-0, x>=+0) = +-0, atan2(+-0, x<=-0) = +-pi.  */
+	r = sx ? D.pi_hi + D.pi_lo : 0.0;
+      else if (ix == 0 || (ey == 0x7ff && ex != 0x7ff))
+	r = D.pio2_hi + D.pio2_lo;
+      else if (ey != 0x7ff)
+	/* x is +-inf, y is finite.  */
+	r = sx ? D.pi_hi + D.pi_lo : 0.0;
+      else
+	/* Both are infinite: +-pi/4 or +-3pi/4.  */
+	r = sx ? 0x1.2d97c7f3321d2p+1 : 0x1.921fb54442d18p-1;
+      return sy ? -r : r;
+    }
+
+  swap = iy > ix;
+  a = asdouble (swap ? ix : iy);
+  b = asdouble (swap ? iy : ix);
+  if (unlikely ((swap ? ey - ex : ex - ey) > 60))
+    {
+      /* a/b < 0x1p-59, atan(a/b) rounds to a/b.  */
+      if (swap)
+	r = D.pio2_hi + D.pio2_lo;
+      else if (sx)
+	r = D.pi_hi + D.pi_lo;
+      else
+	r = eval_as_double (a / b);
+      return sy ? -r : r;
+    }
+  if (unlikely ((swap ? ey : ex) - 0x07b >= 0x7e7 - 0x07b))
+    {
+      /* b < 0x1p-900 or b >= 0x1p1000: scale both, a is at most 60
+	 binades smaller so stays normal.  */
+      if (b < 1.0)
+	{
+	  a *= 0x1p600;
+	  b *= 0x1p600;
+	}
+      else
+	{
+	  a *= 0x1p-600;
+	  b *= 0x1p-600;
+	}
+    }
+  hi = atan_inline (a, b, &lo);
+  if (!swap && !sx)
+    r = hi + lo;
+  else
+    {
+      khi = swap ? D.pio2_hi : D.pi_hi;
+      klo = swap ? D.pio2_lo : D.pi_lo;
+      /* pi/2 + atan(a/b) when both swap and sx, otherwise k - atan.  */
+      if (!(swap && sx))
+	{
+	  hi = -hi;
+	  lo = -lo;
+	}
+      s = khi + hi;
+      e = (khi - s) + hi;
+      r = s + (e + (klo + lo));
+    }
+  return sy ? -r : r;
+}
+#endif
@@ -0,0 +1,223 @@
+/* Shared data between atan and atan2.
+   Copyright (c) 2026 The newlib contributors.
+
+   Permission to use, copy, modify, and distribute this software
+   is freely granted, provided that this notice is preserved.  */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include "math_config.h"
+
+const struct atan_data __atan_data = {
+.pio2_hi = 0x1.921fb54442d18p+0,
+.pio2_lo = 0x1.1a62633145c07p-54,
+.pi_hi = 0x1.921fb54442d18p+1,
+.pi_lo = 0x1.1a62633145c07p-53,
+.poly = {
+// atan(t) ~= t + t^3 * poly(t^2)
+// relative error: 2^-60.5
+// in [-0x1p-5, 0x1p-5]
+-0x1.555555555554ap-2,
+0x1.99999998dfb88p-3,
+-0x1.24923a9e77a75p-3,
+0x1.c662795501790p-4,
+},
+.tab = {
+// atan(c) as hi + lo, c in the comment
+{ 0x1.07fa26dbb46dbp-6, -0x1.d69b7cc286f51p-60 }, // 0x1.0800000000000p-6
+{ 0x1.17f905dacabecp-6, -0x1.ad1e891a14cf4p-60 }, // 0x1.1800000000000p-6
+{ 0x1.27f7c1df1e80cp-6, 0x1.b74a33a1b2e9ap-61 }, // 0x1.2800000000000p-6
+{ 0x1.37f658e9a2b38p-6, 0x1.d89d66c47fca2p-60 }, // 0x1.3800000000000p-6
+{ 0x1.47f4c8fb660b2p-6, 0x1.e62270f7c2d07p-60 }, // 0x1.4800000000000p-6
+{ 0x1.57f31015946e3p-6, -0x1.66101c3b5ddd9p-61 }, // 0x1.5800000000000p-6
+{ 0x1.67f12c3978735p-6, 0x1.7d37126c8ab1ep-60 }, // 0x1.6800000000000p-6
+{ 0x1.77ef1b687cdf3p-6, -0x1.d2f413c7eb9e0p-60 }, // 0x1.7800000000000p-6
+{ 0x1.87ecdba42e215p-6, -0x1.2d373627008afp-61 }, // 0x1.8800000000000p-6
+{ 0x1.97ea6aee3bd1ap-6, 0x1.e6e294c2ad53dp-60 }, // 0x1.9800000000000p-6
+{ 0x1.a7e7c7487a2d3p-6, -0x1.1e641e313f225p-60 }, // 0x1.a800000000000p-6
+{ 0x1.b7e4eeb4e3927p-6, 0x1.b4ceb31f0ccb6p-61 }, // 0x1.b800000000000p-6
+{ 0x1.c7e1df3599fe1p-6, -0x1.7f46672e87c88p-60 }, // 0x1.c800000000000p-6
+{ 0x1.d7de96cce8867p-6, -0x1.cf6a84a7669f0p-61 }, // 0x1.d800000000000p-6
+{ 0x1.e7db137d44d7cp-6, -0x1.57f2444070467p-62 }, // 0x1.e800000000000p-6
+{ 0x1.f7d7534950af3p-6, 0x1.3fc3d93c947a1p-62 }, // 0x1.f800000000000p-6
+{ 0x1.07e89e3abee7ep-5, -0x1.487ba8ef8f523p-62 }, // 0x1.0800000000000p-5
+{ 0x1.17e41b2bdeb61p-5, -0x1.ec808e6941860p-61 }, // 0x1.1800000000000p-5
+{ 0x1.27df0c70b94dfp-5, 0x1.edc1fc47f3298p-60 }, // 0x1.2800000000000p-5
+{ 0x1.37d96a1875a50p-5, 0x1.14630cae354c7p-59 }, // 0x1.3800000000000p-5
+{ 0x1.47d32c33f3cb4p-5, 0x1.a00db0726717dp-59 }, // 0x1.4800000000000p-5
+{ 0x1.57cc4ad5e46d1p-5, 0x1.af5b692e5208cp-59 }, // 0x1.5800000000000p-5
+{ 0x1.67c4be12e0476p-5, 0x1.edbefc2789435p-61 }, // 0x1.6800000000000p-5
+{ 0x1.77bc7e017f8dbp-5, -0x1.1b2746d8fa6a3p-60 }, // 0x1.7800000000000p-5
+{ 0x1.87b382ba71414p-5, 0x1.438cb47badbd9p-60 }, // 0x1.8800000000000p-5
+{ 0x1.97a9c4589278dp-5, -0x1.3a5d9acededc3p-59 }, // 0x1.9800000000000p-5
+{ 0x1.a79f3af90597cp-5, 0x1.fc19bde1816d2p-61 }, // 0x1.a800000000000p-5
+{ 0x1.b793debb49750p-5, 0x1.aad654cd739d1p-61 }, // 0x1.b800000000000p-5
+{ 0x1.c787a7c1506fdp-5, 0x1.993ff6d7d0532p-64 }, // 0x1.c800000000000p-5
+{ 0x1.d77a8e2f9772cp-5, -0x1.f361e817d1ba4p-62 }, // 0x1.d800000000000p-5
+{ 0x1.e76c8a2d3ce3cp-5, -0x1.dd1a3cdadc8b8p-59 }, // 0x1.e800000000000p-5
+{ 0x1.f75d93e417809p-5, 0x1.91c5384f38a8dp-59 }, // 0x1.f800000000000p-5
+{ 0x1.07a2a58a0c16fp-4, 0x1.286a0aa8fbfd2p-58 }, // 0x1.0800000000000p-4
+{ 0x1.1790a88aca931p-4, 0x1.c57fd08281008p-58 }, // 0x1.1800000000000p-4
+{ 0x1.277c80c02ec4dp-4, 0x1.869be03c4d7f0p-58 }, // 0x1.2800000000000p-4
+{ 0x1.37660f1a6b5d8p-4, 0x1.00c2bea115ef0p-58 }, // 0x1.3800000000000p-4
+{ 0x1.474d34a4bbb9dp-4, -0x1.0d3965910af34p-62 }, // 0x1.4800000000000p-4
+{ 0x1.5731d286c4ecbp-4, -0x1.e6e754b5c9fd0p-59 }, // 0x1.5800000000000p-4
+{ 0x1.6713ca05f38b3p-4, 0x1.8844be8e0089bp-61 }, // 0x1.6800000000000p-4
+{ 0x1.76f2fc86d613dp-4, -0x1.0517b6267cdb9p-59 }, // 0x1.7800000000000p-4
+{ 0x1.86cf4b8e73cbfp-4, -0x1.dcdd915cf736bp-58 }, // 0x1.8800000000000p-4
+{ 0x1.96a898c39fefbp-4, -0x1.1cfa6eef407cep-58 }, // 0x1.9800000000000p-4
+{ 0x1.a67ec5f04910ap-4, 0x1.9eda51bd12082p-58 }, // 0x1.a800000000000p-4
+{ 0x1.b651b502c480ap-4, -0x1.c46fc87331ba0p-58 }, // 0x1.b800000000000p-4
+{ 0x1.c621480f15a6ap-4, -0x1.cfccaa3f66870p-60 }, // 0x1.c800000000000p-4
+{ 0x1.d5ed6150311dcp-4, 0x1.eb3fd6855286cp-59 }, // 0x1.d800000000000p-4
+{ 0x1.e5b5e3293b7cfp-4, 0x1.d4aae80ff2fd5p-59 }, // 0x1.e800000000000p-4
+{ 0x1.f57ab026c3a90p-4, -0x1.c26c3afc8b17ap-59 }, // 0x1.f800000000000p-4
+{ 0x1.068d584212b3ep-3, -0x1.9e2d283019bfdp-57 }, // 0x1.0800000000000p-3
+{ 0x1.1646541060850p-3, 0x1.6bcee8ae7ea92p-57 }, // 0x1.1800000000000p-3
+{ 0x1.25f6e171a535cp-3, 0x1.7c6d7bde1a310p-57 }, // 0x1.2800000000000p-3
+{ 0x1.359e8edeb99a4p-3, -0x1.a5fd74e4604c6p-57 }, // 0x1.3800000000000p-3
+{ 0x1.453cec6092a9ep-3, 0x1.1f653b3a5a78bp-57 }, // 0x1.4800000000000p-3
+{ 0x1.54d18ba11570ap-3, 0x1.18282f2884073p-57 }, // 0x1.5800000000000p-3
+{ 0x1.645bfffb3aa74p-3, -0x1.f536b677c2cb4p-60 }, // 0x1.6800000000000p-3
+{ 0x1.73dbde8a7d202p-3, -0x1.5ad0f6d4a665dp-58 }, // 0x1.7800000000000p-3
+{ 0x1.8350be398ebc8p-3, -0x1.5a91332b9c90dp-58 }, // 0x1.8800000000000p-3
+{ 0x1.92ba37d050272p-3, -0x1.0d3ded0ff4764p-57 }, // 0x1.9800000000000p-3
+{ 0x1.a217e601081a6p-3, -0x1.0def8a60af374p-57 }, // 0x1.a800000000000p-3
+{ 0x1.b1696574d780cp-3, -0x1.85ab8fc15a673p-58 }, // 0x1.b800000000000p-3
+{ 0x1.c0ae54d768467p-3, -0x1.04cdbf55f26dcp-57 }, // 0x1.c800000000000p-3
+{ 0x1.cfe654e1d5395p-3, 0x1.47b9a3f71eafbp-57 }, // 0x1.d800000000000p-3
+{ 0x1.df110864c9d9ep-3, -0x1.5818b53bf4781p-60 }, // 0x1.e800000000000p-3
+{ 0x1.ee2e1451d980dp-3, -0x1.9a7708c46ba91p-58 }, // 0x1.f800000000000p-3
+{ 0x1.025fa510665b6p-2, -0x1.672df6832fa48p-56 }, // 0x1.0800000000000p-2
+{ 0x1.1151a362431cap-2, -0x1.4dc8dc9077b9fp-56 }, // 0x1.1800000000000p-2
+{ 0x1.2025567e47c96p-2, -0x1.1832328f4290ep-57 }, // 0x1.2800000000000p-2
+{ 0x1.2ed987a823cfep-2, 0x1.b91258ea012cap-57 }, // 0x1.3800000000000p-2
+{ 0x1.3d6d129271134p-2, 0x1.137ca41cc958ap-56 }, // 0x1.4800000000000p-2
+{ 0x1.4bdee586890e7p-2, -0x1.e4dc77c22a757p-57 }, // 0x1.5800000000000p-2
+{ 0x1.5a2e0175e0f4ep-2, 0x1.13b7a8f82e457p-56 }, // 0x1.6800000000000p-2
+{ 0x1.685979f5fa6fep-2, -0x1.257814d1ada9cp-59 }, // 0x1.7800000000000p-2
+{ 0x1.7660752817502p-2, -0x1.dd11791cc7600p-59 }, // 0x1.8800000000000p-2
+{ 0x1.84422b8df95d7p-2, 0x1.d76a0299b41b6p-56 }, // 0x1.9800000000000p-2
+{ 0x1.91fde7cd0c662p-2, 0x1.1074188054b53p-56 }, // 0x1.a800000000000p-2
+{ 0x1.9f93066168002p-2, -0x1.c827047c9439ap-56 }, // 0x1.b800000000000p-2
+{ 0x1.ad00f5422058bp-2, 0x1.fc4c33891d2e8p-56 }, // 0x1.c800000000000p-2
+{ 0x1.ba473378624a5p-2, 0x1.519a1b46e4affp-56 }, // 0x1.d800000000000p-2
+{ 0x1.c76550aad71f9p-2, -0x1.74b8bff7043e4p-56 }, // 0x1.e800000000000p-2
+{ 0x1.d45aec9ec862bp-2, 0x1.89421163ef92dp-57 }, // 0x1.f800000000000p-2
+{ 0x1.e77eb7f175a34p-2, 0x1.0e53dc1bf3435p-56 }, // 0x1.0800000000000p-1
+{ 0x1.0039c73c1a40cp-1, -0x1.b32c949c9d593p-55 }, // 0x1.1800000000000p-1
+{ 0x1.0c6145b5b43dap-1, 0x1.974fa13b5404fp-58 }, // 0x1.2800000000000p-1
+{ 0x1.1835a88be7c13p-1, 0x1.c621cec00c301p-55 }, // 0x1.3800000000000p-1
+{ 0x1.23b71e2cc9e6ap-1, 0x1.c421c9f38224ep-57 }, // 0x1.4800000000000p-1
+{ 0x1.2ee628406cbcap-1, 0x1.c5d5e9ff0cf8dp-55 }, // 0x1.5800000000000p-1
+{ 0x1.39c391cd4171ap-1, -0x1.2304331d8bf46p-55 }, // 0x1.6800000000000p-1
+{ 0x1.445065b795b56p-1, -0x1.f76d0163f79c8p-56 }, // 0x1.7800000000000p-1
+{ 0x1.4e8de5bb6ec04p-1, 0x1.4a33dbeb3796cp-55 }, // 0x1.8800000000000p-1
+{ 0x1.587d81f732fbbp-1, -0x1.5e5c9d8c5a950p-56 }, // 0x1.9800000000000p-1
+{ 0x1.6220d115d7b8ep-1, -0x1.2b785350ee8c1p-57 }, // 0x1.a800000000000p-1
+{ 0x1.6b798920b3d99p-1, -0x1.a80386188c50ep-55 }, // 0x1.b800000000000p-1
+{ 0x1.748978fba8e0fp-1, 0x1.7b2a6165884a1p-59 }, // 0x1.c800000000000p-1
+{ 0x1.7d528289fa093p-1, 0x1.560821e2f3aa9p-55 }, // 0x1.d800000000000p-1
+{ 0x1.85d69576cc2c5p-1, 0x1.6b66e7fc8b8c3p-57 }, // 0x1.e800000000000p-1
+{ 0x1.8e17aa99cc05ep-1, -0x1.ec182ab042f61p-56 }, // 0x1.f800000000000p-1
+{ 0x1.9a000a935bd8ep-1, 0x1.59411df0dccefp-56 }, // 0x1.0800000000000p+0
+{ 0x1.a908afa5b1d4ap-1, -0x1.5d7be5d5f808bp-56 }, // 0x1.1800000000000p+0
+{ 0x1.b7291b4e25bdap-1, -0x1.c49cc26e63660p-56 }, // 0x1.2800000000000p+0
+{ 0x1.c470abf2d3d01p-1, 0x1.6a61dbf199479p-56 }, // 0x1.3800000000000p+0
+{ 0x1.d0ee2253886a6p-1, 0x1.2c9f73793ddedp-55 }, // 0x1.4800000000000p+0
+{ 0x1.dcaf82dc1a6f4p-1, -0x1.f99cb3ddd4790p-55 }, // 0x1.5800000000000p+0
+{ 0x1.e7c2042350f87p-1, -0x1.0e14d8d5a7dd8p-57 }, // 0x1.6800000000000p+0
+{ 0x1.f232073aeb172p-1, -0x1.5f5b3a2cdfc2cp-55 }, // 0x1.7800000000000p+0
+{ 0x1.fc0b171ec926cp-1, -0x1.3337369af334fp-58 }, // 0x1.8800000000000p+0
+{ 0x1.02abf692f6d0cp+0, -0x1.7e03a29351e05p-54 }, // 0x1.9800000000000p+0
+{ 0x1.07113c6a93a21p+0, 0x1.c2bc4d3a3e69fp-56 }, // 0x1.a800000000000p+0
+{ 0x1.0b39f4eca23aep+0, 0x1.25934545c016cp-54 }, // 0x1.b800000000000p+0
+{ 0x1.0f2a5d9fff026p+0, 0x1.e6ac2e9161719p-55 }, // 0x1.c800000000000p+0
+{ 0x1.12e65fa32aaedp+0, -0x1.f25b08b14d8d6p-54 }, // 0x1.d800000000000p+0
+{ 0x1.167195a203265p+0, 0x1.1a5aca105c6aep-54 }, // 0x1.e800000000000p+0
+{ 0x1.19cf51b0603ddp+0, -0x1.4b79cf12e503dp-55 }, // 0x1.f800000000000p+0
+{ 0x1.1e8d473c5d5cap+0, 0x1.40b5b2505c143p-54 }, // 0x1.0800000000000p+1
+{ 0x1.245b4faf23111p+0, -0x1.bcadba0fe318bp-54 }, // 0x1.1800000000000p+1
+{ 0x1.29a33f97bdbeap+0, 0x1.20768f82d028dp-54 }, // 0x1.2800000000000p+1
+{ 0x1.2e75728833a54p+0, 0x1.16e3ef7326bdap-56 }, // 0x1.3800000000000p+1
+{ 0x1.32dfe01c11c21p+0, 0x1.cb1af39d75eb5p-54 }, // 0x1.4800000000000p+1
+{ 0x1.36ee7f2a24644p+0, -0x1.2c820975621fbp-54 }, // 0x1.5800000000000p+1
+{ 0x1.3aab98641f26bp+0, -0x1.dc349cc175bc7p-55 }, // 0x1.6800000000000p+1
+{ 0x1.3e200aea00d99p+0, -0x1.4794dda3dc8fbp-54 }, // 0x1.7800000000000p+1
+{ 0x1.41538521b2f98p+0, 0x1.b0a24edb2ee98p-57 }, // 0x1.8800000000000p+1
+{ 0x1.444cb3d7d780cp+0, 0x1.84edbdae1963fp-54 }, // 0x1.9800000000000p+1
+{ 0x1.4711695fedde2p+0, -0x1.369e22089162cp-55 }, // 0x1.a800000000000p+1
+{ 0x1.49a6be20c3a52p+0, 0x1.61f86cbdae1abp-54 }, // 0x1.b800000000000p+1
+{ 0x1.4c112bb9f7c63p+0, 0x1.f746650006c33p-57 }, // 0x1.c800000000000p+1
+{ 0x1.4e54a3b8e6cf8p+0, -0x1.546673bfb75f0p-55 }, // 0x1.d800000000000p+1
+{ 0x1.5074a2a612ac3p+0, -0x1.70b6f0046b390p-55 }, // 0x1.e800000000000p+1
+{ 0x1.5274400eea72bp+0, -0x1.c8ca264844338p-54 }, // 0x1.f800000000000p+1
+{ 0x1.553ce48a04765p+0, -0x1.fb2a15b01af76p-55 }, // 0x1.0800000000000p+2
+{ 0x1.58990974dfc9bp+0, -0x1.38724877fdf56p-54 }, // 0x1.1800000000000p+2
+{ 0x1.5b9c9494c0d73p+0, -0x1.dbb3cb11f72aep-56 }, // 0x1.2800000000000p+2
+{ 0x1.5e545b9b1a4c8p+0, -0x1.b1f8afb3dd31dp-54 }, // 0x1.3800000000000p+2
+{ 0x1.60cadf03e444dp+0, -0x1.1cafc7209e76bp-54 }, // 0x1.4800000000000p+2
+{ 0x1.6308ca2a1ee29p+0, 0x1.69afbaa88c2dcp-55 }, // 0x1.5800000000000p+2
+{ 0x1.6515542adf35bp+0, 0x1.1abca6117c655p-54 }, // 0x1.6800000000000p+2
+{ 0x1.66f689fe6ecd7p+0, 0x1.296b3ad3ab6dap-56 }, // 0x1.7800000000000p+2
+{ 0x1.68b187b9d2c61p+0, -0x1.e65414ed76ae6p-54 }, // 0x1.8800000000000p+2
+{ 0x1.6a4aa53aac449p+0, -0x1.4371a18cdc2a7p-55 }, // 0x1.9800000000000p+2
+{ 0x1.6bc59952bf3b1p+0, 0x1.977d7c13d209cp-56 }, // 0x1.a800000000000p+2
+{ 0x1.6d2595b4f5943p+0, 0x1.6d3e45139467ep-54 }, // 0x1.b800000000000p+2
+{ 0x1.6e6d5d4f4d24bp+0, 0x1.bc3dadd1ee93fp-58 }, // 0x1.c800000000000p+2
+{ 0x1.6f9f5650fd3efp+0, 0x1.9b070ed3f43e4p-54 }, // 0x1.d800000000000p+2
+{ 0x1.70bd98cd96433p+0, 0x1.a965f981024a8p-58 }, // 0x1.e800000000000p+2
+{ 0x1.71c9fab4414b2p+0, 0x1.ed22abd9c91bcp-54 }, // 0x1.f800000000000p+2
+{ 0x1.733e83ec95ff3p+0, 0x1.daa1cb741b5afp-54 }, // 0x1.0800000000000p+3
+{ 0x1.74fe3c2f08578p+0, -0x1.85702971de777p-55 }, // 0x1.1800000000000p+3
+{ 0x1.768e250aec6fcp+0, 0x1.7d3c945f7481bp-55 }, // 0x1.2800000000000p+3
+{ 0x1.77f57d148f11cp+0, -0x1.2113a4a1ff42dp-56 }, // 0x1.3800000000000p+3
+{ 0x1.793a1f5a56d14p+0, -0x1.436a317c1ec50p-54 }, // 0x1.4800000000000p+3
+{ 0x1.7a60d4728e3dap+0, -0x1.3ccc36faf1683p-54 }, // 0x1.5800000000000p+3
+{ 0x1.7b6d8e630ad5ep+0, 0x1.8a1b0e4f4fe5bp-55 }, // 0x1.6800000000000p+3
+{ 0x1.7c63958a05d02p+0, -0x1.47cce616ff378p-54 }, // 0x1.7800000000000p+3
+{ 0x1.7d45aab9c6633p+0, -0x1.8eca10bf2b832p-54 }, // 0x1.8800000000000p+3
+{ 0x1.7e16216f80625p+0, 0x1.df2f346b6593dp-56 }, // 0x1.9800000000000p+3
+{ 0x1.7ed6f431b596fp+0, -0x1.cc4ff0c22192ep-57 }, // 0x1.a800000000000p+3
+{ 0x1.7f89d48cc7f43p+0, 0x1.eb24ac99c7f13p-56 }, // 0x1.b800000000000p+3
+{ 0x1.803037bd17135p+0, -0x1.d61a03be8ededp-54 }, // 0x1.c800000000000p+3
+{ 0x1.80cb60cd9f7edp+0, -0x1.e3611150d62acp-54 }, // 0x1.d800000000000p+3
+{ 0x1.815c68beac681p+0, 0x1.733b941c0a1c0p-54 }, // 0x1.e800000000000p+3
+{ 0x1.81e445233973dp+0, -0x1.5943116be80adp-55 }, // 0x1.f800000000000p+3
+{ 0x1.82a0ae7eef9ffp+0, 0x1.a66d9699385eap-56 }, // 0x1.0800000000000p+4
+{ 0x1.8382dca698943p+0, -0x1.7059a8c1fe6b2p-54 }, // 0x1.1800000000000p+4
+{ 0x1.844caa6e36176p+0, -0x1.b87e5ac7e2cd4p-55 }, // 0x1.2800000000000p+4
+{ 0x1.8501d43dec744p+0, -0x1.978349c4bab71p-54 }, // 0x1.3800000000000p+4
+{ 0x1.85a55cb2f0384p+0, 0x1.f0fb0a6f20ff2p-55 }, // 0x1.4800000000000p+4
+{ 0x1.8639b79e21172p+0, 0x1.e89b524089f11p-54 }, // 0x1.5800000000000p+4
+{ 0x1.86c0e99b54aa8p+0, 0x1.0fdfd986dcdbdp-54 }, // 0x1.6800000000000p+4
+{ 0x1.873c9fa1e3b82p+0, 0x1.1e6af79236efbp-54 }, // 0x1.7800000000000p+4
+{ 0x1.87ae40d675cb3p+0, 0x1.d61a71dadc304p-54 }, // 0x1.8800000000000p+4
+{ 0x1.8816fc2fd657ap+0, 0x1.890d9a056105ep-54 }, // 0x1.9800000000000p+4
+{ 0x1.8877d307f1995p+0, -0x1.ee5d82c86da8dp-54 }, // 0x1.a800000000000p+4
+{ 0x1.88d1a160b268fp+0, -0x1.a7444820f31c2p-55 }, // 0x1.b800000000000p+4
+{ 0x1.8925246ca8b4cp+0, 0x1.1373d282bba8bp-54 }, // 0x1.c800000000000p+4
+{ 0x1.8972ffc482372p+0, -0x1.b05c71dab7260p-56 }, // 0x1.d800000000000p+4
+{ 0x1.89bbc196ec7fep+0, 0x1.c232ab696e88fp-54 }, // 0x1.e800000000000p+4
+{ 0x1.89ffe60cd476ep+0, -0x1.f3ca250b7d564p-55 }, // 0x1.f800000000000p+4
+{ 0x1.8a5e605023121p+0, 0x1.d8fd1b8c0ba6ap-54 }, // 0x1.0800000000000p+5
+{ 0x1.8acfc29bfd496p+0, 0x1.ab90a256eee99p-54 }, // 0x1.1800000000000p+5
+{ 0x1.8b34e55aadb0bp+0, 0x1.363eeb95499bap-55 }, // 0x1.2800000000000p+5
+{ 0x1.8b8faa7b0a723p+0, 0x1.16810fed9dc02p-55 }, // 0x1.3800000000000p+5
+{ 0x1.8be195fd5d56cp+0, -0x1.59cf0623e9060p-61 }, // 0x1.4800000000000p+5
+{ 0x1.8c2be3c4b60d8p+0, 0x1.515de92ddf0a4p-55 }, // 0x1.5800000000000p+5
+{ 0x1.8c6f9798d1971p+0, 0x1.32642664559e2p-54 }, // 0x1.6800000000000p+5
+{ 0x1.8cad891303322p+0, -0x1.ea07cc8a6828ep-54 }, // 0x1.7800000000000p+5
+{ 0x1.8ce66ca04c5b0p+0, -0x1.97335c3967b63p-54 }, // 0x1.8800000000000p+5
+{ 0x1.8d1ada6566ed2p+0, -0x1.58febcbef293ap-57 }, // 0x1.9800000000000p+5
+{ 0x1.8d4b5393c8053p+0, -0x1.e740e340636f9p-57 }, // 0x1.a800000000000p+5
+{ 0x1.8d7846951342fp+0, -0x1.e134d10f18b09p-55 }, // 0x1.b800000000000p+5
+{ 0x1.8da21256028f4p+0, -0x1.b8321f8acd947p-54 }, // 0x1.c800000000000p+5
+{ 0x1.8dc908e5fe989p+0, -0x1.05df57376e4d1p-54 }, // 0x1.d800000000000p+5
+{ 0x1.8ded7192b0f61p+0, 0x1.e21b0f53af0e4p-59 }, // 0x1.e800000000000p+5
+{ 0x1.8e0f8a9ce0f88p+0, -0x1.daba15818f0a1p-58 }, // 0x1.f800000000000p+5
+{ 0x1.8e3ed07941909p+0, -0x1.cb2907c7f8595p-54 }, // 0x1.0800000000000p+6
+},
+};
+#endif
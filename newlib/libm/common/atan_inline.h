@@ -0,0 +1,82 @@
+/* Inline atan kernel shared by atan and atan2.
+   Copyright (c) 2026 The newlib contributors.
+
+   Permission to use, copy, modify, and distribute this software
+   is freely granted, provided that this notice is preserved.  */
+
+#include <math.h>
+#include <stdint.h>
+#include "math_config.h"
+
+#define P __atan_data.poly
+
+/* atan(t) - t for |t| <= 0x1p-5.  */
+static inline double_t
+atan_poly (double_t t)
+{
+  double_t t2, t4;
+
+  t2 = t * t;
+  t4 = t2 * t2;
+  return t * t2 * (P[0] + t2 * P[1] + t4 * (P[2] + t2 * P[3]));
+}
+
+/* a - t b exactly, for t ~= a/b.  */
+static inline double_t
+atan_residual (double_t a, double_t t, double_t b)
+{
+#if HAVE_FAST_FMA
+  return fma (-t, b, a);
+#else
+  double_t thi, tlo, bhi, blo;
+
+  thi = asdouble (asuint64 (t) & -1ULL << 27);
+  tlo = t - thi;
+  bhi = asdouble (asuint64 (b) & -1ULL << 27);
+  blo = b - bhi;
+  return a - thi * bhi - thi * blo - tlo * bhi - tlo * blo;
+#endif
+}
+
+/* atan(a/b) ~= hi + *LO for 0 <= a <= b, b normal and below 0x1p1000.
+   z = a/b is looked up in a table of atan(c) with c the top bits of z, and
+   atan(z) = atan(c) + atan((a - c b)/(b + c a)).  c has only 6 significant
+   bits so the numerator is computed without cancellation, and the
+   remaining argument is below 0x1p-5 for the polynomial.  Below 0x1p-6
+   the polynomial is applied to z directly.  */
+static inline double_t
+atan_inline (double_t a, double_t b, double_t *lo)
+{
+  double_t z, c, t, tl, p, bhi, blo, hi;
+  uint64_t iz;
+  uint32_t i;
+
+  z = a / b;
+  iz = asuint64 (z);
+  i = (iz >> (52 - ATAN_TABLE_BITS)) - (0x3f9 << ATAN_TABLE_BITS);
+  if (likely (i < ATAN_TABLE_SIZE))
+    {
+      c = asdouble ((iz & -1ULL << (52 - ATAN_TABLE_BITS))
+		    | 1ULL << (51 - ATAN_TABLE_BITS));
+      bhi = asdouble (asuint64 (b) & -1ULL << 27);
+      blo = b - bhi;
+      /* a - c bhi is exact and c blo is exact.  */
+      t = (a - c * bhi - c * blo) / (b + c * a);
+      hi = __atan_data.tab[i].hi;
+      tl = __atan_data.tab[i].lo;
+    }
+  else
+    {
+      t = z;
+      hi = 0;
+      tl = atan_residual (a, z, b) / b;
+    }
+  p = atan_poly (t);
+  if (hi == 0)
+    {
+      *lo = tl + p;
+      return t;
+    }
+  *lo = t + (tl + p);
+  return hi;
+}
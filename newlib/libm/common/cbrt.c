@@ -0,0 +1,61 @@
+/* Double-precision cube root function.
+   Copyright (c) 2026 The newlib contributors.
+
+   Permission to use, copy, modify, and distribute this software
+   is freely granted, provided that this notice is preserved.  */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include <math.h>
+#include <stdint.h>
+#include "math_config.h"
+
+#define C __cbrt_data.poly
+#define T __cbrt_data.scale
+
+/* x = m 2^r 2^3q with m in [1, 2) and r in {0, 1, 2}.  cbrt(m) is
+   approximated by a polynomial to 19 bits, scaled by cbrt(2^r) and rounded
+   to 17 bits so that its cube y0^3 is exact.  Then with
+   eps = (y0^3 - m 2^r) / y0^3,
+   cbrt(m 2^r) = y0 (1 - eps)^(1/3) ~= y0 - y0 eps (1/3 + eps/9 + 5/81 eps^2)
+   where the neglected terms are below 2^-70.  Worst-case error is
+   0.51 ULP.  */
+double
+cbrt (double x)
+{
+  uint64_t ix, sign;
+  uint32_t e, q, r;
+  /* double_t for better performance on targets with FLT_EVAL_METHOD==2.  */
+  double_t m, m2, xs, p, y0, y3, eps, y;
+
+  ix = asuint64 (x);
+  sign = ix & 0x8000000000000000;
+  ix &= 0x7fffffffffffffff;
+  e = ix >> 52;
+  if (unlikely (e - 1 >= 0x7ff - 1))
+    {
+      /* 0, inf or nan.  */
+      if (ix == 0 || e == 0x7ff)
+	return x + x;
+      /* x is subnormal, normalize it.  */
+      ix = asuint64 (asdouble (ix) * 0x1p54);
+      e = (ix >> 52) - 54;
+    }
+  /* e + 2046 = 3q + r with q the biased exponent of the result.  */
+  q = (e + 2046) / 3;
+  r = (e + 2046) - 3 * q;
+  m = asdouble ((ix & 0x000fffffffffffff) | 0x3ff0000000000000);
+  xs = m * (double) (1 << r);
+
+  m2 = m * m;
+  p = C[0] + m * C[1] + m2 * (C[2] + m * C[3]) + m2 * m2 * (C[4] + m * C[5]);
+  y0 = p * T[r];
+  y0 = asdouble ((asuint64 (y0) + (1ULL << 35)) & -(1ULL << 36));
+  y3 = y0 * y0 * y0;
+  eps = (y3 - xs) / y3;
+  y = y0 - y0 * eps * (0x1.5555555555555p-2
+		       + eps * (0x1.c71c71c71c71cp-4 + eps * 0x1.f9add3c0ca458p-5));
+  return asdouble (sign | asuint64 (y * asdouble ((uint64_t) q << 52)));
+}
+#endif
@@ -0,0 +1,26 @@
+/* Data for cbrt.
+   Copyright (c) 2026 The newlib contributors.
+
+   Permission to use, copy, modify, and distribute this software
+   is freely granted, provided that this notice is preserved.  */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include "math_config.h"
+
+const struct cbrt_data __cbrt_data = {
+.poly = {
+// cbrt(x) ~= poly(x)
+// relative error: 2^-19.1
+// in [1, 2]
+0x1.e68ceb1fc3429p-2,
+0x1.a9da3cc66f245p-1,
+-0x1.d758498b983bcp-2,
+0x1.92bfc00e33108p-3,
+-0x1.8bd2dce403128p-5,
+0x1.4c7608a04eba1p-8,
+},
+.scale = { 1.0, 0x1.428a2f98d728bp+0, 0x1.965fea53d6e3dp+0 },
+};
+#endif
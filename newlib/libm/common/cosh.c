@@ -0,0 +1,51 @@
+/* Double-precision hyperbolic cosine function.
+   Copyright (c) 2026 The newlib contributors.
+
+   Permission to use, copy, modify, and distribute this software
+   is freely granted, provided that this notice is preserved.  */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include <math.h>
+#include <stdint.h>
+#include "math_config.h"
+#include "exp_inline.h"
+
+/* cosh(x) = (e^x + e^-x)/2 with both exponentials sharing one reduction,
+   see sinh.c.  The worst-case error is 0.52 ULP.  */
+double
+cosh (double x)
+{
+  uint32_t abstop;
+  uint64_t ki;
+  /* double_t for better performance on targets with FLT_EVAL_METHOD==2.  */
+  double_t ax, r, r2, s, t, s2, t2, e, a, b, hi, lo;
+
+  abstop = top12 (x) & 0x7ff;
+  ax = fabs (x);
+  if (unlikely (abstop < top12 (0x1p-26)))
+    /* cosh(x) = 1 + x^2/2 rounds to 1, raise inexact unless x is 0.  */
+    return 1.0 + ax * ax;
+  if (unlikely (abstop >= top12 (0x1p5)))
+    {
+      if (abstop >= top12 (INFINITY))
+	return x * x;
+      if (ax > 0x1.633ce8fb9f87dp+9)
+	return __math_oflow (0);
+      return exp_half_inline (ax);
+    }
+
+  ki = exp_reduce (ax, &r);
+  s = exp_scale (ki, &t);
+  s2 = exp_scale (-ki, &t2);
+  r2 = r * r;
+  /* e^r + e^-r - 2 ~= 2e, the odd terms cancel.  */
+  e = r2 * (EXP_C2 + r2 * EXP_C4);
+  a = s * (t + e + r + r * r2 * (EXP_C3 + r2 * EXP_C5));
+  b = s2 * (t2 + e - r - r * r2 * (EXP_C3 + r2 * EXP_C5));
+  hi = s + s2;
+  lo = (s - hi) + s2;
+  return 0.5 * (hi + (lo + (a + b)));
+}
+#endif
@@ -0,0 +1,99 @@
+/* Double-precision erf function.
+   Copyright (c) 2026 The newlib contributors.
+
+   Permission to use, copy, modify, and distribute this software
+   is freely granted, provided that this notice is preserved.  */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include <math.h>
+#include <stdint.h>
+#include "math_config.h"
+
+#define C __erf_data.poly
+#define T __erf_data.tab
+
+/* a b as hi + *LO exactly.  */
+static inline double_t
+mul_exact (double_t a, double_t b, double_t *lo)
+{
+  double_t hi;
+
+  hi = a * b;
+#if HAVE_FAST_FMA
+  *lo = fma (a, b, -hi);
+#else
+  {
+    double_t ahi, alo, bhi, blo;
+    ahi = asdouble (asuint64 (a) & -1ULL << 27);
+    alo = a - ahi;
+    bhi = asdouble (asuint64 (b) & -1ULL << 27);
+    blo = b - bhi;
+    *lo = ahi * bhi - hi + ahi * blo + alo * bhi + alo * blo;
+  }
+#endif
+  return hi;
+}
+
+/* erf(x) = x + x Q(x^2) for |x| < 0.5.  Above that, up to 6 where erf
+   rounds to +-1, the interval is split in steps of 1/4 around the centers
+   c = 0.625 + i/4 and erf(c + d) = erf(c) + d P(d) with erf(c) in
+   double-double.  No exp or division is needed, unlike s_erf.c.  In both
+   cases the leading term of the polynomial times the argument is added
+   exactly (the leading coefficient of Q in double-double).  Worst-case
+   error is 0.80 ULP below 0.5, from the rounding of x^3 Q(x^2) - x Q(0),
+   and 0.56 ULP above.  */
+double
+erf (double x)
+{
+  uint64_t ia;
+  int sign, i;
+  /* double_t for better performance on targets with FLT_EVAL_METHOD==2.  */
+  double_t ax, z, z2, z4, z8, d, d2, d4, d8, p, hi, lo, s, e, y;
+  const double *P;
+
+  ia = asuint64 (x) & 0x7fffffffffffffff;
+  sign = asuint64 (x) >> 63;
+  if (ia < asuint64 (0.5))
+    {
+      if (unlikely (ia < asuint64 (0x1p-28)))
+	/* erf(x) rounds to x (1 + C[0]), which is 2/sqrt(pi) x.  */
+	return x + C[0] * x;
+      z = x * x;
+      z2 = z * z;
+      z4 = z2 * z2;
+      z8 = z4 * z4;
+      p = C[1] + z * C[2] + z2 * (C[3] + z * C[4])
+	  + z4 * (C[5] + z * C[6] + z2 * (C[7] + z * C[8])) + z8 * C[9];
+      hi = mul_exact (C[0], x, &lo);
+      s = x + hi;
+      e = (x - s) + hi;
+      return s + (e + (lo + x * (__erf_data.poly0_lo + z * p)));
+    }
+  if (unlikely (ia >= asuint64 (6.0)))
+    {
+      if (ia > asuint64 (INFINITY))
+	return x + x;
+      /* +-1 with inexact, except for +-inf.  */
+      y = ia == asuint64 (INFINITY) ? 1.0 : 1.0 - opt_barrier_double (0x1p-1000);
+      return sign ? -y : y;
+    }
+  ax = asdouble (ia);
+  /* 0.5 <= ax < 6 so i is in [0, ERF_TABLE_SIZE), and d is exact.  */
+  i = (int) (4.0 * ax - 2.0);
+  d = ax - (0.625 + 0.25 * i);
+  P = T[i].poly;
+  d2 = d * d;
+  d4 = d2 * d2;
+  d8 = d4 * d4;
+  p = P[1] + d * P[2] + d2 * (P[3] + d * P[4])
+      + d4 * (P[5] + d * P[6] + d2 * (P[7] + d * P[8]))
+      + d8 * (P[9] + d * P[10] + d2 * P[11]);
+  hi = mul_exact (P[0], d, &lo);
+  s = T[i].hi + hi;
+  e = (T[i].hi - s) + hi;
+  y = s + (e + (T[i].lo + lo + d2 * p));
+  return sign ? -y : y;
+}
+#endif
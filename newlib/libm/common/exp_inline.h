@@ -0,0 +1,122 @@
+/* Inline exp kernels shared by expm1, sinh, cosh and tanh, derived from
+   exp.c of Arm's optimized-routines.
+   Copyright (c) 2018 Arm Ltd.  All rights reserved.
+   Copyright (c) 2026 The newlib contributors.
+
+   SPDX-License-Identifier: BSD-3-Clause
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+   3. The name of the company may not be used to endorse or promote
+      products derived from this software without specific prior written
+      permission.
+
+   THIS SOFTWARE IS PROVIDED BY ARM LTD ``AS IS'' AND ANY EXPRESS OR IMPLIED
+   WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+   MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+   IN NO EVENT SHALL ARM LTD BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+   TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. */
+
+/* These use the exp table and polynomial (see exp.c) for the arguments
+   where the result is not close to 0; small arguments are handled by the
+   callers with polynomials from __expm1_data.  */
+
+#include <math.h>
+#include <stdint.h>
+#include "math_config.h"
+
+#define EXP_N (1 << EXP_TABLE_BITS)
+#define EXP_C2 __exp_data.poly[5 - EXP_POLY_ORDER]
+#define EXP_C3 __exp_data.poly[6 - EXP_POLY_ORDER]
+#define EXP_C4 __exp_data.poly[7 - EXP_POLY_ORDER]
+#define EXP_C5 __exp_data.poly[8 - EXP_POLY_ORDER]
+
+/* Top 12 bits of a double (sign and exponent bits).  */
+static inline uint32_t
+top12 (double x)
+{
+  return asuint64 (x) >> 52;
+}
+
+/* x = k ln2/N + r with |r| <= ln2/2N (ln2/N in non-nearest rounding
+   modes).  Return k, its low bits are enough for exp_scale.  */
+static inline uint64_t
+exp_reduce (double_t x, double_t *r)
+{
+  double_t z, kd;
+  uint64_t ki;
+
+  z = __exp_data.invln2N * x;
+#if TOINT_INTRINSICS
+  kd = roundtoint (z);
+  ki = converttoint (z);
+#else
+  kd = eval_as_double (z + __exp_data.shift);
+  ki = asuint64 (kd);
+  kd -= __exp_data.shift;
+#endif
+  *r = x + kd * __exp_data.negln2hiN + kd * __exp_data.negln2loN;
+  return ki;
+}
+
+/* 2^(k/N) ~= scale * (1 + *TAIL), only valid when -1022*N < k < 1024*N.  */
+static inline double_t
+exp_scale (uint64_t ki, double_t *tail)
+{
+  uint64_t idx = 2 * (ki % EXP_N);
+
+  *tail = asdouble (__exp_data.tab[idx]);
+  return asdouble (__exp_data.tab[idx + 1] + (ki << (52 - EXP_TABLE_BITS)));
+}
+
+/* expm1(x) ~= hi + *LO, for x in [-512, 512].  The subtraction of 1 is
+   exact or done in two parts, so the error is 0.5 ulp + the rounding of
+   the small terms relative to the result: below 0.1 ulp when
+   |x| > 0x1p-5.  *LO is not normalized: it holds scale * (e^r - 1) and can
+   be up to half of hi.  */
+static inline double_t
+expm1_inline (double_t x, double_t *lo)
+{
+  double_t r, r2, scale, tail, tmp, hi, t;
+  uint64_t ki;
+
+  ki = exp_reduce (x, &r);
+  scale = exp_scale (ki, &tail);
+  r2 = r * r;
+  tmp = tail + r + r2 * (EXP_C2 + r * EXP_C3) + r2 * r2 * (EXP_C4 + r * EXP_C5);
+  /* scale - 1 as hi + lo exactly.  */
+  hi = scale - 1.0;
+  t = hi - scale;
+  *lo = (scale - (hi - t)) + (-1.0 - t) + scale * tmp;
+  return hi;
+}
+
+/* e^x / 2 for 32 <= x <= 0x1.633ce8fb9f87dp+9, where e^-x is negligible
+   in sinh and cosh.  The scale is divided by 4 so that only the final
+   doubling can overflow.  */
+static inline double
+exp_half_inline (double_t x)
+{
+  double_t r, r2, scale, tail, tmp;
+  uint64_t ki, idx, sbits;
+
+  ki = exp_reduce (x, &r);
+  idx = 2 * (ki % EXP_N);
+  tail = asdouble (__exp_data.tab[idx]);
+  sbits = __exp_data.tab[idx + 1] + (ki << (52 - EXP_TABLE_BITS));
+  scale = asdouble (sbits - (2ULL << 52));
+  r2 = r * r;
+  tmp = tail + r + r2 * (EXP_C2 + r * EXP_C3) + r2 * r2 * (EXP_C4 + r * EXP_C5);
+  return check_oflow (eval_as_double (2.0 * (scale + scale * tmp)));
+}
@@ -0,0 +1,53 @@
+/* Double-precision e^x - 1 function.
+   Copyright (c) 2026 The newlib contributors.
+
+   Permission to use, copy, modify, and distribute this software
+   is freely granted, provided that this notice is preserved.  */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include <math.h>
+#include <stdint.h>
+#include "math_config.h"
+#include "exp_inline.h"
+
+#define C __expm1_data.poly
+
+/* Worst-case error is 0.51 ulp for |x| < 0x1p-5 and 0.6 ulp above.  */
+double
+expm1 (double x)
+{
+  uint32_t abstop;
+  /* double_t for better performance on targets with FLT_EVAL_METHOD==2.  */
+  double_t x2, p, hi, lo;
+
+  abstop = top12 (x) & 0x7ff;
+  if (abstop < top12 (0x1p-5))
+    {
+      if (unlikely (abstop < top12 (0x1p-54)))
+	{
+	  /* Raise inexact, and underflow if x is subnormal.  */
+	  force_eval_double (abstop == 0 ? x / 0x1p120 : x + 0x1p120);
+	  return x;
+	}
+      /* expm1(x) = x + x^2/2 + x^3 P(x), no cancellation near 0.  */
+      x2 = x * x;
+      p = C[0] + x * C[1] + x2 * (C[2] + x * C[3])
+	  + x2 * x2 * (C[4] + x * C[5]);
+      return x + (0.5 * x2 + x * x2 * p);
+    }
+  if (unlikely (abstop >= top12 (512.0)))
+    {
+      if (abstop >= top12 (INFINITY))
+	return asuint64 (x) == asuint64 (-INFINITY) ? -1.0 : x + x;
+      if (asuint64 (x) >> 63)
+	/* -1 rounded according to the rounding mode, with inexact.  */
+	return opt_barrier_double (0x1p-1000) - 1.0;
+      /* The -1 is far below the rounding error of exp(x).  */
+      return exp (x);
+    }
+  hi = expm1_inline (x, &lo);
+  return hi + lo;
+}
+#endif
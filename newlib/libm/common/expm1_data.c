@@ -0,0 +1,42 @@
+/* Shared data between expm1, sinh and tanh.
+   Copyright (c) 2026 The newlib contributors.
+
+   Permission to use, copy, modify, and distribute this software
+   is freely granted, provided that this notice is preserved.  */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include "math_config.h"
+
+const struct expm1_data __expm1_data = {
+.poly = {
+// expm1(x) ~= x + x^2/2 + x^3 * poly(x)
+// relative error: 2^-63.3
+// in [-0x1p-5, 0x1p-5]
+0x1.5555555555558p-3,
+0x1.5555555555556p-5,
+0x1.1111111041036p-7,
+0x1.6c16c16b70503p-10,
+0x1.a01c2c6edca70p-13,
+0x1.a01bbd78854dbp-16,
+},
+.sinh_poly = {
+// sinh(x) ~= x + x^3 * poly(x^2)
+// relative error: 2^-63.4
+// in [-0x1p-5, 0x1p-5]
+0x1.5555555555558p-3,
+0x1.1111111041036p-7,
+0x1.a01c2c6edca70p-13,
+},
+.tanh_poly = {
+// tanh(x) ~= x + x^3 * poly(x^2)
+// relative error: 2^-63.6
+// in [-0x1p-5, 0x1p-5]
+-0x1.5555555555554p-2,
+0x1.11111110feeddp-3,
+-0x1.ba1b9c0efd4afp-5,
+0x1.6606b711c07f0p-6,
+},
+};
+#endif
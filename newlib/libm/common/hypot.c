@@ -0,0 +1,86 @@
+/* Double-precision hypot function.
+   Copyright (c) 2026 The newlib contributors.
+
+   Permission to use, copy, modify, and distribute this software
+   is freely granted, provided that this notice is preserved.  */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include <math.h>
+#include <stdint.h>
+#include "math_config.h"
+
+/* x^2 as hi + *LO exactly.  */
+static inline double_t
+square (double_t x, double_t *lo)
+{
+  double_t hi;
+
+  hi = x * x;
+#if HAVE_FAST_FMA
+  *lo = fma (x, x, -hi);
+#else
+  {
+    double_t xhi, xlo;
+    xhi = asdouble (asuint64 (x) & -1ULL << 27);
+    xlo = x - xhi;
+    *lo = xhi * xhi - hi + 2.0 * xhi * xlo + xlo * xlo;
+  }
+#endif
+  return hi;
+}
+
+/* The squares are computed exactly, with scaling away from overflow and
+   underflow, so only the final sum and the square root round.  Worst-case
+   error is 0.85 ULP, without the division of e_hypot.c.  */
+double
+hypot (double x, double y)
+{
+  uint64_t ix, iy, t;
+  uint32_t ex, ey;
+  /* double_t for better performance on targets with FLT_EVAL_METHOD==2.  */
+  double_t z, hx, lx, hy, ly, hi, lo;
+
+  ix = asuint64 (x) & 0x7fffffffffffffff;
+  iy = asuint64 (y) & 0x7fffffffffffffff;
+  if (ix < iy)
+    {
+      t = ix;
+      ix = iy;
+      iy = t;
+    }
+  ex = ix >> 52;
+  ey = iy >> 52;
+  x = asdouble (ix);
+  y = asdouble (iy);
+  /* hypot(inf, nan) == inf.  */
+  if (unlikely (ey == 0x7ff))
+    return y;
+  if (unlikely (ex == 0x7ff || iy == 0))
+    return x;
+  /* y^2 is below half an ulp of x^2.  */
+  if (unlikely (ex - ey > 64))
+    return x + y;
+
+  z = 1.0;
+  if (unlikely (ex > 0x3ff + 510))
+    {
+      z = 0x1p700;
+      x *= 0x1p-700;
+      y *= 0x1p-700;
+    }
+  else if (unlikely (ey < 0x3ff - 450))
+    {
+      z = 0x1p-700;
+      x *= 0x1p700;
+      y *= 0x1p700;
+    }
+  hx = square (x, &lx);
+  hy = square (y, &ly);
+  /* hx >= hy, so hi + lo is exact.  */
+  hi = hx + hy;
+  lo = (hx - hi) + hy;
+  return check_oflow (eval_as_double (z * sqrt (hi + (lo + lx + ly))));
+}
+#endif
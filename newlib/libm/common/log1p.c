@@ -0,0 +1,141 @@
+/* Double-precision log(1+x) function, derived from log.c of Arm's
+   optimized-routines.
+   Copyright (c) 2018 Arm Ltd.  All rights reserved.
+   Copyright (c) 2026 The newlib contributors.
+
+   SPDX-License-Identifier: BSD-3-Clause
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+   3. The name of the company may not be used to endorse or promote
+      products derived from this software without specific prior written
+      permission.
+
+   THIS SOFTWARE IS PROVIDED BY ARM LTD ``AS IS'' AND ANY EXPRESS OR IMPLIED
+   WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+   MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+   IN NO EVENT SHALL ARM LTD BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+   TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include <math.h>
+#include <stdint.h>
+#include "math_config.h"
+
+#define T __log_data.tab
+#define T2 __log_data.tab2
+#define B __log_data.poly1
+#define A __log_data.poly
+#define Ln2hi __log_data.ln2hi
+#define Ln2lo __log_data.ln2lo
+#define N (1 << LOG_TABLE_BITS)
+#define OFF 0x3fe6000000000000
+
+/* This is log (see log.c) applied to 1 + x computed as hi + lo exactly:
+   x itself is the argument of the polynomial near 0, and lo is folded into
+   the reduced argument elsewhere, so there is no cancellation.  */
+double
+log1p (double x)
+{
+  /* double_t for better performance on targets with FLT_EVAL_METHOD==2.  */
+  double_t w, z, r, r2, r3, y, invc, logc, kd, hi, lo, scale;
+  uint64_t ix, iz, tmp;
+  int k, i;
+
+  ix = asuint64 (x);
+  if ((ix & 0x7fffffffffffffff) < asuint64 (0x1p-4))
+    {
+      if (unlikely ((ix & 0x7fffffffffffffff) < asuint64 (0x1p-54)))
+	{
+	  /* Raise inexact, and underflow if x is subnormal.  */
+	  force_eval_double ((ix & 0x7ff0000000000000) == 0
+			     ? x / 0x1p120 : x + 0x1p120);
+	  return x;
+	}
+      /* Worst-case error is around 0.507 ULP, see log.c.  */
+      r = x;
+      r2 = r * r;
+      r3 = r * r2;
+      y = r3 * (B[1] + r * B[2] + r2 * B[3]
+		+ r3 * (B[4] + r * B[5] + r2 * B[6]
+			+ r3 * (B[7] + r * B[8] + r2 * B[9] + r3 * B[10])));
+      w = r * 0x1p27;
+      double_t rhi = r + w - w;
+      double_t rlo = r - rhi;
+      w = rhi * rhi * B[0]; /* B[0] == -0.5.  */
+      hi = r + w;
+      lo = r - hi + w;
+      lo += B[0] * rlo * (rhi + r);
+      y += lo;
+      y += hi;
+      return y;
+    }
+  if (unlikely (ix >= asuint64 (-1.0)
+		|| (ix >= asuint64 (0x1p53) && ix < 0x8000000000000000)))
+    {
+      /* x <= -1, x >= 0x1p53, inf or nan.  */
+      if (ix == asuint64 (-1.0))
+	return __math_divzero (1);
+      if (ix > asuint64 (-1.0))
+	return __math_invalid (x);
+      /* log1p(x) - log(x) < 0x1p-53 while log(x) > 36: the difference is
+	 below 0.02 ULP.  */
+      return log (x);
+    }
+
+  /* 1 + x = hi + lo exactly, hi > 0.  */
+  hi = 1.0 + x;
+  w = hi - 1.0;
+  lo = (1.0 - (hi - w)) + (x - w);
+
+  /* hi = 2^k z; where z is in range [OFF,2*OFF) and exact, -53 < k <= 53.  */
+  ix = asuint64 (hi);
+  tmp = ix - OFF;
+  i = (tmp >> (52 - LOG_TABLE_BITS)) % N;
+  k = (int64_t) tmp >> 52; /* arithmetic shift */
+  iz = ix - (tmp & 0xfffULL << 52);
+  invc = T[i].invc;
+  logc = T[i].logc;
+  z = asdouble (iz);
+  scale = asdouble ((uint64_t) (0x3ff - k) << 52);
+
+  /* r ~= (z + lo 2^-k)/c - 1, |r| < 1/(2*N), the lo term adds at most
+     0x1p-53 to r so its rounding error is negligible.  */
+#if HAVE_FAST_FMA
+  r = fma (z, invc, -1.0) + lo * scale * invc;
+#else
+  r = (z - T2[i].chi - T2[i].clo + lo * scale) * invc;
+#endif
+  kd = (double_t) k;
+
+  /* hi + lo = r + log(c) + k*Ln2.  */
+  w = kd * Ln2hi + logc;
+  hi = w + r;
+  lo = w - hi + r + kd * Ln2lo;
+
+  /* log1p(x) = lo + (log1p(r) - r) + hi.  */
+  r2 = r * r;
+#if LOG_POLY_ORDER == 6
+  y = lo + r2 * A[0] + r * r2 * (A[1] + r * A[2] + r2 * (A[3] + r * A[4])) + hi;
+#elif LOG_POLY_ORDER == 7
+  y = lo
+      + r2 * (A[0] + r * A[1] + r2 * (A[2] + r * A[3])
+	      + r2 * r2 * (A[4] + r * A[5]))
+      + hi;
+#endif
+  return y;
+}
+#endif
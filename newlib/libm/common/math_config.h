@@ -295,6 +295,19 @@ HIDDEN float __math_invalidf (float);
 /* Invalid input unless it is a quiet NaN.  */
 HIDDEN double __math_invalid (double);
 
+/* Error reporting for a result the caller already computed, only for
+   errno setting.  The wrappers test their error condition inline and
+   call these on the rare path.  */
+
+/* Domain error.  */
+HIDDEN float __math_edomf (float);
+/* Range error.  */
+HIDDEN float __math_erangef (float);
+/* Domain error.  */
+HIDDEN double __math_edom (double);
+/* Range error.  */
+HIDDEN double __math_erange (double);
+
 /* Error handling using output checking, only for errno setting.  */
 
 /* Check if the result overflowed to infinity.  */
@@ -432,4 +445,69 @@ extern const struct pow_log_data
   struct {double invc, pad, logc, logctail;} tab[1 << POW_LOG_TABLE_BITS];
 } __pow_log_data HIDDEN;
 
+#define ATAN_TABLE_BITS 4
+#define ATAN_TABLE_SIZE (12 * (1 << ATAN_TABLE_BITS) + 1)
+#define ATAN_POLY_ORDER 4
+/* Shared between atan and atan2.  */
+extern const struct atan_data
+{
+  double pio2_hi, pio2_lo;
+  double pi_hi, pi_lo;
+  double poly[ATAN_POLY_ORDER]; /* First coefficient is 1.  */
+  /* atan(c) for c in [0x1p-6, 0x1p6], ATAN_TABLE_BITS mantissa bits plus
+     a half.  atan2 only uses the first half, c <= 1.  */
+  struct {double hi, lo;} tab[ATAN_TABLE_SIZE];
+} __atan_data HIDDEN;
+
+#define ASIN_POLY_ORDER 13
+/* Shared between asin and acos.  */
+extern const struct asin_data
+{
+  double pio2_hi, pio2_lo;
+  double pi_hi, pi_lo;
+  double poly[ASIN_POLY_ORDER]; /* First coefficient is 1.  */
+} __asin_data HIDDEN;
+
+#define EXPM1_POLY_ORDER 6
+#define SINH_POLY_ORDER 3
+#define TANH_POLY_ORDER 4
+/* Shared between expm1, sinh and tanh, for small arguments.  */
+extern const struct expm1_data
+{
+  double poly[EXPM1_POLY_ORDER]; /* First two coefficients are 1, 1/2.  */
+  double sinh_poly[SINH_POLY_ORDER]; /* First coefficient is 1.  */
+  double tanh_poly[TANH_POLY_ORDER]; /* First coefficient is 1.  */
+} __expm1_data HIDDEN;
+
+#define CBRT_POLY_ORDER 6
+extern const struct cbrt_data
+{
+  double poly[CBRT_POLY_ORDER];
+  double scale[3]; /* cbrt(2^i).  */
+} __cbrt_data HIDDEN;
+
+#define TGAMMA_N 13
+#define TGAMMA_NFACT 23
+extern const struct tgamma_data
+{
+  double num[TGAMMA_N];
+  double den[TGAMMA_N];
+  double fact[TGAMMA_NFACT];
+} __tgamma_data HIDDEN;
+
+#define ERF_POLY_ORDER 10
+#define ERF_TABLE_SIZE 22
+#define ERF_TABLE_POLY_ORDER 12
+extern const struct erf_data
+{
+  double poly[ERF_POLY_ORDER];
+  double poly0_lo;
+  /* erf(c) and erf(c+d) - erf(c) = d P(d) for c = 0.625 + i/4.  */
+  struct
+  {
+    double hi, lo;
+    double poly[ERF_TABLE_POLY_ORDER];
+  } tab[ERF_TABLE_SIZE];
+} __erf_data HIDDEN;
+
 #endif
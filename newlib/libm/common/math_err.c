@@ -86,6 +86,22 @@ __math_invalid (double x)
   return isnan (x) ? y : with_errno (y, EDOM);
 }
 
+/* Report an error for a result computed by the caller.  Used by the
+   wrappers in libm/math, which keep only the error test on their common
+   path and call these out of line.  */
+
+HIDDEN double
+__math_edom (double y)
+{
+  return with_errno (y, EDOM);
+}
+
+HIDDEN double
+__math_erange (double y)
+{
+  return with_errno (y, ERANGE);
+}
+
 /* Check result and set errno if necessary.  */
 
 HIDDEN double
@@ -88,3 +88,17 @@ __math_invalidf (float x)
   float y = (x - x) / (x - x);
   return isnan (x) ? y : with_errnof (y, EDOM);
 }
+
+/* Report an error for a result computed by the caller.  */
+
+HIDDEN float
+__math_edomf (float y)
+{
+  return with_errnof (y, EDOM);
+}
+
+HIDDEN float
+__math_erangef (float y)
+{
+  return with_errnof (y, ERANGE);
+}
@@ -37,6 +37,7 @@ PORTABILITY
 */
 
 #include "fdlibm.h"
+#if __OBSOLETE_MATH
 
 #ifndef _DOUBLE_IS_32BITS
 
@@ -116,3 +117,4 @@ G =  3.57142857142857150787e-01; /* 5/14      = 0x3FD6DB6D, 0xB6DB6DB7 */
 }
 
 #endif /* _DOUBLE_IS_32BITS */
+#endif /* __OBSOLETE_MATH */
@@ -15,21 +15,15 @@ DESCRIPTION
 The <<fma>> functions compute (<[x]> * <[y]>) + <[z]>, rounded as one ternary
 operation:  they compute the value (as if) to infinite precision and round once
 to the result format, according to the rounding mode characterized by the value
-of FLT_ROUNDS.  That is, they are supposed to do this:  see below.
+of FLT_ROUNDS.
 
 RETURNS
 The <<fma>> functions return (<[x]> * <[y]>) + <[z]>, rounded as one ternary
 operation.
 
-BUGS
-This implementation does not provide the function that it should, purely
-returning "(<[x]> * <[y]>) + <[z]>;" with no attempt at all to provide the
-simulated infinite precision intermediates which are required.  DO NOT USE THEM.
-
-If double has enough more precision than float, then <<fmaf>> should provide
-the expected numeric results, as it does use double for the calculation.  But
-since this is not the case for all platforms, this manual cannot determine
-if it is so for your case.
+The result is correctly rounded in all rounding modes, also on targets
+without a fused multiply-add instruction, where the product and the sum are
+computed exactly on integers.
 
 PORTABILITY
 ANSI C, POSIX.
@@ -42,17 +36,215 @@ ANSI C, POSIX.
 
 #ifndef _DOUBLE_IS_32BITS
 
-#ifdef __STDC__
-	double fma(double x, double y, double z)
+/* x = m 2^e, with m < 2^54 and its lowest bit clear.  Zero, inf and nan
+   have e >= ZEROINFNAN, zero strictly greater.  */
+struct num
+{
+  uint64_t m;
+  int e;
+  int sign;
+};
+
+#define ZEROINFNAN (0x7ff - 0x3ff - 52 - 1)
+
+static struct num
+normalize (double x)
+{
+  struct num n;
+  uint64_t ix = asuint64 (x);
+  int e = ix >> 52;
+
+  n.sign = e & 0x800;
+  e &= 0x7ff;
+  if (!e)
+    {
+      ix = asuint64 (x * 0x1p63);
+      e = ix >> 52 & 0x7ff;
+      e = e ? e - 63 : 0x800;
+    }
+  ix &= (1ULL << 52) - 1;
+  ix |= 1ULL << 52;
+  n.m = ix << 1;
+  n.e = e - (0x3ff + 52 + 1);
+  return n;
+}
+
+/* hi:lo = x * y for x, y < 2^54.  */
+static inline void
+mul (uint64_t *hi, uint64_t *lo, uint64_t x, uint64_t y)
+{
+#ifdef __SIZEOF_INT128__
+  unsigned __int128 p = (unsigned __int128) x * y;
+
+  *hi = p >> 64;
+  *lo = p;
 #else
-	double fma(x,y)
-	double x;
-	double y;
-        double z;
+  uint64_t xlo = (uint32_t) x, xhi = x >> 32;
+  uint64_t ylo = (uint32_t) y, yhi = y >> 32;
+  uint64_t t1, t2, t3;
+
+  t1 = xlo * ylo;
+  t2 = xlo * yhi + xhi * ylo;
+  t3 = xhi * yhi;
+  *lo = t1 + (t2 << 32);
+  *hi = t3 + (t2 >> 32) + (*lo < t1);
 #endif
+}
+
+/* The product is computed exactly as a 128-bit integer and z is added
+   with its bits beyond the product collapsed into a sticky bit.  The sum
+   is normalized to 63 bits plus a sticky bit, so that the conversion to
+   double, or scalbn for subnormal results, rounds it only once and in the
+   current rounding mode.  */
+double
+fma (double x, double y, double z)
 {
-  /* Implementation defined. */
-  return (x * y) + z;
+  struct num nx, ny, nz;
+  uint64_t rhi, rlo, zhi, zlo, t;
+  int e, d, sign, nonzero;
+  int64_t i;
+  double r;
+
+  nx = normalize (x);
+  ny = normalize (y);
+  nz = normalize (z);
+  if (nx.e >= ZEROINFNAN || ny.e >= ZEROINFNAN)
+    return x * y + z;
+  if (nz.e >= ZEROINFNAN)
+    {
+      /* Adding zero could change the sign of a product that underflows
+	 to zero.  */
+      if (nz.e > ZEROINFNAN)
+	return x * y;
+      return z;
+    }
+
+  /* The product is below 2^108 with its two lowest bits clear.  */
+  mul (&rhi, &rlo, nx.m, ny.m);
+
+  /* Align the operands: shift z left by kz and the product right by kr,
+     with kz + kr = d, and set e to the exponent of the result.  */
+  e = nx.e + ny.e;
+  d = nz.e - e;
+  if (d > 0)
+    {
+      if (d < 64)
+	{
+	  zlo = nz.m << d;
+	  zhi = nz.m >> (64 - d);
+	}
+      else
+	{
+	  zlo = 0;
+	  zhi = nz.m;
+	  e = nz.e - 64;
+	  d -= 64;
+	  if (d == 0)
+	    ;
+	  else if (d < 64)
+	    {
+	      rlo = rhi << (64 - d) | rlo >> d | !!(rlo << (64 - d));
+	      rhi = rhi >> d;
+	    }
+	  else
+	    {
+	      rlo = 1;
+	      rhi = 0;
+	    }
+	}
+    }
+  else
+    {
+      zhi = 0;
+      d = -d;
+      if (d == 0)
+	zlo = nz.m;
+      else if (d < 64)
+	zlo = nz.m >> d | !!(nz.m << (64 - d));
+      else
+	zlo = 1;
+    }
+
+  sign = nx.sign ^ ny.sign;
+  nonzero = 1;
+  if (sign == nz.sign)
+    {
+      rlo += zlo;
+      rhi += zhi + (rlo < zlo);
+    }
+  else
+    {
+      t = rlo;
+      rlo -= zlo;
+      rhi = rhi - zhi - (t < rlo);
+      if (rhi >> 63)
+	{
+	  rlo = -rlo;
+	  rhi = -rhi - !!rlo;
+	  sign = !sign;
+	}
+      nonzero = !!rhi;
+    }
+
+  /* Move the top 63 bits of the sum to rhi, the last one sticky.  */
+  if (nonzero)
+    {
+      e += 64;
+      /* d > 0 since rhi < 2^55.  */
+      d = __builtin_clzll (rhi) - 1;
+      rhi = rhi << d | rlo >> (64 - d) | !!(rlo << d);
+    }
+  else if (rlo)
+    {
+      d = __builtin_clzll (rlo) - 1;
+      if (d < 0)
+	rhi = rlo >> 1 | (rlo & 1);
+      else
+	rhi = rlo << d;
+    }
+  else
+    /* Exact zero, its sign depends on the rounding mode.  */
+    return x * y + z;
+  e -= d;
+
+  /* rhi is in [2^62, 2^63).  */
+  i = rhi;
+  if (sign)
+    i = -i;
+  r = i;
+  if (e < -1022 - 62)
+    {
+      if (e == -1022 - 63)
+	{
+	  /* The result is in [2^-1023, 2^-1022] with 52 bits of precision.
+	     Unless it is exact or rounds up to 2^-1022, add a leading bit
+	     so that the conversion rounds at the right place, then remove
+	     it; scalbn is exact.  */
+	  double c = sign ? -0x1p63 : 0x1p63;
+
+	  if (r != c && (rhi << 53))
+	    {
+	      i = rhi >> 1 | (rhi & 1) | 1ULL << 62;
+	      if (sign)
+		i = -i;
+	      r = i;
+	      r = 2 * r - c;
+	      if (r != c)
+		force_eval_double (opt_barrier_double (0x1p-1022) * 0x1p-1022);
+	    }
+	}
+      else
+	{
+	  /* Fewer than 52 bits: keep 53, the last one sticky, so that the
+	     conversion is exact and scalbn does the only rounding.  */
+	  d = 10;
+	  i = (rhi >> d | !!(rhi << (64 - d))) << d;
+	  if (sign)
+	    i = -i;
+	  r = i;
+	}
+    }
+  return scalbn (r, e);
 }
 
 #endif /* _DOUBLE_IS_32BITS */
@@ -113,6 +113,7 @@ Interface Definition (Issue 2).
  */
 
 #include "fdlibm.h"
+#if __OBSOLETE_MATH
 #include "math_config.h"
 
 #ifndef _DOUBLE_IS_32BITS
@@ -210,3 +211,4 @@ static double zero = 0.0;
 }
 
 #endif /* _DOUBLE_IS_32BITS */
+#endif /* __OBSOLETE_MATH */
@@ -8,26 +8,65 @@
 
 #if !HAVE_FAST_FMAF
 
-#ifdef __STDC__
-	float fmaf(float x, float y, float z)
+#ifndef _DOUBLE_IS_32BITS
+
+/* The product is exact in double, so the sum is the only rounding before
+   the conversion to float.  Directed roundings compose, and in round to
+   nearest the double rounding can only go wrong when the sum lands
+   exactly halfway between two floats: then it is moved by one double ulp
+   toward the exact value.  In the directed modes that move does not cross
+   a float either.  The sign of the rounding error comes from Fast2Sum,
+   where r - big is exact in any rounding mode.  */
+float
+fmaf (float x, float y, float z)
+{
+  double xy, r, err;
+  uint64_t i, m;
+  int e, s, tiny;
+
+  xy = (double) x * y;
+  r = xy + z;
+  i = asuint64 (r);
+  e = i >> 52 & 0x7ff;
+  if (unlikely (e == 0x7ff))
+    return (float) r;
+  /* Number of bits of r below the float precision, more in the float
+     subnormal range.  r is not a double subnormal.  */
+  tiny = e < 0x3ff - 126;
+  s = tiny ? 52 - 23 + (0x3ff - 126 - e) : 52 - 23;
+  m = (i & ((1ULL << 52) - 1)) | 1ULL << 52;
+  if (unlikely (tiny
+		|| (s <= 53 && (m & ((1ULL << s) - 1)) == 1ULL << (s - 1))))
+    {
+      if (fabs (xy) >= fabs ((double) z))
+	err = z - (r - xy);
+      else
+	err = xy - (r - z);
+      if (err != 0)
+	{
+	  if (s <= 53 && (m & ((1ULL << s) - 1)) == 1ULL << (s - 1))
+	    i += (err > 0) == (r > 0) ? 1 : -1;
+	  r = asdouble (i);
+	  /* The conversion of r may be exact, but the result is not.  */
+	  if (tiny && fabsf ((float) r) < 0x1p-126f)
+	    force_eval_float (opt_barrier_float (0x1p-126f) * 0x1p-126f);
+	}
+    }
+  return (float) r;
+}
+
 #else
-	float fmaf(x,y,z)
-	float x;
-	float y;
-        float z;
-#endif
+
+float
+fmaf (float x, float y, float z)
 {
-  /* NOTE:  The floating-point exception behavior of this is not as
-   * required.  But since the basic function is not really done properly,
-   * it is not worth bothering to get the exceptions right, either.  */
-  /* Let the implementation handle this. */ /* <= NONSENSE! */
-  /* In floating-point implementations in which double is larger than float,
-   * computing as double should provide the desired function.  Otherwise,
-   * the behavior will not be as specified in the standards.  */
-  return (float) (((double) x * (double) y) + (double) z);
+  /* Without a wider type this is not fused.  */
+  return x * y + z;
 }
 
-#endif
+#endif /* _DOUBLE_IS_32BITS */
+
+#endif /* !HAVE_FAST_FMAF */
 
 #ifdef _DOUBLE_IS_32BITS
 
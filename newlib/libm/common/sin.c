@@ -0,0 +1,55 @@
+/*
+ * ====================================================
+ * Copyright (C) 1993 by Sun Microsystems, Inc. All rights reserved.
+ *
+ * Developed at SunPro, a Sun Microsystems, Inc. business.
+ * Permission to use, copy, modify, and distribute this
+ * software is freely granted, provided that this notice
+ * is preserved.
+ * ====================================================
+ */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include <stdint.h>
+#include <math.h>
+#include "math_config.h"
+#include "sincos.h"
+
+/* sin(x) with the fdlibm kernels and an inline range reduction, see
+   sincos.h.  The error is below 1 ulp.  */
+double
+sin (double x)
+{
+  uint32_t ix = abstop32 (x);
+  double y[2];
+  int n;
+
+  if (ix <= PIO4_TOP)
+    {
+      if (unlikely (ix < 0x3e500000))
+	{
+	  /* |x| < 2^-26: raise inexact, and underflow if subnormal.  */
+	  force_eval_double (ix < 0x00100000 ? x / 0x1p120 : x + 0x1p120);
+	  return x;
+	}
+      return sin_kernel (x, 0.0, 0);
+    }
+  if (unlikely (ix >= 0x7ff00000))
+    return __math_invalid (x);
+
+  n = reduce (x, ix, y);
+  switch (n & 3)
+    {
+    case 0:
+      return sin_kernel (y[0], y[1], 1);
+    case 1:
+      return cos_kernel (y[0], y[1]);
+    case 2:
+      return -sin_kernel (y[0], y[1], 1);
+    default:
+      return -cos_kernel (y[0], y[1]);
+    }
+}
+#endif
@@ -0,0 +1,73 @@
+/*
+ * ====================================================
+ * Copyright (C) 1993 by Sun Microsystems, Inc. All rights reserved.
+ *
+ * Developed at SunPro, a Sun Microsystems, Inc. business.
+ * Permission to use, copy, modify, and distribute this
+ * software is freely granted, provided that this notice
+ * is preserved.
+ * ====================================================
+ */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include <stdint.h>
+#include <math.h>
+#include "math_config.h"
+#include "sincos.h"
+
+/* sincos(x) from a single range reduction, see sincos.h.  Both results
+   are identical to what sin and cos return.  */
+void
+sincos (double x, double *sinp, double *cosp)
+{
+  uint32_t ix = abstop32 (x);
+  double y[2], s, c;
+  int n;
+
+  if (ix <= PIO4_TOP)
+    {
+      if (unlikely (ix < 0x3e46a09e))
+	{
+	  /* |x| < 2^-27 * sqrt(2): raise inexact, and underflow if
+	     subnormal.  */
+	  force_eval_double (ix < 0x00100000 ? x / 0x1p120 : x + 0x1p120);
+	  *sinp = x;
+	  *cosp = 1.0;
+	  return;
+	}
+      *sinp = sin_kernel (x, 0.0, 0);
+      *cosp = cos_kernel (x, 0.0);
+      return;
+    }
+  if (unlikely (ix >= 0x7ff00000))
+    {
+      *sinp = *cosp = __math_invalid (x);
+      return;
+    }
+
+  n = reduce (x, ix, y);
+  s = sin_kernel (y[0], y[1], 1);
+  c = cos_kernel (y[0], y[1]);
+  switch (n & 3)
+    {
+    case 0:
+      *sinp = s;
+      *cosp = c;
+      break;
+    case 1:
+      *sinp = c;
+      *cosp = -s;
+      break;
+    case 2:
+      *sinp = -s;
+      *cosp = -c;
+      break;
+    default:
+      *sinp = -c;
+      *cosp = s;
+      break;
+    }
+}
+#endif
@@ -0,0 +1,187 @@
+/*
+ * ====================================================
+ * Copyright (C) 1993 by Sun Microsystems, Inc. All rights reserved.
+ *
+ * Developed at SunPro, a Sun Microsystems, Inc. business.
+ * Permission to use, copy, modify, and distribute this
+ * software is freely granted, provided that this notice
+ * is preserved.
+ * ====================================================
+ */
+
+/* Range reduction and kernels shared by sin, cos, sincos and tan.  The
+   polynomials are the fdlibm ones (k_sin.c, k_cos.c, k_tan.c); they are
+   inlined here and fed from one reduction so that sincos pays for it
+   once.  */
+
+#include <stdint.h>
+#include <math.h>
+#include "math_config.h"
+
+extern const struct sincos_data
+{
+  double invpio2;		/* 2/PI.  */
+  double shift;			/* 1.5 * 2^52, rounds to integer.  */
+  double pio2_1, pio2_1t;	/* First 33 bits of PI/2 and the rest.  */
+  double pio2_2, pio2_2t;	/* Second 33 bits of PI/2 and the rest.  */
+  double pio2_3, pio2_3t;	/* Third 33 bits of PI/2 and the rest.  */
+  double pio4, pio4lo;		/* PI/4 to 107 bits.  */
+  double s[6];			/* Sine polynomial.  */
+  double c[6];			/* Cosine polynomial.  */
+  double t[13];			/* Tangent polynomial.  */
+} __sincos_data HIDDEN;
+
+/* Top 32 bits of the representation of X with the sign bit cleared.  */
+static inline uint32_t
+abstop32 (double x)
+{
+  return (asuint64 (x) >> 32) & 0x7fffffff;
+}
+
+/* |X| <= PI/4, roughly: no reduction needed.  */
+#define PIO4_TOP	0x3fe921fb
+/* |X| < 2^20 * PI/2, roughly: reduce_medium applies.  */
+#define MEDIUM_TOP	0x413921fb
+
+/* Reduce X (with IX = abstop32 (X)) to Y[0] + Y[1] in [-PI/4, PI/4] and
+   return the quadrant.  The first step leaves 85 bits of PI/2; the
+   exponent of the result tells whether cancellation needs a second (118
+   bits) or third (151 bits) step, which covers every double below
+   2^20 * PI/2.  */
+static inline int
+reduce_medium (double x, uint32_t ix, double *y)
+{
+  const struct sincos_data *d = &__sincos_data;
+  double_t fn, r, w, t;
+  uint32_t ex, ey;
+  int n;
+
+  fn = eval_as_double (x * d->invpio2 + d->shift) - d->shift;
+  n = (int32_t) fn;
+  r = x - fn * d->pio2_1;
+  w = fn * d->pio2_1t;
+  /* Only off by one in directed rounding modes.  */
+  if (WANT_ROUNDING && unlikely (r - w < -d->pio4))
+    {
+      n--;
+      fn--;
+      r = x - fn * d->pio2_1;
+      w = fn * d->pio2_1t;
+    }
+  else if (WANT_ROUNDING && unlikely (r - w > d->pio4))
+    {
+      n++;
+      fn++;
+      r = x - fn * d->pio2_1;
+      w = fn * d->pio2_1t;
+    }
+  y[0] = r - w;
+  ex = ix >> 20;
+  ey = abstop32 (y[0]) >> 20;
+  if (unlikely (ex - ey > 16))
+    {
+      t = r;
+      w = fn * d->pio2_2;
+      r = t - w;
+      w = fn * d->pio2_2t - ((t - r) - w);
+      y[0] = r - w;
+      ey = abstop32 (y[0]) >> 20;
+      if (ex - ey > 49)
+	{
+	  t = r;
+	  w = fn * d->pio2_3;
+	  r = t - w;
+	  w = fn * d->pio2_3t - ((t - r) - w);
+	  y[0] = r - w;
+	}
+    }
+  y[1] = (r - y[0]) - w;
+  return n;
+}
+
+/* Reduce finite X with |X| > PI/4, IX = abstop32 (X).  */
+static inline int
+reduce (double x, uint32_t ix, double *y)
+{
+  if (likely (ix < MEDIUM_TOP))
+    return reduce_medium (x, ix, y);
+  return __ieee754_rem_pio2 (x, y);
+}
+
+/* sin (X + Y) for |X| <= PI/4, Y the tail of X (zero if !IY).  */
+static inline double
+sin_kernel (double x, double y, int iy)
+{
+  const double *s = __sincos_data.s;
+  double_t z, w, r, v;
+
+  z = x * x;
+  w = z * z;
+  r = s[1] + z * (s[2] + z * s[3]) + z * w * (s[4] + z * s[5]);
+  v = z * x;
+  if (!iy)
+    return x + v * (s[0] + z * r);
+  return x - ((z * (0.5 * y - v * r) - y) - v * s[0]);
+}
+
+/* cos (X + Y) for |X| <= PI/4, Y the tail of X.  1 - X^2/2 is split so
+   that its rounding error is added back in.  */
+static inline double
+cos_kernel (double x, double y)
+{
+  const double *c = __sincos_data.c;
+  double_t z, w, r, hz;
+
+  z = x * x;
+  w = z * z;
+  r = z * (c[0] + z * (c[1] + z * c[2])) + w * w * (c[3] + z * (c[4] + z * c[5]));
+  hz = 0.5 * z;
+  w = 1.0 - hz;
+  return w + (((1.0 - w) - hz) + (z * r - x * y));
+}
+
+/* tan (X + Y) for |X| <= PI/4 if !ODD, else -1/tan (X + Y).  Above
+   0.6744 use tan (PI/4 - X) instead, as in k_tan.c.  */
+static inline double
+tan_kernel (double x, double y, int odd)
+{
+  const struct sincos_data *d = &__sincos_data;
+  const double *T = d->t;
+  double_t z, r, v, w, s, a;
+  double w0, a0;
+  int big, sign = 0;
+
+  big = abstop32 (x) >= 0x3fe59428;
+  if (big)
+    {
+      sign = asuint64 (x) >> 63;
+      if (sign)
+	{
+	  x = -x;
+	  y = -y;
+	}
+      x = (d->pio4 - x) + (d->pio4lo - y);
+      y = 0.0;
+    }
+  z = x * x;
+  w = z * z;
+  r = T[1] + w * (T[3] + w * (T[5] + w * (T[7] + w * (T[9] + w * T[11]))));
+  v = z * (T[2] + w * (T[4] + w * (T[6] + w * (T[8] + w * (T[10] + w * T[12])))));
+  s = z * x;
+  r = y + z * (s * (r + v) + y) + s * T[0];
+  w = x + r;
+  if (big)
+    {
+      s = 1 - 2 * odd;
+      v = s - 2.0 * (x + (r - w * w / (w + s)));
+      return sign ? -v : v;
+    }
+  if (!odd)
+    return w;
+  /* -1/(x + r) has up to 2 ulp error, so compute it accurately.  */
+  w0 = asdouble (asuint64 (w) & 0xffffffff00000000ULL);
+  v = r - (w0 - x);
+  a0 = a = -1.0 / w;
+  a0 = asdouble (asuint64 (a0) & 0xffffffff00000000ULL);
+  return a0 + a * (1.0 + a0 * w0 + a0 * v);
+}
@@ -0,0 +1,69 @@
+/*
+ * ====================================================
+ * Copyright (C) 1993 by Sun Microsystems, Inc. All rights reserved.
+ *
+ * Developed at SunPro, a Sun Microsystems, Inc. business.
+ * Permission to use, copy, modify, and distribute this
+ * software is freely granted, provided that this notice
+ * is preserved.
+ * ====================================================
+ */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include <stdint.h>
+#include <math.h>
+#include "math_config.h"
+#include "sincos.h"
+
+/* Constants for sin, cos, sincos and tan, see sincos.h.  */
+const struct sincos_data __sincos_data =
+{
+  .invpio2 = 0x1.45f306dc9c883p-1,
+  .shift = 0x1.8p52,
+  .pio2_1 = 0x1.921fb544p+0,
+  .pio2_1t = 0x1.0b4611a626331p-34,
+  .pio2_2 = 0x1.0b4611a6p-34,
+  .pio2_2t = 0x1.3198a2e037073p-69,
+  .pio2_3 = 0x1.3198a2ep-69,
+  .pio2_3t = 0x1.b839a252049c1p-104,
+  .pio4 = 0x1.921fb54442d18p-1,
+  .pio4lo = 0x1.1a62633145c07p-55,
+  /* |sin(x)/x - (1 + s[0] x^2 + ... + s[5] x^12)| <= 2^-58 on [0, PI/4].  */
+  .s = {
+    -0x1.5555555555549p-3,
+    0x1.111111110f8a6p-7,
+    -0x1.a01a019c161d5p-13,
+    0x1.71de357b1fe7dp-19,
+    -0x1.ae5e68a2b9cebp-26,
+    0x1.5d93a5acfd57cp-33,
+  },
+  /* |cos(x) - (1 - x^2/2 + c[0] x^4 + ... + c[5] x^14)| <= 2^-58.  */
+  .c = {
+    0x1.555555555554cp-5,
+    -0x1.6c16c16c15177p-10,
+    0x1.a01a019cb159p-16,
+    -0x1.27e4f809c52adp-22,
+    0x1.1ee9ebdb4b1c4p-29,
+    -0x1.8fae9be8838d4p-37,
+  },
+  /* |tan(x)/x - (1 + t[0] x^2 + ... + t[12] x^26)| <= 2^-59.2 on
+     [0, 0.6744].  */
+  .t = {
+    0x1.5555555555563p-2,
+    0x1.111111110fe7ap-3,
+    0x1.ba1ba1bb341fep-5,
+    0x1.664f48406d637p-6,
+    0x1.226e3e96e8493p-7,
+    0x1.d6d22c9560328p-9,
+    0x1.7dbc8fee08315p-10,
+    0x1.344d8f2f26501p-11,
+    0x1.026f71a8d1068p-12,
+    0x1.47e88a03792a6p-14,
+    0x1.2b80f32f0a7e9p-14,
+    -0x1.375cbdb605373p-16,
+    0x1.b2a7074bf7ad4p-16,
+  },
+};
+#endif
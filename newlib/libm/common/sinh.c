@@ -0,0 +1,69 @@
+/* Double-precision hyperbolic sine function.
+   Copyright (c) 2026 The newlib contributors.
+
+   Permission to use, copy, modify, and distribute this software
+   is freely granted, provided that this notice is preserved.  */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include <math.h>
+#include <stdint.h>
+#include "math_config.h"
+#include "exp_inline.h"
+
+#define C __expm1_data.sinh_poly
+
+/* sinh(x) = (e^x - e^-x)/2 with both exponentials sharing one reduction:
+   e^(+-|x|) = 2^(+-k/N) e^(+-r), so the odd and even parts of the
+   polynomial are computed once.  The difference of the scales is exact,
+   and the worst-case error is 0.61 ULP.  */
+double
+sinh (double x)
+{
+  uint32_t abstop;
+  uint64_t ki;
+  int sign;
+  /* double_t for better performance on targets with FLT_EVAL_METHOD==2.  */
+  double_t ax, x2, r, r2, s, t, s2, t2, e, o, a, b, hi, lo, y;
+
+  abstop = top12 (x) & 0x7ff;
+  sign = asuint64 (x) >> 63;
+  if (abstop < top12 (0x1p-5))
+    {
+      if (unlikely (abstop < top12 (0x1p-26)))
+	{
+	  /* Raise inexact, and underflow if x is subnormal.  */
+	  force_eval_double (abstop == 0 ? x / 0x1p120 : x + 0x1p120);
+	  return x;
+	}
+      x2 = x * x;
+      return x + x * x2 * (C[0] + x2 * (C[1] + x2 * C[2]));
+    }
+  ax = fabs (x);
+  if (unlikely (abstop >= top12 (0x1p5)))
+    {
+      if (abstop >= top12 (INFINITY))
+	return x + x;
+      if (ax > 0x1.633ce8fb9f87dp+9)
+	return __math_oflow (sign);
+      y = exp_half_inline (ax);
+      return sign ? -y : y;
+    }
+
+  ki = exp_reduce (ax, &r);
+  s = exp_scale (ki, &t);
+  s2 = exp_scale (-ki, &t2);
+  r2 = r * r;
+  /* e^r - 1 ~= e + o and e^-r - 1 ~= e - o.  */
+  e = r2 * (EXP_C2 + r2 * EXP_C4);
+  o = r + r * r2 * (EXP_C3 + r2 * EXP_C5);
+  a = s * (t + e + o);
+  b = s2 * (t2 + e - o);
+  /* s > s2 as k > 0 here.  */
+  hi = s - s2;
+  lo = (s - hi) - s2;
+  y = 0.5 * (hi + (lo + (a - b)));
+  return sign ? -y : y;
+}
+#endif
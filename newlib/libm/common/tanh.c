@@ -0,0 +1,80 @@
+/* Double-precision hyperbolic tangent function.
+   Copyright (c) 2026 The newlib contributors.
+
+   Permission to use, copy, modify, and distribute this software
+   is freely granted, provided that this notice is preserved.  */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include <math.h>
+#include <stdint.h>
+#include "math_config.h"
+#include "exp_inline.h"
+
+#define C __expm1_data.tanh_poly
+
+/* tanh(x) = -E/(2 + E) with E = e^(-2|x|) - 1 from expm1_inline as
+   hi + lo.  The quotient is computed to about 2^-100 relative error with
+   one division and a correction step, so the worst-case error is
+   0.56 ULP.  */
+double
+tanh (double x)
+{
+  uint32_t abstop;
+  int sign;
+  /* double_t for better performance on targets with FLT_EVAL_METHOD==2.  */
+  double_t ax, x2, eh, el, nh, nl, dh, dl, inv, q, res, y;
+
+  abstop = top12 (x) & 0x7ff;
+  sign = asuint64 (x) >> 63;
+  if (abstop < top12 (0x1p-5))
+    {
+      if (unlikely (abstop < top12 (0x1p-27)))
+	{
+	  /* Raise inexact, and underflow if x is subnormal.  */
+	  force_eval_double (abstop == 0 ? x / 0x1p120 : x + 0x1p120);
+	  return x;
+	}
+      x2 = x * x;
+      return x + x * x2 * (C[0] + x2 * (C[1] + x2 * (C[2] + x2 * C[3])));
+    }
+  if (unlikely ((asuint64 (x) & 0x7fffffffffffffff) > asuint64 (22.0)))
+    {
+      if (abstop == 0x7ff)
+	/* tanh(+-inf) is +-1 exactly; nan.  */
+	return asuint64 (x) << 12 == 0 ? (sign ? -1.0 : 1.0) : x + x;
+      /* 1 - tanh(x) < 2^-62: +-1 with inexact.  */
+      y = 1.0 - opt_barrier_double (0x1p-1000);
+      return sign ? -y : y;
+    }
+  ax = fabs (x);
+
+  eh = expm1_inline (-2.0 * ax, &el);
+  y = eh + el;
+  el = (eh - y) + el;
+  eh = y;
+  /* -1 < E < 0, the sums are exact.  */
+  nh = -eh;
+  nl = -el;
+  dh = 2.0 + eh;
+  dl = (2.0 - dh) + eh + el;
+  inv = 1.0 / dh;
+  q = nh * inv;
+  /* nh - q dh exactly.  */
+#if HAVE_FAST_FMA
+  res = fma (-q, dh, nh);
+#else
+  {
+    double_t qhi, qlo, dhi, dlo;
+    qhi = asdouble (asuint64 (q) & -1ULL << 27);
+    qlo = q - qhi;
+    dhi = asdouble (asuint64 (dh) & -1ULL << 27);
+    dlo = dh - dhi;
+    res = nh - qhi * dhi - qhi * dlo - qlo * dhi - qlo * dlo;
+  }
+#endif
+  y = q + (res + nl - q * dl) * inv;
+  return sign ? -y : y;
+}
+#endif
@@ -0,0 +1,151 @@
+/* Double-precision tgamma function.
+   Copyright (c) 2026 The newlib contributors.
+
+   Permission to use, copy, modify, and distribute this software
+   is freely granted, provided that this notice is preserved.  */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include <math.h>
+#include <stdint.h>
+#include "math_config.h"
+
+#define N TGAMMA_N
+#define Num __tgamma_data.num
+#define Den __tgamma_data.den
+#define Fact __tgamma_data.fact
+
+/* g - 0.5 for the Lanczos g used in tgamma_data.c.  */
+static const double gmhalf = 5.524680040776729583740234375;
+
+/* num(x)/den(x) for x > 0.  In 1/x for large x to avoid overflow, the
+   ratio is then insensitive to the rounding of 1/x.  */
+static inline double_t
+lanczos_sum (double_t x)
+{
+  double_t num, den, t;
+  int i;
+
+  num = den = 0;
+  if (x < 8.0)
+    for (i = N - 1; i >= 0; i--)
+      {
+	num = num * x + Num[i];
+	den = den * x + Den[i];
+      }
+  else
+    {
+      t = 1.0 / x;
+      for (i = 0; i < N; i++)
+	{
+	  num = num * t + Num[i];
+	  den = den * t + Den[i];
+	}
+    }
+  return num / den;
+}
+
+/* sin(pi x) for a positive non-integer x.  */
+static double
+sinpi (double x)
+{
+  int n;
+
+  /* x mod 2, then x = n/2 + r with |r| <= 1/4.  */
+  x = 2.0 * (0.5 * x - floor (0.5 * x));
+  n = (int) (4.0 * x);
+  n = (n + 1) / 2;
+  x = (x - 0.5 * n) * M_PI;
+  switch (n)
+    {
+    default: /* case 4 */
+    case 0:
+      return __kernel_sin (x, 0.0, 0);
+    case 1:
+      return __kernel_cos (x, 0.0);
+    case 2:
+      return __kernel_sin (-x, 0.0, 0);
+    case 3:
+      return -__kernel_cos (x, 0.0);
+    }
+}
+
+/* Gamma(x) = num(x)/den(x) y^(x-0.5) e^-y with y = x + g - 0.5 for x > 0,
+   and Gamma(x) = -pi / (x sin(pi x) Gamma(-x)) for x < 0.  The rounding
+   error of y is compensated using the derivative of y^(x-0.5) e^-y, and
+   y^(x-0.5) is computed as a square so it only overflows with the
+   result.  Integers below TGAMMA_NFACT come from a table.  This replaces
+   exp(lgamma(x)), whose error grows with |lgamma(x)| to over 1000 ULP
+   near the overflow threshold.  Worst-case error found is 7.0 ULP for
+   x > 0 and 8.7 ULP for x < 0, most of it from the evaluation of the
+   Lanczos sum for small |x|.  */
+double
+tgamma (double x)
+{
+  uint64_t ix;
+  uint32_t top;
+  int sign;
+  /* double_t for better performance on targets with FLT_EVAL_METHOD==2.  */
+  double_t ax, y, dy, z, r;
+
+  ix = asuint64 (x);
+  sign = ix >> 63;
+  top = (ix >> 52) & 0x7ff;
+  if (unlikely (top == 0x7ff))
+    {
+      /* tgamma(-inf) is invalid, +inf and nan are returned.  */
+      if (ix == asuint64 (-INFINITY))
+	return __math_invalid (x);
+      return x + x;
+    }
+  if (unlikely (top < 0x3ff - 54))
+    {
+      /* |x| < 2^-54: Gamma(x) rounds to 1/x.  */
+      if (x == 0.0)
+	return __math_divzero (sign);
+      return check_oflow (1.0 / x);
+    }
+  if (unlikely (top >= 0x406))
+    {
+      /* |x| >= 128.  */
+      if (!sign)
+	{
+	  if (x > 0x1.573fae561f647p+7)
+	    return __math_oflow (0);
+	}
+      else if (x == floor (x))
+	return __math_invalid (x);
+      else if (x < -184.0)
+	/* The sign of Gamma(x) is + if floor(x) is even.  */
+	return __math_uflow (floor (x) * 0.5 != floor (x * 0.5));
+    }
+  else if (x == (double) (int32_t) x)
+    {
+      if (sign)
+	return __math_invalid (x);
+      if (x <= TGAMMA_NFACT)
+	return Fact[(int) x - 1];
+    }
+
+  ax = sign ? -x : x;
+  y = ax + gmhalf;
+  /* y = ax + gmhalf - dy exactly.  */
+  if (ax > gmhalf)
+    dy = (y - ax) - gmhalf;
+  else
+    dy = (y - gmhalf) - ax;
+  z = ax - 0.5;
+  r = lanczos_sum (ax) * exp (-y);
+  if (sign)
+    {
+      /* Reflection, sinpi(ax) is not zero as integers are handled.  */
+      r = -M_PI / (sinpi (ax) * ax * r);
+      dy = -dy;
+      z = -z;
+    }
+  r += dy * (gmhalf + 0.5) * r / y;
+  z = pow (y, 0.5 * z);
+  return check_uflow (eval_as_double (r * z * z));
+}
+#endif
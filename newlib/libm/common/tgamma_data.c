@@ -0,0 +1,74 @@
+/* Data for tgamma.
+   Copyright (c) 2026 The newlib contributors.
+
+   Permission to use, copy, modify, and distribute this software
+   is freely granted, provided that this notice is preserved.  */
+
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include "math_config.h"
+
+const struct tgamma_data __tgamma_data = {
+// Lanczos approximation with g = 6.024680040776729583740234375 and 13
+// terms: Gamma(x) ~= num(x)/den(x) (x+g-0.5)^(x-0.5) e^-(x+g-0.5), with
+// den(x) = x(x+1)...(x+11) and relative error 2^-54.7 for x > 0.
+.num = {
+0x1.5ea5143c1a49ep+34,
+0x1.3fc7075f54c57p+35,
+0x1.0a132818ab61ap+35,
+0x1.0b0b522e8261ap+34,
+0x1.67fc1b3a5a1e8p+32,
+0x1.57418f5d3f33fp+30,
+0x1.dab0c7bb95f2ap+27,
+0x1.df876f95dcc98p+24,
+0x1.5f1e95080f44cp+21,
+0x1.6b6421f8787ebp+17,
+0x1.f87ac0858d804p+12,
+0x1.a5a607bbc3b52p+7,
+0x1.40d931ff62705p+1,
+},
+.den = {
+0.0,
+39916800.0,
+120543840.0,
+150917976.0,
+105258076.0,
+45995730.0,
+13339535.0,
+2637558.0,
+357423.0,
+32670.0,
+1925.0,
+66.0,
+1.0,
+},
+// n! for n < TGAMMA_NFACT, exact in double.
+.fact = {
+1.0,
+1.0,
+2.0,
+6.0,
+24.0,
+120.0,
+720.0,
+5040.0,
+40320.0,
+362880.0,
+3628800.0,
+39916800.0,
+479001600.0,
+6227020800.0,
+87178291200.0,
+1307674368000.0,
+20922789888000.0,
+355687428096000.0,
+6402373705728000.0,
+121645100408832000.0,
+2432902008176640000.0,
+51090942171709440000.0,
+1124000727777607680000.0,
+},
+};
+#endif
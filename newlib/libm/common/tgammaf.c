@@ -0,0 +1,33 @@
+/* Single-precision tgamma function.
+   Copyright (c) 2026 The newlib contributors.
+
+   Permission to use, copy, modify, and distribute this software
+   is freely granted, provided that this notice is preserved.  */
+
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include <math.h>
+#include <stdint.h>
+#include "math_config.h"
+
+/* The double precision tgamma is accurate to a few ULP and cannot
+   overflow or underflow for arguments in float range other than the
+   poles, so its result rounded to float is within 0.51 ULP.  Only the
+   float overflow and underflow need handling here.  */
+float
+tgammaf (float x)
+{
+  double y;
+  float r;
+
+  y = tgamma (x);
+  r = (float) y;
+  if (unlikely (isinf (r) && !isinf (y)))
+    return __math_oflowf (asuint64 (y) >> 63);
+  if (unlikely (r == 0.0f && y != 0.0))
+    return __math_uflowf (asuint64 (y) >> 63);
+  return r;
+}
+#endif
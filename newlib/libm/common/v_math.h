@@ -0,0 +1,820 @@
+/* Vector (SIMD) variants of exp, exp2, log, log2, pow, expf, logf, powf,
+   sinf and cosf, derived from the scalar code of Arm's optimized-routines.
+   Copyright (c) 2018 Arm Ltd.  All rights reserved.
+   Copyright (c) 2026 The newlib contributors.
+
+   SPDX-License-Identifier: BSD-3-Clause
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+   3. The name of the company may not be used to endorse or promote
+      products derived from this software without specific prior written
+      permission.
+
+   THIS SOFTWARE IS PROVIDED BY ARM LTD ``AS IS'' AND ANY EXPRESS OR IMPLIED
+   WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+   MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+   IN NO EVENT SHALL ARM LTD BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+   TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. */
+
+/* This file is included by the machine specific vector math sources after
+   math_config.h and sincosf.h, with the following defined:
+
+     V_ISA	   the vector ABI ISA letter (b, c, d, e for x86_64 SSE2, AVX,
+		   AVX2 and AVX512, n for AArch64 AdvSIMD),
+     V_F64_LANES   the number of double lanes in a vector register,
+     V_F32_LANES   the number of float lanes, twice V_F64_LANES,
+     V_ABI	   optionally, attributes for the vector calling convention.
+
+   The functions are written with the GCC vector extensions and follow the
+   scalar code in exp.c, exp2.c, log.c, log2.c, pow.c, sf_exp.c, sf_log.c,
+   sf_pow.c, sinf.c and cosf.c using the same data tables, so the results
+   are within the same error bounds.  Lanes that need the slow paths of the
+   scalar code (overflow, underflow, zero, negative, subnormal, inf and nan
+   inputs and the large argument reduction of sinf and cosf) are passed to
+   the scalar function, which also takes care of errno and the exceptions
+   for them.  The entry points use the vector function ABI names, e.g.
+   _ZGVbN2v_exp, so that GCC can call them from vectorized loops; see the
+   __simd__ declarations in math.h.  */
+
+#ifndef V_ABI
+# define V_ABI
+#endif
+
+#define V_NAME_(isa, lanes, args, fn) _ZGV ## isa ## N ## lanes ## args ## _ ## fn
+#define V_NAME(isa, lanes, args, fn) V_NAME_ (isa, lanes, args, fn)
+#define V_D1(fn) V_NAME (V_ISA, V_F64_LANES, v, fn)
+#define V_D2(fn) V_NAME (V_ISA, V_F64_LANES, vv, fn)
+#define V_F1(fn) V_NAME (V_ISA, V_F32_LANES, v, fn)
+#define V_F2(fn) V_NAME (V_ISA, V_F32_LANES, vv, fn)
+
+typedef double v_f64_t __attribute__ ((vector_size (V_F64_LANES * 8)));
+typedef uint64_t v_u64_t __attribute__ ((vector_size (V_F64_LANES * 8)));
+typedef int64_t v_s64_t __attribute__ ((vector_size (V_F64_LANES * 8)));
+typedef float v_f32_t __attribute__ ((vector_size (V_F32_LANES * 4)));
+typedef uint32_t v_u32_t __attribute__ ((vector_size (V_F32_LANES * 4)));
+typedef int32_t v_s32_t __attribute__ ((vector_size (V_F32_LANES * 4)));
+/* Half of the float lanes, one per double lane.  */
+typedef float v_f32h_t __attribute__ ((vector_size (V_F64_LANES * 4)));
+typedef int32_t v_s32h_t __attribute__ ((vector_size (V_F64_LANES * 4)));
+
+V_ABI v_f64_t V_D1 (exp) (v_f64_t);
+V_ABI v_f64_t V_D1 (exp2) (v_f64_t);
+V_ABI v_f64_t V_D1 (log) (v_f64_t);
+V_ABI v_f64_t V_D1 (log2) (v_f64_t);
+V_ABI v_f64_t V_D2 (pow) (v_f64_t, v_f64_t);
+V_ABI v_f32_t V_F1 (expf) (v_f32_t);
+V_ABI v_f32_t V_F1 (logf) (v_f32_t);
+V_ABI v_f32_t V_F2 (powf) (v_f32_t, v_f32_t);
+V_ABI v_f32_t V_F1 (sinf) (v_f32_t);
+V_ABI v_f32_t V_F1 (cosf) (v_f32_t);
+
+/* The vector { F (0), F (1), ... } over the double or float lanes.  This
+   is how table lookups are put together: GCC builds it in registers,
+   while storing to a vector lane by lane goes through memory.  */
+#define V_LANES_2(F) { F (0), F (1) }
+#define V_LANES_4(F) { F (0), F (1), F (2), F (3) }
+#define V_LANES_8(F) { F (0), F (1), F (2), F (3), F (4), F (5), F (6), F (7) }
+#define V_LANES_16(F) { F (0), F (1), F (2), F (3), F (4), F (5), F (6), \
+			F (7), F (8), F (9), F (10), F (11), F (12), F (13), \
+			F (14), F (15) }
+#define V_LANES__(n, F) V_LANES_ ## n (F)
+#define V_LANES_(n, F) V_LANES__ (n, F)
+#define V_LANES64(F) V_LANES_ (V_F64_LANES, F)
+#define V_LANES32(F) V_LANES_ (V_F32_LANES, F)
+
+/* BASE[IDX] for each lane; the index is in units of BASE elements.  */
+#define V_GATHER_LANE(j) base[idx[j]]
+
+static inline v_f64_t
+v_gather (const double *base, v_u64_t idx)
+{
+  return (v_f64_t) V_LANES64 (V_GATHER_LANE);
+}
+
+static inline v_u64_t
+v_gather_u64 (const uint64_t *base, v_u64_t idx)
+{
+  return (v_u64_t) V_LANES64 (V_GATHER_LANE);
+}
+
+/* Return nonzero if any lane of the comparison result M is set.  */
+static inline int
+v_any64 (v_s64_t m)
+{
+  uint64_t r = 0;
+  int i;
+
+  for (i = 0; i < V_F64_LANES; i++)
+    r |= m[i];
+  return unlikely (r != 0);
+}
+
+static inline int
+v_any32 (v_s32_t m)
+{
+  uint32_t r = 0;
+  int i;
+
+  for (i = 0; i < V_F32_LANES; i++)
+    r |= m[i];
+  return unlikely (r != 0);
+}
+
+static inline v_f64_t
+v_f64 (double x)
+{
+  return (v_f64_t) {0} + x;
+}
+
+/* Lanes of A where M is set, of B elsewhere.  */
+static inline v_f64_t
+v_sel_f64 (v_s64_t m, v_f64_t a, v_f64_t b)
+{
+  return (v_f64_t) (((v_u64_t) a & (v_u64_t) m) | ((v_u64_t) b & ~(v_u64_t) m));
+}
+
+/* Convert K to double, |K| < 2^51.  Unlike a lane-wise conversion this does
+   not need AVX512DQ on x86_64.  */
+static inline v_f64_t
+v_cvt_small_s64 (v_s64_t k)
+{
+  return (v_f64_t) ((v_u64_t) k + asuint64 (0x1.8p52)) - 0x1.8p52;
+}
+
+/* The float functions compute in double like the scalar ones.  Each half
+   of the float lanes is widened to a vector of doubles of the register
+   width, which GCC handles much better than a vector twice as wide.  */
+union v_f32_halves
+{
+  v_f32_t f;
+  v_s32_t s;
+  v_f32h_t fh[2];
+  v_s32h_t sh[2];
+};
+
+/* Float lanes H * V_F64_LANES ... of X as doubles.  */
+static inline v_f64_t
+v_half_f32 (v_f32_t x, int h)
+{
+  union v_f32_halves u = { .f = x };
+
+  return __builtin_convertvector (u.fh[h], v_f64_t);
+}
+
+static inline v_f64_t
+v_half_s32 (v_s32_t x, int h)
+{
+  union v_f32_halves u = { .s = x };
+
+  return __builtin_convertvector (u.sh[h], v_f64_t);
+}
+
+/* BASE[IDX * STRIDE] for float lanes H * V_F64_LANES ...  */
+#define V_GATHER_HALF_LANE(j) base[idx[(j) + h * V_F64_LANES] * stride]
+
+static inline v_f64_t
+v_gather_half (const double *base, int stride, v_u32_t idx, int h)
+{
+  return (v_f64_t) V_LANES64 (V_GATHER_HALF_LANE);
+}
+
+#define V_JOIN_LANE(j) \
+  ((j) < V_F64_LANES ? lo[(j) % V_F64_LANES] : hi[(j) % V_F64_LANES])
+
+/* Round the doubles LO and HI to the float lanes of the result.  */
+static inline v_f32_t
+v_join_f32 (v_f64_t lo64, v_f64_t hi64)
+{
+  v_f32h_t lo = __builtin_convertvector (lo64, v_f32h_t);
+  v_f32h_t hi = __builtin_convertvector (hi64, v_f32h_t);
+
+  return (v_f32_t) V_LANES32 (V_JOIN_LANE);
+}
+
+static inline v_s32_t
+v_join_mask (v_s64_t lo64, v_s64_t hi64)
+{
+  v_s32h_t lo = __builtin_convertvector (lo64, v_s32h_t);
+  v_s32h_t hi = __builtin_convertvector (hi64, v_s32h_t);
+
+  return (v_s32_t) V_LANES32 (V_JOIN_LANE);
+}
+
+#if HAVE_FAST_FMA
+/* The log and log2 tables only hold what the fma variant needs.  */
+static inline v_f64_t
+v_fma (v_f64_t x, v_f64_t y, v_f64_t z)
+{
+  v_f64_t r;
+  int i;
+
+  for (i = 0; i < V_F64_LANES; i++)
+    r[i] = __builtin_fma (x[i], y[i], z[i]);
+  return r;
+}
+#endif
+
+/* exp.c, exp2.c and the exp part of pow.c.  */
+
+#define EXP_N (1 << EXP_TABLE_BITS)
+#define EXP_C2 __exp_data.poly[5 - EXP_POLY_ORDER]
+#define EXP_C3 __exp_data.poly[6 - EXP_POLY_ORDER]
+#define EXP_C4 __exp_data.poly[7 - EXP_POLY_ORDER]
+#define EXP_C5 __exp_data.poly[8 - EXP_POLY_ORDER]
+
+/* Lanes with |X| >= 512 or nan, whose result may overflow or underflow.
+   Tiny X needs no special care here since no exceptions are raised.  */
+static inline v_s64_t
+v_exp_special (v_f64_t x)
+{
+  return ((v_u64_t) x >> 52 & 0x7ff) >= 0x408; /* top12 (512.0).  */
+}
+
+/* 2^(k/N) * (1 + P) with k from the low bits of KI: the table holds
+   2^(k/N) as scale * (1 + tail), so this is scale + scale * (tail + P).  */
+static inline v_f64_t
+v_exp_scale (v_u64_t ki, v_f64_t p)
+{
+  v_u64_t idx, tail, sbits;
+  v_f64_t scale, tmp;
+
+  idx = 2 * (ki & (EXP_N - 1));
+  tail = v_gather_u64 (__exp_data.tab, idx);
+  sbits = v_gather_u64 (__exp_data.tab + 1, idx);
+  /* This is only a valid scale when -1023*N < k < 1024*N.  */
+  sbits += ki << (52 - EXP_TABLE_BITS);
+  scale = (v_f64_t) sbits;
+  tmp = (v_f64_t) tail + p;
+  return scale + scale * tmp;
+}
+
+/* exp (X + XTAIL) for lanes that are not special.  */
+static inline v_f64_t
+v_exp_inline (v_f64_t x, v_f64_t xtail)
+{
+  v_f64_t z, kd, r, r2;
+  v_u64_t ki;
+
+  /* exp(x) = 2^(k/N) * exp(r), with exp(r) in [2^(-1/2N),2^(1/2N)].  */
+  z = __exp_data.invln2N * x;
+  kd = z + __exp_data.shift;
+  ki = (v_u64_t) kd;
+  kd -= __exp_data.shift;
+  r = x + kd * __exp_data.negln2hiN + kd * __exp_data.negln2loN;
+  r += xtail;
+  r2 = r * r;
+  return v_exp_scale (ki, r + r2 * (EXP_C2 + r * EXP_C3)
+			  + r2 * r2 * (EXP_C4 + r * EXP_C5));
+}
+
+V_ABI v_f64_t
+V_D1 (exp) (v_f64_t x)
+{
+  v_f64_t y;
+  v_s64_t special;
+  int i;
+
+  special = v_exp_special (x);
+  y = v_exp_inline (x, v_f64 (0.0));
+  if (v_any64 (special))
+    for (i = 0; i < V_F64_LANES; i++)
+      if (special[i])
+	y[i] = exp (x[i]);
+  return y;
+}
+
+V_ABI v_f64_t
+V_D1 (exp2) (v_f64_t x)
+{
+  const double *C = __exp_data.exp2_poly;
+  v_f64_t kd, r, r2, y;
+  v_u64_t ki;
+  v_s64_t special;
+  int i;
+
+  special = v_exp_special (x);
+  /* exp2(x) = 2^(k/N) * 2^r, with 2^r in [2^(-1/2N),2^(1/2N)].  */
+  kd = x + __exp_data.exp2_shift;
+  ki = (v_u64_t) kd;
+  kd -= __exp_data.exp2_shift;
+  r = x - kd;
+  r2 = r * r;
+  y = v_exp_scale (ki, r * C[0] + r2 * (C[1] + r * C[2])
+			 + r2 * r2 * (C[3] + r * C[4]));
+  if (v_any64 (special))
+    for (i = 0; i < V_F64_LANES; i++)
+      if (special[i])
+	y[i] = exp2 (x[i]);
+  return y;
+}
+
+/* log.c and log2.c.  */
+
+#define LOG_OFF 0x3fe6000000000000
+
+/* Lanes with x < 0x1p-1022, inf or nan.  */
+static inline v_s64_t
+v_log_special (v_u64_t ix)
+{
+  return (ix >> 48) - 0x0010 >= 0x7ff0 - 0x0010;
+}
+
+V_ABI v_f64_t
+V_D1 (log) (v_f64_t x)
+{
+  const double *A = __log_data.poly;
+  const double *B = __log_data.poly1;
+  v_f64_t z, r, r2, w, kd, hi, lo, y, invc, logc;
+  v_u64_t ix, iz, tmp, i;
+  v_s64_t special, near1;
+  int j;
+
+  ix = (v_u64_t) x;
+  special = v_log_special (ix);
+
+  /* x = 2^k z; where z is in range [OFF,2*OFF) and exact.  */
+  tmp = ix - LOG_OFF;
+  i = (tmp >> (52 - LOG_TABLE_BITS)) & ((1 << LOG_TABLE_BITS) - 1);
+  iz = ix - (tmp & 0xfffULL << 52);
+  z = (v_f64_t) iz;
+  kd = v_cvt_small_s64 ((v_s64_t) tmp >> 52);
+  i *= 2;
+  invc = v_gather (&__log_data.tab[0].invc, i);
+  logc = v_gather (&__log_data.tab[0].logc, i);
+
+  /* log(x) = log1p(z/c-1) + log(c) + k*Ln2.  */
+#if HAVE_FAST_FMA
+  r = v_fma (z, invc, v_f64 (-1.0));
+#else
+  {
+    v_f64_t chi, clo;
+
+    chi = v_gather (&__log_data.tab2[0].chi, i);
+    clo = v_gather (&__log_data.tab2[0].clo, i);
+    r = (z - chi - clo) * invc;
+  }
+#endif
+  w = kd * __log_data.ln2hi + logc;
+  hi = w + r;
+  lo = w - hi + r + kd * __log_data.ln2lo;
+  r2 = r * r;
+  y = lo + r2 * A[0] + r * r2 * (A[1] + r * A[2] + r2 * (A[3] + r * A[4])) + hi;
+
+  /* Close to 1.0 the scalar code uses a single polynomial, as here.  */
+  near1 = ix - asuint64 (1.0 - 0x1p-4) < asuint64 (1.0 + 0x1.09p-4)
+				       - asuint64 (1.0 - 0x1p-4);
+  if (v_any64 (near1))
+    {
+      v_f64_t r3, y1, rhi, rlo;
+
+      r = x - 1.0;
+      r2 = r * r;
+      r3 = r * r2;
+      y1 = r3 * (B[1] + r * B[2] + r2 * B[3]
+		 + r3 * (B[4] + r * B[5] + r2 * B[6]
+			 + r3 * (B[7] + r * B[8] + r2 * B[9] + r3 * B[10])));
+      w = r * 0x1p27;
+      rhi = r + w - w;
+      rlo = r - rhi;
+      w = rhi * rhi * B[0]; /* B[0] == -0.5.  */
+      hi = r + w;
+      lo = r - hi + w;
+      lo += B[0] * rlo * (rhi + r);
+      y1 += lo;
+      y1 += hi;
+      y = v_sel_f64 (near1, y1, y);
+    }
+  if (v_any64 (special))
+    for (j = 0; j < V_F64_LANES; j++)
+      if (special[j])
+	y[j] = log (x[j]);
+  return y;
+}
+
+V_ABI v_f64_t
+V_D1 (log2) (v_f64_t x)
+{
+  const double *A = __log2_data.poly;
+  const double *B = __log2_data.poly1;
+  const double InvLn2hi = __log2_data.invln2hi;
+  const double InvLn2lo = __log2_data.invln2lo;
+  v_f64_t z, r, r2, r4, kd, hi, lo, y, invc, logc, t1, t2, t3, p;
+  v_u64_t ix, iz, tmp, i;
+  v_s64_t special, near1;
+  int j;
+
+  ix = (v_u64_t) x;
+  special = v_log_special (ix);
+
+  /* x = 2^k z; where z is in range [OFF,2*OFF) and exact.  */
+  tmp = ix - LOG_OFF;
+  i = (tmp >> (52 - LOG2_TABLE_BITS)) & ((1 << LOG2_TABLE_BITS) - 1);
+  iz = ix - (tmp & 0xfffULL << 52);
+  z = (v_f64_t) iz;
+  kd = v_cvt_small_s64 ((v_s64_t) tmp >> 52);
+  i *= 2;
+  invc = v_gather (&__log2_data.tab[0].invc, i);
+  logc = v_gather (&__log2_data.tab[0].logc, i);
+
+  /* log2(x) = log2(z/c) + log2(c) + k.  */
+#if HAVE_FAST_FMA
+  r = v_fma (z, invc, v_f64 (-1.0));
+  t1 = r * InvLn2hi;
+  t2 = r * InvLn2lo + v_fma (r, v_f64 (InvLn2hi), -t1);
+#else
+  {
+    v_f64_t chi, clo, rhi, rlo;
+
+    chi = v_gather (&__log2_data.tab2[0].chi, i);
+    clo = v_gather (&__log2_data.tab2[0].clo, i);
+    r = (z - chi - clo) * invc;
+    rhi = (v_f64_t) ((v_u64_t) r & -1ULL << 32);
+    rlo = r - rhi;
+    t1 = rhi * InvLn2hi;
+    t2 = rlo * InvLn2hi + r * InvLn2lo;
+  }
+#endif
+  t3 = kd + logc;
+  hi = t3 + t1;
+  lo = t3 - hi + t1 + t2;
+  r2 = r * r;
+  r4 = r2 * r2;
+  p = A[0] + r * A[1] + r2 * (A[2] + r * A[3]) + r4 * (A[4] + r * A[5]);
+  y = lo + r2 * p + hi;
+
+  near1 = ix - asuint64 (1.0 - 0x1.5b51p-5) < asuint64 (1.0 + 0x1.6ab2p-5)
+					    - asuint64 (1.0 - 0x1.5b51p-5);
+  if (v_any64 (near1))
+    {
+      v_f64_t y1, rhi, rlo;
+
+      r = x - 1.0;
+      rhi = (v_f64_t) ((v_u64_t) r & -1ULL << 32);
+      rlo = r - rhi;
+      hi = rhi * InvLn2hi;
+      lo = rlo * InvLn2hi + r * InvLn2lo;
+      r2 = r * r;
+      r4 = r2 * r2;
+      p = r2 * (B[0] + r * B[1]);
+      y1 = hi + p;
+      lo += hi - y1 + p;
+      lo += r4 * (B[2] + r * B[3] + r2 * (B[4] + r * B[5])
+		  + r4 * (B[6] + r * B[7] + r2 * (B[8] + r * B[9])));
+      y1 += lo;
+      y = v_sel_f64 (near1, y1, y);
+    }
+  if (v_any64 (special))
+    for (j = 0; j < V_F64_LANES; j++)
+      if (special[j])
+	y[j] = log2 (x[j]);
+  return y;
+}
+
+/* pow.c.  */
+
+#define POW_OFF 0x3fe6955500000000
+
+/* log(x) + tail for positive normal IX, see log_inline in pow.c.  */
+static inline v_f64_t
+v_pow_log_inline (v_u64_t ix, v_f64_t *tail)
+{
+  const double *A = __pow_log_data.poly;
+  v_f64_t z, r, y, invc, logc, logctail, kd, hi, t1, t2, lo, lo1, lo2, lo3,
+	  lo4, p, zhi, zlo, rhi, rlo, ar, ar2, ar3, arhi, arhi2;
+  v_u64_t iz, tmp, i;
+
+  tmp = ix - POW_OFF;
+  i = (tmp >> (52 - POW_LOG_TABLE_BITS)) & ((1 << POW_LOG_TABLE_BITS) - 1);
+  iz = ix - (tmp & 0xfffULL << 52);
+  z = (v_f64_t) iz;
+  kd = v_cvt_small_s64 ((v_s64_t) tmp >> 52);
+  i *= 4;
+  invc = v_gather (&__pow_log_data.tab[0].invc, i);
+  logc = v_gather (&__pow_log_data.tab[0].logc, i);
+  logctail = v_gather (&__pow_log_data.tab[0].logctail, i);
+
+  /* Split z such that rhi, rlo and rhi*rhi are exact and |rlo| <= |r|.  */
+  zhi = (v_f64_t) ((iz + (1ULL << 31)) & (-1ULL << 32));
+  zlo = z - zhi;
+  rhi = zhi * invc - 1.0;
+  rlo = zlo * invc;
+  r = rhi + rlo;
+
+  /* k*Ln2 + log(c) + r.  */
+  t1 = kd * __pow_log_data.ln2hi + logc;
+  t2 = t1 + r;
+  lo1 = kd * __pow_log_data.ln2lo + logctail;
+  lo2 = t1 - t2 + r;
+
+  ar = A[0] * r; /* A[0] = -0.5.  */
+  ar2 = r * ar;
+  ar3 = r * ar2;
+  arhi = A[0] * rhi;
+  arhi2 = rhi * arhi;
+  hi = t2 + arhi2;
+  lo3 = rlo * (ar + arhi);
+  lo4 = t2 - hi + arhi2;
+  p = (ar3
+       * (A[1] + r * A[2] + ar2 * (A[3] + r * A[4] + ar2 * (A[5] + r * A[6]))));
+  lo = lo1 + lo2 + lo3 + lo4 + p;
+  y = hi + lo;
+  *tail = hi - y + lo;
+  return y;
+}
+
+V_ABI v_f64_t
+V_D2 (pow) (v_f64_t x, v_f64_t y)
+{
+  v_f64_t hi, lo, yhi, ylo, lhi, llo, ehi, elo, r;
+  v_u64_t ix, iy;
+  v_s64_t special;
+  int i;
+
+  ix = (v_u64_t) x;
+  iy = (v_u64_t) y;
+  /* x < 0x1p-1022, negative, inf or nan, or |y| < 0x1p-65, |y| >= 0x1p63
+     or nan: the scalar code sorts these out.  */
+  special = ((ix >> 52) - 0x001 >= 0x7ff - 0x001)
+	    | ((iy >> 52 & 0x7ff) - 0x3be >= 0x43e - 0x3be);
+
+  hi = v_pow_log_inline (ix, &lo);
+  yhi = (v_f64_t) (iy & -1ULL << 27);
+  ylo = y - yhi;
+  lhi = (v_f64_t) ((v_u64_t) hi & -1ULL << 27);
+  llo = hi - lhi + lo;
+  ehi = yhi * lhi;
+  elo = ylo * lhi + y * llo; /* |elo| < |ehi| * 2^-25.  */
+  special |= v_exp_special (ehi);
+  r = v_exp_inline (ehi, elo);
+  if (v_any64 (special))
+    for (i = 0; i < V_F64_LANES; i++)
+      if (special[i])
+	r[i] = pow (x[i], y[i]);
+  return r;
+}
+
+
+/* sf_exp.c and the exp2 part of sf_pow.c.  */
+
+#define EXP2F_N (1 << EXP2F_TABLE_BITS)
+
+/* 2^(k/N) * 2^r ~= s * (C0*r^3 + C1*r^2 + C2*r + 1) where SHIFT rounds Z
+   to k/N (or to k if Z is scaled by N, and then C is too) and r is what
+   is left.  */
+static inline v_f64_t
+v_exp2f_inline (v_f64_t z, const double *C, double shift)
+{
+  v_f64_t kd, r, r2, y;
+  v_u64_t ki, t;
+
+  kd = z + shift;
+  ki = (v_u64_t) kd;
+  kd -= shift;
+  r = z - kd;
+  t = v_gather_u64 (__exp2f_data.tab, ki & (EXP2F_N - 1));
+  t += ki << (52 - EXP2F_TABLE_BITS);
+  r2 = r * r;
+  y = (C[0] * r + C[1]) * r2 + (C[2] * r + 1);
+  return y * (v_f64_t) t;
+}
+
+static inline v_f64_t
+v_expf_half (v_f32_t x, int h)
+{
+  return v_exp2f_inline (__exp2f_data.invln2_scaled * v_half_f32 (x, h),
+			 __exp2f_data.poly_scaled, __exp2f_data.shift);
+}
+
+V_ABI v_f32_t
+V_F1 (expf) (v_f32_t x)
+{
+  v_f32_t y;
+  v_s32_t special;
+  int i;
+
+  /* |x| >= 88 or nan.  */
+  special = ((v_u32_t) x >> 20 & 0x7ff) >= (asuint (88.0f) >> 20);
+  y = v_join_f32 (v_expf_half (x, 0), v_expf_half (x, 1));
+  if (v_any32 (special))
+    for (i = 0; i < V_F32_LANES; i++)
+      if (special[i])
+	y[i] = expf (x[i]);
+  return y;
+}
+
+/* sf_log.c.  */
+
+#define LOGF_OFF 0x3f330000
+
+/* log(x) for lanes H, with x = 2^K Z and I the table index of Z.  */
+static inline v_f64_t
+v_logf_half (v_u32_t i, v_f32_t z, v_s32_t k, int h)
+{
+  const double *A = __logf_data.poly;
+  v_f64_t r, r2, y, y0, invc, logc;
+
+  invc = v_gather_half (&__logf_data.tab[0].invc, 2, i, h);
+  logc = v_gather_half (&__logf_data.tab[0].logc, 2, i, h);
+
+  /* log(x) = log1p(z/c-1) + log(c) + k*Ln2 */
+  r = v_half_f32 (z, h) * invc - 1;
+  y0 = logc + v_half_s32 (k, h) * __logf_data.ln2;
+  r2 = r * r;
+  y = A[1] * r + A[2];
+  y = A[0] * r2 + y;
+  return y * r2 + (y0 + r);
+}
+
+V_ABI v_f32_t
+V_F1 (logf) (v_f32_t x)
+{
+  v_u32_t ix, iz, tmp, i;
+  v_s32_t special, k;
+  v_f32_t y;
+  int j;
+
+  ix = (v_u32_t) x;
+  /* x < 0x1p-126, inf or nan.  */
+  special = ix - 0x00800000 >= 0x7f800000 - 0x00800000;
+
+  /* x = 2^k z; where z is in range [OFF,2*OFF] and exact.  */
+  tmp = ix - LOGF_OFF;
+  i = (tmp >> (23 - LOGF_TABLE_BITS)) & ((1 << LOGF_TABLE_BITS) - 1);
+  k = (v_s32_t) tmp >> 23; /* arithmetic shift */
+  iz = ix - (tmp & 0x1ff << 23);
+  y = v_join_f32 (v_logf_half (i, (v_f32_t) iz, k, 0),
+		  v_logf_half (i, (v_f32_t) iz, k, 1));
+  if (v_any32 (special))
+    for (j = 0; j < V_F32_LANES; j++)
+      if (special[j])
+	y[j] = logf (x[j]);
+  return y;
+}
+
+/* sf_pow.c.  */
+
+/* y * log2(x) for lanes H, scaled by POWF_SCALE, with x = 2^K Z and I the
+   table index of Z.  */
+static inline v_f64_t
+v_powf_ylogx (v_u32_t i, v_f32_t z, v_s32_t k, v_f32_t y, int h)
+{
+  const double *A = __powf_log2_data.poly;
+  v_f64_t r, r2, r4, p, q, l, y0, invc, logc;
+
+  invc = v_gather_half (&__powf_log2_data.tab[0].invc, 2, i, h);
+  logc = v_gather_half (&__powf_log2_data.tab[0].logc, 2, i, h);
+
+  /* log2(x) = log1p(z/c-1)/ln2 + log2(c) + k */
+  r = v_half_f32 (z, h) * invc - 1;
+  y0 = logc + v_half_s32 (k, h);
+  r2 = r * r;
+  l = A[0] * r + A[1];
+  p = A[2] * r + A[3];
+  r4 = r2 * r2;
+  q = A[4] * r + y0;
+  q = p * r2 + q;
+  l = l * r4 + q;
+  return v_half_f32 (y, h) * l;
+}
+
+/* |y*log(x)| >= 126.  */
+static inline v_s64_t
+v_powf_special (v_f64_t ylogx)
+{
+  return ((v_u64_t) ylogx >> 47 & 0xffff)
+	 >= (asuint64 (126.0 * POWF_SCALE) >> 47);
+}
+
+static inline v_f64_t
+v_powf_exp2 (v_f64_t ylogx)
+{
+#if TOINT_INTRINSICS
+  return v_exp2f_inline (ylogx, __exp2f_data.poly_scaled, __exp2f_data.shift);
+#else
+  return v_exp2f_inline (ylogx, __exp2f_data.poly, __exp2f_data.shift_scaled);
+#endif
+}
+
+V_ABI v_f32_t
+V_F2 (powf) (v_f32_t x, v_f32_t y)
+{
+  v_f64_t lo, hi;
+  v_u32_t ix, iy, iz, top, tmp, i;
+  v_s32_t special, k;
+  v_f32_t res;
+  int j;
+
+  ix = (v_u32_t) x;
+  iy = (v_u32_t) y;
+  /* x < 0x1p-126, negative, inf or nan, or y is 0, inf or nan.  */
+  special = (ix - 0x00800000 >= 0x7f800000 - 0x00800000)
+	    | (2 * iy - 1 >= 2u * 0x7f800000 - 1);
+
+  /* x = 2^k z; where z is in range [OFF,2*OFF] and exact.  */
+  tmp = ix - LOGF_OFF;
+  i = (tmp >> (23 - POWF_LOG2_TABLE_BITS))
+      & ((1 << POWF_LOG2_TABLE_BITS) - 1);
+  top = tmp & 0xff800000;
+  iz = ix - top;
+  k = (v_s32_t) top >> (23 - POWF_SCALE_BITS); /* arithmetic shift */
+  lo = v_powf_ylogx (i, (v_f32_t) iz, k, y, 0);
+  hi = v_powf_ylogx (i, (v_f32_t) iz, k, y, 1);
+  special |= v_join_mask (v_powf_special (lo), v_powf_special (hi));
+  res = v_join_f32 (v_powf_exp2 (lo), v_powf_exp2 (hi));
+  if (v_any32 (special))
+    for (j = 0; j < V_F32_LANES; j++)
+      if (special[j])
+	res[j] = powf (x[j], y[j]);
+  return res;
+}
+
+/* sinf.c and cosf.c.  */
+
+/* sin (X + N0 * PI/2) for |X| < 120.  */
+static inline v_f64_t
+v_sinf_half (v_f64_t x, uint64_t n0)
+{
+  const sincos_t *p = &__sincosf_table[0];
+  v_f64_t kd, x2, x3, x4, s, c;
+  v_u64_t n, odd;
+
+  /* Reduce x to [-PI/4, PI/4] as reduce_fast does, but round to nearest
+     with the usual shift since there is no vector lround.  */
+  kd = x * p->hpi_inv;
+#if !TOINT_INTRINSICS
+  kd *= 0x1p-24;
+#endif
+  kd += 0x1.8p52;
+  n = (v_u64_t) kd + n0;
+  kd -= 0x1.8p52;
+  x = x - kd * p->hpi;
+
+  /* Evaluate both polynomials of sinf_poly and pick per lane.  */
+  x2 = x * x;
+  x3 = x * x2;
+  x4 = x2 * x2;
+  s = x + x3 * p->s1 + x3 * x2 * (p->s2 + x2 * p->s3);
+  c = p->c0 + x2 * p->c1 + x4 * p->c2 + x4 * x2 * (p->c3 + x2 * p->c4);
+  odd = -(n & 1);
+  s = (v_f64_t) (((v_u64_t) c & odd) | ((v_u64_t) s & ~odd));
+  return (v_f64_t) ((v_u64_t) s ^ (n & 2) << 62);
+}
+
+/* |x| >= 120, inf or nan.  */
+static inline v_s32_t
+v_sinf_special (v_f32_t x)
+{
+  return ((v_u32_t) x >> 20 & 0x7ff) >= (asuint (120.0f) >> 20 & 0x7ff);
+}
+
+V_ABI v_f32_t
+V_F1 (sinf) (v_f32_t x)
+{
+  v_f32_t y;
+  v_s32_t special;
+  v_u32_t tiny;
+  int i;
+
+  special = v_sinf_special (x);
+  y = v_join_f32 (v_sinf_half (v_half_f32 (x, 0), 0),
+		  v_sinf_half (v_half_f32 (x, 1), 0));
+  /* As in sinf, the result is x for |x| < 0x1p-12, which also keeps the
+     sign of -0 that the polynomial loses.  */
+  tiny = (v_u32_t) (((v_u32_t) x >> 20 & 0x7ff)
+		    < (asuint (0x1p-12f) >> 20 & 0x7ff));
+  y = (v_f32_t) (((v_u32_t) x & tiny) | ((v_u32_t) y & ~tiny));
+  if (v_any32 (special))
+    for (i = 0; i < V_F32_LANES; i++)
+      if (special[i])
+	y[i] = sinf (x[i]);
+  return y;
+}
+
+V_ABI v_f32_t
+V_F1 (cosf) (v_f32_t x)
+{
+  v_f32_t y;
+  v_s32_t special;
+  int i;
+
+  special = v_sinf_special (x);
+  y = v_join_f32 (v_sinf_half (v_half_f32 (x, 0), 1),
+		  v_sinf_half (v_half_f32 (x, 1), 1));
+  if (v_any32 (special))
+    for (i = 0; i < V_F32_LANES; i++)
+      if (special[i])
+	y[i] = cosf (x[i]);
+  return y;
+}
@@ -73,9 +73,10 @@ double complex
 ccos(double complex z)
 {
 	double complex w;
-	double ch, sh;
+	double ch, sh, s, c;
 
 	_cchsh(cimag(z), &ch, &sh);
-	w = cos(creal(z)) * ch - (sin(creal(z)) * sh) * I;
+	sincos(creal(z), &s, &c);
+	w = c * ch - (s * sh) * I;
 	return w;
 }
@@ -40,9 +40,10 @@ float complex
 ccosf(float complex z)
 {
 	float complex w;
-	float ch, sh;
+	float ch, sh, s, c;
 
 	_cchshf(cimagf(z), &ch, &sh);
-	w = cosf(crealf(z)) * ch - (sinf(crealf(z)) * sh) * I;
+	sincosf(crealf(z), &s, &c);
+	w = c * ch - (s * sh) * I;
 	return w;
 }
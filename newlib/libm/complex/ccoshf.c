@@ -34,15 +34,18 @@
 
 #include <complex.h>
 #include <math.h>
+#include "cephes_subrf.h"
 
 float complex
 ccoshf(float complex z)
 {
 	float complex w;
-	float x, y;
+	float x, y, ch, sh, s, c;
 
 	x = crealf(z);
 	y = cimagf(z);
-	w = coshf(x) * cosf(y) + (sinhf(x) * sinf(y)) * I;
+	_cchshf(x, &ch, &sh);
+	sincosf(y, &s, &c);
+	w = ch * c + (sh * s) * I;
 	return w;
 }
@@ -36,23 +36,36 @@
 #include <math.h>
 #include "cephes_subr.h"
 
-/* calculate cosh and sinh */
+/* calculate cosh and sinh from a single exponential */
 
 void
 _cchsh(double x, double *c, double *s)
 {
-	double e, ei;
-
-	if (fabs(x) <= 0.5) {
-		*c = cosh(x);
-		*s = sinh(x);
-	} else {
-		e = exp(x);
+	double a, e, ei;
+
+	a = fabs(x);
+	if (a <= 0.5) {
+		/* With t = e^a - 1, cosh(a) = 1 + t^2 / 2(1 + t) and
+		   sinh(a) = t - t^2 / 2(1 + t), neither cancels.  */
+		e = expm1(a);
+		ei = e / (1.0 + e);
+		*c = 1.0 + 0.5 * e * ei;
+		*s = e - 0.5 * e * ei;
+	} else if (a < 22.0) {
+		e = exp(a);
 		ei = 0.5 / e;
 		e = 0.5 * e;
-		*s = e - ei;
 		*c = e + ei;
+		*s = e - ei;
+	} else if (a < 709.0) {
+		/* e^-a is below half an ulp of e^a / 2.  */
+		*c = *s = 0.5 * exp(a);
+	} else {
+		/* Split so that exp does not overflow before cosh does.  */
+		e = exp(0.5 * a);
+		*c = *s = (0.5 * e) * e;
 	}
+	*s = copysign(*s, x);
 }
 
 /* Program to subtract nearest integer multiple of PI */
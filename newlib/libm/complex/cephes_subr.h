@@ -1,5 +1,7 @@
 /* $NetBSD: cephes_subr.h,v 1.1 2007/08/20 16:01:33 drochner Exp $ */
 
 void _cchsh(double, double *, double *);
+/* GNU extension, declared here so the kernels need not set _GNU_SOURCE.  */
+void sincos(double, double *, double *);
 double _redupi(double);
 double _ctans(double complex);
@@ -36,23 +36,36 @@
 #include <math.h>
 #include "cephes_subrf.h"
 
-/* calculate cosh and sinh */
+/* calculate cosh and sinh from a single exponential */
 
 void
 _cchshf(float x, float *c, float *s)
 {
-	float e, ei;
-
-	if (fabsf(x) <= 0.5f) {
-		*c = coshf(x);
-		*s = sinhf(x);
-	} else {
-		e = expf(x);
+	float a, e, ei;
+
+	a = fabsf(x);
+	if (a <= 0.5f) {
+		/* With t = e^a - 1, cosh(a) = 1 + t^2 / 2(1 + t) and
+		   sinh(a) = t - t^2 / 2(1 + t), neither cancels.  */
+		e = expm1f(a);
+		ei = e / (1.0f + e);
+		*c = 1.0f + 0.5f * e * ei;
+		*s = e - 0.5f * e * ei;
+	} else if (a < 9.0f) {
+		e = expf(a);
 		ei = 0.5f / e;
 		e = 0.5f * e;
-		*s = e - ei;
 		*c = e + ei;
+		*s = e - ei;
+	} else if (a < 88.0f) {
+		/* e^-a is below half an ulp of e^a / 2.  */
+		*c = *s = 0.5f * expf(a);
+	} else {
+		/* Split so that expf does not overflow before coshf does.  */
+		e = expf(0.5f * a);
+		*c = *s = (0.5f * e) * e;
 	}
+	*s = copysignf(*s, x);
 }
 
 /* Program to subtract nearest integer multiple of PI */
@@ -1,5 +1,7 @@
 /* $NetBSD: cephes_subrf.h,v 1.1 2007/08/20 16:01:34 drochner Exp $ */
 
 void _cchshf(float, float *, float *);
+/* GNU extension, declared here so the kernels need not set _GNU_SOURCE.  */
+void sincosf(float, float *, float *);
 float _redupif(float);
 float _ctansf(float complex);
@@ -67,16 +67,18 @@ QUICKREF
 
 #include <complex.h>
 #include <math.h>
+#include "cephes_subr.h"
 
 double complex
 cexp(double complex z)
 {
 	double complex w;
-	double r, x, y;
+	double r, x, y, s, c;
 
 	x = creal(z);
 	y = cimag(z);
 	r = exp(x);
-	w = r * cos(y) + r * sin(y) * I;
+	sincos(y, &s, &c);
+	w = r * c + r * s * I;
 	return w;
 }
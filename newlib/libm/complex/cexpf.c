@@ -34,16 +34,18 @@
 
 #include <complex.h>
 #include <math.h>
+#include "cephes_subrf.h"
 
 float complex
 cexpf(float complex z)
 {
 	float complex w;
-	float r, x, y;
+	float r, x, y, s, c;
 
 	x = crealf(z);
 	y = cimagf(z);
 	r = expf(x);
-	w = r * cosf(y) + r * sinf(y) * I;
+	sincosf(y, &s, &c);
+	w = r * c + r * s * I;
 	return w;
 }
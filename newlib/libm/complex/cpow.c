@@ -76,12 +76,13 @@ QUICKREF
 
 #include <complex.h>
 #include <math.h>
+#include "cephes_subr.h"
 
 double complex
 cpow(double complex a, double complex z)
 {
 	double complex w;
-	double x, y, r, theta, absa, arga;
+	double x, y, r, theta, absa, arga, s, c;
 
 	x = creal(z);
 	y = cimag(z);
@@ -96,6 +97,7 @@ cpow(double complex a, double complex z)
 		r = r * exp(-y * arga);
 		theta = theta + y * log(absa);
 	}
-	w = r * cos(theta) + (r * sin(theta)) * I;
+	sincos(theta, &s, &c);
+	w = r * c + (r * s) * I;
 	return w;
 }
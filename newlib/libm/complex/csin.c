@@ -73,9 +73,10 @@ double complex
 csin(double complex z)
 {
 	double complex w;
-	double ch, sh;
+	double ch, sh, s, c;
 
 	_cchsh(cimag(z), &ch, &sh);
-	w = sin(creal(z)) * ch + (cos(creal(z)) * sh) * I;
+	sincos(creal(z), &s, &c);
+	w = s * ch + (c * sh) * I;
 	return w;
 }
@@ -40,9 +40,10 @@ float complex
 csinf(float complex z)
 {
 	float complex w;
-	float ch, sh;
+	float ch, sh, s, c;
 
 	_cchshf(cimagf(z), &ch, &sh);
-	w = sinf(crealf(z)) * ch + (cosf(crealf(z)) * sh) * I;
+	sincosf(crealf(z), &s, &c);
+	w = s * ch + (c * sh) * I;
 	return w;
 }
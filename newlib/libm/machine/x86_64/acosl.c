@@ -0,0 +1,16 @@
+/*
+ * Copyright (c) 2026 The newlib contributors.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+#include "x87_math.h"
+
+long double
+acosl (long double x)
+{
+  if (__builtin_expect (!(__builtin_fabsl (x) <= 1.0L), 0))
+    return isnan (x) ? x + x : __math_invalid (x);
+  return x87_fpatan (x87_fsqrt ((1.0L - x) * (1.0L + x)), x);
+}
@@ -0,0 +1,17 @@
+/*
+ * Copyright (c) 2026 The newlib contributors.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+#include "x87_math.h"
+
+long double
+asinl (long double x)
+{
+  if (__builtin_expect (!(__builtin_fabsl (x) <= 1.0L), 0))
+    return isnan (x) ? x + x : __math_invalid (x);
+  /* 1 - x^2 as a product: 1 - x is exact for x >= 0.5.  */
+  return x87_fpatan (x, x87_fsqrt ((1.0L - x) * (1.0L + x)));
+}
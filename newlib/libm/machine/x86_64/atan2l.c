@@ -0,0 +1,15 @@
+/*
+ * Copyright (c) 2026 The newlib contributors.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+#include "x87_math.h"
+
+/* fpatan handles the signed zeros and infinities as C99 requires.  */
+long double
+atan2l (long double y, long double x)
+{
+  return x87_fpatan (y, x);
+}
@@ -0,0 +1,14 @@
+/*
+ * Copyright (c) 2026 The newlib contributors.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+#include "x87_math.h"
+
+long double
+atanl (long double x)
+{
+  return x87_fpatan (x, 1.0L);
+}
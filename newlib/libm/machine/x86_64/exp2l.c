@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) 2026 The newlib contributors.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+#include "x87_math.h"
+
+long double
+exp2l (long double x)
+{
+  long double k;
+
+  if (__builtin_expect (!(__builtin_fabsl (x) < 16383.0L), 0))
+    {
+      if (!x87_isfinite (x))
+	return x == -INFINITY ? 0.0L : x + x;
+      if (x >= 16384.0L)
+	return __math_oflow (0);
+      if (x <= -16446.0L)
+	return __math_uflow (0);
+    }
+  /* x - k is exact.  */
+  k = x87_frndint (x);
+  return x87_exp2_reduced (k, x - k);
+}
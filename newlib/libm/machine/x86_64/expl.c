@@ -0,0 +1,26 @@
+/*
+ * Copyright (c) 2026 The newlib contributors.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+#include "x87_math.h"
+
+long double
+expl (long double x)
+{
+  long double k, t;
+
+  if (__builtin_expect (!(__builtin_fabsl (x) < 11356.0L), 0))
+    {
+      if (!x87_isfinite (x))
+	return x == -INFINITY ? 0.0L : x + x;
+      if (x > X87_EXP_OFLOW)
+	return __math_oflow (0);
+      if (x < X87_EXP_UFLOW)
+	return __math_uflow (0);
+    }
+  k = x87_exp_reduce (x, &t);
+  return x87_exp2_reduced (k, t);
+}
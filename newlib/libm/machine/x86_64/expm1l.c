@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2026 The newlib contributors.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+#include "x87_math.h"
+
+long double
+expm1l (long double x)
+{
+  long double k, t, s;
+
+  /* |x log2(e)| <= 0.5: the rounding of the product is relative, so
+     f2xm1 gives the result directly, also for tiny x.  */
+  if (__builtin_fabsl (x) <= 0.34L)
+    return x87_f2xm1 (x * X87_LOG2E);
+  if (__builtin_expect (!(__builtin_fabsl (x) < 64.0L), 0))
+    {
+      if (!x87_isfinite (x))
+	return x == -INFINITY ? -1.0L : x + x;
+      if (x > X87_EXP_OFLOW)
+	return __math_oflow (0);
+      if (x < 0)
+	/* e^x < 2^-92, -1 with inexact.  */
+	return -1.0L + 0x1p-100L;
+    }
+  k = x87_exp_reduce (x, &t);
+  t = x87_f2xm1 (t);
+  if (k > 64)
+    return x87_fscale (1.0L + t, k) - 1.0L;
+  /* 2^k (1 + t) - 1 with 2^k - 1 exact.  */
+  s = x87_fscale (1.0L, k);
+  return (s - 1.0L) + s * t;
+}
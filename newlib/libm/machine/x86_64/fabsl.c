@@ -0,0 +1,14 @@
+/*
+ * Copyright (c) 2026 The newlib contributors.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+#include <math.h>
+
+long double
+fabsl (long double x)
+{
+  return __builtin_fabsl (x);
+}
@@ -0,0 +1,21 @@
+/*
+ * Copyright (c) 2026 The newlib contributors.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+#include "x87_math.h"
+
+/* frndint in the current rounding mode is within 1 of x, so one step
+   corrects it; this avoids reloading the control word.  */
+long double
+floorl (long double x)
+{
+  long double t = x87_frndint (x);
+
+  if (t > x)
+    t = t - 1.0L;
+  /* The sign of a zero result is that of x in every rounding mode.  */
+  return t == 0 ? __builtin_copysignl (t, x) : t;
+}
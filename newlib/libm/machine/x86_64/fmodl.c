@@ -0,0 +1,18 @@
+/*
+ * Copyright (c) 2026 The newlib contributors.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+#include "x87_math.h"
+
+/* fprem is exact.  */
+long double
+fmodl (long double x, long double y)
+{
+  if (__builtin_expect ((y == 0 || !x87_isfinite (x))
+			&& !isnan (x) && !isnan (y), 0))
+    return __math_invalid (x);
+  return x87_fprem (x, y);
+}
@@ -0,0 +1,24 @@
+/*
+ * Copyright (c) 2026 The newlib contributors.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+#include "x87_math.h"
+
+long double
+log1pl (long double x)
+{
+  if (__builtin_expect (!(x > -1.0L && x <= __LDBL_MAX__), 0))
+    {
+      if (x == -1.0L)
+	return __math_divzero (1);
+      if (x < -1.0L)
+	return __math_invalid (x);
+      return x + x;
+    }
+  if (__builtin_fabsl (x) < 0.29L)
+    return x87_fyl2xp1 (x, X87_LN2);
+  return x87_fyl2x (1.0L + x, X87_LN2);
+}
@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) 2026 The newlib contributors.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+#include "x87_math.h"
+
+long double
+logl (long double x)
+{
+  if (__builtin_expect (!(x > 0 && x <= __LDBL_MAX__), 0))
+    {
+      if (x == 0)
+	return __math_divzero (1);
+      if (x < 0)
+	return __math_invalid (x);
+      /* +inf or nan.  */
+      return x + x;
+    }
+  /* Near 1 the result is small and fyl2x loses the low bits of x - 1,
+     which is exact here.  */
+  if (__builtin_fabsl (x - 1.0L) < 0.29L)
+    return x87_fyl2xp1 (x - 1.0L, X87_LN2);
+  return x87_fyl2x (x, X87_LN2);
+}
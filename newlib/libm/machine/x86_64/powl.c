@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2026 The newlib contributors.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+#include "x87_math.h"
+
+/* Returns 0 if not an integer, 1 if odd, 2 if even.  */
+static inline int
+checkint (long double y)
+{
+  if (x87_frndint (y) != y)
+    return 0;
+  if (__builtin_fabsl (y) >= 0x1p64L)
+    return 2;
+  return (uint64_t) __builtin_fabsl (y) & 1 ? 1 : 2;
+}
+
+/* a * b = hi + *LO exactly, with Veltkamp splitting into 32-bit halves.  */
+static inline long double
+mul_exact (long double a, long double b, long double *lo)
+{
+  long double ah, al, bh, bl, hi, t;
+
+  t = a * (0x1p32L + 1);
+  ah = t - (t - a);
+  al = a - ah;
+  t = b * (0x1p32L + 1);
+  bh = t - (t - b);
+  bl = b - bh;
+  hi = a * b;
+  *lo = ((ah * bh - hi) + ah * bl + al * bh) + al * bl;
+  return hi;
+}
+
+/* 2/(2j+3): log(1+u) = 2s + s^3 P(s^2), s = u/(2+u).  */
+static const long double P[] = {
+  0.666666666666666666666666666666666667L,
+  0.4L,
+  0.285714285714285714285714285714285714L,
+  0.222222222222222222222222222222222222L,
+  0.181818181818181818181818181818181818L,
+  0.153846153846153846153846153846153846L,
+  0.133333333333333333333333333333333333L,
+};
+
+/* log2(1 + i/32) = hi + lo for i = -9 .. 13.  */
+static const struct
+{
+  long double hi, lo;
+} T[] = {
+  {-0xf3efaff29c559a78p-65L, 0x95d4a6d897785542p-131L},
+  {-0xd47fcb8c0852f0c1p-65L, 0x802c48281a2eb745p-130L},
+  {-0xb6587b432e47501bp-65L, -0xda8120164a049665p-130L},
+  {-0x995ff71b8773432dp-65L, -0x925e378d67caee1ep-132L},
+  {-0xfafec54831f1a484p-66L, -0xfef64f0f62e7b465p-131L},
+  {-0xc544c055fde99333p-66L, -0xa9b7e2df60d2bdc6p-131L},
+  {-0x916d6e1559a4b697p-66L, 0xdc50cd8e31bb38f8p-131L},
+  {-0xbeb024b67dda633ap-67L, 0x975dc0e7a9636091p-133L},
+  {-0xbb9ca64ecac6aaefp-68L, -0xb8701fc10e3aeafep-134L},
+  {0, 0},
+  {0xb5d69bac77ec398ap-68L, -0x9f90f69483ef6df4p-133L},
+  {0xb31fb7d64898b3e6p-67L, 0xc53826144575ac3dp-132L},
+  {0x8462c466d3cf1cb1p-66L, 0xf78dfa14aa5157aap-132L},
+  {0xae00d1cfdeb43cfdp-66L, 0xb120a068badd124fp-139L},
+  {0xd67af16da7649f7fp-66L, 0x8f65e00c1b1a5a90p-134L},
+  {0xfde0b5c81340511dp-66L, 0x8d998a784ef35f25p-131L},
+  {0x92203d587039cc12p-65L, 0xb72974898077f77ap-131L},
+  {0xa4d3c25e68dc57f2p-65L, 0x92bf6ff4dafdb4cep-130L},
+  {0xb7110e6ce866f2bcp-65L, 0xd520b44f703c4432p-130L},
+  {0xc8ddd448f8b845a6p-65L, -0xd4afa947963aa79fp-130L},
+  {0xda3f5fb9c4150521p-65L, -0xb91070275d871524p-130L},
+  {0xeb3a9f01975077f2p-65L, -0xa0f337d555652818p-133L},
+  {0xfbd42b4658367671p-65L, -0xd9cfff75e149b953p-131L},
+};
+
+/* log2(e) = L2EHI + L2ELO.  */
+#define L2EHI 0xb8aa3b295c17f0bcp-63L
+#define L2ELO -0x82f0025f2dc582eep-128L
+
+/* log2(m) = hi + *LO for sqrt(1/2) <= m < sqrt(2), with about 2^-76
+   relative error.  fyl2x is only accurate to 2^-64, which the
+   multiplication by a large y would magnify.  m = c (1 + u) with
+   c = 1 + i/32 from the table so that |s| < 0.011: the polynomial part
+   is then below 2^-14 of the result and its rounding errors vanish.  */
+static long double
+log2_ext (long double m, long double *lo)
+{
+  long double c, f, g, glo, t, s, slo, z, p, r, hi, rlo, h;
+  int i, j;
+
+  /* Round to nearest independently of the rounding mode.  */
+  i = (int) ((m - 1.0L) * 32 + 9.5L);
+  c = 1.0L + (i - 9) * 0x1p-5L;
+  /* s = (m - c) / (m + c) = s + slo, f is exact and g + glo = m + c.  */
+  f = m - c;
+  g = m + c;
+  t = g - c;
+  glo = (c - (g - t)) + (m - t);
+  s = f / g;
+  t = mul_exact (s, g, &r);
+  slo = (((f - t) - r) - s * glo) / g;
+  z = s * s;
+  p = P[6];
+  for (j = 5; j >= 0; j--)
+    p = P[j] + z * p;
+  r = 2 * slo + s * z * p;
+  /* (2s + r) log2(e) + log2(c).  */
+  hi = mul_exact (2 * s, L2EHI, &rlo);
+  rlo += r * L2EHI + 2 * s * L2ELO;
+  h = T[i].hi + hi;
+  t = h - T[i].hi;
+  rlo += ((T[i].hi - (h - t)) + (hi - t)) + T[i].lo;
+  t = h + rlo;
+  *lo = rlo - (t - h);
+  return t;
+}
+
+/* x^y = 2^(y log2(x)) with x = 2^e m, sqrt(1/2) <= m < sqrt(2).  y e is
+   computed exactly as two terms and y log2(m) in double extended
+   precision, so the exponent is accurate to 2^-64 and the result to
+   about 1 ulp.  */
+long double
+powl (long double x, long double y)
+{
+  long double e, m, lm, lmlo, yh, yl, a, b, blo, k, f;
+  int sign = 0, yint;
+
+  if (__builtin_expect (y == 0 || x == 1.0L, 0))
+    return 1.0L;
+  if (__builtin_expect (isnan (x) || isnan (y), 0))
+    return x + y;
+  yint = checkint (y);
+  if (__builtin_expect (!x87_isfinite (y), 0))
+    {
+      if (__builtin_fabsl (x) == 1.0L)
+	return 1.0L;
+      return (__builtin_fabsl (x) < 1.0L) == (y < 0) ? INFINITY : 0.0L;
+    }
+  if (__builtin_expect (x == 0 || !x87_isfinite (x), 0))
+    {
+      /* +-0 or +-inf: the result is +-0 or +-inf, negative only for x < 0
+	 and odd integer y.  */
+      int neg = yint == 1 && __builtin_signbit (x);
+
+      if ((x == 0) == (y < 0))
+	{
+	  if (x == 0)
+	    return __math_divzero (neg);
+	  return neg ? -INFINITY : INFINITY;
+	}
+      return neg ? -0.0L : 0.0L;
+    }
+  if (y == 1)
+    return x;
+  if (x < 0)
+    {
+      if (yint == 0)
+	return __math_invalid (x);
+      sign = yint == 1;
+      x = -x;
+      if (x == 1.0L)
+	return sign ? -1.0L : 1.0L;
+    }
+  /* Correctly rounded unless the result overflows or underflows, which
+     is left to the code below.  */
+  if (y == 2 || y == -1)
+    {
+      f = y == 2 ? x * x : 1.0L / x;
+      if (f <= __LDBL_MAX__ && f >= __LDBL_MIN__)
+	return sign ? -f : f;
+    }
+
+  /* |log2(x)| > 2^-64 so y log2(x) is beyond the exponent range, and
+     the split of y below could overflow.  */
+  if (__builtin_expect (__builtin_fabsl (y) >= 0x1p80L, 0))
+    return (x < 1.0L) == (y < 0) ? __math_oflow (sign) : __math_uflow (sign);
+
+  m = x87_fxtract (x, &e);
+  if (m > 0xb504f333f9de6484p-63L)
+    {
+      m *= 0.5L;
+      e += 1.0L;
+    }
+  lm = log2_ext (m, &lmlo);
+
+  /* y = yh + yl with yh of 32 bits, |e| < 2^15 so yh e and yl e are
+     exact.  */
+  yh = y + y * 0x1p32L - y * 0x1p32L;
+  yl = y - yh;
+  a = yh * e;
+  b = mul_exact (y, lm, &blo);
+  blo += yl * e + y * lmlo;
+  if (__builtin_expect (!(__builtin_fabsl (a + b) < 16382.0L), 0))
+    {
+      if (a + b > 16385.0L)
+	return __math_oflow (sign);
+      if (a + b < -16447.0L)
+	return __math_uflow (sign);
+    }
+  k = x87_frndint (a + b);
+  f = ((a - k) + b) + blo;
+  f = x87_exp2_reduced (k, f);
+  if (__builtin_expect (!x87_isfinite (f), 0))
+    return __math_oflow (sign);
+  if (__builtin_expect (f == 0, 0))
+    return __math_uflow (sign);
+  return sign ? -f : f;
+}
@@ -0,0 +1,23 @@
+/*
+ * Copyright (c) 2026 The newlib contributors.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+#include "x87_math.h"
+
+long double
+sinl (long double x)
+{
+  long double r;
+  int n;
+
+  if (__builtin_fabsl (x) <= 0xc90fdaa22168c235p-64L)
+    return x87_fsin (x);
+  if (__builtin_expect (!x87_isfinite (x), 0))
+    return isnan (x) ? x + x : __math_invalid (x);
+  n = __x87_rem_pio2 (x, &r);
+  r = n & 1 ? x87_fcos (r) : x87_fsin (r);
+  return n & 2 ? -r : r;
+}
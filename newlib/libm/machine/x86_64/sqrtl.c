@@ -0,0 +1,16 @@
+/*
+ * Copyright (c) 2026 The newlib contributors.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+#include "x87_math.h"
+
+long double
+sqrtl (long double x)
+{
+  if (__builtin_expect (x < 0, 0))
+    return __math_invalid (x);
+  return x87_fsqrt (x);
+}
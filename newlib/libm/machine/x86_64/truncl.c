@@ -0,0 +1,18 @@
+/*
+ * Copyright (c) 2026 The newlib contributors.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+#include "x87_math.h"
+
+long double
+truncl (long double x)
+{
+  long double t = x87_frndint (x);
+
+  if (__builtin_fabsl (t) > __builtin_fabsl (x))
+    t -= __builtin_copysignl (1.0L, x);
+  return t == 0 ? __builtin_copysignl (t, x) : t;
+}
@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) 2026 The newlib contributors.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* AVX (ymm) variants of the vector math functions, see v_math.h.  */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH && defined (__GNUC__) && __GNUC__ >= 9 \
+    && !defined (__clang__)
+
+#include <stdint.h>
+#include <math.h>
+#include "math_config.h"
+#include "sincosf.h"
+
+/* After math_config.h, so that HAVE_FAST_FMA still matches the tables.  */
+#pragma GCC target ("avx")
+
+#define V_ISA c
+#define V_F64_LANES 4
+#define V_F32_LANES 8
+#include "v_math.h"
+
+#endif
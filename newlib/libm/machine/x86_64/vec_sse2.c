@@ -0,0 +1,24 @@
+/*
+ * Copyright (c) 2026 The newlib contributors.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* SSE2 (xmm) variants of the vector math functions, see v_math.h.  */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH && defined (__GNUC__) && __GNUC__ >= 9 \
+    && !defined (__clang__)
+
+#include <stdint.h>
+#include <math.h>
+#include "math_config.h"
+#include "sincosf.h"
+
+#define V_ISA b
+#define V_F64_LANES 2
+#define V_F32_LANES 4
+#include "v_math.h"
+
+#endif
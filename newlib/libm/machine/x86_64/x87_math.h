@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2026 The newlib contributors.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* Helpers for the long double functions, which use the x87 unit.  The
+   transcendental x87 instructions are accurate to about 1 ulp of the
+   80-bit format as long as their argument is reduced: f2xm1 wants
+   |x| <= 1, fyl2xp1 |x| < 1 - sqrt(2)/2 and fsin, fcos and fptan are
+   only used on [-pi/4, pi/4], where their internal 66-bit pi does not
+   matter.  The precision control must be left at 64 bits, which is the
+   default on x86_64.  */
+
+#ifndef _X87_MATH_H
+#define _X87_MATH_H
+
+#include <math.h>
+#include <stdint.h>
+#include "math_config.h"
+
+#define X87_LN2 0.693147180559945309417232121458176568L
+#define X87_LOG2E 1.44269504088896340735992468100189214L
+#define X87_LG2 0.301029995663981195213738894724493027L
+
+/* ln(LDBL_MAX) rounded down and ln(2^-16446) rounded down: expl
+   overflows above the first and rounds to 0 below the second.  */
+#define X87_EXP_OFLOW 0xb17217f7d1cf79abp-50L
+#define X87_EXP_UFLOW -0xb21dfe7f09e2baaap-50L
+
+/* ln2 = LN2HI + LN2LO where LN2HI has 48 bits so that k * LN2HI is exact
+   for |k| < 2^16.  */
+#define X87_LN2HI 0xb17217f7d1cfp-48L
+#define X87_LN2LO 0xf35793c7673007e6p-113L
+
+static inline long double
+x87_f2xm1 (long double x)
+{
+  __asm__ ("f2xm1" : "+t" (x));
+  return x;
+}
+
+/* x * 2^n, n is an integer.  */
+static inline long double
+x87_fscale (long double x, long double n)
+{
+  __asm__ ("fscale" : "+t" (x) : "u" (n));
+  return x;
+}
+
+static inline long double
+x87_frndint (long double x)
+{
+  __asm__ ("frndint" : "+t" (x));
+  return x;
+}
+
+/* y * log2(x).  */
+static inline long double
+x87_fyl2x (long double x, long double y)
+{
+  long double r;
+
+  __asm__ ("fyl2x" : "=t" (r) : "0" (x), "u" (y) : "st(1)");
+  return r;
+}
+
+/* y * log2(1 + x).  */
+static inline long double
+x87_fyl2xp1 (long double x, long double y)
+{
+  long double r;
+
+  __asm__ ("fyl2xp1" : "=t" (r) : "0" (x), "u" (y) : "st(1)");
+  return r;
+}
+
+/* atan(y / x) in the quadrant of (x, y).  */
+static inline long double
+x87_fpatan (long double y, long double x)
+{
+  long double r;
+
+  __asm__ ("fpatan" : "=t" (r) : "0" (x), "u" (y) : "st(1)");
+  return r;
+}
+
+static inline long double
+x87_fsqrt (long double x)
+{
+  __asm__ ("fsqrt" : "+t" (x));
+  return x;
+}
+
+static inline long double
+x87_fsin (long double x)
+{
+  __asm__ ("fsin" : "+t" (x));
+  return x;
+}
+
+static inline long double
+x87_fcos (long double x)
+{
+  __asm__ ("fcos" : "+t" (x));
+  return x;
+}
+
+static inline long double
+x87_fptan (long double x)
+{
+  __asm__ ("fptan\n\tfstp %%st(0)" : "+t" (x));
+  return x;
+}
+
+/* x = 2^e * m with 1 <= |m| < 2, x finite and nonzero.  */
+static inline long double
+x87_fxtract (long double x, long double *e)
+{
+  long double m;
+
+  __asm__ ("fxtract" : "=t" (m), "=u" (*e) : "0" (x));
+  return m;
+}
+
+/* Partial remainders, repeated until complete.  fprem truncates the
+   quotient like fmod, fprem1 rounds it to nearest like remainder.  */
+static inline long double
+x87_fprem (long double x, long double y)
+{
+  __asm__ ("1:\tfprem\n\tfnstsw %%ax\n\ttestl $0x400, %%eax\n\tjnz 1b"
+	   : "+t" (x) : "u" (y) : "ax", "cc");
+  return x;
+}
+
+static inline long double
+x87_fprem1 (long double x, long double y)
+{
+  __asm__ ("1:\tfprem1\n\tfnstsw %%ax\n\ttestl $0x400, %%eax\n\tjnz 1b"
+	   : "+t" (x) : "u" (y) : "ax", "cc");
+  return x;
+}
+
+/* |x| <= LDBL_MAX, false for inf and nan.  */
+static inline int
+x87_isfinite (long double x)
+{
+  return __builtin_fabsl (x) <= __LDBL_MAX__;
+}
+
+/* 2^(k + f) for |f| <= 1 and k integral.  */
+static inline long double
+x87_exp2_reduced (long double k, long double f)
+{
+  return x87_fscale (1.0L + x87_f2xm1 (f), k);
+}
+
+/* e^x = 2^k e^r with r = x - k ln2 in extended precision, so that the
+   rounding of x * log2(e) does not leak into the result; for |x| in the
+   thousands it would cost up to 2^14 ulp.  Returns k and sets *T to
+   r * log2(e), |*T| <= 0.5.  */
+static inline long double
+x87_exp_reduce (long double x, long double *t)
+{
+  long double k, r;
+
+  k = x87_frndint (x * X87_LOG2E);
+  r = (x - k * X87_LN2HI) - k * X87_LN2LO;
+  *t = r * X87_LOG2E;
+  return k;
+}
+
+int __x87_rem_pio2 (long double, long double *) HIDDEN;
+
+#endif
@@ -123,7 +123,7 @@ static float zero  =  0.0000000000e+00;
 			q1 = tmp;
 		}
 		m = n+n;
-		for(t=zero, i = 2*(n+k); i>=m; i -= 2) t = one/(i/x-t);
+		for(t=zero, i = 2*(n+k); i>=m; i -= 2) t = x/(i-x*t);
 		a = t;
 		b = one;
 		/*  estimate log((2/x)^n*n!) = n*log(2/x)+n*ln(n)
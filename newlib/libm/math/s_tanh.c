@@ -69,6 +69,7 @@ PORTABILITY
  */
 
 #include "fdlibm.h"
+#if __OBSOLETE_MATH
 
 #ifndef _DOUBLE_IS_32BITS
 
@@ -117,3 +118,4 @@ static double one=1.0, two=2.0, tiny = 1.0e-300;
 }
 
 #endif /* _DOUBLE_IS_32BITS */
+#endif /* __OBSOLETE_MATH */
@@ -71,7 +71,6 @@ MATHREF
  */
 
 #include "fdlibm.h"
-#include <errno.h>
 
 #ifndef _DOUBLE_IS_32BITS
 
@@ -82,19 +81,10 @@ MATHREF
 	double x;
 #endif
 {
-#ifdef _IEEE_LIBM
+	if(WANT_ERRNO && unlikely(x<1.0))
+	    /* acosh(x<1) */
+	    return __math_edom(__ieee754_acosh(x));
 	return __ieee754_acosh(x);
-#else
-	double z;
-	z = __ieee754_acosh(x);
-	if(_LIB_VERSION == _IEEE_ || isnan(x)) return z;
-	if(x<1.0) {
-            /* acosh(x<1) */
-	    errno = EDOM;
-	    return 0.0/0.0;
-	} else
-	    return z;
-#endif
 }
 
 #endif /* defined(_DOUBLE_IS_32BITS) */
@@ -68,7 +68,7 @@ MATHREF
 
 
 #include "fdlibm.h"
-#include <errno.h>
+#if __OBSOLETE_MATH
 
 #ifndef _DOUBLE_IS_32BITS
 
@@ -79,19 +79,11 @@ MATHREF
 	double x;
 #endif
 {
-#ifdef _IEEE_LIBM
-	return __ieee754_asin(x);
-#else
-	double z;
-	z = __ieee754_asin(x);
-	if(_LIB_VERSION == _IEEE_ || isnan(x)) return z;
-	if(fabs(x)>1.0) {
+	if(WANT_ERRNO && unlikely(fabs(x)>1.0))
 	    /* asin(|x|>1) */
-	    errno = EDOM;
-	    return nan("");
-	} else
-	    return z;
-#endif
+	    return __math_edom(__ieee754_asin(x));
+	return __ieee754_asin(x);
 }
 
 #endif /* defined(_DOUBLE_IS_32BITS) */
+#endif /* __OBSOLETE_MATH */
@@ -69,7 +69,6 @@ QUICKREF
  */
 
 #include "fdlibm.h"
-#include <errno.h>
 
 #ifndef _DOUBLE_IS_32BITS
 
@@ -80,26 +79,10 @@ QUICKREF
 	double x;
 #endif
 {
-#ifdef _IEEE_LIBM
+	if(WANT_ERRNO && unlikely(fabs(x)>=1.0))
+	    /* atanh(|x|>1) or atanh(|x|=1) */
+	    return __math_edom(__ieee754_atanh(x));
 	return __ieee754_atanh(x);
-#else
-	double z,y;
-	z = __ieee754_atanh(x);
-	if(_LIB_VERSION == _IEEE_ || isnan(x)) return z;
-	y = fabs(x);
-	if(y>=1.0) {
-	    if(y>1.0) {
-		/* atanh(|x|>1) */
-		errno = EDOM;
-		return 0.0/0.0;
-	    } else { 
-		/* atanh(|x|=1) */
-		errno = EDOM;
-		return x/0.0;	/* sign(x)*inf */
-	    }
-	} else
-	    return z;
-#endif
 }
 
 #endif /* defined(_DOUBLE_IS_32BITS) */
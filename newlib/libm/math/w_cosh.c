@@ -55,7 +55,7 @@ QUICKREF
  */
 
 #include "fdlibm.h"
-#include <errno.h>
+#if __OBSOLETE_MATH
 
 #ifndef _DOUBLE_IS_32BITS
  
@@ -66,19 +66,11 @@ QUICKREF
 	double x;
 #endif
 {
-#ifdef _IEEE_LIBM
-	return __ieee754_cosh(x);
-#else
-	double z;
-	z = __ieee754_cosh(x);
-	if(_LIB_VERSION == _IEEE_ || isnan(x)) return z;
-	if(fabs(x)>7.10475860073943863426e+02) {	
+	if(WANT_ERRNO && unlikely(fabs(x)>7.10475860073943863426e+02))
 	    /* cosh(finite) overflow */
-	    errno = ERANGE;
-	    return HUGE_VAL;
-	} else
-	    return z;
-#endif
+	    return __math_erange(__ieee754_cosh(x));
+	return __ieee754_cosh(x);
 }
 
 #endif /* defined(_DOUBLE_IS_32BITS) */
+#endif /* __OBSOLETE_MATH */
@@ -51,7 +51,6 @@ PORTABILITY
 
 #include "fdlibm.h"
 #if __OBSOLETE_MATH
-#include <errno.h>
 
 #ifndef _DOUBLE_IS_32BITS
 
@@ -70,25 +69,10 @@ u_threshold= -7.45133219101941108420e+02;  /* 0xc0874910, 0xD52D3051 */
 	double x;
 #endif
 {
-#ifdef _IEEE_LIBM
+	if(WANT_ERRNO && unlikely((x>o_threshold||x<u_threshold)&&finite(x)))
+	    /* exp(finite) overflow or underflow */
+	    return __math_erange(__ieee754_exp(x));
 	return __ieee754_exp(x);
-#else
-	double z;
-	z = __ieee754_exp(x);
-	if(_LIB_VERSION == _IEEE_) return z;
-	if(finite(x)) {
-	    if(x>o_threshold) {
-		/* exp(finite) overflow */
-		errno = ERANGE;
-		return HUGE_VAL;
-	    } else if(x<u_threshold) {
-		/* exp(finite) underflow */
-		errno = ERANGE;
-		return 0.0;
-	    } 
-	} 
-	return z;
-#endif
 }
 
 #endif /* defined(_DOUBLE_IS_32BITS) */
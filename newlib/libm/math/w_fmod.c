@@ -52,7 +52,6 @@ PORTABILITY
  */
 
 #include "fdlibm.h"
-#include <errno.h>
 
 #ifndef _DOUBLE_IS_32BITS
 
@@ -63,19 +62,10 @@ PORTABILITY
 	double x,y;
 #endif
 {
-#ifdef _IEEE_LIBM
-	return __ieee754_fmod(x,y);
-#else
-	double z;
-	z = __ieee754_fmod(x,y);
-	if(_LIB_VERSION == _IEEE_ ||isnan(y)||isnan(x)) return z;
-	if(y==0.0) {
+	if(WANT_ERRNO && unlikely(y==0.0&&!isnan(x)))
 	    /* fmod(x,0) */
-	    errno = EDOM;
-	    return 0.0/0.0;
-	} else
-	    return z;
-#endif
+	    return __math_edom(__ieee754_fmod(x,y));
+	return __ieee754_fmod(x,y);
 }
 
 #endif /* defined(_DOUBLE_IS_32BITS) */
@@ -137,7 +137,6 @@ in terms of the base return values, although the <[signgam]> global for
 
 #include "fdlibm.h"
 #include <reent.h>
-#include <errno.h>
 
 #ifndef _DOUBLE_IS_32BITS
 
@@ -148,18 +147,11 @@ in terms of the base return values, although the <[signgam]> global for
 	double x;
 #endif
 {
-#ifdef _IEEE_LIBM
-	return __ieee754_gamma_r(x,&(_REENT_SIGNGAM(_REENT)));
-#else
-        double y;
-        y = __ieee754_gamma_r(x,&(_REENT_SIGNGAM(_REENT)));
-        if(_LIB_VERSION == _IEEE_) return y;
-        if(!finite(y)&&finite(x)) {
+	double y = __ieee754_gamma_r(x,&(_REENT_SIGNGAM(_REENT)));
+	if(WANT_ERRNO && unlikely(!finite(y)&&finite(x)))
 	    /* gamma(finite) overflow */
-	    errno = ERANGE;
-        }
+	    return __math_erange(y);
 	return y;
-#endif
 }             
 
 #endif /* defined(_DOUBLE_IS_32BITS) */
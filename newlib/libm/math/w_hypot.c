@@ -49,7 +49,7 @@ PORTABILITY
  */
 
 #include "fdlibm.h"
-#include <errno.h>
+#if __OBSOLETE_MATH
 
 #ifndef _DOUBLE_IS_32BITS
 
@@ -60,19 +60,12 @@ PORTABILITY
 	double x,y;
 #endif
 {
-#ifdef _IEEE_LIBM
-	return __ieee754_hypot(x,y);
-#else
-	double z;
-	z = __ieee754_hypot(x,y);
-	if(_LIB_VERSION == _IEEE_) return z;
-	if((!finite(z))&&finite(x)&&finite(y)) {
+	double z = __ieee754_hypot(x,y);
+	if(WANT_ERRNO && unlikely(!finite(z)&&finite(x)&&finite(y)))
 	    /* hypot(finite,finite) overflow */
-	    errno = ERANGE;
-	    return HUGE_VAL;
-	} else
-	    return z;
-#endif
+	    return __math_erange(z);
+	return z;
 }
 
 #endif /* defined(_DOUBLE_IS_32BITS) */
+#endif /* __OBSOLETE_MATH */
@@ -90,7 +90,6 @@ None of the Bessel functions are in ANSI C.
  */
 
 #include "fdlibm.h"
-#include <errno.h>
 
 #ifndef _DOUBLE_IS_32BITS
 
@@ -101,18 +100,10 @@ None of the Bessel functions are in ANSI C.
 	double x;
 #endif
 {
-#ifdef _IEEE_LIBM
-	return __ieee754_j0(x);
-#else
-	double z = __ieee754_j0(x);
-	if(_LIB_VERSION == _IEEE_ || isnan(x)) return z;
-	if(fabs(x)>X_TLOSS) {
+	if(WANT_ERRNO && unlikely(fabs(x)>X_TLOSS))
 	    /* j0(|x|>X_TLOSS) */
-	    errno = ERANGE;
-	    return 0.0;
-	} else
-	    return z;
-#endif
+	    return __math_erange(0.0);
+	return __ieee754_j0(x);
 }
 
 #ifdef __STDC__
@@ -122,26 +113,10 @@ None of the Bessel functions are in ANSI C.
 	double x;
 #endif
 {
-#ifdef _IEEE_LIBM
+	if(WANT_ERRNO && unlikely(x<=0.0||x>X_TLOSS))
+	    /* y0(x<0) = NaN, y0(0) = -inf or y0(x>X_TLOSS) */
+	    return x<0.0 ? __math_edom(__ieee754_y0(x)) : __math_erange(__ieee754_y0(x));
 	return __ieee754_y0(x);
-#else
-	double z;
-	z = __ieee754_y0(x);
-	if(_LIB_VERSION == _IEEE_ || isnan(x) ) return z;
-        if(x < 0.0){
-	    /* y0(x<0) = NaN */
-	    errno = EDOM;
-        }
-        if(x == 0.0){
-	    /* y0(0) = -inf */
-	    errno = ERANGE;
-        }
-	if(x>X_TLOSS) {
-	    /* y0(x>X_TLOSS) */
-	    errno = ERANGE;
-	}
-	return z;
-#endif
 }
 
 #endif /* defined(_DOUBLE_IS_32BITS) */
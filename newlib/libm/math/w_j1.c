@@ -16,7 +16,6 @@
  */
 
 #include "fdlibm.h"
-#include <errno.h>
 
 #ifndef _DOUBLE_IS_32BITS
 
@@ -27,19 +26,10 @@
 	double x;
 #endif
 {
-#ifdef _IEEE_LIBM
-	return __ieee754_j1(x);
-#else
-	double z;
-	z = __ieee754_j1(x);
-	if(_LIB_VERSION == _IEEE_ || isnan(x) ) return z;
-	if(fabs(x)>X_TLOSS) {
+	if(WANT_ERRNO && unlikely(fabs(x)>X_TLOSS))
 	    /* j1(|x|>X_TLOSS) */
-	    errno = ERANGE;
-	    return 0.0;
-	} else
-	    return z;
-#endif
+	    return __math_erange(0.0);
+	return __ieee754_j1(x);
 }
 
 #ifdef __STDC__
@@ -49,26 +39,10 @@
 	double x;
 #endif
 {
-#ifdef _IEEE_LIBM
+	if(WANT_ERRNO && unlikely(x<=0.0||x>X_TLOSS))
+	    /* y1(x<0) = NaN, y1(0) = -inf or y1(x>X_TLOSS) */
+	    return x<0.0 ? __math_edom(__ieee754_y1(x)) : __math_erange(__ieee754_y1(x));
 	return __ieee754_y1(x);
-#else
-	double z;
-	z = __ieee754_y1(x);
-	if(_LIB_VERSION == _IEEE_ || isnan(x) ) return z;
-        if(x < 0.0){
-	    /* y1(x<0) = NaN */
-	    errno = EDOM;
-        }
-        if(x == 0.0){
-	    /* y1(0) = -inf */
-	    errno = ERANGE;
-        }
-	if(x>X_TLOSS) {
-	    /* y1(x>X_TLOSS) */
-	    errno = ERANGE;
-	}
-	return z;
-#endif
 }
 
 #endif /* defined(_DOUBLE_IS_32BITS) */
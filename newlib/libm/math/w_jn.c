@@ -38,7 +38,6 @@
  */
 
 #include "fdlibm.h"
-#include <errno.h>
 
 #ifndef _DOUBLE_IS_32BITS
 
@@ -49,19 +48,10 @@
 	double x; int n;
 #endif
 {
-#ifdef _IEEE_LIBM
-	return __ieee754_jn(n,x);
-#else
-	double z;
-	z = __ieee754_jn(n,x);
-	if(_LIB_VERSION == _IEEE_ || isnan(x) ) return z;
-	if(fabs(x)>X_TLOSS) {
+	if(WANT_ERRNO && unlikely(fabs(x)>X_TLOSS))
 	    /* jn(|x|>X_TLOSS) */
-	    errno = ERANGE;
-	    return 0.0;
-	} else
-	    return z;
-#endif
+	    return __math_erange(0.0);
+	return __ieee754_jn(n,x);
 }
 
 #ifdef __STDC__
@@ -71,26 +61,10 @@
 	double x; int n;
 #endif
 {
-#ifdef _IEEE_LIBM
+	if(WANT_ERRNO && unlikely(x<=0.0||x>X_TLOSS))
+	    /* yn(x<0) = NaN, yn(0) = -inf or yn(x>X_TLOSS) */
+	    return x<0.0 ? __math_edom(__ieee754_yn(n,x)) : __math_erange(__ieee754_yn(n,x));
 	return __ieee754_yn(n,x);
-#else
-	double z;
-	z = __ieee754_yn(n,x);
-	if(_LIB_VERSION == _IEEE_ || isnan(x) ) return z;
-        if(x < 0.0){
-	    /* yn(x<0) = NaN */
-	    errno = EDOM;
-        }
-        if(x == 0.0){
-	    /* yn(0) = -inf */
-	    errno = ERANGE;
-        }
-	if(x>X_TLOSS) {
-	    /* yn(x>X_TLOSS) */
-	    errno = ERANGE;
-	}
-	return z;
-#endif
 }
 
 #endif /* defined(_DOUBLE_IS_32BITS) */
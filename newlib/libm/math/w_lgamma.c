@@ -20,7 +20,6 @@
 
 #include "fdlibm.h"
 #include <reent.h>
-#include <errno.h>
 
 #ifndef _DOUBLE_IS_32BITS
 
@@ -31,18 +30,11 @@
 	double x;
 #endif
 {
-#ifdef _IEEE_LIBM
-	return __ieee754_lgamma_r(x,&(_REENT_SIGNGAM(_REENT)));
-#else
-        double y;
-        y = __ieee754_lgamma_r(x,&(_REENT_SIGNGAM(_REENT)));
-        if(_LIB_VERSION == _IEEE_) return y;
-        if(!finite(y)&&finite(x)) {
+	double y = __ieee754_lgamma_r(x,&(_REENT_SIGNGAM(_REENT)));
+	if(WANT_ERRNO && unlikely(!finite(y)&&finite(x)))
 	    /* lgamma(finite) overflow */
-	    errno = ERANGE;
-	}
+	    return __math_erange(y);
 	return y;
-#endif
 }             
 
 #endif /* defined(_DOUBLE_IS_32BITS) */
@@ -46,7 +46,6 @@ PORTABILITY
 
 #include "fdlibm.h"
 #if __OBSOLETE_MATH
-#include <errno.h>
 
 #ifndef _DOUBLE_IS_32BITS
 
@@ -57,22 +56,10 @@ PORTABILITY
 	double x;
 #endif
 {
-#ifdef _IEEE_LIBM
+	if(WANT_ERRNO && unlikely(x<=0.0))
+	    /* log(0) or log(x<0) */
+	    return x==0.0 ? __math_erange(__ieee754_log(x)) : __math_edom(__ieee754_log(x));
 	return __ieee754_log(x);
-#else
-	double z;
-	z = __ieee754_log(x);
-	if(_LIB_VERSION == _IEEE_ || isnan(x) || x > 0.0) return z;
-	if(x==0.0) {
-	    /* log(0) */
-	    errno = ERANGE;
-	    return -HUGE_VAL;
-	} else { 
-	    /* log(x<0) */
-	    errno = EDOM;
-	    return nan("");
-        }
-#endif
 }
 
 #endif /* defined(_DOUBLE_IS_32BITS) */
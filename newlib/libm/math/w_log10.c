@@ -46,7 +46,6 @@ PORTABILITY
  */
 
 #include "fdlibm.h"
-#include <errno.h>
 
 #ifndef _DOUBLE_IS_32BITS
 
@@ -57,25 +56,10 @@ PORTABILITY
 	double x;
 #endif
 {
-#ifdef _IEEE_LIBM
+	if(WANT_ERRNO && unlikely(x<=0.0))
+	    /* log10(0) or log10(x<0) */
+	    return x==0.0 ? __math_erange(__ieee754_log10(x)) : __math_edom(__ieee754_log10(x));
 	return __ieee754_log10(x);
-#else
-	double z;
-	z = __ieee754_log10(x);
-	if(_LIB_VERSION == _IEEE_ || isnan(x)) return z;
-	if(x<=0.0) {
-	    if(x==0.0) {
-		/* log10(0) */
-		errno = ERANGE;
-		return -HUGE_VAL;
-	    } else { 
-		/* log10(x<0) */
-		errno = EDOM;
-		return nan("");
-	    }
-	} else
-	    return z;
-#endif
 }
 
 #endif /* defined(_DOUBLE_IS_32BITS) */
@@ -51,10 +51,29 @@ PORTABILITY
 
 #include "fdlibm.h"
 #if __OBSOLETE_MATH
-#include <errno.h>
 
 #ifndef _DOUBLE_IS_32BITS
 
+/* Set errno for pow(x,y) = z when z is not finite or is zero.  Kept
+   out of line so the common path of the wrapper is the kernel call.  */
+static NOINLINE double
+pow_error(double x, double y, double z)
+{
+	if(isnan(y)) return z;
+	if(x==0.0) {
+	    if(finite(y)&&y<0.0)
+		/* 0**neg */
+		return __math_erange(z);
+	    return z;
+	}
+	if(!finite(x)||!finite(y)) return z;
+	if(isnan(z))
+	    /* neg**non-integral */
+	    return __math_edom(z);
+	/* pow(x,y) overflow or underflow */
+	return __math_erange(z);
+}
+
 #ifdef __STDC__
 	double pow(double x, double y)	/* wrapper pow */
 #else
@@ -62,42 +81,10 @@ PORTABILITY
 	double x,y;
 #endif
 {
-#ifdef _IEEE_LIBM
-	return  __ieee754_pow(x,y);
-#else
-	double z;
-	z=__ieee754_pow(x,y);
-	if(_LIB_VERSION == _IEEE_|| isnan(y)) return z;
-	if(x==0.0){ 
-	    if(y==0.0) {
-		/* pow(0.0,0.0) */
-		/* Not an error.  */
-		return 1.0;
-	    }
-	    if(finite(y)&&y<0.0) {
-		/* 0**neg */
-		errno = ERANGE;
-	    }
-	    return z;
-	}
-	if(!finite(z)) {
-	    if(finite(x)&&finite(y)) {
-	        if(isnan(z)) {
-		    /* neg**non-integral */
-		    errno = EDOM;
-	        } else {
-		    /* pow(x,y) overflow */
-		    errno = ERANGE;
-                }
-		return z;
-	    }
-	} 
-	if(z==0.0&&finite(x)&&finite(y)) {
-	    /* pow(x,y) underflow */
-	    errno = ERANGE;
-        } 
+	double z = __ieee754_pow(x,y);
+	if(WANT_ERRNO && unlikely(!finite(z)||z==0.0))
+	    return pow_error(x,y,z);
 	return z;
-#endif
 }
 
 #endif /* defined(_DOUBLE_IS_32BITS) */
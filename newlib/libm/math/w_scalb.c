@@ -18,7 +18,6 @@
  */
 
 #include "fdlibm.h"
-#include <errno.h>
 
 #ifndef _DOUBLE_IS_32BITS
 
@@ -37,27 +36,19 @@
 #endif
 #endif
 {
-#ifdef _IEEE_LIBM
-	return __ieee754_scalb(x,fn);
-#else
-	double z;
-	z = __ieee754_scalb(x,fn);
-	if(_LIB_VERSION == _IEEE_) return z;
-	if(!(finite(z)||isnan(z))&&finite(x)) {
-	    /* scalb overflow */
-	    errno = ERANGE;
-	    return (x > 0.0 ? HUGE_VAL : -HUGE_VAL);
+	double z = __ieee754_scalb(x,fn);
+	if(WANT_ERRNO && unlikely(!finite(z)||z==0.0)) {
+	    if(isinf(z)&&finite(x))
+		/* scalb overflow */
+		return __math_erange(x > 0.0 ? HUGE_VAL : -HUGE_VAL);
+	    if(z==0.0&&z!=x)
+		/* scalb underflow */
+		return __math_erange(copysign(0.0,x));
 	}
-	if(z==0.0&&z!=x) {
-	    /* scalb underflow */
-	    errno = ERANGE;
-	    return copysign(0.0,x);
-	} 
 #ifndef _SCALB_INT
-	if(!finite(fn)) errno = ERANGE;
+	if(WANT_ERRNO && unlikely(!finite(fn))) return __math_erange(z);
 #endif
 	return z;
-#endif 
 }
 
 #endif /* defined(_DOUBLE_IS_32BITS) */
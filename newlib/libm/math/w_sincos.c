@@ -1,7 +1,8 @@
-/* sincos -- currently no more efficient than two separate calls to
-   sin and cos. */
+/* sincos -- no more efficient than two separate calls to sin and cos.
+   Without __OBSOLETE_MATH, common/sincos.c shares one reduction.  */
 
 #include "fdlibm.h"
+#if __OBSOLETE_MATH
 #include <errno.h>
 
 #ifndef _DOUBLE_IS_32BITS
@@ -20,3 +21,4 @@
 }
 
 #endif /* defined(_DOUBLE_IS_32BITS) */
+#endif /* __OBSOLETE_MATH */
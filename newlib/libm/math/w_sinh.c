@@ -60,7 +60,7 @@ QUICKREF
  */
 
 #include "fdlibm.h"
-#include <errno.h>
+#if __OBSOLETE_MATH
 
 #ifndef _DOUBLE_IS_32BITS
 
@@ -71,19 +71,12 @@ QUICKREF
 	double x;
 #endif
 {
-#ifdef _IEEE_LIBM
-	return __ieee754_sinh(x);
-#else
-	double z; 
-	z = __ieee754_sinh(x);
-	if(_LIB_VERSION == _IEEE_) return z;
-	if(!finite(z)&&finite(x)) {
+	double z = __ieee754_sinh(x);
+	if(WANT_ERRNO && unlikely(!finite(z)&&finite(x)))
 	    /* sinh(finite) overflow */
-	    errno = ERANGE;
-	    return ((x>0.0) ? HUGE_VAL : -HUGE_VAL);
-	} else
-	    return z;
-#endif
+	    return __math_erange(z);
+	return z;
 }
 
 #endif /* defined(_DOUBLE_IS_32BITS) */
+#endif /* __OBSOLETE_MATH */
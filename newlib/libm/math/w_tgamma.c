@@ -16,6 +16,7 @@
  */
 
 #include "fdlibm.h"
+#if __OBSOLETE_MATH
 
 #ifndef _DOUBLE_IS_32BITS
 
@@ -30,19 +31,14 @@
 	int local_signgam;
 	y = __ieee754_gamma_r(x,&local_signgam);
 	if (local_signgam < 0) y = -y;
-#ifdef _IEEE_LIBM
-	return y;
-#else
-	if(_LIB_VERSION == _IEEE_) return y;
-
-	if(!finite(y)&&finite(x)) {
+	if(WANT_ERRNO && unlikely(!finite(y)&&finite(x))) {
 	  if(floor(x)==x&&x<=0.0)
 	    return __kernel_standard(x,x,41); /* tgamma pole */
 	  else
 	    return __kernel_standard(x,x,40); /* tgamma overflow */
 	}
 	return y;
-#endif
 }
 
 #endif /* defined(_DOUBLE_IS_32BITS) */
+#endif /* __OBSOLETE_MATH */
@@ -18,23 +18,13 @@
  */
 
 #include "fdlibm.h"
-#include <errno.h>
 
 	float acosf(float x)		/* wrapper acosf */
 {
-#ifdef _IEEE_LIBM
-	return __ieee754_acosf(x);
-#else
-	float z;
-	z = __ieee754_acosf(x);
-	if(_LIB_VERSION == _IEEE_ || isnan(x)) return z;
-	if(fabsf(x)>1.0f) {
+	if(WANT_ERRNO && unlikely(fabsf(x)>1.0f))
 	    /* acosf(|x|>1) */
-	    errno = EDOM;
-	    return nanf("");
-	} else
-	    return z;
-#endif
+	    return __math_edomf(__ieee754_acosf(x));
+	return __ieee754_acosf(x);
 }
 
 #ifdef _DOUBLE_IS_32BITS
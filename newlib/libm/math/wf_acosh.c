@@ -19,7 +19,6 @@
  */
 
 #include "fdlibm.h"
-#include <errno.h>
 
 #ifdef __STDC__
 	float acoshf(float x)		/* wrapper acoshf */
@@ -28,19 +27,10 @@
 	float x;
 #endif
 {
-#ifdef _IEEE_LIBM
-	return __ieee754_acoshf(x);
-#else
-	float z;
-	z = __ieee754_acoshf(x);
-	if(_LIB_VERSION == _IEEE_ || isnan(x)) return z;
-	if(x<1.0f) {
+	if(WANT_ERRNO && unlikely(x<1.0f))
 	    /* acoshf(x<1) */
-	    errno = EDOM;
-	    return 0.0f/0.0f;
-	} else
-	    return z;
-#endif
+	    return __math_edomf(__ieee754_acoshf(x));
+	return __ieee754_acoshf(x);
 }
 
 #ifdef _DOUBLE_IS_32BITS
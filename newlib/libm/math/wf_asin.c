@@ -20,7 +20,6 @@
 
 
 #include "fdlibm.h"
-#include <errno.h>
 
 #ifdef __STDC__
 	float asinf(float x)		/* wrapper asinf */
@@ -29,19 +28,10 @@
 	float x;
 #endif
 {
-#ifdef _IEEE_LIBM
-	return __ieee754_asinf(x);
-#else
-	float z;
-	z = __ieee754_asinf(x);
-	if(_LIB_VERSION == _IEEE_ || isnan(x)) return z;
-	if(fabsf(x)>1.0f) {
+	if(WANT_ERRNO && unlikely(fabsf(x)>1.0f))
 	    /* asinf(|x|>1) */
-	    errno = EDOM;
-	    return nanf("");
-	} else
-	    return z;
-#endif
+	    return __math_edomf(__ieee754_asinf(x));
+	return __ieee754_asinf(x);
 }
 
 #ifdef _DOUBLE_IS_32BITS
@@ -17,7 +17,6 @@
  */
 
 #include "fdlibm.h"
-#include <errno.h>
 
 #ifdef __STDC__
 	float atanhf(float x)		/* wrapper atanhf */
@@ -26,26 +25,10 @@
 	float x;
 #endif
 {
-#ifdef _IEEE_LIBM
+	if(WANT_ERRNO && unlikely(fabsf(x)>=1.0f))
+	    /* atanhf(|x|>1) or atanhf(|x|=1) */
+	    return __math_edomf(__ieee754_atanhf(x));
 	return __ieee754_atanhf(x);
-#else
-	float z,y;
-	z = __ieee754_atanhf(x);
-	if(_LIB_VERSION == _IEEE_ || isnan(x)) return z;
-	y = fabsf(x);
-	if(y>=1.0f) {
-	    if(y>1.0f) {
-		/* atanhf(|x|>1) */
-		errno = EDOM;
-		return 0.0f/0.0f;
-	    } else { 
-		/* atanhf(|x|=1) */
-		errno = EDOM;
-		return x/0.0f;	/* sign(x)*inf */
-	    }
-	} else
-	    return z;
-#endif
 }
 
 #ifdef _DOUBLE_IS_32BITS
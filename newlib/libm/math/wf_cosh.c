@@ -18,7 +18,6 @@
  */
 
 #include "fdlibm.h"
-#include <errno.h>
 
 #ifdef __STDC__
 	float coshf(float x)		/* wrapper coshf */
@@ -27,19 +26,10 @@
 	float x;
 #endif
 {
-#ifdef _IEEE_LIBM
-	return __ieee754_coshf(x);
-#else
-	float z;
-	z = __ieee754_coshf(x);
-	if(_LIB_VERSION == _IEEE_ || isnan(x)) return z;
-	if(fabsf(x)>8.9415985107e+01f) {
+	if(WANT_ERRNO && unlikely(fabsf(x)>8.9415985107e+01f))
 	    /* coshf(finite) overflow */
-	    errno = ERANGE;
-	    return HUGE_VALF;
-	} else
-	    return z;
-#endif
+	    return __math_erangef(__ieee754_coshf(x));
+	return __ieee754_coshf(x);
 }
 
 #ifdef _DOUBLE_IS_32BITS
@@ -19,7 +19,6 @@
 
 #include "fdlibm.h"
 #if __OBSOLETE_MATH
-#include <errno.h>
 
 #ifdef __STDC__
 static const float
@@ -36,25 +35,10 @@ u_threshold= -1.0397208405e+02;  /* 0xc2cff1b5 */
 	float x;
 #endif
 {
-#ifdef _IEEE_LIBM
+	if(WANT_ERRNO && unlikely((x>o_threshold||x<u_threshold)&&finitef(x)))
+	    /* expf(finite) overflow or underflow */
+	    return __math_erangef(__ieee754_expf(x));
 	return __ieee754_expf(x);
-#else
-	float z;
-	z = __ieee754_expf(x);
-	if(_LIB_VERSION == _IEEE_) return z;
-	if(finitef(x)) {
-	    if(x>o_threshold) {
-		/* expf(finite) overflow */
-		errno = ERANGE;
-	        return HUGE_VALF;
-	    } else if(x<u_threshold) {
-		/* expf(finite) underflow */
-		errno = ERANGE;
-		return 0.0f;
-	    } 
-	} 
-	return z;
-#endif
 }
 
 #ifdef _DOUBLE_IS_32BITS
@@ -18,7 +18,6 @@
  */
 
 #include "fdlibm.h"
-#include <errno.h>
 
 #ifdef __STDC__
 	float fmodf(float x, float y)	/* wrapper fmodf */
@@ -27,19 +26,10 @@
 	float x,y;
 #endif
 {
-#ifdef _IEEE_LIBM
+	if(WANT_ERRNO && unlikely(y==0.0f&&!isnan(x)))
+	    /* fmodf(x,0) */
+	    return __math_edomf(__ieee754_fmodf(x,y));
 	return __ieee754_fmodf(x,y);
-#else
-	float z;
-	z = __ieee754_fmodf(x,y);
-	if(_LIB_VERSION == _IEEE_ ||isnan(y)||isnan(x)) return z;
-	if(y==0.0f) {
-            /* fmodf(x,0) */
-	    errno = EDOM;
-	    return  0.0f/0.0f;
-	} else
-	    return z;
-#endif
 }
 
 #ifdef _DOUBLE_IS_32BITS
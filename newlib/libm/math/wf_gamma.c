@@ -16,7 +16,6 @@
 
 #include "fdlibm.h"
 #include <reent.h>
-#include <errno.h>
 
 #ifdef __STDC__
 	float gammaf(float x)
@@ -25,18 +24,11 @@
 	float x;
 #endif
 {
-#ifdef _IEEE_LIBM
-	return __ieee754_gammaf_r(x,&(_REENT_SIGNGAM(_REENT)));
-#else
-        float y;
-        y = __ieee754_gammaf_r(x,&(_REENT_SIGNGAM(_REENT)));
-        if(_LIB_VERSION == _IEEE_) return y;
-        if(!finitef(y)&&finitef(x)) {
+	float y = __ieee754_gammaf_r(x,&(_REENT_SIGNGAM(_REENT)));
+	if(WANT_ERRNO && unlikely(!finitef(y)&&finitef(x)))
 	    /* gammaf(finite) overflow */
-	    errno = ERANGE;
-        }
+	    return __math_erangef(y);
 	return y;
-#endif
 }             
 
 #ifdef _DOUBLE_IS_32BITS
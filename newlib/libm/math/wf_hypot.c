@@ -18,7 +18,6 @@
  */
 
 #include "fdlibm.h"
-#include <errno.h>
 
 #ifdef __STDC__
 	float hypotf(float x, float y)	/* wrapper hypotf */
@@ -27,19 +26,11 @@
 	float x,y;
 #endif
 {
-#ifdef _IEEE_LIBM
-	return __ieee754_hypotf(x,y);
-#else
-	float z;
-	z = __ieee754_hypotf(x,y);
-	if(_LIB_VERSION == _IEEE_) return z;
-	if((!finitef(z))&&finitef(x)&&finitef(y)) {
+	float z = __ieee754_hypotf(x,y);
+	if(WANT_ERRNO && unlikely(!finitef(z)&&finitef(x)&&finitef(y)))
 	    /* hypotf(finite,finite) overflow */
-	    errno = ERANGE;
-	    return HUGE_VALF;
-	} else
-	    return z;
-#endif
+	    return __math_erangef(z);
+	return z;
 }
 
 #ifdef _DOUBLE_IS_32BITS
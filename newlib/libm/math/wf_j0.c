@@ -18,7 +18,6 @@
  */
 
 #include "fdlibm.h"
-#include <errno.h>
 
 #ifdef __STDC__
 	float j0f(float x)		/* wrapper j0f */
@@ -27,17 +26,10 @@
 	float x;
 #endif
 {
-#ifdef _IEEE_LIBM
-	return __ieee754_j0f(x);
-#else
-	float z = __ieee754_j0f(x);
-	if(_LIB_VERSION == _IEEE_ || isnan(x)) return z;
-	if(fabsf(x)>(float)X_TLOSS) {
+	if(WANT_ERRNO && unlikely(fabsf(x)>(float)X_TLOSS))
 	    /* j0f(|x|>X_TLOSS) */
-	    errno = ERANGE;
-	}
-	return z;
-#endif
+	    return __math_erangef(__ieee754_j0f(x));
+	return __ieee754_j0f(x);
 }
 
 #ifdef __STDC__
@@ -47,26 +39,10 @@
 	float x;
 #endif
 {
-#ifdef _IEEE_LIBM
+	if(WANT_ERRNO && unlikely(x<=0.0f||x>(float)X_TLOSS))
+	    /* y0f(x<0) = NaN, y0f(0) = -inf or y0f(x>X_TLOSS) */
+	    return x<0.0f ? __math_edomf(__ieee754_y0f(x)) : __math_erangef(__ieee754_y0f(x));
 	return __ieee754_y0f(x);
-#else
-	float z;
-	z = __ieee754_y0f(x);
-	if(_LIB_VERSION == _IEEE_ || isnan(x) ) return z;
-        if(x < 0.0f){
-	    /* y0f(x<0) = NaN */
-	    errno = EDOM;
-        }
-	if (x == 0.0f){
-	    /* y0f(n,0) = -inf */
-	    errno = ERANGE;
-	}
-	if(x>(float)X_TLOSS) {
-	    /* y0f(x>X_TLOSS) */
-	    errno = ERANGE;
-	}
-	return z;
-#endif
 }
 
 #ifdef _DOUBLE_IS_32BITS
@@ -18,7 +18,6 @@
  */
 
 #include "fdlibm.h"
-#include <errno.h>
 
 
 #ifdef __STDC__
@@ -28,19 +27,10 @@
 	float x;
 #endif
 {
-#ifdef _IEEE_LIBM
-	return __ieee754_j1f(x);
-#else
-	float z;
-	z = __ieee754_j1f(x);
-	if(_LIB_VERSION == _IEEE_ || isnan(x) ) return z;
-	if(fabsf(x)>(float)X_TLOSS) {
+	if(WANT_ERRNO && unlikely(fabsf(x)>(float)X_TLOSS))
 	    /* j1f(|x|>X_TLOSS) */
-	    errno = ERANGE;
-	    return 0.0f;
-	} else
-	    return z;
-#endif
+	    return __math_erangef(0.0f);
+	return __ieee754_j1f(x);
 }
 
 #ifdef __STDC__
@@ -50,26 +40,10 @@
 	float x;
 #endif
 {
-#ifdef _IEEE_LIBM
+	if(WANT_ERRNO && unlikely(x<=0.0f||x>(float)X_TLOSS))
+	    /* y1f(x<0) = NaN, y1f(0) = -inf or y1f(x>X_TLOSS) */
+	    return x<0.0f ? __math_edomf(__ieee754_y1f(x)) : __math_erangef(__ieee754_y1f(x));
 	return __ieee754_y1f(x);
-#else
-	float z;
-	z = __ieee754_y1f(x);
-	if(_LIB_VERSION == _IEEE_ || isnan(x) ) return z;
-        if(x < 0.0f){
-	    /* y1f(x<0) = NaN */
-	    errno = EDOM;
-        }
-	if (x == 0.0f){
-	    /* y1f(n,0) = -inf */
-	    errno = ERANGE;
-	}
-	if(x>(float)X_TLOSS) {
-	    /* y1f(x>X_TLOSS) */
-	    errno = ERANGE;
-	}
-	return z;
-#endif
 }
 
 #ifdef _DOUBLE_IS_32BITS
@@ -14,7 +14,6 @@
  */
 
 #include "fdlibm.h"
-#include <errno.h>
 
 
 #ifdef __STDC__
@@ -24,18 +23,10 @@
 	float x; int n;
 #endif
 {
-#ifdef _IEEE_LIBM
-	return __ieee754_jnf(n,x);
-#else
-	float z;
-	z = __ieee754_jnf(n,x);
-	if(_LIB_VERSION == _IEEE_ || isnan(x) ) return z;
-	if(fabsf(x)>(float)X_TLOSS) {
+	if(WANT_ERRNO && unlikely(fabsf(x)>(float)X_TLOSS))
 	    /* jnf(|x|>X_TLOSS) */
-	    errno = ERANGE;
-	}
-	return z;
-#endif
+	    return __math_erangef(__ieee754_jnf(n,x));
+	return __ieee754_jnf(n,x);
 }
 
 #ifdef __STDC__
@@ -45,26 +36,10 @@
 	float x; int n;
 #endif
 {
-#ifdef _IEEE_LIBM
+	if(WANT_ERRNO && unlikely(x<=0.0f||x>(float)X_TLOSS))
+	    /* ynf(x<0) = NaN, ynf(0) = -inf or ynf(x>X_TLOSS) */
+	    return x<0.0f ? __math_edomf(__ieee754_ynf(n,x)) : __math_erangef(__ieee754_ynf(n,x));
 	return __ieee754_ynf(n,x);
-#else
-	float z;
-	z = __ieee754_ynf(n,x);
-	if(_LIB_VERSION == _IEEE_ || isnan(x) ) return z;
-        if(x < 0.0f){
-	    /* ynf(x<0) = NaN */
-	    errno = EDOM;
-        }
-	if (x == 0.0f){
-	    /* ynf(n,0) = -inf */
-	    errno = ERANGE;
-	}
-	if(x>(float)X_TLOSS) {
-	    /* ynf(x>X_TLOSS) */
-	    errno = ERANGE;
-	}
-	return z;
-#endif
 }
 
 #ifdef _DOUBLE_IS_32BITS
@@ -19,7 +19,6 @@
 
 #include "fdlibm.h"
 #if __OBSOLETE_MATH
-#include <errno.h>
 
 #ifdef __STDC__
 	float logf(float x)		/* wrapper logf */
@@ -28,22 +27,10 @@
 	float x;
 #endif
 {
-#ifdef _IEEE_LIBM
+	if(WANT_ERRNO && unlikely(x<=0.0f))
+	    /* logf(0) or logf(x<0) */
+	    return x==0.0f ? __math_erangef(__ieee754_logf(x)) : __math_edomf(__ieee754_logf(x));
 	return __ieee754_logf(x);
-#else
-	float z;
-	z = __ieee754_logf(x);
-	if(_LIB_VERSION == _IEEE_ || isnan(x) || x > 0.0f) return z;
-	if(x==0.0f) {
-	    /* logf(0) */
-	    errno = ERANGE;
-	    return -HUGE_VALF;
-	} else { 
-	    /* logf(x<0) */
-	    errno = EDOM;
-	    return nanf("");
-        }
-#endif
 }
 
 #ifdef _DOUBLE_IS_32BITS
@@ -18,7 +18,6 @@
  */
 
 #include "fdlibm.h"
-#include <errno.h>
 
 #ifdef __STDC__
 	float log10f(float x)		/* wrapper log10f */
@@ -27,25 +26,10 @@
 	float x;
 #endif
 {
-#ifdef _IEEE_LIBM
+	if(WANT_ERRNO && unlikely(x<=0.0f))
+	    /* log10f(0) or log10f(x<0) */
+	    return x==0.0f ? __math_erangef(__ieee754_log10f(x)) : __math_edomf(__ieee754_log10f(x));
 	return __ieee754_log10f(x);
-#else
-	float z;
-	z = __ieee754_log10f(x);
-	if(_LIB_VERSION == _IEEE_ || isnan(x)) return z;
-	if(x<=0.0f) {
-	    if(x==0.0f) {
-		/* log10f(0) */
-		errno = ERANGE;
-		return -HUGE_VALF;
-	    } else { 
-		/* log10f(x<0) */
-		errno = EDOM;
-		return nanf("");
-            }
-	} else
-	    return z;
-#endif
 }
 
 #ifdef _DOUBLE_IS_32BITS
@@ -19,7 +19,26 @@
 
 #include "fdlibm.h"
 #if __OBSOLETE_MATH
-#include <errno.h>
+
+/* Set errno for powf(x,y) = z when z is not finite or is zero.  Kept
+   out of line so the common path of the wrapper is the kernel call.  */
+static NOINLINE float
+powf_error(float x, float y, float z)
+{
+	if(isnan(y)) return z;
+	if(x==0.0f) {
+	    if(finitef(y)&&y<0.0f)
+		/* 0**neg */
+		return __math_erangef(z);
+	    return z;
+	}
+	if(!finitef(x)||!finitef(y)) return z;
+	if(isnan(z))
+	    /* neg**non-integral */
+	    return __math_edomf(z);
+	/* powf(x,y) overflow or underflow */
+	return __math_erangef(z);
+}
 
 #ifdef __STDC__
 	float powf(float x, float y)	/* wrapper powf */
@@ -28,44 +47,10 @@
 	float x,y;
 #endif
 {
-#ifdef _IEEE_LIBM
-	return  __ieee754_powf(x,y);
-#else
-	float z;
-	z=__ieee754_powf(x,y);
-	if(_LIB_VERSION == _IEEE_|| isnan(y)) return z;
-	if(x==0.0f){
-	    if(y==0.0f) {
-		/* powf(0.0,0.0) */
-		/* Not an error.  */
-		return 1.0f;
-	    }
-	    if(finitef(y)&&y<0.0f) {
-		/* 0**neg */
-		errno = ERANGE;
-	    }
-	    return z;
-	}
-	if(!finitef(z)) {
-	    if(finitef(x)&&finitef(y)) {
-		if(isnan(z)) {
-		    /* neg**non-integral */
-		    errno = EDOM;
-		    /* Use a float divide, to avoid a soft-float double
-		       divide call on single-float only targets.  */
-		} else {
-		    /* powf(x,y) overflow */
-		    errno = ERANGE;
-		}
-		return z;
-	    }
-	} 
-	if(z==0.0f&&finitef(x)&&finitef(y)) {
-	    /* powf(x,y) underflow */
-	    errno = ERANGE;
-        }
+	float z = __ieee754_powf(x,y);
+	if(WANT_ERRNO && unlikely(!finitef(z)||z==0.0f))
+	    return powf_error(x,y,z);
 	return z;
-#endif
 }
 
 #ifdef _DOUBLE_IS_32BITS
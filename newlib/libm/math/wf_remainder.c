@@ -18,7 +18,6 @@
  */
 
 #include "fdlibm.h"
-#include <errno.h>
 
 #ifdef __STDC__
 	float remainderf(float x, float y)	/* wrapper remainder */
@@ -27,19 +26,10 @@
 	float x,y;
 #endif
 {
-#ifdef _IEEE_LIBM
-	return __ieee754_remainderf(x,y);
-#else
-	float z;
-	z = __ieee754_remainderf(x,y);
-	if(_LIB_VERSION == _IEEE_ || isnan(y)) return z;
-	if(y==0.0f) {
+	if(WANT_ERRNO && unlikely(y==0.0f))
 	    /* remainderf(x,0) */
-	    errno = EDOM;
-	    return 0.0f/0.0f;
-	} else
-	    return z;
-#endif
+	    return __math_edomf(__ieee754_remainderf(x,y));
+	return __ieee754_remainderf(x,y);
 }
 
 #ifdef _DOUBLE_IS_32BITS
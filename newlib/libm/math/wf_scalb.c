@@ -20,7 +20,6 @@
  */
 
 #include "fdlibm.h"
-#include <errno.h>
 
 #ifdef __STDC__
 #ifdef _SCALB_INT
@@ -37,27 +36,19 @@
 #endif
 #endif
 {
-#ifdef _IEEE_LIBM
-	return __ieee754_scalbf(x,fn);
-#else
-	float z;
-	z = __ieee754_scalbf(x,fn);
-	if(_LIB_VERSION == _IEEE_) return z;
-	if(!(finitef(z)||isnan(z))&&finitef(x)) {
-	    /* scalbf overflow; */
-	    errno = ERANGE;
-	    return (x > 0.0 ? HUGE_VALF : -HUGE_VALF);
+	float z = __ieee754_scalbf(x,fn);
+	if(WANT_ERRNO && unlikely(!finitef(z)||z==0.0f)) {
+	    if(isinf(z)&&finitef(x))
+		/* scalbf overflow */
+		return __math_erangef(x > 0.0f ? HUGE_VALF : -HUGE_VALF);
+	    if(z==0.0f&&z!=x)
+		/* scalbf underflow */
+		return __math_erangef(copysignf(0.0f,x));
 	}
-	if(z==0.0f&&z!=x) {
-	    /* scalbf underflow */
-	    errno = ERANGE;
-	    return copysign(0.0,x);
-	} 
 #ifndef _SCALB_INT
-	if(!finitef(fn)) errno = ERANGE;
+	if(WANT_ERRNO && unlikely(!finitef(fn))) return __math_erangef(z);
 #endif
 	return z;
-#endif 
 }
 
 #ifdef _DOUBLE_IS_32BITS
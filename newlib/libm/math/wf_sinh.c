@@ -18,7 +18,6 @@
  */
 
 #include "fdlibm.h"
-#include <errno.h>
 
 #ifdef __STDC__
 	float sinhf(float x)		/* wrapper sinhf */
@@ -27,19 +26,11 @@
 	float x;
 #endif
 {
-#ifdef _IEEE_LIBM
-	return __ieee754_sinhf(x);
-#else
-	float z; 
-	z = __ieee754_sinhf(x);
-	if(_LIB_VERSION == _IEEE_) return z;
-	if(!finitef(z)&&finitef(x)) {
+	float z = __ieee754_sinhf(x);
+	if(WANT_ERRNO && unlikely(!finitef(z)&&finitef(x)))
 	    /* sinhf(finite) overflow */
-	    errno = ERANGE;
-	    return ( (x>0.0f) ? HUGE_VALF : -HUGE_VALF);
-	} else
-	    return z;
-#endif
+	    return __math_erangef(z);
+	return z;
 }
 
 #ifdef _DOUBLE_IS_32BITS
@@ -18,7 +18,6 @@
  */
 
 #include "fdlibm.h"
-#include <errno.h>
 
 #ifdef __STDC__
 	float sqrtf(float x)		/* wrapper sqrtf */
@@ -27,19 +26,10 @@
 	float x;
 #endif
 {
-#ifdef _IEEE_LIBM
+	if(WANT_ERRNO && unlikely(x<0.0f))
+	    /* sqrtf(x<0) */
+	    return __math_edomf(__ieee754_sqrtf(x));
 	return __ieee754_sqrtf(x);
-#else
-	float z;
-	z = __ieee754_sqrtf(x);
-	if(_LIB_VERSION == _IEEE_ || isnan(x)) return z;
-	if(x<0.0f) {
-	    /* sqrtf(negative) */
-	    errno = EDOM;
-	    return 0.0f/0.0f;
-	} else
-	    return z;
-#endif
 }
 
 #ifdef _DOUBLE_IS_32BITS
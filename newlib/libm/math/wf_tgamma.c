@@ -15,6 +15,7 @@
 
 #include "math.h"
 #include "fdlibm.h"
+#if __OBSOLETE_MATH
 
 #ifdef __STDC__
 	float tgammaf(float x)
@@ -27,12 +28,7 @@
 	int local_signgam;
 	y = __ieee754_gammaf_r(x,&local_signgam);
 	if (local_signgam < 0) y = -y;
-#ifdef _IEEE_LIBM
-	return y;
-#else
-	if(_LIB_VERSION == _IEEE_) return y;
-
-	if(!finitef(y)&&finitef(x)) {
+	if(WANT_ERRNO && unlikely(!finitef(y)&&finitef(x))) {
 	  if(floorf(x)==x&&x<=(float)0.0)
 	    /* tgammaf pole */
 	    return (float)__kernel_standard((double)x,(double)x,141);
@@ -41,7 +37,6 @@
 	    return (float)__kernel_standard((double)x,(double)x,140);
 	}
 	return y;
-#endif
 }
 
 #ifdef _DOUBLE_IS_32BITS
@@ -57,3 +52,4 @@
 }
 
 #endif /* defined(_DOUBLE_IS_32BITS) */
+#endif /* __OBSOLETE_MATH */
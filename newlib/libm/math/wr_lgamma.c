@@ -16,7 +16,6 @@
  */
 
 #include "fdlibm.h"
-#include <errno.h>
 
 #ifndef _DOUBLE_IS_32BITS
 
@@ -27,23 +26,15 @@
 	double x; int *signgamp;
 #endif
 {
-#ifdef _IEEE_LIBM
-	return __ieee754_lgamma_r(x,signgamp);
-#else
-        double y;
-        y = __ieee754_lgamma_r(x,signgamp);
-        if(_LIB_VERSION == _IEEE_) return y;
-        if(!finite(y)&&finite(x)) {
+	double y = __ieee754_lgamma_r(x,signgamp);
+	if(WANT_ERRNO && unlikely(!finite(y)&&finite(x))) {
 	    if(floor(x)==x&&x<=0.0)
-	      /* lgamma(-integer) */
-	      errno = EDOM;
-	    else
-	      /* lgamma(finite) overflow */
-	      errno = ERANGE;
-	    return HUGE_VAL;
-        } else
-            return y;
-#endif
+		/* lgamma(-integer) */
+		return __math_edom(y);
+	    /* lgamma(finite) overflow */
+	    return __math_erange(y);
+	}
+	return y;
 }
 
 #endif /* defined(_DOUBLE_IS_32BITS) */
@@ -18,7 +18,6 @@
  */
 
 #include "fdlibm.h"
-#include <errno.h>
 
 #ifdef __STDC__
 	float lgammaf_r(float x, int *signgamp) /* wrapper lgammaf_r */
@@ -27,22 +26,13 @@
 	float x; int *signgamp;
 #endif
 {
-#ifdef _IEEE_LIBM
-	return __ieee754_lgammaf_r(x,signgamp);
-#else
-        float y;
-        y = __ieee754_lgammaf_r(x,signgamp);
-        if(_LIB_VERSION == _IEEE_) return y;
-        if(!finitef(y)&&finitef(x)) {
-	    if(floorf(x)==x&&x<=0.0f) {
-		/* lgammaf(-integer) or lgamma(0) */
-		errno = EDOM;
-	    } else {
-		/* lgammaf(finite) overflow */
-		errno = ERANGE;
-	    }
-	    return HUGE_VALF;
-        } else
-            return y;
-#endif
+	float y = __ieee754_lgammaf_r(x,signgamp);
+	if(WANT_ERRNO && unlikely(!finitef(y)&&finitef(x))) {
+	    if(floorf(x)==x&&x<=0.0f)
+		/* lgamma(-integer) */
+		return __math_edomf(y);
+	    /* lgammaf(finite) overflow */
+	    return __math_erangef(y);
+	}
+	return y;
 }             
@@ -284,5 +284,11 @@
 {64, 0,123,__LINE__, 0x42392ead, 0xfa09870a, 0x403a1999, 0x99999996},			/* 1.08157e+11=f(26.1000)*/
 {63, 0,123,__LINE__, 0x42613b19, 0x1e69fb25, 0x403bcccc, 0xccccccc9},			/* 5.92048e+11=f(27.8000)*/
 {61, 0,123,__LINE__, 0x42879487, 0x9e85b8dc, 0x403d7fff, 0xfffffffc},			/* 3.24084e+12=f(29.5000)*/
+{64, 0,123,__LINE__, 0x3ff00000, 0x00000000, 0x3e400000, 0x00000000},			/* 1.00000=f(7.45058e-09)*/
+{64, 0,123,__LINE__, 0x3ff00000, 0x00000000, 0xbe400000, 0x00000000},			/* 1.00000=f(-7.45058e-09)*/
+{64, 0,123,__LINE__, 0x3ff00000, 0x00000000, 0x3ddb7cdf, 0xd9d7bdbb},			/* 1.00000=f(1.00000e-10)*/
+{64, 0,123,__LINE__, 0x3ff00000, 0x00000000, 0xbddb7cdf, 0xd9d7bdbb},			/* 1.00000=f(-1.00000e-10)*/
+{64, 0,123,__LINE__, 0x3ff00000, 0x00000000, 0x00100000, 0x00000000},			/* 1.00000=f(2.22507e-308)*/
+{64, 0,123,__LINE__, 0x3ff00000, 0x00000000, 0x00000000, 0x00000000},			/* 1.00000=f(0.00000)*/
 0,};
 test_cosh(m)   {run_vector_1(m,cosh_vec,(char *)(cosh),"cosh","dd");   }	
@@ -0,0 +1,186 @@
+/* Cost of switching the rounding mode.
+
+   Built with the target compiler and the newlib headers, like the test
+   program in this directory, with "make fenvbench".  When optimizing,
+   <fenv.h> may provide inline versions of fegetround, fesetround,
+   feclearexcept and fetestexcept; calls through a function pointer always
+   reach the library functions, so both are measured and compared.
+
+   Usage: fenvbench [iters]
+
+   Each loop evaluates a product rounded down and rounded up, as interval
+   arithmetic does, and the time is reported in ns per iteration.  The
+   inline and library versions must agree on the rounding mode and the
+   flags, otherwise the program fails.  */
+
+#include <fenv.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+static int (*volatile lib_fesetround) (int) = fesetround;
+static int (*volatile lib_fegetround) (void) = fegetround;
+static int (*volatile lib_feclearexcept) (int) = feclearexcept;
+static int (*volatile lib_fetestexcept) (int) = fetestexcept;
+
+/* The compiler does not order arithmetic with respect to the rounding
+   mode, so the operands are read from and the results stored to volatile
+   objects to keep each product between the mode switches.  */
+static volatile double va = 1.0 / 3, vb = 3.0 / 7;
+
+static double
+seconds (void)
+{
+  return (double) clock () / CLOCKS_PER_SEC;
+}
+
+static double
+bench_inline (long n, double *w)
+{
+  volatile double lo, hi;
+  double sum = 0, t0;
+  long i;
+
+  t0 = seconds ();
+  for (i = 0; i < n; i++)
+    {
+      int r = fegetround ();
+
+      fesetround (FE_DOWNWARD);
+      lo = va * vb;
+      fesetround (FE_UPWARD);
+      hi = va * vb;
+      fesetround (r);
+      sum += hi - lo;
+    }
+  *w = sum;
+  return (seconds () - t0) * 1e9 / n;
+}
+
+static double
+bench_lib (long n, double *w)
+{
+  volatile double lo, hi;
+  double sum = 0, t0;
+  long i;
+
+  t0 = seconds ();
+  for (i = 0; i < n; i++)
+    {
+      int r = lib_fegetround ();
+
+      lib_fesetround (FE_DOWNWARD);
+      lo = va * vb;
+      lib_fesetround (FE_UPWARD);
+      hi = va * vb;
+      lib_fesetround (r);
+      sum += hi - lo;
+    }
+  *w = sum;
+  return (seconds () - t0) * 1e9 / n;
+}
+
+static double
+bench_flags (long n, int lib)
+{
+  volatile double x = 1.0;
+  double t0;
+  long i;
+  int f = 0;
+
+  t0 = seconds ();
+  for (i = 0; i < n; i++)
+    {
+      if (lib)
+	{
+	  lib_feclearexcept (FE_ALL_EXCEPT);
+	  x = x / 3;
+	  f += lib_fetestexcept (FE_INEXACT) != 0;
+	}
+      else
+	{
+	  feclearexcept (FE_ALL_EXCEPT);
+	  x = x / 3;
+	  f += fetestexcept (FE_INEXACT) != 0;
+	}
+      x = 1.0;
+    }
+  if (f != n)
+    {
+      printf ("FAIL: inexact not raised %ld times\n", n - f);
+      exit (1);
+    }
+  return (seconds () - t0) * 1e9 / n;
+}
+
+static int
+check (void)
+{
+  static const int modes[] =
+    { FE_TONEAREST, FE_DOWNWARD, FE_UPWARD, FE_TOWARDZERO };
+  volatile double z = 0.0;
+  volatile long double lx = 1.0L, ly = 3.0L, l1, l2;
+  int i, err = 0;
+
+  for (i = 0; i < 4; i++)
+    {
+      fesetround (modes[i]);
+      if (lib_fegetround () != modes[i])
+	err |= 1;
+      lib_fesetround (modes[i]);
+      if (fegetround () != modes[i])
+	err |= 1;
+    }
+  /* Long double arithmetic, done by the x87 unit on x86_64, has to
+     follow the mode too.  */
+  fesetround (FE_DOWNWARD);
+  l1 = lx / ly;
+  fesetround (FE_UPWARD);
+  l2 = lx / ly;
+  fesetround (FE_TONEAREST);
+  if (!(l1 < l2))
+    err |= 2;
+  if (fesetround (-1) == 0 || fegetround () != FE_TONEAREST)
+    err |= 4;
+
+  feclearexcept (FE_ALL_EXCEPT);
+  z = 1.0 / z;
+  if (fetestexcept (FE_ALL_EXCEPT) != FE_DIVBYZERO
+      || lib_fetestexcept (FE_ALL_EXCEPT) != FE_DIVBYZERO)
+    err |= 8;
+  lib_feclearexcept (FE_DIVBYZERO);
+  if (fetestexcept (FE_ALL_EXCEPT) != 0)
+    err |= 8;
+  /* Flags raised by long double arithmetic.  */
+  lx = lx / 0.0L;
+  if (!fetestexcept (FE_DIVBYZERO))
+    err |= 16;
+  feclearexcept (FE_DIVBYZERO);
+  if (lib_fetestexcept (FE_ALL_EXCEPT) != 0)
+    err |= 16;
+  return err;
+}
+
+int
+main (int argc, char **argv)
+{
+  long n = argc > 1 ? atol (argv[1]) : 1000000;
+  double w1, w2;
+  int err;
+
+  if ((err = check ()) != 0)
+    {
+      printf ("FAIL: inline and library versions disagree (%#x)\n", err);
+      return 1;
+    }
+  printf ("round down/up, <fenv.h>     %8.2f ns\n", bench_inline (n, &w1));
+  printf ("round down/up, library      %8.2f ns\n", bench_lib (n, &w2));
+  printf ("clear/test flags, <fenv.h>  %8.2f ns\n", bench_flags (n, 0));
+  printf ("clear/test flags, library   %8.2f ns\n", bench_flags (n, 1));
+  if (w1 != w2 || !(w1 > 0))
+    {
+      printf ("FAIL: intervals differ\n");
+      return 1;
+    }
+  return 0;
+}
@@ -16,6 +16,7 @@
 
 */
 
+#define _GNU_SOURCE
 #include "test.h"
 #include <math.h>
 #include <ieeefp.h>
@@ -331,6 +332,37 @@ run_vector_1 (int vector,
   }
 }
 
+/* sincos shares its range reduction between both results; check each
+   half against the sin and cos vectors.  */
+extern one_line_type sin_vec[], cos_vec[];
+
+static double
+sincos_sin (double x)
+{
+  double s, c;
+
+  sincos (x, &s, &c);
+  return s;
+}
+
+static double
+sincos_cos (double x)
+{
+  double s, c;
+
+  sincos (x, &s, &c);
+  return c;
+}
+
+void
+test_sincos (int vector)
+{
+  if (vector)
+    return;
+  run_vector_1 (0, sin_vec, (char *) sincos_sin, "sincos", "dd");
+  run_vector_1 (0, cos_vec, (char *) sincos_cos, "sincos", "dd");
+}
+
 void
 test_math (void)
 {
@@ -384,8 +416,10 @@ test_math (void)
   test_log2(0);
   test_log2f(0);
   test_logf(0);
+  test_simd(0);
   test_sin(0);
   test_sinf(0);
+  test_sincos(0);
   test_sinh(0);
   test_sinhf(0);
   test_sqrt(0);
@@ -394,6 +428,9 @@ test_math (void)
   test_tanf(0);
   test_tanh(0);
   test_tanhf(0);
+  test_tgamma(0);
+  test_tgammaf(0);
+  test_trigl(0);
   test_y0(0);
   test_y0f(0);
   test_y1(0);
@@ -1,6 +1,7 @@
 
 #include "test.h"
 #include <errno.h>
+#include <fenv.h>
 
 
 int
@@ -221,6 +222,191 @@ test_pow (void)
 
 }
 
+/* fma must round x * y + z once, in every rounding mode.  The expected
+   results were computed exactly; they include products that cancel
+   against z, results that are subnormal or overflow, the sign of an exact
+   zero and sums that a double rounding of x * y + z gets wrong.  */
+
+static const struct
+{
+  double x, y, z;
+  double r[4];			/* nearest, down, up, towards zero */
+} fma_vec[] =
+{
+  { 0x1.0000000000001p+0, 0x1.0000000000001p+0, -0x1.0000000000002p+0,
+    { 0x1p-104, 0x1p-104, 0x1p-104, 0x1p-104 } },
+  { 0x1.fffffffffffffp+1023, 0x1p+1, -0x1.fffffffffffffp+1023,
+    { 0x1.fffffffffffffp+1023, 0x1.fffffffffffffp+1023, 0x1.fffffffffffffp+1023, 0x1.fffffffffffffp+1023 } },
+  { 0x1.fffffffffffffp+1023, 0x1.0000000000001p+0, 0.0,
+    { HUGE_VAL, 0x1.fffffffffffffp+1023, HUGE_VAL, 0x1.fffffffffffffp+1023 } },
+  { 0x1.0000000000001p-1022, 0x1p-1, 0.0,
+    { 0x0.8p-1022, 0x0.8p-1022, 0x0.8000000000001p-1022, 0x0.8p-1022 } },
+  { 0x1.0000000000003p-1022, 0x1p-1, 0.0,
+    { 0x0.8000000000002p-1022, 0x0.8000000000001p-1022, 0x0.8000000000002p-1022, 0x0.8000000000001p-1022 } },
+  { 0x0.0000000000001p-1022, 0x1p-1, 0.0,
+    { 0.0, 0.0, 0x0.0000000000001p-1022, 0.0 } },
+  { -0x0.0000000000001p-1022, 0x1p-1, 0.0,
+    { -0.0, -0x0.0000000000001p-1022, -0.0, -0.0 } },
+  { 0x1p-1000, 0x1p-100, -0.0,
+    { 0.0, 0.0, 0x0.0000000000001p-1022, 0.0 } },
+  { -0x1p-1000, 0x1p-100, 0.0,
+    { -0.0, -0x0.0000000000001p-1022, -0.0, -0.0 } },
+  { 0x1p+0, 0x1p+0, 0x0.0000000000001p-1022,
+    { 0x1p+0, 0x1p+0, 0x1.0000000000001p+0, 0x1p+0 } },
+  { -0x1p+0, 0x1p+0, 0x0.0000000000001p-1022,
+    { -0x1p+0, -0x1p+0, -0x1.fffffffffffffp-1, -0x1.fffffffffffffp-1 } },
+  { 0x1p+0, -0x1p+0, 0x1p+0,
+    { 0.0, -0.0, 0.0, 0.0 } },
+  { -0.0, 0x1p+0, -0.0,
+    { -0.0, -0.0, -0.0, -0.0 } },
+  { 0x1.fffffffffffffp-1, 0x1.fffffffffffffp-1, -0x1p+0,
+    { -0x1p-52, -0x1p-52, -0x1.fffffffffffffp-53, -0x1.fffffffffffffp-53 } },
+  { 0x1.0000000000001p+0, 0x1.fffffffffffffp-1, -0x1p+0,
+    { 0x1.ffffffffffffep-54, 0x1.ffffffffffffep-54, 0x1.ffffffffffffep-54, 0x1.ffffffffffffep-54 } },
+  { 0x1.8p-1022, 0x1.8p-1, -0x1p-1022,
+    { 0x0.2p-1022, 0x0.2p-1022, 0x0.2p-1022, 0x0.2p-1022 } },
+  { 0x1.fffffffffffffp-2, 0x1p-1021, 0x0.0000000000001p-1022,
+    { 0x1p-1022, 0x1p-1022, 0x1.0000000000001p-1022, 0x1p-1022 } },
+  { 0x1.8p+1, 0x1.5555555555555p-2, -0x1p+0,
+    { -0x1p-54, -0x1p-54, -0x1p-54, -0x1p-54 } },
+  { 0x1.a9735a1f2a74ep+0, 0x1.934f069651327p+0, -0x1.9e43ec6a64190p+0,
+    { 0x1.ffffffffffffep-1, 0x1.ffffffffffffep-1, 0x1.fffffffffffffp-1, 0x1.ffffffffffffep-1 } },
+  { 0x1.c497c811818e8p+0, 0x1.aecee4f953198p+0, -0x1.f9a4b9005e6f2p+0,
+    { 0x1.fffffffffffffp-1, 0x1.ffffffffffffep-1, 0x1.fffffffffffffp-1, 0x1.ffffffffffffep-1 } },
+  { 0x1.b656a510f21dep+0, 0x1.e9d64a590c193p+0, -0x1.235d36846f997p+1,
+    { 0x1.0000000000001p+0, 0x1p+0, 0x1.0000000000001p+0, 0x1p+0 } }
+};
+
+static const struct
+{
+  float x, y, z;
+  float r[4];
+} fmaf_vec[] =
+{
+  { 0x1.000002p+0f, 0x1.000002p+0f, -0x1.000004p+0f,
+    { 0x1p-46f, 0x1p-46f, 0x1p-46f, 0x1p-46f } },
+  { 0x1.fffffep+127f, 0x1p+1f, -0x1.fffffep+127f,
+    { 0x1.fffffep+127f, 0x1.fffffep+127f, 0x1.fffffep+127f, 0x1.fffffep+127f } },
+  { 0x1p-149f, 0x1p-1f, 0.0,
+    { 0.0, 0.0, 0x1p-149f, 0.0 } },
+  { 0x1.000002p-126f, 0x1p-1f, 0.0,
+    { 0x1p-127f, 0x1p-127f, 0x1.000004p-127f, 0x1p-127f } },
+  { 0x1p+0f, 0x1p+0f, 0x1p-149f,
+    { 0x1p+0f, 0x1p+0f, 0x1.000002p+0f, 0x1p+0f } },
+  { 0x1p+0f, -0x1p+0f, 0x1p+0f,
+    { 0.0, -0.0, 0.0, 0.0 } },
+  { 0x1p-100f, 0x1p-30f, -0.0,
+    { 0x1p-130f, 0x1p-130f, 0x1p-130f, 0x1p-130f } },
+  { -0x1p-100f, 0x1p-30f, 0.0,
+    { -0x1p-130f, -0x1p-130f, -0x1p-130f, -0x1p-130f } },
+  { 0x1.0002p+0f, 0x1.fffcp-26f, 0x1.000002p+0f,
+    { 0x1.000002p+0f, 0x1.000002p+0f, 0x1.000004p+0f, 0x1.000002p+0f } },
+  { -0x1.0002p+0f, 0x1.fffcp-26f, -0x1.000002p+0f,
+    { -0x1.000002p+0f, -0x1.000004p+0f, -0x1.000002p+0f, -0x1.000002p+0f } },
+  { 0x1.0002p+0f, -0x1.fffcp-26f, 0x1.000006p+0f,
+    { 0x1.000006p+0f, 0x1.000004p+0f, 0x1.000006p+0f, 0x1.000004p+0f } },
+  { 0x1.0002p-75f, 0x1.fffcp-76f, 0x1.8p-148f,
+    { 0x1.8p-148f, 0x1.8p-148f, 0x1p-147f, 0x1.8p-148f } },
+  { 0x1.0002p-64f, 0x1.fffcp-64f, 0x1.000002p-102f,
+    { 0x1.000002p-102f, 0x1.000002p-102f, 0x1.000004p-102f, 0x1.000002p-102f } },
+  { 0x1.fffffep+127f, 0x1.000002p+0f, 0.0,
+    { HUGE_VALF, 0x1.fffffep+127f, HUGE_VALF, 0x1.fffffep+127f } }
+};
+
+/* Switch to the I'th rounding mode of the tables, return 0 if the target
+   cannot.  */
+static int
+set_round (int i)
+{
+  switch (i)
+    {
+    case 0:
+#ifdef FE_TONEAREST
+      return fesetround (FE_TONEAREST) == 0;
+#else
+      return 1;
+#endif
+#ifdef FE_DOWNWARD
+    case 1:
+      return fesetround (FE_DOWNWARD) == 0;
+#endif
+#ifdef FE_UPWARD
+    case 2:
+      return fesetround (FE_UPWARD) == 0;
+#endif
+#ifdef FE_TOWARDZERO
+    case 3:
+      return fesetround (FE_TOWARDZERO) == 0;
+#endif
+    }
+  return 0;
+}
+
+void
+test_fma (void)
+{
+  unsigned int i;
+  int m;
+
+  newfunc("fma");
+  for (m = 0; m < 4; m++)
+  {
+    if (!set_round(m))
+      continue;
+    for (i = 0; i < sizeof(fma_vec) / sizeof(fma_vec[0]); i++)
+    {
+      volatile double x = fma_vec[i].x;
+      double res = fma(x, fma_vec[i].y, fma_vec[i].z);
+
+      line(m * 100 + i);
+      test_mok(res, fma_vec[i].r[m], 64);
+      test_iok(signbit(res) != 0, signbit(fma_vec[i].r[m]) != 0);
+    }
+  }
+  set_round(0);
+
+  /* x * y - fl(x * y) is exact, compare with Dekker's product.  */
+  for (i = 0; i < 1000; i++)
+  {
+    double x = randy();
+    double y = randy();
+    double p = x * y;
+    double c = 0x1p27 + 1;
+    double xh = x * c - (x * c - x), xl = x - xh;
+    double yh = y * c - (y * c - y), yl = y - yh;
+    double e = ((xh * yh - p) + xh * yl + xl * yh) + xl * yl;
+
+    line(i);
+    test_mok(fma(x, y, -p), e, 64);
+  }
+
+  newfunc("fmaf");
+  for (m = 0; m < 4; m++)
+  {
+    if (!set_round(m))
+      continue;
+    for (i = 0; i < sizeof(fmaf_vec) / sizeof(fmaf_vec[0]); i++)
+    {
+      volatile float x = fmaf_vec[i].x;
+      float res = fmaf(x, fmaf_vec[i].y, fmaf_vec[i].z);
+
+      line(m * 100 + i);
+      test_mok(res, fmaf_vec[i].r[m], 64);
+      test_iok(signbit(res) != 0, signbit(fmaf_vec[i].r[m]) != 0);
+    }
+  }
+  set_round(0);
+
+  for (i = 0; i < 1000; i++)
+  {
+    float x = randy();
+    float y = randy();
+    float p = x * y;
+
+    line(i);
+    test_mok(fmaf(x, y, -p), (double) x * y - p, 64);
+  }
+}
 
 
 void
@@ -229,4 +415,5 @@ test_math2 (void)
   test_mod();  
   test_frexp();
   test_pow();
+  test_fma();
 }
@@ -0,0 +1,662 @@
+/* Throughput, latency and ulp error of the libm functions.
+
+   This is a host program: it is built with the host compiler and headers
+   and linked against a libm.a built for the same ABI (x86_64-elf on an
+   x86_64 GNU/Linux host, for example) followed by libquadmath, which
+   supplies the reference functions, and the host libm:
+
+     cc -O2 -DNEWLIB_LIBM mathbench.c .../libm.a -lquadmath -lm -o mathbench
+
+   or "make mathbench" in this directory.  Without -DNEWLIB_LIBM the host
+   libm is measured, which is useful as a baseline.
+
+   Usage: mathbench [-n count] [-i iters] [-b | -u] [func[:lo:hi[:lo2:hi2]]]...
+
+   Each function is evaluated on COUNT inputs drawn uniformly from
+   [lo, hi] (and [lo2, hi2] for the second argument), or from its default
+   range.  -b only benchmarks, -u only measures the error.  With no
+   function name all of them are run.  The complex functions take one
+   argument, with its real part in [lo, hi] and its imaginary part in
+   [lo2, hi2]; their error is the larger error of the two parts in ulp of
+   the larger part of the exact result.
+
+   The benchmark reports ns per call for independent calls (throughput)
+   and for calls that depend on the previous result (latency).  The
+   error is measured against the __float128 function of libquadmath,
+   rounded to the format under test only when computing the ulp
+   difference; it is exact to well below 1/1000 ulp for float and double
+   and to about 1/1000 ulp for the 64-bit long double of x86.  */
+
+#define _GNU_SOURCE
+#include <complex.h>
+#include <math.h>
+#include <quadmath.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <errno.h>
+
+#ifdef NEWLIB_LIBM
+/* The newlib wrappers set errno through __errno and lgamma stores signgam
+   in the reentrancy structure; a zeroed block larger than struct _reent
+   is enough for both.  */
+int *
+__errno (void)
+{
+  return &errno;
+}
+
+static char impure_data[4096] __attribute__ ((aligned (16)));
+void *_impure_ptr = impure_data;
+
+/* The kernels behind the errno wrappers of libm/math, to measure what
+   the wrappers cost.  */
+extern double __ieee754_acosh (double);
+extern double __ieee754_atanh (double);
+extern double __ieee754_fmod (double, double);
+extern double __ieee754_log10 (double);
+extern double __ieee754_remainder (double, double);
+extern double __ieee754_sqrt (double);
+extern float __ieee754_acosf (float);
+extern float __ieee754_acoshf (float);
+extern float __ieee754_asinf (float);
+extern float __ieee754_atan2f (float, float);
+extern float __ieee754_atanhf (float);
+extern float __ieee754_coshf (float);
+extern float __ieee754_fmodf (float, float);
+extern float __ieee754_hypotf (float, float);
+extern float __ieee754_log10f (float);
+extern float __ieee754_remainderf (float, float);
+extern float __ieee754_sinhf (float);
+extern float __ieee754_sqrtf (float);
+#endif
+
+/* Format of the arguments and the result.  */
+enum { D, F, L, CD, CF };
+
+struct fun
+{
+  const char *name;
+  int args;
+  int type;
+  union
+  {
+    double (*d) (double);
+    double (*d2) (double, double);
+    float (*f) (float);
+    float (*f2) (float, float);
+    long double (*l) (long double);
+    long double (*l2) (long double, long double);
+    double complex (*cd) (double complex);
+    float complex (*cf) (float complex);
+  } fun;
+  union
+  {
+    __float128 (*q) (__float128);
+    __float128 (*q2) (__float128, __float128);
+    __complex128 (*c) (__complex128);
+  } ref;
+  long double lo, hi, lo2, hi2;
+};
+
+#define D1(fn, lo, hi) {#fn, 1, D, {.d = fn}, {.q = fn##q}, lo, hi, 0, 0},
+#define D2(fn, lo, hi, lo2, hi2) \
+  {#fn, 2, D, {.d2 = fn}, {.q2 = fn##q}, lo, hi, lo2, hi2},
+#define F1(fn, lo, hi) \
+  {#fn "f", 1, F, {.f = fn##f}, {.q = fn##q}, lo, hi, 0, 0},
+#define F2(fn, lo, hi, lo2, hi2) \
+  {#fn "f", 2, F, {.f2 = fn##f}, {.q2 = fn##q}, lo, hi, lo2, hi2},
+#define L1(fn, lo, hi) \
+  {#fn "l", 1, L, {.l = fn##l}, {.q = fn##q}, lo, hi, 0, 0},
+#define L2(fn, lo, hi, lo2, hi2) \
+  {#fn "l", 2, L, {.l2 = fn##l}, {.q2 = fn##q}, lo, hi, lo2, hi2},
+#define K1(fn, lo, hi) \
+  {"__ieee754_" #fn, 1, D, {.d = __ieee754_##fn}, {.q = fn##q}, lo, hi, 0, 0},
+#define K2(fn, lo, hi, lo2, hi2) \
+  {"__ieee754_" #fn, 2, D, {.d2 = __ieee754_##fn}, {.q2 = fn##q}, \
+   lo, hi, lo2, hi2},
+#define KF1(fn, lo, hi) \
+  {"__ieee754_" #fn "f", 1, F, {.f = __ieee754_##fn##f}, {.q = fn##q}, \
+   lo, hi, 0, 0},
+#define KF2(fn, lo, hi, lo2, hi2) \
+  {"__ieee754_" #fn "f", 2, F, {.f2 = __ieee754_##fn##f}, {.q2 = fn##q}, \
+   lo, hi, lo2, hi2},
+#define CD1(fn, lo, hi, lo2, hi2) \
+  {#fn, 1, CD, {.cd = fn}, {.c = fn##q}, lo, hi, lo2, hi2},
+#define CF1(fn, lo, hi, lo2, hi2) \
+  {#fn "f", 1, CF, {.cf = fn##f}, {.c = fn##q}, lo, hi, lo2, hi2},
+
+/* fma is measured as x * y - x, which cancels for y near 1.  */
+static double
+fma_xy (double x, double y)
+{
+  return fma (x, y, -x);
+}
+
+static float
+fma_xyf (float x, float y)
+{
+  return fmaf (x, y, -x);
+}
+
+static __float128
+fma_xyq (__float128 x, __float128 y)
+{
+  return fmaq (x, y, -x);
+}
+
+/* cpow is measured as z^(1.5 - 0.5i).  */
+static double complex
+cpow_z (double complex z)
+{
+  return cpow (z, CMPLX (1.5, -0.5));
+}
+
+static float complex
+cpow_zf (float complex z)
+{
+  return cpowf (z, CMPLXF (1.5f, -0.5f));
+}
+
+static __complex128
+cpow_zq (__complex128 z)
+{
+  __complex128 w;
+
+  __real__ w = 1.5Q;
+  __imag__ w = -0.5Q;
+  return cpowq (z, w);
+}
+
+static const struct fun funtab[] = {
+  D1 (exp, -700, 700)
+  D1 (exp2, -1000, 1000)
+  D1 (expm1, -10, 10)
+  D1 (log, 0x1p-1000, 0x1p1000)
+  D1 (log2, 0x1p-1000, 0x1p1000)
+  D1 (log10, 0x1p-1000, 0x1p1000)
+  D1 (log1p, -0.5, 10)
+  D1 (sin, -10, 10)
+  D1 (cos, -10, 10)
+  D1 (tan, -10, 10)
+  D1 (asin, -1, 1)
+  D1 (acos, -1, 1)
+  D1 (atan, -10, 10)
+  D1 (sinh, -10, 10)
+  D1 (cosh, -10, 10)
+  D1 (tanh, -10, 10)
+  D1 (asinh, -10, 10)
+  D1 (acosh, 1, 10)
+  D1 (atanh, -1, 1)
+  D1 (cbrt, -10, 10)
+  D1 (erf, -6, 6)
+  D1 (erfc, -6, 28)
+  D1 (tgamma, -170, 170)
+  D1 (lgamma, -10, 100)
+  D2 (pow, 0.01, 11.1, -10, 10)
+  D2 (atan2, -10, 10, -10, 10)
+  D2 (hypot, -10, 10, -10, 10)
+  D2 (fmod, -1e10, 1e10, -10, 10)
+  D2 (remainder, -1e10, 1e10, -10, 10)
+  D1 (sqrt, 0, 1e10)
+  {"fma", 2, D, {.d2 = fma_xy}, {.q2 = fma_xyq}, -10, 10, 0.5, 2},
+  F1 (exp, -87, 88)
+  F1 (exp2, -126, 127)
+  F1 (expm1, -10, 10)
+  F1 (log, 0x1p-126, 0x1p127)
+  F1 (log2, 0x1p-126, 0x1p127)
+  F1 (log10, 0x1p-126, 0x1p127)
+  F1 (log1p, -0.5, 10)
+  F1 (sin, -10, 10)
+  F1 (cos, -10, 10)
+  F1 (tan, -10, 10)
+  F1 (atan, -10, 10)
+  F1 (sinh, -10, 10)
+  F1 (cosh, -10, 10)
+  F1 (tanh, -10, 10)
+  F1 (cbrt, -10, 10)
+  F1 (erf, -4, 4)
+  F1 (tgamma, -30, 30)
+  F2 (pow, 0.01, 11.1, -10, 10)
+  F2 (atan2, -10, 10, -10, 10)
+  F2 (hypot, -10, 10, -10, 10)
+  F1 (asin, -1, 1)
+  F1 (acos, -1, 1)
+  F1 (acosh, 1, 10)
+  F1 (atanh, -1, 1)
+  F2 (fmod, -1e10, 1e10, -10, 10)
+  F2 (remainder, -1e10, 1e10, -10, 10)
+  F1 (sqrt, 0, 1e10)
+  {"fmaf", 2, F, {.f2 = fma_xyf}, {.q2 = fma_xyq}, -10, 10, 0.5, 2},
+  L1 (exp, -11000, 11000)
+  L1 (exp2, -16000, 16000)
+  L1 (expm1, -10, 10)
+  L1 (log, 0, 0x1p16000L)
+  L1 (log2, 0, 0x1p16000L)
+  L1 (log10, 0, 0x1p16000L)
+  L1 (log1p, -0.5, 10)
+  L1 (sin, -10, 10)
+  L1 (cos, -10, 10)
+  L1 (tan, -10, 10)
+  L1 (asin, -1, 1)
+  L1 (acos, -1, 1)
+  L1 (atan, -10, 10)
+  L1 (sqrt, 0, 0x1p16000L)
+  L2 (pow, 0.01, 11.1, -10, 10)
+  L2 (atan2, -10, 10, -10, 10)
+  L2 (fmod, -1e10, 1e10, -10, 10)
+  L2 (remainder, -1e10, 1e10, -10, 10)
+#ifdef NEWLIB_LIBM
+  K1 (acosh, 1, 10)
+  K1 (atanh, -1, 1)
+  K2 (fmod, -1e10, 1e10, -10, 10)
+  K1 (log10, 0x1p-1000, 0x1p1000)
+  K2 (remainder, -1e10, 1e10, -10, 10)
+  K1 (sqrt, 0, 1e10)
+  KF1 (acos, -1, 1)
+  KF1 (acosh, 1, 10)
+  KF1 (asin, -1, 1)
+  KF2 (atan2, -10, 10, -10, 10)
+  KF1 (atanh, -1, 1)
+  KF1 (cosh, -10, 10)
+  KF2 (fmod, -1e10, 1e10, -10, 10)
+  KF2 (hypot, -10, 10, -10, 10)
+  KF1 (log10, 0x1p-126, 0x1p127)
+  KF2 (remainder, -1e10, 1e10, -10, 10)
+  KF1 (sinh, -10, 10)
+  KF1 (sqrt, 0, 1e10)
+#endif
+  CD1 (cexp, -10, 10, -10, 10)
+  CD1 (clog, -10, 10, -10, 10)
+  CD1 (csqrt, -10, 10, -10, 10)
+  CD1 (csin, -10, 10, -10, 10)
+  CD1 (ccos, -10, 10, -10, 10)
+  CD1 (csinh, -10, 10, -10, 10)
+  CD1 (ccosh, -10, 10, -10, 10)
+  {"cpow", 1, CD, {.cd = cpow_z}, {.c = cpow_zq}, -10, 10, -10, 10},
+  CF1 (cexp, -10, 10, -10, 10)
+  CF1 (clog, -10, 10, -10, 10)
+  CF1 (csqrt, -10, 10, -10, 10)
+  CF1 (csin, -10, 10, -10, 10)
+  CF1 (ccos, -10, 10, -10, 10)
+  CF1 (csinh, -10, 10, -10, 10)
+  CF1 (ccosh, -10, 10, -10, 10)
+  {"cpowf", 1, CF, {.cf = cpow_zf}, {.c = cpow_zq}, -10, 10, -10, 10},
+  {0}
+};
+
+static uint64_t seed = 0x0123456789abcdefULL;
+
+static long double
+rand_in (long double lo, long double hi)
+{
+  /* 64-bit LCG, all 64 bits give a uniform long double in [0, 1).  */
+  seed = 6364136223846793005ULL * seed + 1442695040888963407ULL;
+  return lo + (hi - lo) * (seed * 0x1p-64L);
+}
+
+static double
+now (void)
+{
+  struct timespec ts;
+
+  clock_gettime (CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static double *xs, *ys;
+static float *xfs, *yfs;
+static long double *xls, *yls;
+static int count = 5000;
+static int iters = 40;
+
+/* Opaque zero so that the latency loops cannot drop the dependency.  */
+static volatile uint64_t vzero;
+
+static void
+bench (const struct fun *f)
+{
+  double t0, tput, lat;
+  uint64_t zero = vzero;
+  int i, n;
+
+  if (f->type == F)
+    {
+      float s = 0, prev = 0;
+
+      t0 = now ();
+      for (n = 0; n < iters; n++)
+	for (i = 0; i < count; i++)
+	  s += f->args == 1 ? f->fun.f (xfs[i]) : f->fun.f2 (xfs[i], yfs[i]);
+      tput = now () - t0;
+      t0 = now ();
+      for (n = 0; n < iters; n++)
+	for (i = 0; i < count; i++)
+	  {
+	    union { float f; uint32_t i; } u = {prev};
+	    float x = xfs[i] + (float) (u.i & zero);
+	    prev = f->args == 1 ? f->fun.f (x) : f->fun.f2 (x, yfs[i]);
+	  }
+      lat = now () - t0;
+      vzero = (uint64_t) (s + prev) & 0;
+    }
+  else if (f->type == D)
+    {
+      double s = 0, prev = 0;
+
+      t0 = now ();
+      for (n = 0; n < iters; n++)
+	for (i = 0; i < count; i++)
+	  s += f->args == 1 ? f->fun.d (xs[i]) : f->fun.d2 (xs[i], ys[i]);
+      tput = now () - t0;
+      t0 = now ();
+      for (n = 0; n < iters; n++)
+	for (i = 0; i < count; i++)
+	  {
+	    union { double f; uint64_t i; } u = {prev};
+	    double x = xs[i] + (double) (u.i & zero);
+	    prev = f->args == 1 ? f->fun.d (x) : f->fun.d2 (x, ys[i]);
+	  }
+      lat = now () - t0;
+      vzero = (uint64_t) (s + prev) & 0;
+    }
+  else if (f->type == CF)
+    {
+      float complex s = 0, prev = 0;
+
+      t0 = now ();
+      for (n = 0; n < iters; n++)
+	for (i = 0; i < count; i++)
+	  s += f->fun.cf (CMPLXF (xfs[i], yfs[i]));
+      tput = now () - t0;
+      t0 = now ();
+      for (n = 0; n < iters; n++)
+	for (i = 0; i < count; i++)
+	  {
+	    union { float f; uint32_t i; } u = {crealf (prev)};
+	    float x = xfs[i] + (float) (u.i & zero);
+	    prev = f->fun.cf (CMPLXF (x, yfs[i]));
+	  }
+      lat = now () - t0;
+      vzero = (uint64_t) crealf (s + prev) & 0;
+    }
+  else if (f->type == CD)
+    {
+      double complex s = 0, prev = 0;
+
+      t0 = now ();
+      for (n = 0; n < iters; n++)
+	for (i = 0; i < count; i++)
+	  s += f->fun.cd (CMPLX (xs[i], ys[i]));
+      tput = now () - t0;
+      t0 = now ();
+      for (n = 0; n < iters; n++)
+	for (i = 0; i < count; i++)
+	  {
+	    union { double f; uint64_t i; } u = {creal (prev)};
+	    double x = xs[i] + (double) (u.i & zero);
+	    prev = f->fun.cd (CMPLX (x, ys[i]));
+	  }
+      lat = now () - t0;
+      vzero = (uint64_t) creal (s + prev) & 0;
+    }
+  else
+    {
+      long double s = 0, prev = 0;
+
+      t0 = now ();
+      for (n = 0; n < iters; n++)
+	for (i = 0; i < count; i++)
+	  s += f->args == 1 ? f->fun.l (xls[i]) : f->fun.l2 (xls[i], yls[i]);
+      tput = now () - t0;
+      t0 = now ();
+      for (n = 0; n < iters; n++)
+	for (i = 0; i < count; i++)
+	  {
+	    union { long double f; uint64_t i[2]; } u = {prev};
+	    long double x = xls[i] + (long double) (u.i[0] & zero);
+	    prev = f->args == 1 ? f->fun.l (x) : f->fun.l2 (x, yls[i]);
+	  }
+      lat = now () - t0;
+      vzero = (uint64_t) (s + prev) & 0;
+    }
+  tput /= (double) iters * count;
+  lat /= (double) iters * count;
+  printf ("%-8s tput %7.2f ns/call %8.1f Mcall/s  lat %7.2f ns/call\n",
+	  f->name, tput, 1e3 / tput, lat);
+}
+
+/* Difference between Y and the exact REF in units of the last place of
+   REF rounded to a format with MANT bits and minimum exponent EMIN.  */
+static double
+ulperr (long double y, __float128 ref, int mant, int emin)
+{
+  int e;
+
+  if (isnan (y) && isnanq (ref))
+    return 0;
+  if (isinfq (ref) || isinf (y))
+    return y == ref ? 0 : INFINITY;
+  frexpq (ref, &e);
+  if (e - 1 < emin)
+    e = emin + 1;
+  return (double) ldexpq (y - ref, mant - e);
+}
+
+static __complex128
+complexq (long double re, long double im)
+{
+  __complex128 z;
+
+  __real__ z = re;
+  __imag__ z = im;
+  return z;
+}
+
+/* Error of the complex Y in units of the last place of the larger part of
+   the exact REF, infinite when a part of either is not finite.  */
+static double
+culperr (long double complex y, __complex128 ref, int mant, int emin)
+{
+  __float128 re = __real__ ref, im = __imag__ ref, dre, dim;
+  int e;
+
+  if (!finiteq (re) || !finiteq (im) || !isfinite (creall (y))
+      || !isfinite (cimagl (y)))
+    return INFINITY;
+  dre = fabsq (creall (y) - re);
+  dim = fabsq (cimagl (y) - im);
+  frexpq (fabsq (re) > fabsq (im) ? re : im, &e);
+  if (e - 1 < emin)
+    e = emin + 1;
+  return (double) ldexpq (dre > dim ? dre : dim, mant - e);
+}
+
+static void
+ulp (const struct fun *f)
+{
+  double maxerr = 0, sumerr = 0, err;
+  long double y, x1, x2, worstx = 0, worsty = 0;
+  __float128 ref;
+  int i, n = 0;
+
+  for (i = 0; i < count; i++)
+    {
+      if (f->type == F)
+	{
+	  if (f->args == 1)
+	    {
+	      y = f->fun.f (xfs[i]);
+	      ref = f->ref.q (xfs[i]);
+	    }
+	  else
+	    {
+	      y = f->fun.f2 (xfs[i], yfs[i]);
+	      ref = f->ref.q2 (xfs[i], yfs[i]);
+	    }
+	  err = fabs (ulperr (y, ref, 24, -126));
+	  x1 = xfs[i];
+	  x2 = yfs[i];
+	}
+      else if (f->type == D)
+	{
+	  if (f->args == 1)
+	    {
+	      y = f->fun.d (xs[i]);
+	      ref = f->ref.q (xs[i]);
+	    }
+	  else
+	    {
+	      y = f->fun.d2 (xs[i], ys[i]);
+	      ref = f->ref.q2 (xs[i], ys[i]);
+	    }
+	  err = fabs (ulperr (y, ref, 53, -1022));
+	  x1 = xs[i];
+	  x2 = ys[i];
+	}
+      else if (f->type == CF)
+	{
+	  err = culperr (f->fun.cf (CMPLXF (xfs[i], yfs[i])),
+			 f->ref.c (complexq (xfs[i], yfs[i])), 24, -126);
+	  x1 = xfs[i];
+	  x2 = yfs[i];
+	}
+      else if (f->type == CD)
+	{
+	  err = culperr (f->fun.cd (CMPLX (xs[i], ys[i])),
+			 f->ref.c (complexq (xs[i], ys[i])), 53, -1022);
+	  x1 = xs[i];
+	  x2 = ys[i];
+	}
+      else
+	{
+	  if (f->args == 1)
+	    {
+	      y = f->fun.l (xls[i]);
+	      ref = f->ref.q (xls[i]);
+	    }
+	  else
+	    {
+	      y = f->fun.l2 (xls[i], yls[i]);
+	      ref = f->ref.q2 (xls[i], yls[i]);
+	    }
+	  err = fabs (ulperr (y, ref, 64, -16382));
+	  x1 = xls[i];
+	  x2 = yls[i];
+	}
+      if (isinf (err))
+	continue;
+      n++;
+      sumerr += err;
+      if (err > maxerr)
+	{
+	  maxerr = err;
+	  worstx = x1;
+	  worsty = x2;
+	}
+    }
+  printf ("%-8s max %8.3f ulp  avg %6.3f ulp  at ", f->name, maxerr,
+	  n ? sumerr / n : 0);
+  if (f->type == L)
+    printf (f->args == 2 ? "%La %La\n" : "%La\n", worstx, worsty);
+  else
+    printf (f->args == 2 || f->type >= CD ? "%a %a\n" : "%a\n",
+	    (double) worstx, (double) worsty);
+}
+
+static void
+run (const struct fun *f, long double lo, long double hi, long double lo2,
+     long double hi2, int dobench, int doulp)
+{
+  int i;
+
+  for (i = 0; i < count; i++)
+    {
+      xls[i] = rand_in (lo, hi);
+      yls[i] = rand_in (lo2, hi2);
+      xs[i] = xls[i];
+      ys[i] = yls[i];
+      xfs[i] = xs[i];
+      yfs[i] = ys[i];
+    }
+  if (dobench)
+    bench (f);
+  if (doulp)
+    ulp (f);
+}
+
+static void
+usage (void)
+{
+  const struct fun *f;
+
+  fprintf (stderr, "usage: mathbench [-n count] [-i iters] [-b | -u] "
+	   "[func[:lo:hi[:lo2:hi2]]]...\nfunctions:");
+  for (f = funtab; f->name; f++)
+    fprintf (stderr, " %s", f->name);
+  fprintf (stderr, "\n");
+  exit (1);
+}
+
+int
+main (int argc, char **argv)
+{
+  const struct fun *f;
+  int i, dobench = 1, doulp = 1;
+
+  for (i = 1; i < argc && argv[i][0] == '-'; i++)
+    {
+      if (strcmp (argv[i], "-n") == 0 && i + 1 < argc)
+	count = atoi (argv[++i]);
+      else if (strcmp (argv[i], "-i") == 0 && i + 1 < argc)
+	iters = atoi (argv[++i]);
+      else if (strcmp (argv[i], "-b") == 0)
+	doulp = 0;
+      else if (strcmp (argv[i], "-u") == 0)
+	dobench = 0;
+      else
+	usage ();
+    }
+  if (count <= 0 || iters <= 0)
+    usage ();
+  xs = malloc (count * sizeof *xs);
+  ys = malloc (count * sizeof *ys);
+  xfs = malloc (count * sizeof *xfs);
+  yfs = malloc (count * sizeof *yfs);
+  xls = malloc (count * sizeof *xls);
+  yls = malloc (count * sizeof *yls);
+  if (!xs || !ys || !xfs || !yfs || !xls || !yls)
+    {
+      perror ("mathbench");
+      return 1;
+    }
+
+  if (i == argc)
+    for (f = funtab; f->name; f++)
+      run (f, f->lo, f->hi, f->lo2, f->hi2, dobench, doulp);
+  for (; i < argc; i++)
+    {
+      char name[32];
+      long double lo, hi, lo2, hi2;
+      size_t len = strcspn (argv[i], ":");
+
+      if (len >= sizeof name)
+	usage ();
+      memcpy (name, argv[i], len);
+      name[len] = 0;
+      for (f = funtab; f->name; f++)
+	if (strcmp (f->name, name) == 0)
+	  break;
+      if (!f->name)
+	usage ();
+      lo = f->lo, hi = f->hi, lo2 = f->lo2, hi2 = f->hi2;
+      if (argv[i][len]
+	  && sscanf (argv[i] + len, ":%Lf:%Lf:%Lf:%Lf", &lo, &hi, &lo2, &hi2)
+	     < 2)
+	usage ();
+      run (f, lo, hi, lo2, hi2, dobench, doulp);
+    }
+  return 0;
+}
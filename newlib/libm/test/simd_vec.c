@@ -0,0 +1,161 @@
+/* The vector variants of libm/machine/x86_64 and libm/machine/aarch64 (see
+   libm/common/v_math.h) against the scalar functions.  The variants take
+   the same steps as the scalar code, up to the order of some operations,
+   and pass the lanes that need its slow paths to it: every lane must be
+   within 1 ULP of the scalar result, and give it exactly if that is 0,
+   inf or nan.  The arguments mix such lanes with ordinary ones.  Only the
+   variant for the baseline ISA is tested, SSE2 or AdvSIMD.  */
+
+#include "test.h"
+#include <stdint.h>
+#include <string.h>
+
+#if !__OBSOLETE_MATH && defined (__GNUC__) && __GNUC__ >= 9		\
+    && !defined (__clang__) && (defined (__x86_64__) || defined (__aarch64__))
+
+extern int inacc;
+
+#ifdef __aarch64__
+#define V_ABI __attribute__ ((aarch64_vector_pcs))
+#define V(name) _ZGVn ## name
+#else
+#define V_ABI
+#define V(name) _ZGVb ## name
+#endif
+
+typedef double v2df __attribute__ ((vector_size (16)));
+typedef float v4sf __attribute__ ((vector_size (16)));
+
+V_ABI v2df V (N2v_exp) (v2df);
+V_ABI v2df V (N2v_exp2) (v2df);
+V_ABI v2df V (N2v_log) (v2df);
+V_ABI v2df V (N2v_log2) (v2df);
+V_ABI v2df V (N2vv_pow) (v2df, v2df);
+V_ABI v4sf V (N4v_expf) (v4sf);
+V_ABI v4sf V (N4v_logf) (v4sf);
+V_ABI v4sf V (N4vv_powf) (v4sf, v4sf);
+V_ABI v4sf V (N4v_sinf) (v4sf);
+V_ABI v4sf V (N4v_cosf) (v4sf);
+
+static const double args[] = {
+  0.5, -0.0, 1.0, 0x1p-1074, 2.75, -3.5, 0.0, 1e-300, 10.0,
+  0x1.fffffffffffffp1023,
+  -1.0, 709.7, 0.1, 709.8, -0.1, -745.1, 3.0, -745.2, 1.5, -1e300,
+  0x1p-1022, 1022.5, 0x1p-1030, -1074.5, 64.0, 1024.0, 0.999, __builtin_inf (),
+  1.001, -__builtin_inf (), 100.25, __builtin_nan (""), 2.0, -2.0, 1e10, -1e10,
+  0.3, 88.5, -87.5, -103.5, 1e5, 1e38, -0x1p30, 0x1.921fb6p0, 3e-5, 0.75
+};
+
+#define NARGS (sizeof (args) / sizeof (args[0]))
+
+/* The argument for lane K when lane 0 has args[I]; each argument meets
+   each other in some vector.  */
+#define ARG(i, k) args[((i) + (k) * ((k) + 3)) % NARGS]
+
+static void
+report (const char *name, int li, double x, double y, double is,
+	double shouldbe)
+{
+  printf ("%s lane %d, wrong answer: (%a, %a) gives %a, should be %a\n",
+	  name, li, x, y, is, shouldbe);
+  inacc++;
+}
+
+static void
+check_d (const char *name, int li, double x, double y, double is,
+	 double shouldbe)
+{
+  int64_t a, b;
+
+  memcpy (&a, &is, sizeof (a));
+  memcpy (&b, &shouldbe, sizeof (b));
+  if (a == b || (is != is && shouldbe != shouldbe))
+    return;
+  if ((a ^ b) < 0 || is - is != 0 || shouldbe - shouldbe != 0
+      || shouldbe == 0 || a - b > 1 || b - a > 1)
+    report (name, li, x, y, is, shouldbe);
+}
+
+static void
+check_f (const char *name, int li, float x, float y, float is,
+	 float shouldbe)
+{
+  int32_t a, b;
+
+  memcpy (&a, &is, sizeof (a));
+  memcpy (&b, &shouldbe, sizeof (b));
+  if (a == b || (is != is && shouldbe != shouldbe))
+    return;
+  if ((a ^ b) < 0 || is - is != 0 || shouldbe - shouldbe != 0
+      || shouldbe == 0 || a - b > 1 || b - a > 1)
+    report (name, li, x, y, is, shouldbe);
+}
+
+#define D1(fn)								\
+  for (i = 0; i < NARGS; i++)						\
+    {									\
+      v2df x = { ARG (i, 0), ARG (i, 1) };				\
+      v2df r = V (N2v_ ## fn) (x);					\
+      for (k = 0; k < 2; k++)						\
+	check_d (#fn, k, x[k], 0, r[k], (fn) (x[k]));			\
+    }
+
+#define D2(fn)								\
+  for (i = 0; i < NARGS; i++)						\
+    for (j = 0; j < NARGS; j++)						\
+      {									\
+	v2df x = { ARG (i, 0), ARG (i, 1) };				\
+	v2df y = { ARG (j, 0), ARG (j, 1) };				\
+	v2df r = V (N2vv_ ## fn) (x, y);				\
+	for (k = 0; k < 2; k++)						\
+	  check_d (#fn, k, x[k], y[k], r[k], (fn) (x[k], y[k]));	\
+      }
+
+#define F1(fn)								\
+  for (i = 0; i < NARGS; i++)						\
+    {									\
+      v4sf x = { ARG (i, 0), ARG (i, 1), ARG (i, 2), ARG (i, 3) };	\
+      v4sf r = V (N4v_ ## fn) (x);					\
+      for (k = 0; k < 4; k++)						\
+	check_f (#fn, k, x[k], 0, r[k], (fn) (x[k]));			\
+    }
+
+#define F2(fn)								\
+  for (i = 0; i < NARGS; i++)						\
+    for (j = 0; j < NARGS; j++)						\
+      {									\
+	v4sf x = { ARG (i, 0), ARG (i, 1), ARG (i, 2), ARG (i, 3) };	\
+	v4sf y = { ARG (j, 0), ARG (j, 1), ARG (j, 2), ARG (j, 3) };	\
+	v4sf r = V (N4vv_ ## fn) (x, y);				\
+	for (k = 0; k < 4; k++)						\
+	  check_f (#fn, k, x[k], y[k], r[k], (fn) (x[k], y[k]));	\
+      }
+
+void
+test_simd (int vector)
+{
+  unsigned int i, j, k;
+
+  if (vector)
+    return;
+  newfunc ("vector variants");
+  D1 (exp)
+  D1 (exp2)
+  D1 (log)
+  D1 (log2)
+  D2 (pow)
+  F1 (expf)
+  F1 (logf)
+  F2 (powf)
+  F1 (sinf)
+  F1 (cosf)
+}
+
+#else
+
+void
+test_simd (int vector)
+{
+}
+
+#endif
@@ -1,6 +1,7 @@
 
 #include "test.h"
 #include <ieeefp.h>
+#include <fenv.h>
 
 
 /* Test fp getround and fp setround */
@@ -161,6 +162,50 @@ test_round (void)
 }
 
 
+#if defined (FE_DOWNWARD) && defined (FE_UPWARD)
+/* Sums that round differently down and up, with fesetround, which is
+   inline when optimizing on some targets.  Operands and results are
+   ordinary objects in memory, not volatile ones, so the compiler must
+   not move the sums across the rounding mode changes or reuse one sum
+   for both modes.  */
+double fe_one = 1.0;
+double fe_tiny = 0x1p-60;
+long double fe_lone = 1.0L;
+long double fe_ltiny = 0x1p-200L;
+double dn, up;
+long double ldn, lup;
+
+void
+test_fesetround (void)
+{
+  newfunc("fesetround");
+
+  fesetround(FE_DOWNWARD);
+  dn = fe_one + fe_tiny;
+  ldn = fe_lone + fe_ltiny;
+  fesetround(FE_UPWARD);
+  up = fe_one + fe_tiny;
+  lup = fe_lone + fe_ltiny;
+  fesetround(FE_TONEAREST);
+  line(1);
+  test_iok(dn == 1.0, 1);
+  line(2);
+  test_iok(up == 1.0 + 0x1p-52, 1);
+  line(3);
+  test_iok(ldn == 1.0L && lup > 1.0L, 1);
+
+  fesetround(FE_UPWARD);
+  up = - fe_one - fe_tiny;
+  fesetround(FE_DOWNWARD);
+  dn = - fe_one - fe_tiny;
+  fesetround(FE_TONEAREST);
+  line(4);
+  test_iok(up == -1.0, 1);
+  line(5);
+  test_iok(dn == -1.0 - 0x1p-52, 1);
+}
+#endif
+
 void
 test_ieee (void)
 {
@@ -171,6 +216,9 @@ test_ieee (void)
   test_getroundtoi();
 
   test_round();
+#if defined (FE_DOWNWARD) && defined (FE_UPWARD)
+  test_fesetround();
+#endif
   fpsetround(old);
 
   
@@ -0,0 +1,72 @@
+/* Correctly rounded tgamma values.  The tgamma of the !__OBSOLETE_MATH
+   configuration is within 16 ULP, so the first 59 bits must agree.  The
+   older exp (lgamma (x)) inherits the rounding of lgamma (x), which near
+   the overflow threshold is about 709 with an ULP of 2^-43, worth 2^9 ULP
+   of the result: with the error of lgamma itself it is within 1024 ULP,
+   which leaves 54 bits.  */
+#include "test.h"
+#if __OBSOLETE_MATH
+#define OKBITS 54
+#else
+#define OKBITS 59
+#endif
+ one_line_type tgamma_vec[] = {
+{OKBITS, 0,123,__LINE__, 0xbfc752d6, 0x6fd5dd09, 0xc013cccc, 0xcccccccd},			/* -0.182216=f(-4.95)*/
+{OKBITS, 0,123,__LINE__, 0xbfab0661, 0x3ed611af, 0xc0129999, 0x9999999a},			/* -0.052783=f(-4.65)*/
+{OKBITS, 0,123,__LINE__, 0xbfb5e8b1, 0x8b7910fd, 0xc0116666, 0x66666667},			/* -0.0855819=f(-4.35)*/
+{OKBITS, 0,123,__LINE__, 0xbfe8d3d1, 0x8fa7ddf7, 0xc0103333, 0x33333334},			/* -0.775857=f(-4.05)*/
+{OKBITS, 0,123,__LINE__, 0x3fd124b7, 0xf9ca9e3c, 0xc00e0000, 0x00000002},			/* 0.267866=f(-3.75)*/
+{OKBITS, 0,123,__LINE__, 0x3fd2c0f8, 0x5489df6e, 0xc00b9999, 0x9999999c},			/* 0.293028=f(-3.45)*/
+{OKBITS, 0,123,__LINE__, 0x3fee78ea, 0x0931149b, 0xc0093333, 0x33333336},			/* 0.95226=f(-3.15)*/
+{OKBITS, 0,123,__LINE__, 0xbff6350b, 0x6652ba75, 0xc006cccc, 0xccccccd0},			/* -1.38795=f(-2.85)*/
+{OKBITS, 0,123,__LINE__, 0xbfecf8b2, 0x92daceb7, 0xc0046666, 0x6666666a},			/* -0.905359=f(-2.55)*/
+{OKBITS, 0,123,__LINE__, 0xbffbe291, 0xd7349116, 0xc0020000, 0x00000004},			/* -1.74281=f(-2.25)*/
+{OKBITS, 0,123,__LINE__, 0x40250534, 0xad0123a0, 0xbfff3333, 0x3333333b},			/* 10.5102=f(-1.95)*/
+{OKBITS, 0,123,__LINE__, 0x4002fe03, 0x580d3f78, 0xbffa6666, 0x6666666e},			/* 2.37403=f(-1.65)*/
+{OKBITS, 0,123,__LINE__, 0x4007723e, 0x81bc04a6, 0xbff59999, 0x999999a1},			/* 2.93078=f(-1.35)*/
+{OKBITS, 0,123,__LINE__, 0x4033a590, 0x16636c93, 0xbff0cccc, 0xccccccd4},			/* 19.6467=f(-1.05)*/
+{OKBITS, 0,123,__LINE__, 0xc013562a, 0x82ff4a0a, 0xbfe80000, 0x0000000e},			/* -4.83415=f(-0.75)*/
+{OKBITS, 0,123,__LINE__, 0xc00cbb29, 0x3eec22a8, 0xbfdccccc, 0xcccccce9},			/* -3.59139=f(-0.45)*/
+{OKBITS, 0,123,__LINE__, 0xc01daa8e, 0x3eb3589e, 0xbfc33333, 0x3333336c},			/* -7.41656=f(-0.15)*/
+{OKBITS, 0,123,__LINE__, 0x4058dbaf, 0x797edf3d, 0x3f847ae1, 0x47ae147b},			/* 99.4326=f(0.01)*/
+{OKBITS, 0,123,__LINE__, 0x402306ea, 0x7b280d87, 0x3fb99999, 0x9999999a},			/* 9.51351=f(0.1)*/
+{OKBITS, 0,123,__LINE__, 0x400d013f, 0xc47eeeea, 0x3fd00000, 0x00000000},			/* 3.62561=f(0.25)*/
+{OKBITS, 0,123,__LINE__, 0x3ffc5bf8, 0x91b4ef6b, 0x3fe00000, 0x00000000},			/* 1.77245=f(0.5)*/
+{OKBITS, 0,123,__LINE__, 0x3ff39b4e, 0x8b50f62c, 0x3fe80000, 0x00000000},			/* 1.22542=f(0.75)*/
+{OKBITS, 0,123,__LINE__, 0x3ff00000, 0x00000000, 0x3ff00000, 0x00000000},			/* 1=f(1)*/
+{OKBITS, 0,123,__LINE__, 0x3fed61a3, 0x6a1a201e, 0x3ff33333, 0x33333333},			/* 0.918169=f(1.2)*/
+{OKBITS, 0,123,__LINE__, 0x3fec5bf8, 0x91b4ef6b, 0x3ff80000, 0x00000000},			/* 0.886227=f(1.5)*/
+{OKBITS, 0,123,__LINE__, 0x3ff00000, 0x00000000, 0x40000000, 0x00000000},			/* 1=f(2)*/
+{OKBITS, 0,123,__LINE__, 0x3ff544fa, 0x6d47b390, 0x40040000, 0x00000000},			/* 1.32934=f(2.5)*/
+{OKBITS, 0,123,__LINE__, 0x40000000, 0x00000000, 0x40080000, 0x00000000},			/* 2=f(3)*/
+{OKBITS, 0,123,__LINE__, 0x4010aebf, 0x5759a454, 0x400d9999, 0x9999999a},			/* 4.17065=f(3.7)*/
+{OKBITS, 0,123,__LINE__, 0x40274371, 0xe7866c65, 0x40120000, 0x00000000},			/* 11.6317=f(4.5)*/
+{OKBITS, 0,123,__LINE__, 0x40380000, 0x00000000, 0x40140000, 0x00000000},			/* 24=f(5)*/
+{OKBITS, 0,123,__LINE__, 0x40671b8d, 0x00a81d10, 0x40190000, 0x00000000},			/* 184.861=f(6.25)*/
+{OKBITS, 0,123,__LINE__, 0x40b01ab5, 0xa0c31b03, 0x401f9999, 0x9999999a},			/* 4122.71=f(7.9)*/
+{OKBITS, 0,123,__LINE__, 0x40b3b000, 0x00000000, 0x40200000, 0x00000000},			/* 5040=f(8)*/
+{OKBITS, 0,123,__LINE__, 0x40fd1fc7, 0x6454758a, 0x40230000, 0x00000000},			/* 119292=f(9.5)*/
+{OKBITS, 0,123,__LINE__, 0x41162600, 0x00000000, 0x40240000, 0x00000000},			/* 362880=f(10)*/
+{OKBITS, 0,123,__LINE__, 0x4193e170, 0x5f9991bc, 0x40289999, 0x9999999a},			/* 8.33854e+07=f(12.3)*/
+{OKBITS, 0,123,__LINE__, 0x42344c3b, 0x28000000, 0x402e0000, 0x00000000},			/* 8.71783e+10=f(15)*/
+{OKBITS, 0,123,__LINE__, 0x42d3789c, 0x8ef8e684, 0x40318000, 0x00000000},			/* 8.5635e+13=f(17.5)*/
+{OKBITS, 0,123,__LINE__, 0x437b02b9, 0x30689000, 0x40340000, 0x00000000},			/* 1.21645e+17=f(20)*/
+{OKBITS, 0,123,__LINE__, 0x444e7752, 0x6159f06c, 0x40370000, 0x00000000},			/* 1.124e+21=f(23)*/
+{OKBITS, 0,123,__LINE__, 0x44baadf7, 0x49e77e83, 0x40388000, 0x00000000},			/* 1.25991e+23=f(24.5)*/
+{OKBITS, 0,123,__LINE__, 0x46639256, 0x7f8a9141, 0x403e1999, 0x9999999a},			/* 1.2405e+31=f(30.1)*/
+{OKBITS, 0,123,__LINE__, 0x4b70fb35, 0x1a32ec4c, 0x4046cccc, 0xcccccccd},			/* 2.60237e+55=f(45.6)*/
+{OKBITS, 0,123,__LINE__, 0x5092b6c3, 0x5dccd76c, 0x404e0000, 0x00000000},			/* 1.38683e+80=f(60)*/
+{OKBITS, 0,123,__LINE__, 0x5869585f, 0x6c854a5c, 0x40542000, 0x00000000},			/* 7.98922e+117=f(80.5)*/
+{OKBITS, 0,123,__LINE__, 0x605166c6, 0x98cf183b, 0x40590000, 0x00000000},			/* 9.33262e+155=f(100)*/
+{OKBITS, 0,123,__LINE__, 0x68e3bb0b, 0x540c55cf, 0x405e1000, 0x00000000},			/* 1.84361e+197=f(120.25)*/
+{OKBITS, 0,123,__LINE__, 0x7608c5d9, 0x2b583900, 0x4062c000, 0x00000000},			/* 3.80892e+260=f(150)*/
+{OKBITS, 0,123,__LINE__, 0x7f69589f, 0x849167a8, 0x40655000, 0x00000000},			/* 5.56209e+305=f(170.5)*/
+{OKBITS, 0,123,__LINE__, 0x7fec3ada, 0xdc5107b1, 0x40657333, 0x33333333},			/* 1.5859e+308=f(171.6)*/
+{OKBITS, 0,123,__LINE__, 0xbe91b7b1, 0xdb2e47f1, 0xc0250000, 0x00000000},			/* -2.64012e-07=f(-10.5)*/
+{OKBITS, 0,123,__LINE__, 0xbc27be20, 0x4054ca42, 0xc0344ccc, 0xcccccccd},			/* -6.43547e-19=f(-20.3)*/
+{OKBITS, 0,123,__LINE__, 0xb26b801f, 0x451d7974, 0xc0495999, 0x9999999a},			/* -8.1604e-66=f(-50.7)*/
+{OKBITS, 0,123,__LINE__, 0x9f07932f, 0xb5136292, 0xc0592000, 0x00000000},			/* -3.35369e-159=f(-100.5)*/
+{OKBITS, 0,123,__LINE__, 0x895e6d0a, 0x9ed79e9f, 0xc062c999, 0x9999999a},			/* -1.50976e-263=f(-150.3)*/
+{OKBITS, 0,123,__LINE__, 0x800efa48, 0x53ec2b5c, 0xc0655333, 0x33333333},			/* -2.0829e-308=f(-170.6)*/
+0,};
+test_tgamma(m)   {run_vector_1(m,tgamma_vec,(char *)(tgamma),"tgamma","dd");   }
@@ -0,0 +1,65 @@
+/* Correctly rounded tgammaf values.  The tgammaf of the !__OBSOLETE_MATH
+   configuration rounds the double tgamma, so it is within 1 ULP of float,
+   which is 2^29 ULP of double and leaves 34 bits.  The older
+   expf (lgammaf (x)) inherits the rounding of lgammaf (x), which is below
+   89 without overflow and has an ULP of at most 2^-17, worth 2^6 ULP of
+   the result: with the error of lgammaf itself it is within 128 ULP,
+   which leaves 28 bits.  */
+#include "test.h"
+#if __OBSOLETE_MATH
+#define OKBITS 28
+#else
+#define OKBITS 34
+#endif
+ one_line_type tgammaf_vec[] = {
+{OKBITS, 0,123,__LINE__, 0xbfc752d1, 0x20000000, 0xc013cccc, 0xcccccccd},			/* -0.182215=f(-4.95)*/
+{OKBITS, 0,123,__LINE__, 0xbfab0661, 0x40000000, 0xc0129999, 0x9999999a},			/* -0.052783=f(-4.65)*/
+{OKBITS, 0,123,__LINE__, 0xbfb5e8b2, 0x00000000, 0xc0116666, 0x66666667},			/* -0.0855819=f(-4.35)*/
+{OKBITS, 0,123,__LINE__, 0xbfe8d3ca, 0xe0000000, 0xc0103333, 0x33333334},			/* -0.775854=f(-4.05)*/
+{OKBITS, 0,123,__LINE__, 0x3fd124b8, 0x00000000, 0xc00e0000, 0x00000002},			/* 0.267866=f(-3.75)*/
+{OKBITS, 0,123,__LINE__, 0x3fd2c0f8, 0x40000000, 0xc00b9999, 0x9999999c},			/* 0.293028=f(-3.45)*/
+{OKBITS, 0,123,__LINE__, 0x3fee78e8, 0xa0000000, 0xc0093333, 0x33333336},			/* 0.952259=f(-3.15)*/
+{OKBITS, 0,123,__LINE__, 0xbff6350a, 0xc0000000, 0xc006cccc, 0xccccccd0},			/* -1.38795=f(-2.85)*/
+{OKBITS, 0,123,__LINE__, 0xbfecf8b2, 0xa0000000, 0xc0046666, 0x6666666a},			/* -0.905359=f(-2.55)*/
+{OKBITS, 0,123,__LINE__, 0xbffbe291, 0xe0000000, 0xc0020000, 0x00000004},			/* -1.74281=f(-2.25)*/
+{OKBITS, 0,123,__LINE__, 0x40250535, 0xe0000000, 0xbfff3333, 0x3333333b},			/* 10.5102=f(-1.95)*/
+{OKBITS, 0,123,__LINE__, 0x4002fe03, 0x60000000, 0xbffa6666, 0x6666666e},			/* 2.37403=f(-1.65)*/
+{OKBITS, 0,123,__LINE__, 0x4007723e, 0x60000000, 0xbff59999, 0x999999a1},			/* 2.93078=f(-1.35)*/
+{OKBITS, 0,123,__LINE__, 0x4033a591, 0x60000000, 0xbff0cccc, 0xccccccd4},			/* 19.6467=f(-1.05)*/
+{OKBITS, 0,123,__LINE__, 0xc013562a, 0x80000000, 0xbfe80000, 0x0000000e},			/* -4.83415=f(-0.75)*/
+{OKBITS, 0,123,__LINE__, 0xc00cbb29, 0x40000000, 0xbfdccccc, 0xcccccce9},			/* -3.59139=f(-0.45)*/
+{OKBITS, 0,123,__LINE__, 0xc01daa8e, 0x20000000, 0xbfc33333, 0x3333336c},			/* -7.41656=f(-0.15)*/
+{OKBITS, 0,123,__LINE__, 0x4058dbaf, 0x80000000, 0x3f847ae1, 0x47ae147b},			/* 99.4326=f(0.01)*/
+{OKBITS, 0,123,__LINE__, 0x402306ea, 0x80000000, 0x3fb99999, 0x9999999a},			/* 9.51351=f(0.1)*/
+{OKBITS, 0,123,__LINE__, 0x400d013f, 0xc0000000, 0x3fd00000, 0x00000000},			/* 3.62561=f(0.25)*/
+{OKBITS, 0,123,__LINE__, 0x3ffc5bf8, 0xa0000000, 0x3fe00000, 0x00000000},			/* 1.77245=f(0.5)*/
+{OKBITS, 0,123,__LINE__, 0x3ff39b4e, 0x80000000, 0x3fe80000, 0x00000000},			/* 1.22542=f(0.75)*/
+{OKBITS, 0,123,__LINE__, 0x3ff00000, 0x00000000, 0x3ff00000, 0x00000000},			/* 1=f(1)*/
+{OKBITS, 0,123,__LINE__, 0x3fed61a3, 0x60000000, 0x3ff33333, 0x33333333},			/* 0.918169=f(1.2)*/
+{OKBITS, 0,123,__LINE__, 0x3fec5bf8, 0xa0000000, 0x3ff80000, 0x00000000},			/* 0.886227=f(1.5)*/
+{OKBITS, 0,123,__LINE__, 0x3ff00000, 0x00000000, 0x40000000, 0x00000000},			/* 1=f(2)*/
+{OKBITS, 0,123,__LINE__, 0x3ff544fa, 0x60000000, 0x40040000, 0x00000000},			/* 1.32934=f(2.5)*/
+{OKBITS, 0,123,__LINE__, 0x40000000, 0x00000000, 0x40080000, 0x00000000},			/* 2=f(3)*/
+{OKBITS, 0,123,__LINE__, 0x4010aebf, 0x60000000, 0x400d9999, 0x9999999a},			/* 4.17065=f(3.7)*/
+{OKBITS, 0,123,__LINE__, 0x40274371, 0xe0000000, 0x40120000, 0x00000000},			/* 11.6317=f(4.5)*/
+{OKBITS, 0,123,__LINE__, 0x40380000, 0x00000000, 0x40140000, 0x00000000},			/* 24=f(5)*/
+{OKBITS, 0,123,__LINE__, 0x40671b8d, 0x00000000, 0x40190000, 0x00000000},			/* 184.861=f(6.25)*/
+{OKBITS, 0,123,__LINE__, 0x40b01ab5, 0xe0000000, 0x401f9999, 0x9999999a},			/* 4122.71=f(7.9)*/
+{OKBITS, 0,123,__LINE__, 0x40b3b000, 0x00000000, 0x40200000, 0x00000000},			/* 5040=f(8)*/
+{OKBITS, 0,123,__LINE__, 0x40fd1fc7, 0x60000000, 0x40230000, 0x00000000},			/* 119292=f(9.5)*/
+{OKBITS, 0,123,__LINE__, 0x41162600, 0x00000000, 0x40240000, 0x00000000},			/* 362880=f(10)*/
+{OKBITS, 0,123,__LINE__, 0x4193e171, 0x00000000, 0x40289999, 0x9999999a},			/* 8.33854e+07=f(12.3)*/
+{OKBITS, 0,123,__LINE__, 0x42344c3b, 0x20000000, 0x402e0000, 0x00000000},			/* 8.71783e+10=f(15)*/
+{OKBITS, 0,123,__LINE__, 0x42d3789c, 0x80000000, 0x40318000, 0x00000000},			/* 8.5635e+13=f(17.5)*/
+{OKBITS, 0,123,__LINE__, 0x437b02b9, 0x40000000, 0x40340000, 0x00000000},			/* 1.21645e+17=f(20)*/
+{OKBITS, 0,123,__LINE__, 0x444e7752, 0x60000000, 0x40370000, 0x00000000},			/* 1.124e+21=f(23)*/
+{OKBITS, 0,123,__LINE__, 0x44baadf7, 0x40000000, 0x40388000, 0x00000000},			/* 1.25991e+23=f(24.5)*/
+{OKBITS, 0,123,__LINE__, 0x46639258, 0x20000000, 0x403e1999, 0x9999999a},			/* 1.2405e+31=f(30.1)*/
+{OKBITS, 0,123,__LINE__, 0xbe91b7b1, 0xe0000000, 0xc0250000, 0x00000000},			/* -2.64012e-07=f(-10.5)*/
+{OKBITS, 0,123,__LINE__, 0xbc27be26, 0xa0000000, 0xc0344ccc, 0xcccccccd},			/* -6.43549e-19=f(-20.3)*/
+{OKBITS, 0,123,__LINE__, 0x80000000, 0x00000000, 0xc0495999, 0x9999999a},			/* -0=f(-50.7)*/
+{OKBITS, 0,123,__LINE__, 0x80000000, 0x00000000, 0xc0592000, 0x00000000},			/* -0=f(-100.5)*/
+{OKBITS, 0,123,__LINE__, 0x80000000, 0x00000000, 0xc062c999, 0x9999999a},			/* -0=f(-150.3)*/
+{OKBITS, 0,123,__LINE__, 0x80000000, 0x00000000, 0xc0655333, 0x33333333},			/* -0=f(-170.6)*/
+0,};
+test_tgammaf(m)   {run_vector_1(m,tgammaf_vec,(char *)(tgammaf),"tgammaf","ff");   }
@@ -0,0 +1,110 @@
+/* Vectors for sinl, cosl and tanl where the 80-bit long double format is
+   used.  The arguments are close to multiples of pi/2, so that the
+   result depends on pi/2 to well beyond 128 bits; the expected values
+   are those of the __float128 functions of libquadmath, rounded.
+
+   x87 fsin, fcos and fptan are good to about 1 ulp on the reduced
+   argument, so sinl and cosl are expected within 2 ulp and tanl, which
+   adds the error of a division, within 4 ulp.  */
+
+#include "test.h"
+#include <float.h>
+#include <math.h>
+
+#if LDBL_MANT_DIG == 64
+
+extern int inacc;
+
+typedef struct
+{
+  int line;
+  long double x;
+  long double sin, cos, tan;
+} trigl_type;
+
+static const trigl_type trigl_vec[] = {
+  {__LINE__, 0xf39a0a24e3f8956dp-35L,
+   -0x91d8ee1f6b9dbb01p-127L, -0x1p0L,
+   0x91d8ee1f6b9dbb01p-127L},
+  {__LINE__, -0xf39a0a24e3f8956dp-35L,
+   0x91d8ee1f6b9dbb01p-127L, -0x1p0L,
+   -0x91d8ee1f6b9dbb01p-127L},
+  {__LINE__, 0x9a09018f04f2c2d4p-34L,
+   0x1p0L, 0xd6cbe4558032b85bp-130L,
+   0x1311b827437e7a5dp6L},
+  /* pi/2, pi and 3 pi/2 */
+  {__LINE__, 0xc90fdaa22168c235p-63L,
+   0x1p0L, -0xece675d1fc8f8cbbp-129L,
+   -0x8a51e04daabda35fp2L},
+  {__LINE__, 0xc90fdaa22168c235p-62L,
+   -0xece675d1fc8f8cbbp-128L, -0x1p0L,
+   0xece675d1fc8f8cbbp-128L},
+  {__LINE__, 0x12d97c7f3321d235p-58L,
+   -0x1p0L, 0x6c6b36175f5aea63p-125L,
+   -0x4b8f1127b60290e3p0L},
+  /* 10^6 pi/2, and the multiples on both sides of 2^30 */
+  {__LINE__, 0x5fdfb14ea35245ebp-42L,
+   0xca0e7c5a5b202b29p-108L, 0x1p0L,
+   0xca0e7c5a5b202b29p-108L},
+  {__LINE__, 0x7ffffffe3067fd49p-33L,
+   -0x1p0L, 0xa5086e55a95a7827p-103L,
+   -0xc68de728e7107445p-24L},
+  {__LINE__, 0x40000000aa53b3e9p-32L,
+   0xf9e231cc8717bf65p-98L, 0x1p0L,
+   0xf9e231cc8717bf65p-98L},
+  {0},
+};
+
+/* The error of IS in ulp of SHOULDBE, which is not 0.  frexpl is not
+   there for every long double format, so the ulp is found by halving.  */
+static long double
+ulp_error (long double is, long double shouldbe)
+{
+  long double a = fabsl (shouldbe), u = 1;
+
+  while (u <= a)
+    u *= 2;
+  while (u > a)
+    u /= 2;
+  return fabsl (is - shouldbe) / (u * LDBL_EPSILON);
+}
+
+static void
+check (const char *name, int li, long double is, long double shouldbe,
+       long double okulp)
+{
+  long double err = ulp_error (is, shouldbe);
+
+  if (err > okulp)
+    {
+      printf ("%s_vec.c:%d, inaccurate answer: %Lg ulp (%La %La)\n",
+	      name, li, err, shouldbe, is);
+      inacc++;
+    }
+}
+
+void
+test_trigl (int vector)
+{
+  const trigl_type *p;
+
+  if (vector)
+    return;
+  newfunc ("sinl/cosl/tanl");
+  for (p = trigl_vec; p->line; p++)
+    {
+      line (p->line);
+      check ("trigl", p->line, sinl (p->x), p->sin, 2);
+      check ("trigl", p->line, cosl (p->x), p->cos, 2);
+      check ("trigl", p->line, tanl (p->x), p->tan, 4);
+    }
+}
+
+#else
+
+void
+test_trigl (int vector)
+{
+}
+
+#endif /* LDBL_MANT_DIG == 64 */
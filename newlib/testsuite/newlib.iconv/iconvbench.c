@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 2002 by Red Hat, Incorporated. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ *
+ * Throughput of iconv between UTF-8 and UTF-16, ISO-8859-1 and CP1251,
+ * which have direct converters, and between UTF-16 and CP1251, which go
+ * through UCS-4 blocks.
+ *
+ * Usage: iconvbench [iters]
+ *
+ * Every text is converted and back, and has to come back unchanged,
+ * otherwise the program fails.  Conversions which are not configured
+ * are skipped.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <iconv.h>
+
+#define TEXT_LEN 16384
+
+/* Latin-1 and Cyrillic text in UTF-8, most of it ASCII.  */
+static const char latin1[] =
+  "Voil\xc3\xa0 l'\xc3\xa9t\xc3\xa9, na\xc3\xafve fa\xc3\xa7" "ade - "
+  "no, just \xc2\xabplain\xc2\xbb ASCII text with a few accents. ";
+static const char cyrillic[] =
+  "\xd0\x9f\xd1\x80\xd0\xb8\xd0\xb2\xd0\xb5\xd1\x82, "
+  "\xd0\xbc\xd0\xb8\xd1\x80! Hello, world! 0123456789 ";
+
+static char text[TEXT_LEN], mid[4 * TEXT_LEN], back[TEXT_LEN];
+
+static double
+seconds (void)
+{
+  return (double) clock () / CLOCKS_PER_SEC;
+}
+
+/* Fills TEXT with copies of S, up to MAX bytes.  */
+static size_t
+fill (const char *s, size_t max)
+{
+  size_t len = strlen (s), n = 0;
+
+  while (n + len <= max)
+    {
+      memcpy (text + n, s, len);
+      n += len;
+    }
+  return n;
+}
+
+static size_t
+convert (iconv_t cd, const char *in, size_t inlen, char *out, size_t outlen)
+{
+  char *ip = (char *) in, *op = out;
+  size_t il = inlen, ol = outlen;
+
+  iconv (cd, NULL, NULL, NULL, NULL);
+  if (iconv (cd, &ip, &il, &op, &ol) == (size_t) -1 || il != 0)
+    return (size_t) -1;
+  return outlen - ol;
+}
+
+/* Converts TEXT from FROM to TO and back N times.  */
+static int
+bench (const char *from, const char *to, size_t len, long n)
+{
+  iconv_t there, home;
+  size_t midlen = 0, backlen = 0;
+  double t0, t1, t2;
+  long i;
+
+  there = iconv_open (to, from);
+  home = iconv_open (from, to);
+  if (there == (iconv_t) -1 || home == (iconv_t) -1)
+    {
+      printf ("%-8s -> %-10s not configured, skipped\n", from, to);
+      if (there != (iconv_t) -1)
+	iconv_close (there);
+      if (home != (iconv_t) -1)
+	iconv_close (home);
+      return 0;
+    }
+
+  t0 = seconds ();
+  for (i = 0; i < n; i++)
+    midlen = convert (there, text, len, mid, sizeof (mid));
+  t1 = seconds ();
+  for (i = 0; i < n; i++)
+    backlen = convert (home, mid, midlen, back, sizeof (back));
+  t2 = seconds ();
+  iconv_close (there);
+  iconv_close (home);
+
+  if (midlen == (size_t) -1 || backlen != len || memcmp (back, text, len))
+    {
+      printf ("FAIL: %s -> %s -> %s does not convert back\n", from, to, from);
+      return 1;
+    }
+  printf ("%-8s -> %-10s %8.1f MB/s   back %8.1f MB/s\n", from, to,
+	  len * (double) n / ((t1 - t0) * 1e6 + 1e-3),
+	  midlen * (double) n / ((t2 - t1) * 1e6 + 1e-3));
+  return 0;
+}
+
+int
+main (int argc, char **argv)
+{
+  long n = argc > 1 ? atol (argv[1]) : 200;
+  iconv_t cd;
+  size_t len;
+  int err;
+
+  if (n <= 0)
+    n = 1;
+
+  len = fill (latin1, TEXT_LEN);
+  err = bench ("UTF-8", "UTF-16LE", len, n);
+  err |= bench ("UTF-8", "ISO-8859-1", len, n);
+
+  len = fill (cyrillic, TEXT_LEN);
+  err |= bench ("UTF-8", "UTF-16BE", len, n);
+  err |= bench ("UTF-8", "CP1251", len, n);
+
+  /* The Cyrillic text in UTF-16, at most twice as long.  */
+  cd = iconv_open ("UTF-16LE", "UTF-8");
+  if (cd != (iconv_t) -1)
+    {
+      len = convert (cd, text, fill (cyrillic, TEXT_LEN / 2), mid,
+		     sizeof (mid));
+      iconv_close (cd);
+      memcpy (text, mid, len);
+      err |= bench ("UTF-16LE", "CP1251", len, n);
+    }
+  return err;
+}
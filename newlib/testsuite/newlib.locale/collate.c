@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2002 by Red Hat, Incorporated. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ *
+ * Collation of a UTF-8 locale: strcoll orders base letters first, then
+ * accents, then case, strxfrm keys compare with strcmp as their strings
+ * do with strcoll, and wcscoll and wcsxfrm agree with both.  The "C"
+ * locale still compares bytes.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <wchar.h>
+#include <locale.h>
+#include "check.h"
+
+/* In collation order. */
+static const char *const sorted[] = {
+  " x",
+  "-x",
+  "1",
+  "\xd9\xa1",			/* ARABIC-INDIC DIGIT ONE */
+  "2",
+  "a",
+  "A",
+  "\xc3\xa1",			/* a WITH ACUTE */
+  "\xc3\x81",			/* A WITH ACUTE */
+  "\xc3\xa4",			/* a WITH DIAERESIS */
+  "ab",
+  "Ab",
+  "abc",
+  "b",
+  "B",
+  "c",
+  "e",
+  "\xc3\xa9",			/* e WITH ACUTE */
+  "ex",
+  "e\xcc\x81x",			/* e, COMBINING ACUTE ACCENT, x */
+  "\xc3\xa9x",			/* e WITH ACUTE, x */
+  "f",
+  "\xef\xac\x81",		/* LATIN SMALL LIGATURE FI */
+  "ss",
+  "\xc3\x9f",			/* SHARP S */
+  "st",
+  "z",
+  "\xce\xb1",			/* GREEK SMALL LETTER ALPHA */
+  "\xce\x91",			/* GREEK CAPITAL LETTER ALPHA */
+};
+
+#define N (sizeof (sorted) / sizeof (sorted[0]))
+
+static int
+sign (int i)
+{
+  return (i > 0) - (i < 0);
+}
+
+int
+main (void)
+{
+  char key[N][128];
+  wchar_t w[N][16], wkey[N][128];
+  size_t i, j, len;
+
+  CHECK (strcoll ("b", "a") > 0);
+  CHECK (strcoll ("B", "a") < 0);
+  if (!setlocale (LC_ALL, "en_US.UTF-8"))
+    {
+      puts ("no UTF-8 locale, skip collation test");
+      exit (0);
+    }
+
+  for (i = 0; i < N; i++)
+    {
+      len = strxfrm (key[i], sorted[i], sizeof (key[i]));
+      CHECK (len < sizeof (key[i]) && strlen (key[i]) == len);
+      CHECK (strxfrm (NULL, sorted[i], 0) == len);
+      CHECK (mbstowcs (w[i], sorted[i], 16) < 16);
+      CHECK (wcsxfrm (wkey[i], w[i], 128) == len);
+    }
+  for (i = 0; i < N; i++)
+    for (j = 0; j < N; j++)
+      {
+	int r = sign (strcoll (sorted[i], sorted[j]));
+
+	CHECK (r == (i > j) - (i < j));
+	CHECK (sign (strcmp (key[i], key[j])) == r);
+	CHECK (sign (wcscoll (w[i], w[j])) == r);
+	CHECK (sign (wcscmp (wkey[i], wkey[j])) == r);
+      }
+
+  /* A key which does not fit is not terminated, and not overrun. */
+  memset (key[0], 'x', sizeof (key[0]));
+  CHECK (strxfrm (key[0], "abc", 4) > 4 && key[0][4] == 'x');
+
+  /* Ignorable characters count only at the last level. */
+  CHECK (strcoll ("a\xc2\xad" "b", "ab") > 0);	/* SOFT HYPHEN */
+  CHECK (strcoll ("a\xc2\xad" "b", "ac") < 0);
+
+  /* A byte which starts no character differs from every character, even
+     from a lone surrogate, which the UTF-8 conversion lets through. */
+  CHECK (strcoll ("\xed\xb2\x80", "\x80") != 0);
+  CHECK (sign (strcoll ("\xed\xb2\x80", "\x80"))
+	 == -sign (strcoll ("\x80", "\xed\xb2\x80")));
+  strxfrm (key[0], "\xed\xb2\x80", sizeof (key[0]));
+  strxfrm (key[1], "\x80", sizeof (key[1]));
+  CHECK (strcmp (key[0], key[1]) != 0);
+
+  setlocale (LC_COLLATE, "C");
+  CHECK (strcoll ("B", "a") < 0);
+  CHECK (strxfrm (key[0], "abc", 4) == 3 && strcmp (key[0], "abc") == 0);
+  exit (0);
+}
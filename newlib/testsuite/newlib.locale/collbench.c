@@ -0,0 +1,148 @@
+/*
+ * Copyright (C) 2002 by Red Hat, Incorporated. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ *
+ * Speed of sorting a large set of strings with strcoll, and with strcmp
+ * on strxfrm keys, in the "C" locale and in a UTF-8 one, for ASCII words
+ * and words of accented Latin letters.
+ *
+ * Usage: collbench [strings]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <locale.h>
+
+#define MAXLEN 12
+
+struct entry
+{
+  char *key;
+  char *str;
+};
+
+static char **text;
+static struct entry *entries;
+static size_t nstr;
+
+static double
+seconds (void)
+{
+  return (double) clock () / CLOCKS_PER_SEC;
+}
+
+static int
+cmp_coll (const void *a, const void *b)
+{
+  return strcoll (*(char *const *) a, *(char *const *) b);
+}
+
+static int
+cmp_key (const void *a, const void *b)
+{
+  return strcmp (((const struct entry *) a)->key,
+		 ((const struct entry *) b)->key);
+}
+
+/* Fills TEXT with random words of letters from ALPHABET, a list of
+   UTF-8 characters separated by spaces. */
+static void
+fill (const char *alphabet)
+{
+  const char *chars[64];
+  char buf[256], *p;
+  size_t nchars = 0, i;
+  int j, len;
+
+  strcpy (buf, alphabet);
+  for (p = strtok (buf, " "); p && nchars < 64; p = strtok (NULL, " "))
+    chars[nchars++] = p;
+  srand (1);
+  for (i = 0; i < nstr; i++)
+    {
+      char word[MAXLEN * 4 + 1];
+
+      word[0] = '\0';
+      len = 1 + rand () % MAXLEN;
+      for (j = 0; j < len; j++)
+	strcat (word, chars[rand () % nchars]);
+      free (text[i]);
+      text[i] = strdup (word);
+    }
+}
+
+static int
+bench (const char *locale, const char *words)
+{
+  char **sorted = malloc (nstr * sizeof (char *));
+  double t0, t1, t2, t3;
+  size_t i, len, total = 0;
+  int ok = 1;
+
+  if (!setlocale (LC_COLLATE, locale))
+    {
+      printf ("%-12s %-8s not available\n", locale, words);
+      free (sorted);
+      return 1;
+    }
+  memcpy (sorted, text, nstr * sizeof (char *));
+  t0 = seconds ();
+  qsort (sorted, nstr, sizeof (char *), cmp_coll);
+  t1 = seconds ();
+  for (i = 0; i < nstr; i++)
+    {
+      len = strxfrm (NULL, text[i], 0);
+      entries[i].key = malloc (len + 1);
+      entries[i].str = text[i];
+      strxfrm (entries[i].key, text[i], len + 1);
+      total += len;
+    }
+  t2 = seconds ();
+  qsort (entries, nstr, sizeof (struct entry), cmp_key);
+  t3 = seconds ();
+
+  /* Only equal strings collate equal, so both sorts give the same
+     order. */
+  for (i = 0; i < nstr; i++)
+    {
+      if (strcmp (sorted[i], entries[i].str) != 0)
+	ok = 0;
+      free (entries[i].key);
+    }
+  printf ("%-12s %-8s %9.1f %9.1f %9.1f %6.1f%s\n", locale, words,
+	  (t1 - t0) * 1e3, (t2 - t1) * 1e3, (t3 - t2) * 1e3,
+	  (double) total / nstr, ok ? "" : "  ORDER DIFFERS");
+  free (sorted);
+  return ok;
+}
+
+int
+main (int argc, char **argv)
+{
+  static const char ascii[] = "a b c d e f g h i j k l m n o p q r s t u v "
+			      "w x y z A B C D E F G H I J K L M N O P Q R S "
+			      "T U V W X Y Z";
+  static const char latin[] = "a \xc3\xa1 \xc3\xa0 \xc3\xa4 e \xc3\xa9 "
+			      "\xc3\xa8 o \xc3\xb6 \xc3\xb8 u \xc3\xbc c "
+			      "\xc3\xa7 n \xc3\xb1 s \xc3\x9f A \xc3\x81 E "
+			      "\xc3\x89 O \xc3\x96 U \xc3\x9c";
+  long n = argc > 1 ? atol (argv[1]) : 100000;
+  int ok = 1;
+
+  nstr = n > 0 ? n : 1;
+  text = calloc (nstr, sizeof (char *));
+  entries = malloc (nstr * sizeof (struct entry));
+
+  printf ("ms                    strcoll   strxfrm    strcmp  key/str\n");
+  fill (ascii);
+  ok &= bench ("C", "ASCII");
+  ok &= bench ("en_US.UTF-8", "ASCII");
+  fill (latin);
+  ok &= bench ("C.UTF-8", "Latin");
+  ok &= bench ("en_US.UTF-8", "Latin");
+  return !ok;
+}
@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 2002 by Red Hat, Incorporated. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ *
+ * Speed of making, using and freeing a locale object per request, as
+ * servers do, while another object of the same locale stays in use.
+ *
+ * Usage: localebench [iters]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <locale.h>
+
+static double
+seconds (void)
+{
+  return (double) clock () / CLOCKS_PER_SEC;
+}
+
+int
+main (int argc, char **argv)
+{
+  long n = argc > 1 ? atol (argv[1]) : 100000;
+  locale_t keep, loc, old;
+  double t0, t1, t2;
+  long i;
+
+  if (n <= 0)
+    n = 1;
+  keep = newlocale (LC_ALL_MASK, "en_US.UTF-8", NULL);
+  if (!keep)
+    {
+      puts ("no UTF-8 locale");
+      return 1;
+    }
+
+  t0 = seconds ();
+  for (i = 0; i < n; i++)
+    {
+      loc = newlocale (LC_ALL_MASK, "en_US.UTF-8", NULL);
+      old = uselocale (loc);
+      uselocale (old);
+      freelocale (loc);
+    }
+  t1 = seconds ();
+  for (i = 0; i < n; i++)
+    {
+      loc = duplocale (keep);
+      loc = newlocale (LC_CTYPE_MASK, "en_US.UTF-8", loc);
+      freelocale (loc);
+    }
+  t2 = seconds ();
+
+  printf ("ns/call   newlocale  duplocale\n");
+  printf ("         %10.1f %10.1f\n", (t1 - t0) * 1e9 / n, (t2 - t1) * 1e9 / n);
+  freelocale (keep);
+  return 0;
+}
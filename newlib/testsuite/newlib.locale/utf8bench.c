@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2002 by Red Hat, Incorporated. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ *
+ * Throughput of mbsnrtowcs and wcsnrtombs in a UTF-8 locale, for ASCII
+ * text and for text of two, three and four byte characters.
+ *
+ * Usage: utf8bench [iters]
+ *
+ * Every string has to convert back to the same bytes, otherwise the
+ * program fails.
+ */
+
+#include <locale.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <wchar.h>
+
+#define SIZE 65536
+
+static char text[SIZE + 1], back[4 * SIZE];
+static wchar_t wide[SIZE];
+
+static double
+seconds (void)
+{
+  return (double) clock () / CLOCKS_PER_SEC;
+}
+
+static int
+bench (const char *name, const char *unit, long n)
+{
+  size_t len = 0, ulen = strlen (unit), nwc = 0, nb = 0;
+  mbstate_t st;
+  const char *src;
+  const wchar_t *wsrc;
+  double t0, t1, t2;
+  long i;
+
+  while (len + ulen <= SIZE)
+    {
+      memcpy (text + len, unit, ulen);
+      len += ulen;
+    }
+  text[len] = '\0';
+
+  memset (&st, 0, sizeof (st));
+  t0 = seconds ();
+  for (i = 0; i < n; i++)
+    {
+      src = text;
+      nwc = mbsnrtowcs (wide, &src, len, SIZE, &st);
+    }
+  t1 = seconds ();
+  for (i = 0; i < n; i++)
+    {
+      wsrc = wide;
+      nb = wcsnrtombs (back, &wsrc, nwc, sizeof (back), &st);
+    }
+  t2 = seconds ();
+  if (nwc == (size_t) -1 || nb != len || memcmp (back, text, len) != 0)
+    {
+      printf ("FAIL: %s does not convert back\n", name);
+      return 1;
+    }
+  printf ("%-8s mbsnrtowcs %8.1f MB/s   wcsnrtombs %8.1f MB/s\n", name,
+	  len * (double) n / 1e6 / (t1 - t0 > 0 ? t1 - t0 : 1e-9),
+	  len * (double) n / 1e6 / (t2 - t1 > 0 ? t2 - t1 : 1e-9));
+  return 0;
+}
+
+int
+main (int argc, char **argv)
+{
+  long n = argc > 1 ? atol (argv[1]) : 1000;
+  int err;
+
+  if (n <= 0)
+    n = 1;
+  if (!setlocale (LC_CTYPE, "C.UTF-8"))
+    {
+      puts ("no UTF-8 locale, skip benchmark");
+      return 0;
+    }
+  err = bench ("ascii", "The quick brown fox jumps over the lazy dog. ", n);
+  err |= bench ("latin", "Gr\303\274\303\237e aus K\303\266ln, \303\247a va? ",
+		n);
+  err |= bench ("cjk", "\346\227\245\346\234\254\350\252\236\343\201\256"
+		"\343\203\206\343\202\255\343\202\271\343\203\210", n);
+  err |= bench ("emoji", "\360\237\230\200\360\237\214\215 ", n);
+  return err;
+}
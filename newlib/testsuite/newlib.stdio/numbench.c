@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2002 by Red Hat, Incorporated. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ *
+ * Speed of formatting and scanning floating-point numbers with
+ * snprintf, swprintf, sscanf and strtod, in the "C" locale.
+ *
+ * Usage: numbench [iters]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <wchar.h>
+
+static volatile double sink;
+
+static double
+seconds (void)
+{
+  return (double) clock () / CLOCKS_PER_SEC;
+}
+
+int
+main (int argc, char **argv)
+{
+  long n = argc > 1 ? atol (argv[1]) : 200000;
+  char buf[64];
+  wchar_t wbuf[64];
+  double d, s = 0.0, t[5];
+  long i;
+
+  if (n <= 0)
+    n = 1;
+  t[0] = seconds ();
+  for (i = 0; i < n; i++)
+    snprintf (buf, sizeof (buf), "%.3f %g", i * 0.125, i * 1e-3);
+  t[1] = seconds ();
+  for (i = 0; i < n; i++)
+    swprintf (wbuf, 64, L"%.3f %g", i * 0.125, i * 1e-3);
+  t[2] = seconds ();
+  for (i = 0; i < n; i++)
+    {
+      snprintf (buf, sizeof (buf), "%ld.%03ld", i, i % 1000);
+      sscanf (buf, "%lf", &d);
+      s += d;
+    }
+  t[3] = seconds ();
+  for (i = 0; i < n; i++)
+    {
+      snprintf (buf, sizeof (buf), "%ld.%03ld", i, i % 1000);
+      s += strtod (buf, NULL);
+    }
+  t[4] = seconds ();
+  sink = s;
+
+  printf ("ns/call   snprintf   swprintf sscanf+fmt strtod+fmt\n");
+  printf ("         %10.1f %10.1f %10.1f %10.1f\n", (t[1] - t[0]) * 1e9 / n,
+	  (t[2] - t[1]) * 1e9 / n, (t[3] - t[2]) * 1e9 / n,
+	  (t[4] - t[3]) * 1e9 / n);
+  return 0;
+}
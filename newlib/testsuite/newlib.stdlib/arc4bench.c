@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2002 by Red Hat, Incorporated. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ *
+ * Throughput of arc4random and of 16-byte arc4random_buf calls from one
+ * thread, and from twice as many up to a given number of threads, which
+ * shows what the per-thread caches of _ARC4RANDOM_THREAD_LOCAL save in
+ * lock traffic.
+ *
+ * Usage: arc4bench [iters [threads]]
+ *
+ * iters is the number of calls per thread, threads defaults to 4.  No two
+ * threads may start with the same words, otherwise the program fails.
+ */
+
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define MAXTHREADS 64
+#define FIRST 8
+
+struct worker
+{
+  pthread_t thread;
+  int buf;
+  long n;
+  uint32_t first[FIRST];
+  uint32_t sum;
+};
+
+static struct worker workers[MAXTHREADS];
+
+static double
+seconds (void)
+{
+  struct timespec ts;
+
+  clock_gettime (CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void *
+run (void *arg)
+{
+  struct worker *w = arg;
+  uint32_t v[4];
+  long i;
+
+  if (w->buf)
+    arc4random_buf (w->first, sizeof (w->first));
+  else
+    for (i = 0; i < FIRST; i++)
+      w->first[i] = arc4random ();
+  w->sum = 0;
+  for (i = 0; i < w->n; i++)
+    if (w->buf)
+      {
+	arc4random_buf (v, sizeof (v));
+	w->sum += v[0] ^ v[3];
+      }
+    else
+      w->sum += arc4random ();
+  return NULL;
+}
+
+static int
+bench (const char *name, int buf, int nthreads, long n)
+{
+  double t0, t1;
+  int i, j;
+
+  for (i = 0; i < nthreads; i++)
+    {
+      workers[i].buf = buf;
+      workers[i].n = n;
+    }
+  t0 = seconds ();
+  for (i = 0; i < nthreads; i++)
+    if (pthread_create (&workers[i].thread, NULL, run, &workers[i]) != 0)
+      {
+	printf ("%s: cannot create thread %d\n", name, i);
+	return 0;
+      }
+  for (i = 0; i < nthreads; i++)
+    pthread_join (workers[i].thread, NULL);
+  t1 = seconds ();
+
+  for (i = 0; i < nthreads; i++)
+    for (j = 0; j < i; j++)
+      if (memcmp (workers[i].first, workers[j].first,
+		  sizeof (workers[i].first)) == 0)
+	{
+	  printf ("%s: threads %d and %d start alike\n", name, j, i);
+	  return 0;
+	}
+  printf ("%-16s %3d threads %10.2f M calls/s\n", name, nthreads,
+	  nthreads * n / (t1 - t0) / 1e6);
+  return 1;
+}
+
+int
+main (int argc, char **argv)
+{
+  long n = argc > 1 ? atol (argv[1]) : 10000000;
+  int maxthreads = argc > 2 ? atoi (argv[2]) : 4;
+  int ok = 1, t;
+
+  if (maxthreads < 1 || maxthreads > MAXTHREADS)
+    {
+      printf ("threads must be from 1 to %d\n", MAXTHREADS);
+      exit (1);
+    }
+  for (t = 1; t <= maxthreads; t *= 2)
+    {
+      ok &= bench ("arc4random", 0, t, n);
+      ok &= bench ("arc4random_buf", 1, t, n);
+    }
+  exit (ok ? 0 : 1);
+}
@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2002 by Red Hat, Incorporated. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ *
+ * strftime_compile and strftime_exec against strftime, for the numeric
+ * fields and their flags, and for results that do not fit.
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "check.h"
+
+static const char *const formats[] = {
+  "%Y-%m-%d %H:%M:%S",
+  "%FT%T%z",
+  "[%a %b %e %k:%M] %D %R %j %y %C",
+  "%I%l%p %U %V %W %u %w %g %G",
+  "%+6Y|%010F|%3d|%05H|%s|%%|%n|%t|%Z",
+  "no conversion",
+  "",
+};
+
+/* Not in CHECK, which prints its argument with printf.  */
+static const char date_time[] = "%F %T";
+static const char unknown[] = "%Y %Q";
+static const char trailing[] = "%Y %";
+
+static void
+compare (const char *format, const struct tm *tm)
+{
+  char expect[128], buf[128];
+  strftime_plan_t *plan;
+  size_t len, n;
+
+  plan = strftime_compile (format);
+  CHECK (plan != NULL);
+  len = strftime (expect, sizeof (expect), format, tm);
+  CHECK (strftime_exec (buf, sizeof (buf), plan, tm) == len);
+  CHECK (strcmp (buf, expect) == 0);
+  /* Too small by one, then exactly large enough.  */
+  if (len > 0)
+    {
+      CHECK (strftime_exec (buf, len, plan, tm) == 0);
+      CHECK (strftime (buf, len, format, tm) == 0);
+    }
+  n = strftime_exec (buf, len + 1, plan, tm);
+  CHECK (n == len && strcmp (buf, expect) == 0);
+  strftime_free (plan);
+}
+
+int
+main (void)
+{
+  struct tm tm;
+  char buf[32];
+  int i, year;
+
+  setenv ("TZ", "EST5EDT", 1);
+  tzset ();
+  memset (&tm, 0, sizeof (tm));
+  tm.tm_sec = 7;
+  tm.tm_min = 5;
+  tm.tm_hour = 9;
+  tm.tm_mday = 3;
+  tm.tm_mon = 0;
+  tm.tm_wday = 5;
+  tm.tm_yday = 2;
+  for (year = -2000; year <= 11000; year += 997)
+    {
+      tm.tm_year = year;
+      tm.tm_isdst = year & 1;
+      for (i = 0; i < sizeof (formats) / sizeof (formats[0]); i++)
+	compare (formats[i], &tm);
+    }
+
+  tm.tm_year = 108;
+  CHECK (strftime (buf, sizeof (buf), date_time, &tm) == 19);
+  CHECK (strcmp (buf, "2008-01-03 09:05:07") == 0);
+
+  errno = 0;
+  CHECK (strftime_compile (unknown) == NULL && errno == EINVAL);
+  CHECK (strftime_compile (trailing) == NULL && errno == EINVAL);
+  exit (0);
+}
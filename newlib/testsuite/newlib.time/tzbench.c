@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2002 by Red Hat, Incorporated. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ *
+ * Throughput of localtime_r and mktime, for a POSIX rule and for a zone
+ * of the tz database when TZif files are supported.
+ *
+ * Usage: tzbench [iters [zone]]
+ *
+ * The zone defaults to Europe/Paris and is looked up like TZ.  The times
+ * are spread over 1900 to 2100, and every result of localtime_r has to
+ * convert back with mktime to a time of the same local time, otherwise
+ * the program fails.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+static double
+seconds (void)
+{
+  return (double) clock () / CLOCKS_PER_SEC;
+}
+
+static time_t
+sample (long i)
+{
+  /* About 200 years around 2000, in steps prime to a day.  */
+  return (time_t) (-2208988800LL + (i * 987654321LL) % 6311390400LL);
+}
+
+static int
+bench (const char *tz, long n)
+{
+  struct tm tm, lt;
+  time_t t;
+  double t0, t1, t2;
+  long i, sum = 0;
+
+  setenv ("TZ", tz, 1);
+  tzset ();
+
+  t0 = seconds ();
+  for (i = 0; i < n; i++)
+    {
+      t = sample (i);
+      localtime_r (&t, &tm);
+      sum += tm.tm_hour;
+    }
+  t1 = seconds ();
+  for (i = 0; i < n; i++)
+    {
+      t = sample (i);
+      localtime_r (&t, &tm);
+      lt = tm;
+      /* Repeated hours of the same tm_isdst may give the other time.  */
+      if (mktime (&tm) != t
+	  && (tm.tm_mday != lt.tm_mday || tm.tm_hour != lt.tm_hour
+	      || tm.tm_min != lt.tm_min || tm.tm_sec != lt.tm_sec))
+	{
+	  printf ("FAIL: %s: %lld does not convert back\n", tz,
+		  (long long) t);
+	  return 1;
+	}
+    }
+  t2 = seconds ();
+  printf ("%-24s localtime_r %8.1f ns   localtime_r + mktime %8.1f ns\n",
+	  tz, (t1 - t0) * 1e9 / n, (t2 - t1) * 1e9 / n);
+  return sum < 0;
+}
+
+int
+main (int argc, char **argv)
+{
+  long n = argc > 1 ? atol (argv[1]) : 100000;
+  int err;
+
+  if (n <= 0)
+    n = 1;
+  err = bench ("CET-1CEST,M3.5.0,M10.5.0/3", n);
+  err |= bench (argc > 2 ? argv[2] : "Europe/Paris", n);
+  return err;
+}
@@ -0,0 +1,182 @@
+/*
+ * Copyright (C) 2002 by Red Hat, Incorporated. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ *
+ * Time zones loaded from TZif files: the test writes a small version 2
+ * file with two transitions and a footer rule, and checks localtime_r,
+ * mktime and the variables of tzset against it.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <newlib.h>
+#include "check.h"
+
+#ifdef _WANT_TZFILE
+
+#define ZONE "tzfile.tz"
+
+static unsigned char buf[256];
+static int len;
+
+static void
+put32 (long v)
+{
+  unsigned long u = v;
+
+  buf[len++] = u >> 24;
+  buf[len++] = u >> 16;
+  buf[len++] = u >> 8;
+  buf[len++] = u;
+}
+
+static void
+put64 (long long v)
+{
+  put32 ((long) (v >> 32));
+  put32 ((long) (v & 0xffffffff));
+}
+
+static void
+header (int timecnt, int typecnt, int charcnt)
+{
+  memcpy (buf + len, "TZif2", 5);
+  memset (buf + len + 5, 0, 15);
+  len += 20;
+  put32 (0);
+  put32 (0);
+  put32 (0);
+  put32 (timecnt);
+  put32 (typecnt);
+  put32 (charcnt);
+}
+
+static void
+type (long utoff, int isdst, int abbr)
+{
+  put32 (utoff);
+  buf[len++] = isdst;
+  buf[len++] = abbr;
+}
+
+/* LMT at UTC+0:30 until 2000, TST at UTC+1 from 1 January 2000, TDT at
+   UTC+2 from 1 July 2000, then the European rule of the footer.  */
+static int
+write_zone (void)
+{
+  static const char rule[] = "\nTST-1TDT,M3.5.0,M10.5.0/3\n";
+  FILE *fp;
+
+  /* Version 1 data, which is skipped.  */
+  header (0, 1, 4);
+  type (1800, 0, 0);
+  memcpy (buf + len, "LMT", 4);
+  len += 4;
+
+  header (2, 3, 12);
+  put64 (946684800);
+  put64 (962409600);
+  buf[len++] = 1;
+  buf[len++] = 2;
+  type (1800, 0, 0);
+  type (3600, 0, 4);
+  type (7200, 1, 8);
+  memcpy (buf + len, "LMT\0TST\0TDT", 12);
+  len += 12;
+  memcpy (buf + len, rule, sizeof (rule) - 1);
+  len += sizeof (rule) - 1;
+
+  if ((fp = fopen (ZONE, "wb")) == NULL)
+    return 0;
+  if (fwrite (buf, 1, len, fp) != len)
+    {
+      fclose (fp);
+      return 0;
+    }
+  return fclose (fp) == 0;
+}
+
+static void
+check (time_t t, int year, int mon, int mday, int hour, int min, int isdst)
+{
+  struct tm tm;
+
+  CHECK (localtime_r (&t, &tm) == &tm);
+  CHECK (tm.tm_year == year - 1900 && tm.tm_mon == mon - 1
+	 && tm.tm_mday == mday && tm.tm_hour == hour && tm.tm_min == min
+	 && tm.tm_isdst == isdst);
+  tm.tm_isdst = -1;
+  CHECK (mktime (&tm) == t);
+  CHECK (tm.tm_isdst == isdst);
+}
+
+int
+main (void)
+{
+  struct tm tm;
+  time_t t;
+
+  if (!write_zone ())
+    {
+      puts ("cannot write " ZONE ", skip TZif test");
+      exit (0);
+    }
+  setenv ("TZDIR", ".", 1);
+  setenv ("TZ", ":" ZONE, 1);
+  tzset ();
+  CHECK (strcmp (tzname[0], "TST") == 0 && strcmp (tzname[1], "TDT") == 0);
+  CHECK (_timezone == -3600 && _daylight);
+
+  check (946684799, 2000, 1, 1, 0, 29, 0);
+  check (946684800, 2000, 1, 1, 1, 0, 0);
+  check (962409600, 2000, 7, 1, 2, 0, 1);
+  /* From the footer rule.  */
+  check (1893499200, 2030, 1, 1, 13, 0, 0);
+  check (1901149199, 2030, 3, 31, 1, 59, 0);
+  check (1901149200, 2030, 3, 31, 3, 0, 1);
+  check (1909094400, 2030, 7, 1, 2, 0, 1);
+
+  /* 02:30 on 31 March 2030 does not exist and is taken as standard
+     time; 02:30 on 27 October 2030 happens twice.  */
+  memset (&tm, 0, sizeof (tm));
+  tm.tm_year = 130;
+  tm.tm_mon = 2;
+  tm.tm_mday = 31;
+  tm.tm_hour = 2;
+  tm.tm_min = 30;
+  tm.tm_isdst = -1;
+  CHECK (mktime (&tm) == 1901151000 && tm.tm_hour == 3);
+  tm.tm_mon = 9;
+  tm.tm_mday = 27;
+  tm.tm_hour = 2;
+  tm.tm_isdst = 1;
+  CHECK ((t = mktime (&tm)) == 1919291400 && tm.tm_isdst == 1);
+  tm.tm_hour = 2;
+  tm.tm_min = 30;
+  tm.tm_isdst = 0;
+  CHECK (mktime (&tm) == t + 3600 && tm.tm_isdst == 0);
+
+  /* A rule in TZ still replaces the zone, and the file comes back.  */
+  setenv ("TZ", "EST5", 1);
+  tzset ();
+  t = 946684800;
+  CHECK (localtime_r (&t, &tm) == &tm && tm.tm_hour == 19);
+  setenv ("TZ", ZONE, 1);
+  tzset ();
+  CHECK (localtime_r (&t, &tm) == &tm && tm.tm_hour == 1);
+
+  remove (ZONE);
+  exit (0);
+}
+#else
+int
+main (void)
+{
+  puts ("TZif support is disabled, skip TZif test");
+  exit (0);
+}
+#endif /* _WANT_TZFILE */
@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2002 by Red Hat, Incorporated. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ *
+ * Speed of iswalpha, iswspace, towupper, towlower and wcwidth, for
+ * ASCII, Latin-1, and characters all over the BMP and the SMP.
+ *
+ * Usage: wctypebench [iters]
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <locale.h>
+#include <wchar.h>
+#include <wctype.h>
+
+#define CHARS 4096
+
+static wint_t text[CHARS];
+static volatile long sink;
+
+static double
+seconds (void)
+{
+  return (double) clock () / CLOCKS_PER_SEC;
+}
+
+/* Fills TEXT with characters from FIRST to LAST, spread evenly.  */
+static void
+fill (wint_t first, wint_t last)
+{
+  int i;
+
+  for (i = 0; i < CHARS; i++)
+    text[i] = first + (wint_t) ((unsigned long) (last - first + 1) * i / CHARS);
+}
+
+static void
+bench (const char *range, long n)
+{
+  double t0, t1, t2, t3, t4;
+  long i, s = 0;
+  int j;
+
+  t0 = seconds ();
+  for (i = 0; i < n; i++)
+    for (j = 0; j < CHARS; j++)
+      s += iswalpha (text[j]) + iswspace (text[j]);
+  t1 = seconds ();
+  for (i = 0; i < n; i++)
+    for (j = 0; j < CHARS; j++)
+      s += towupper (text[j]);
+  t2 = seconds ();
+  for (i = 0; i < n; i++)
+    for (j = 0; j < CHARS; j++)
+      s += towlower (text[j]);
+  t3 = seconds ();
+  for (i = 0; i < n; i++)
+    for (j = 0; j < CHARS; j++)
+      s += wcwidth (text[j]);
+  t4 = seconds ();
+  sink = s;
+
+  printf ("%-8s %8.1f %8.1f %8.1f %8.1f\n", range,
+	  (t1 - t0) * 1e9 / (2.0 * n * CHARS), (t2 - t1) * 1e9 / (n * CHARS),
+	  (t3 - t2) * 1e9 / (n * CHARS), (t4 - t3) * 1e9 / (n * CHARS));
+}
+
+int
+main (int argc, char **argv)
+{
+  long n = argc > 1 ? atol (argv[1]) : 1000;
+
+  if (n <= 0)
+    n = 1;
+  setlocale (LC_CTYPE, "C.UTF-8");
+
+  printf ("ns/call  iswctype towupper towlower  wcwidth\n");
+  fill (0x20, 0x7E);
+  bench ("ASCII", n);
+  fill (0xA0, 0xFF);
+  bench ("Latin-1", n);
+  fill (0x100, 0xFFFD);
+  bench ("BMP", n);
+  fill (0x10000, 0x1FFFF);
+  bench ("SMP", n);
+  return 0;
+}
@@ -0,0 +1,124 @@
+/*
+ * Copyright (C) 2002 by Red Hat, Incorporated. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ *
+ * Encoding and decoding of arrays of int32_t, int64_t, float and double
+ * through a memory stream, one element at a time with xdr_int32_t and
+ * the like, against xdr_int32_vector and the other bulk routines.
+ *
+ * Usage: xdrbench [iters]
+ *
+ * Every array has to decode to the values it was encoded from, and both
+ * ways have to give the same bytes, otherwise the program fails.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <rpc/types.h>
+#include <rpc/xdr.h>
+
+#define N 4096
+
+static char one[8 * N], bulk[8 * N];
+
+static double
+seconds (void)
+{
+  return (double) clock () / CLOCKS_PER_SEC;
+}
+
+static void
+report (const char *name, const char *op, long n, double t0, double t1,
+	double t2)
+{
+  double ns = 1e9 / ((double) n * N);
+
+  printf ("%-8s %s  %7.2f ns/element, bulk %7.2f ns/element\n",
+	  name, op, (t1 - t0) * ns, (t2 - t1) * ns);
+}
+
+/* Runs the benchmark for arrays of TYPE, with PROC for one element and
+   VPROC for the array.  */
+#define BENCH(name, type, proc, vproc, value)				\
+static int								\
+name (long n)								\
+{									\
+  static type src[N], dst[N];						\
+  XDR xdrs;								\
+  double t0, t1, t2;							\
+  long i;								\
+  u_int j;								\
+  int ok = 1;								\
+									\
+  for (j = 0; j < N; j++)						\
+    src[j] = (value);							\
+									\
+  t0 = seconds ();							\
+  for (i = 0; i < n; i++)						\
+    {									\
+      xdrmem_create (&xdrs, one, sizeof (one), XDR_ENCODE);		\
+      for (j = 0; j < N; j++)						\
+	ok &= proc (&xdrs, &src[j]);					\
+    }									\
+  t1 = seconds ();							\
+  for (i = 0; i < n; i++)						\
+    {									\
+      xdrmem_create (&xdrs, bulk, sizeof (bulk), XDR_ENCODE);		\
+      ok &= vproc (&xdrs, src, N);					\
+    }									\
+  t2 = seconds ();							\
+  report (#type, "encode", n, t0, t1, t2);				\
+  if (!ok || memcmp (one, bulk, N * sizeof (type)) != 0)		\
+    {									\
+      printf (#type ": encodings differ\n");				\
+      return 0;								\
+    }									\
+									\
+  t0 = seconds ();							\
+  for (i = 0; i < n; i++)						\
+    {									\
+      xdrmem_create (&xdrs, one, sizeof (one), XDR_DECODE);		\
+      for (j = 0; j < N; j++)						\
+	ok &= proc (&xdrs, &dst[j]);					\
+    }									\
+  t1 = seconds ();							\
+  for (i = 0; i < n; i++)						\
+    {									\
+      xdrmem_create (&xdrs, bulk, sizeof (bulk), XDR_DECODE);		\
+      ok &= vproc (&xdrs, dst, N);					\
+    }									\
+  t2 = seconds ();							\
+  report (#type, "decode", n, t0, t1, t2);				\
+  if (!ok || memcmp (src, dst, sizeof (src)) != 0)			\
+    {									\
+      printf (#type ": decoding differs\n");				\
+      return 0;								\
+    }									\
+  return 1;								\
+}
+
+BENCH (bench_int32, int32_t, xdr_int32_t, xdr_int32_vector,
+       (int32_t) (j * 2654435761u))
+BENCH (bench_int64, int64_t, xdr_int64_t, xdr_int64_vector,
+       (int64_t) (j * 0x9E3779B97F4A7C15ull))
+BENCH (bench_float, float, xdr_float, xdr_float_vector,
+       (float) j / 3 - 1000)
+BENCH (bench_double, double, xdr_double, xdr_double_vector,
+       (double) j / 3 - 1000)
+
+int
+main (int argc, char **argv)
+{
+  long n = argc > 1 ? atol (argv[1]) : 10000;
+  int ok = 1;
+
+  ok &= bench_int32 (n);
+  ok &= bench_int64 (n);
+  ok &= bench_float (n);
+  ok &= bench_double (n);
+  exit (ok ? 0 : 1);
+}